@@ -0,0 +1,34 @@
+#ifndef ADJACENCY_H
+#define ADJACENCY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 그룹 -> 항목 인접 목록 (CSR: 그룹별 시작 위치 + 항목 위치를 이어 붙인 배열)
+// - 선거 -> 후보자, 후보자 -> 공약처럼 "이 그룹에 속한 항목"을 전체 스캔 없이 O(결과 수)로 꺼냄
+// - 데이터를 로드/새로고침할 때 항목마다 그룹 번호(group_of)를 주고 계수 정렬로 한 번에 만듦 (O(항목 수 + 그룹 수))
+// - 그룹 안의 항목은 원래 배열 순서를 유지 (화면/응답 순서가 파일 순서와 같음)
+// 배열은 다시 만들 때 재사용하고, 크기가 모자랄 때만 늘림
+typedef struct {
+    int32_t* offsets;                       // 그룹 g의 항목 = items[offsets[g] .. offsets[g + 1])
+    int32_t* items;                         // 항목 위치
+    int group_count;
+    int item_count;                         // 어떤 그룹에 속한 항목 수 (group_of가 범위 밖인 항목은 빠짐)
+    size_t group_capacity;
+    size_t item_capacity;
+} AdjacencyIndex;
+
+void adjacency_index_init(AdjacencyIndex* index);
+void adjacency_index_free(AdjacencyIndex* index);
+
+// group_of[i]: 항목 i의 그룹 번호 (0..group_count-1, 범위 밖이면 어떤 그룹에도 넣지 않음)
+// 메모리 부족 시 빈 인덱스가 되고 0 반환
+int adjacency_index_build(AdjacencyIndex* index, const int32_t* group_of, int item_count, int group_count);
+
+// 그룹 하나의 항목 위치 배열과 개수 (없는 그룹이면 0)
+int adjacency_index_range(const AdjacencyIndex* index, int group, const int32_t** items);
+
+// 인덱스가 쓰는 메모리 (바이트)
+size_t adjacency_index_memory(const AdjacencyIndex* index);
+
+#endif // ADJACENCY_H
@@ -2,6 +2,8 @@
 #define API_H
 
 #include "structures.h"
+#include "rate_limiter.h"
+#include "xml_stream.h"
 
 #ifdef _WIN32
     #include <windows.h>
@@ -16,6 +18,11 @@
 #define MAX_URL_LEN 1024
 #define MAX_RESPONSE_SIZE 1048576  // 1MB
 
+// 응답 하나에서 파싱될 수 있는 최대 항목 수 (요청 numOfRows=100 기준, 수집 배열을 이만큼씩 늘림)
+#define API_PAGE_ROWS 100
+#define API_MAX_ELECTIONS_PER_RESPONSE (API_PAGE_ROWS * 2)   // 선거 코드는 두 페이지를 합쳐 응답
+#define API_MAX_PLEDGES_PER_CANDIDATE 10                     // prmsTitle1~10
+
 // API 엔드포인트
 #define ELECTION_CODE_API "/CommonCodeService/getCommonSgCodeInfoInqire"
 #define CANDIDATE_API "/PofelcddInfoInqireService/getPoelpcddRegistSttusInfoInqire"  
@@ -27,6 +34,93 @@ typedef struct {
     size_t size;
 } APIResponse;
 
+// 엔드포인트별 호출 속도 제한 (api_get_*와 api_fetch_all이 보내기 전에 엔드포인트의 토큰 버킷에서 토큰을 가져감)
+typedef enum {
+    API_ENDPOINT_ELECTION = 0,
+    API_ENDPOINT_CANDIDATE,
+    API_ENDPOINT_PLEDGE,
+    API_ENDPOINT_COUNT
+} APIEndpoint;
+
+#define API_RATE_DEFAULT 10.0                // 엔드포인트별 초당 요청 수 (서버 --api-rate로 변경, 0이면 제한 없음)
+#define API_RATE_DEFAULT_BURST 4.0           // 쉬고 난 뒤 바로 보낼 수 있는 요청 수 (--api-burst)
+
+// 동시 수집 기본값 (서버 --api-concurrency로 변경)
+#define API_FETCH_DEFAULT_IN_FLIGHT 8        // 동시에 보내 둘 요청 수
+#define API_FETCH_MAX_IN_FLIGHT 32
+
+// 응답을 어디서 가져왔는지 (api_cache.h의 디스크 캐시)
+typedef enum {
+    API_SOURCE_NETWORK = 0,                 // 새로 받음
+    API_SOURCE_CACHE,                       // TTL 안이라 요청하지 않음
+    API_SOURCE_REVALIDATED,                 // 조건부 요청에 304 (본문은 캐시에서)
+    API_SOURCE_STALE                        // 요청이 실패해 TTL이 지난 캐시를 사용
+} APIResponseSource;
+
+// 동시 수집 요청 하나 (호출자가 url/endpoint/user_data를 채우고, 나머지는 api_fetch_all이 채움)
+typedef struct {
+    char url[MAX_URL_LEN * 2];
+    APIEndpoint endpoint;                   // 속도 제한에 쓸 엔드포인트
+    void* user_data;                        // 완료 콜백에서 응답을 어디에 넣을지 (예: 선거/후보자 위치)
+    APIResponse response;                   // 콜백 안에서만 유효 (콜백이 끝나면 해제)
+    int status;                             // 0 성공, -1 실패 (연결 오류, HTTP 200이 아님)
+    APIResponseSource source;
+    double elapsed_ms;                      // 요청 시작부터 완료까지 (캐시에서 바로 넘기면 0)
+} APIFetchRequest;
+
+// 요청 하나가 끝날 때마다 호출 (호출은 한 번에 하나씩이므로 콜백 안에서 잠금 없이 결과 배열에 추가 가능)
+typedef void (*APIFetchCallback)(APIFetchRequest* request, void* context);
+
+typedef struct {
+    int max_in_flight;                      // 동시에 진행할 최대 요청 수
+} APIFetchOptions;
+
+typedef struct {
+    int succeeded;
+    int failed;
+    int peak_in_flight;
+    int cached;                             // 성공 중 요청 없이 캐시에서 넘긴 수
+    int revalidated;                        // 성공 중 304로 캐시 본문을 쓴 수
+    double elapsed_ms;                      // 전체 소요 시간
+} APIFetchStats;
+
+// 응답 XML 스트리밍 파서 (선거/후보자/공약 응답을 한 번 훑으면서 바로 레코드 배열에 채움)
+// - api_parser_feed에 응답 본문을 통째로 넣거나 도착하는 조각마다 넣고, api_parser_finish로 파싱된 개수를 받음
+// - 태그 이름으로 필드를 정하므로 필드마다 응답을 다시 검색하지 않음 (parse_*_json이 이 파서를 사용)
+typedef struct {
+    XmlStream stream;
+    APIEndpoint endpoint;
+    void* records;                          // ElectionInfo / CandidateInfo / PledgeInfo 배열
+    int max_records;
+    int count;                              // 완성된 레코드 수
+    const char* election_id;                // 후보자 레코드에 넣을 선거 ID
+
+    int result_ok;                          // resultCode INFO-00 또는 NORMAL SERVICE
+    char result_message[MAX_STRING_LEN];    // resultMsg
+
+    int field;                              // 지금 텍스트를 받을 필드 (시작 태그 이름으로 정함)
+    int field_number;                       // prmsTitle3 같은 번호 붙은 필드의 번호
+    int in_items;                           // 후보자 응답의 <items> 안
+    int in_item;
+
+    // 항목 하나를 모으는 중인 값
+    int has_id;
+    int typecode;                           // 선거 sgTypecode (없으면 -1)
+    char candidate_id[MAX_STRING_LEN - 16]; // 공약 응답의 cnddtId (공약 ID "<cnddtId>_N"이 MAX_STRING_LEN 안에 들어가도록)
+    char candidate_name[MAX_STRING_LEN];    // 공약 응답의 krName
+    int pledge_total;                       // 공약 응답의 prmsCnt
+    int pledge_slots;                       // 이 응답 공약을 채울 자리 수 (최대 10)
+
+    int skipped_year;                       // 2008년 이전이라 제외한 선거 수
+    int skipped_type;                       // 대통령선거가 아니라 제외한 선거 수
+} APIResponseParser;
+
+// records는 max_records개 자리가 있어야 함 (election_id는 후보자 응답에만 사용)
+void api_parser_init(APIResponseParser* parser, APIEndpoint endpoint, void* records, int max_records,
+                     const char* election_id);
+int api_parser_feed(APIResponseParser* parser, const char* data, size_t length);   // 메모리 부족 시 0
+int api_parser_finish(APIResponseParser* parser);                                  // 파싱된 레코드 수
+
 // API 클라이언트 구조체
 typedef struct {
 #ifdef _WIN32
@@ -44,17 +138,38 @@ int init_api_client(APIClient* client);
 void cleanup_api_client(APIClient* client);
 int load_api_key(const char* filename, char* api_key);
 
-// HTTP 요청 함수
+// HTTP 요청 함수 (API 엔드포인트 URL은 api_cache.h의 디스크 캐시를 먼저 확인하고, 요청을 보낼 때만 엔드포인트 토큰을 받음)
 size_t write_callback(void* contents, size_t size, size_t nmemb, APIResponse* response);
 int make_api_request(APIClient* client, const char* url, APIResponse* response);
 int http_request(const char* url, char* response_buffer, size_t buffer_size);
 
+// 요청 목록을 동시에 보냄 (최대 max_in_flight개를 진행 중으로 유지하고, 요청마다 엔드포인트 토큰을 받은 뒤 시작)
+// 응답은 완료되는 순서대로 on_complete로 넘김, 성공한 요청 수 반환
+// TTL 안에 캐시된 응답은 요청 없이 먼저 넘기고, TTL이 지난 응답은 ETag/Last-Modified로 조건부 요청
+// Linux는 curl multi 한 스레드로, Windows는 WinINet 작업 스레드 max_in_flight개로 처리
+int api_fetch_all(APIClient* client, APIFetchRequest* requests, int count, const APIFetchOptions* options,
+                  APIFetchCallback on_complete, void* context, APIFetchStats* stats);
+
+// 엔드포인트 속도 제한 설정/조회 (모든 스레드가 같은 버킷을 쓰므로 동시에 새로고침해도 합계가 rate를 넘지 않음)
+void api_set_rate_limit(APIEndpoint endpoint, double requests_per_second, double burst);
+void api_get_rate_limit(APIEndpoint endpoint, TokenBucket* stats);
+int api_find_endpoint(const char* name);                // "election" / "candidate" / "pledge" (없으면 -1)
+const char* api_endpoint_name(APIEndpoint endpoint);
+
+// API 서버 주소 (기본 API_BASE_URL, 시험용 모의 서버로 바꿀 때 사용)
+void api_set_base_url(const char* base_url);
+const char* api_get_base_url(void);
+
 // 새로운 API 함수들
 char* url_encode(const char* str);
 int api_get_election_info(APIClient* client, char* response_buffer, size_t buffer_size);
 int api_get_candidate_info(APIClient* client, const char* election_id, char* response_buffer, size_t buffer_size);
 int api_get_pledge_info(APIClient* client, const char* election_id, const char* candidate_id, char* response_buffer, size_t buffer_size);
 
+// 후보자/공약 요청 URL 생성 (api_fetch_all에 넘길 요청을 만들 때 사용, 실패 시 0)
+int api_build_candidate_url(APIClient* client, const char* election_id, char* url, size_t url_size);
+int api_build_pledge_url(APIClient* client, const char* election_id, const char* candidate_id, char* url, size_t url_size);
+
 // URL 생성 함수
 void build_election_code_url(const char* api_key, char* url);
 void build_candidate_url(const char* api_key, const char* sg_id, const char* sg_typecode, char* url);
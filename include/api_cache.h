@@ -0,0 +1,88 @@
+#ifndef API_CACHE_H
+#define API_CACHE_H
+
+#include "api.h"
+#include <stddef.h>
+#include <time.h>
+
+// 공공데이터 API 응답 디스크 캐시 (data/api_cache/)
+// - 키는 serviceKey를 뺀 정규화 URL (스킴/호스트 소문자, 쿼리 매개변수 이름순 정렬)
+//   파일 이름은 키의 64비트 해시, 파일 안에 키를 함께 적어 해시가 겹치면 없는 것으로 봄
+// - 엔드포인트별 TTL 안이면 네트워크 없이 저장된 본문을 사용 (지난 선거 응답은 바뀌지 않음)
+// - TTL이 지났어도 서버가 ETag/Last-Modified를 줬으면 조건부 요청을 보내고, 304면 본문을 다시 받지 않음
+// - 정상 응답(INFO-00, 데이터 없음 INFO-03)만 저장하고, 서비스 키 오류 같은 응답은 저장하지 않음
+// 쓰기마다 이름이 다른 임시 파일(프로세스 ID + 쓰기 번호)에 쓴 뒤 교체하므로 여러 스레드/프로세스가 동시에 써도 깨진 항목을 읽지 않음
+#define API_CACHE_DIR "data/api_cache"
+#define API_CACHE_MAGIC "APICACHE 1"
+
+// 엔드포인트별 기본 TTL (초, 서버 --api-cache-ttl로 변경)
+#define API_CACHE_DEFAULT_TTL_ELECTION (6 * 3600)     // 새 선거 코드가 추가될 수 있음
+#define API_CACHE_DEFAULT_TTL_CANDIDATE (24 * 3600)
+#define API_CACHE_DEFAULT_TTL_PLEDGE (24 * 3600)
+
+#define API_CACHE_MAX_VALIDATOR 128
+
+// 재검증용 응답 헤더 값
+typedef struct {
+    char etag[API_CACHE_MAX_VALIDATOR];
+    char last_modified[API_CACHE_MAX_VALIDATOR];
+} APICacheValidators;
+
+typedef enum {
+    API_CACHE_MISS = 0,                     // 저장된 응답 없음 (또는 캐시 꺼짐)
+    API_CACHE_FRESH,                        // TTL 안 (그대로 사용)
+    API_CACHE_STALE                         // TTL 지남 (검증 값이 있으면 조건부 요청)
+} APICacheState;
+
+// 저장된 항목 하나 (body는 api_cache_entry_free로 해제)
+typedef struct {
+    APICacheState state;
+    time_t fetched_at;                      // 마지막으로 받았거나 304로 확인한 시각
+    APICacheValidators validators;
+    APIResponse body;
+} APICacheEntry;
+
+// 누적 통계 (상태 출력용)
+typedef struct {
+    unsigned long hits;                     // TTL 안이라 요청하지 않음
+    unsigned long revalidated;              // 304 Not Modified
+    unsigned long stored;                   // 새로 받아 저장
+    unsigned long stale_served;             // 요청이 실패해 지난 응답을 사용
+    unsigned long misses;                   // 저장된 응답이 없어 요청
+    unsigned long long bytes_saved;         // 다시 받지 않은 본문 크기 합
+} APICacheStats;
+
+// 설정 (enabled가 0이면 조회/저장 모두 건너뜀)
+void api_cache_set_enabled(int enabled);
+int api_cache_enabled(void);
+void api_cache_set_ttl(APIEndpoint endpoint, long seconds);
+long api_cache_get_ttl(APIEndpoint endpoint);
+
+// URL의 엔드포인트 (API 경로가 아니면 -1, 이런 URL은 캐시하지 않음)
+int api_cache_endpoint_for_url(const char* url);
+
+// serviceKey를 뺀 정규화 키 (size가 모자라면 0)
+int api_cache_normalize_url(const char* url, char* key, size_t size);
+
+// 저장된 응답 조회 (MISS가 아니면 entry->body에 본문이 들어 있음)
+APICacheState api_cache_lookup(const char* url, APICacheEntry* entry);
+void api_cache_entry_free(APICacheEntry* entry);
+
+// 받은 본문 저장 (저장할 응답이 아니거나 쓰기에 실패하면 0)
+int api_cache_store(const char* url, const APICacheValidators* validators, const char* data, size_t size);
+
+// 304를 받았을 때 저장 시각만 갱신 (서버가 새 검증 값을 줬으면 그 값으로 바꿈)
+void api_cache_revalidated(const char* url, APICacheEntry* entry, const APICacheValidators* validators);
+
+// 저장된 응답 삭제 (벤치마크 정리용)
+void api_cache_remove(const char* url);
+
+// 요청이 실패해 지난 응답을 대신 쓸 때 통계 기록
+void api_cache_served_stale(void);
+
+// 응답 헤더 한 줄에서 ETag/Last-Modified를 골라 validators에 기록 (다른 헤더는 무시)
+void api_cache_parse_header(APICacheValidators* validators, const char* line, size_t length);
+
+void api_cache_get_stats(APICacheStats* stats);
+
+#endif // API_CACHE_H
@@ -0,0 +1,25 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stddef.h>
+
+// 벤치마크 공통 유틸리티
+double bench_now_sec(void);                       // 단조 증가 시간 (초)
+unsigned int bench_random(unsigned int* state);   // 재현 가능한 의사 난수 (xorshift)
+void bench_print_row(const char* label, size_t n, double ns_per_op);
+size_t bench_resident_bytes(void);                // 현재 프로세스 상주 메모리 (RSS, 바이트, 알 수 없으면 0)
+
+// 벤치마크 항목 (src/bench/*.c)
+int bench_pledge_index(int argc, char* argv[]);
+int bench_evaluation_store(int argc, char* argv[]);
+int bench_dataset_memory(int argc, char* argv[]);
+int bench_pledge_table(int argc, char* argv[]);
+int bench_vote_kernels(int argc, char* argv[]);
+int bench_leaderboard(int argc, char* argv[]);
+int bench_drilldown(int argc, char* argv[]);
+int bench_vote_contention(int argc, char* argv[]);
+int bench_api_fetch(int argc, char* argv[]);
+int bench_xml_parse(int argc, char* argv[]);
+int bench_delim_scan(int argc, char* argv[]);
+
+#endif // BENCH_H
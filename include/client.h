@@ -108,6 +108,29 @@ typedef struct {
     double approval_rate;
 } PledgeStatistics;
 
+// 일괄 통계 조회 결과 항목
+typedef struct {
+    char pledge_id[MAX_STRING_LEN];
+    char candidate_id[MAX_STRING_LEN];
+    PledgeStatistics stats;
+} PledgeStatisticsEntry;
+
+// 공약 지지율 순위 항목 (서버 순위표 또는 로컬 계산 결과)
+typedef struct {
+    char pledge_id[MAX_STRING_LEN];
+    char candidate_id[MAX_STRING_LEN];
+    char category[MAX_STRING_LEN];
+    char title[MAX_STRING_LEN];
+    PledgeStatistics stats;
+} PledgeRankingEntry;
+
+// 후보자/선거 단위 평가 합계 항목 (서버가 평가마다 갱신)
+typedef struct {
+    char id[MAX_STRING_LEN];                // 후보자 ID 또는 선거 ID
+    PledgeStatistics stats;
+    int pledge_count;
+} VoteStandingEntry;
+
 // 통계 캐시 항목
 typedef struct {
     char pledge_id[MAX_STRING_LEN];
@@ -127,6 +150,9 @@ int send_evaluation_to_server(const char* pledge_id, int evaluation_type);
 int get_user_evaluation_from_server(const char* pledge_id);
 int cancel_evaluation_on_server(const char* pledge_id);
 int get_pledge_statistics_from_server(const char* pledge_id, PledgeStatistics* stats);
+int get_statistics_batch_from_server(const char* scope, const char* value, PledgeStatisticsEntry** entries);
+int get_leaderboard_from_server(const char* scope, const char* value, PledgeRankingEntry entries[], int max_count);
+int get_standings_from_server(const char* scope, const char* value, VoteStandingEntry** entries);
 
 // 입력 처리
 int get_user_input(char* buffer, int max_length);
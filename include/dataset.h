@@ -0,0 +1,132 @@
+#ifndef DATASET_H
+#define DATASET_H
+
+#include "structures.h"
+#include "string_intern.h"
+#include "adjacency.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// 서버 메모리에 올려 두는 선거/후보자/공약
+// - 문자열 필드는 인턴 테이블 핸들(4바이트)로 저장해 같은 문자열(후보자 ID, 정당명, 분야 등)은 한 번만 보관
+// - 고정 길이 문자 배열을 품던 ElectionInfo/CandidateInfo/PledgeInfo(약 1KB/1.3KB/3.3KB)를 공약 기준 40바이트 남짓으로 줄임
+// - ID 비교는 핸들 정수 비교로 처리 (같은 테이블의 핸들끼리만 비교 가능)
+// 파일/네트워크 형식과 클라이언트는 그대로 *Info 구조체를 사용
+
+// 후보자/선거 단위 평가 합계
+// 공약 카운터와 같은 방식으로 평가 샤드 쓰기 잠금 안에서 원자적으로 더하고, 읽기는 잠금 없이 현재 데이터 버전에서 바로 읽음
+typedef struct {
+    int likes;
+    int dislikes;
+    int pledges;                            // 합계에 포함된 (로드된) 공약 수
+} VoteRollup;
+
+typedef struct {
+    StringHandle election_id;
+    StringHandle election_name;
+    StringHandle election_date;
+    StringHandle election_type;
+    int32_t is_active;
+    VoteRollup votes;
+} ElectionRecord;
+
+typedef struct {
+    StringHandle candidate_id;
+    StringHandle candidate_name;
+    StringHandle party_name;
+    StringHandle election_id;
+    int32_t candidate_number;
+    int32_t pledge_count;
+    int32_t election_index;                 // elections 배열 위치 (-1: 선거 정보 없음, 로드 후 서버가 채움)
+    VoteRollup votes;
+} CandidateRecord;
+
+// *Info -> 레코드 (문자열을 strings에 등록, 메모리 부족 시 0)
+int election_record_intern(ElectionRecord* record, const ElectionInfo* info, StringIntern* strings);
+int candidate_record_intern(CandidateRecord* record, const CandidateInfo* info, StringIntern* strings);
+
+// 공약 표: 자주 훑는 필드(hot)와 응답을 만들 때만 읽는 필드(cold)를 분리
+// - hot 필드는 필드별 연속 배열(struct of arrays)이라 카운터/후보자 스캔이 공약당 4~16바이트만 읽고
+//   컴파일러가 벡터화할 수 있음 (공약 10만 개 기준 약 2.1MB)
+// - 제목/내용/생성 시간은 cold 배열에 두고 통계 응답처럼 공약 하나를 다룰 때만 접근
+// - 분야는 표 안의 분야 목록 번호(category_ids)로 저장해 분야별 집계를 작은 정수로 처리
+// 배열은 공약 수에 맞춰 커짐 (파일 줄 수로 pledge_table_reserve를 먼저 하면 한 번에 맞는 크기로 할당)
+typedef struct {
+    StringHandle title;
+    StringHandle content;
+    int64_t created_time;
+} PledgeColdRecord;
+
+typedef struct {
+    // hot
+    StringHandle* ids;                      // pledge_id 핸들
+    StringHandle* candidates;               // candidate_id 핸들
+    int32_t* candidate_indices;             // candidates 배열 위치 (-1: 후보자 정보 없음, 로드 후 서버가 채움)
+    uint16_t* category_ids;                 // categories 배열 위치
+    int* likes;                             // 원자적으로 갱신 (공약이 속한 평가 샤드 잠금 안에서만 쓰기)
+    int* dislikes;
+
+    // cold
+    PledgeColdRecord* cold;
+
+    int count;
+    int capacity;
+
+    StringHandle* categories;               // 분야 번호 -> 분야 문자열 핸들
+    int category_count;
+    int category_capacity;
+} PledgeTable;
+
+#define PLEDGE_TABLE_MAX_CATEGORIES 65535
+
+void pledge_table_init(PledgeTable* table);
+void pledge_table_free(PledgeTable* table);
+void pledge_table_clear(PledgeTable* table);   // 할당한 배열은 다시 쓰기 위해 남겨 둠
+int pledge_table_reserve(PledgeTable* table, int capacity);   // 공약 capacity개 자리 확보 (메모리 부족 시 0)
+size_t pledge_table_memory(const PledgeTable* table);         // 할당한 배열 크기 (바이트)
+
+// 공약 추가 (문자열을 strings에 등록, 메모리 부족 시 0)
+int pledge_table_append(PledgeTable* table, const PledgeInfo* info, StringIntern* strings);
+
+// 공약 index의 분야 문자열 핸들
+StringHandle pledge_table_category(const PledgeTable* table, int index);
+
+// pledge_id 핸들 -> 공약 표 위치 (같은 ID가 여러 번 나오면 마지막 위치)
+typedef struct {
+    int32_t* positions;                     // 핸들로 바로 접근 (-1: 공약 아님)
+    size_t capacity;
+} PledgeLookup;
+
+void pledge_lookup_init(PledgeLookup* lookup);
+void pledge_lookup_free(PledgeLookup* lookup);
+int pledge_lookup_rebuild(PledgeLookup* lookup, const PledgeTable* pledges, const StringIntern* strings);
+int pledge_lookup_find(const PledgeLookup* lookup, StringHandle pledge_id);   // 없으면 -1
+
+// 선거 -> 후보자 -> 공약 연결 (다시 로드할 때마다 dataset_links_rebuild로 다시 만듦)
+// - 선거 ID/후보자 ID 핸들 -> 배열 위치 표로 조회 대상을 바로 찾고
+// - CSR 인접 목록으로 선거의 후보자, 후보자의 공약을 전체 스캔 없이 O(결과 수)로 꺼냄
+typedef struct {
+    AdjacencyIndex election_candidates;     // 선거 위치 -> 후보자 위치 (후보자 파일 순서)
+    AdjacencyIndex candidate_pledges;       // 후보자 위치 -> 공약 위치 (공약 파일 순서)
+    int32_t* election_positions;            // 선거 ID 핸들 -> 선거 위치 (-1: 선거 아님)
+    int32_t* candidate_positions;           // 후보자 ID 핸들 -> 후보자 위치 (-1: 후보자 아님)
+    size_t capacity;                        // 핸들 표 크기
+} DatasetLinks;
+
+void dataset_links_init(DatasetLinks* links);
+void dataset_links_free(DatasetLinks* links);
+
+// 핸들 표와 인접 목록을 다시 만들고 CandidateRecord.election_index, PledgeTable.candidate_indices도 채움
+// (같은 ID가 여러 번 나오면 마지막 위치로 연결, 메모리 부족 시 0)
+int dataset_links_rebuild(DatasetLinks* links, const ElectionRecord* elections, int election_count,
+                          CandidateRecord* candidates, int candidate_count,
+                          PledgeTable* pledges, const StringIntern* strings);
+
+int dataset_links_find_election(const DatasetLinks* links, StringHandle election_id);     // 없으면 -1
+int dataset_links_find_candidate(const DatasetLinks* links, StringHandle candidate_id);   // 없으면 -1
+
+// 선거의 후보자 위치 / 후보자의 공약 위치 (개수 반환)
+int dataset_links_candidates(const DatasetLinks* links, int election, const int32_t** candidates);
+int dataset_links_pledges(const DatasetLinks* links, int candidate, const int32_t** pledges);
+
+#endif // DATASET_H
@@ -0,0 +1,52 @@
+#ifndef DATASET_VERSION_H
+#define DATASET_VERSION_H
+
+#include "dataset.h"
+#include "leaderboard.h"
+
+// 선거/후보자/공약 데이터 한 벌 (RCU 방식으로 교체)
+// - 새로고침은 새 버전을 옆에서 끝까지 만든 뒤(파일 로드, 인덱스, 인접 목록, 카운터, 순위표)
+//   서버의 현재 버전 포인터를 원자적으로 한 번에 바꿔 게시
+// - 읽는 쪽은 에포크 안에서 현재 버전 포인터를 읽어 그대로 사용하므로 잠금을 기다리지 않고 반쯤 로드된 표도 보지 않음
+// - 게시된 뒤에는 카운터(공약/후보자/선거 합계, 순위표)만 바뀜 (평가 샤드 잠금 안에서 원자적으로)
+// - 옛 버전은 epoch_synchronize로 읽던 스레드가 모두 나간 뒤 해제
+typedef struct {
+    StringIntern strings;                   // 이 버전의 문자열 (핸들은 같은 버전 안에서만 유효)
+
+    ElectionRecord* elections;              // 파일 줄 수만큼 할당 (dataset_version_reserve)
+    int election_count;
+    int election_capacity;
+
+    CandidateRecord* candidates;
+    int candidate_count;
+    int candidate_capacity;
+
+    PledgeTable pledges;
+    PledgeLookup pledge_index;              // pledge_id 핸들 -> pledges 위치
+    DatasetLinks links;                     // 선거/후보자 ID 핸들 -> 위치, 선거 -> 후보자 -> 공약 인접 목록
+    Leaderboard leaderboard;                // 전체/선거별/분야별 지지율 순위 힙
+
+    unsigned long number;                   // 게시 순번 (1부터)
+} DatasetVersion;
+
+// 빈 버전 생성 (메모리 부족 시 NULL) / 해제
+DatasetVersion* dataset_version_create(void);
+void dataset_version_destroy(DatasetVersion* version);
+
+// 선거/후보자/공약 자리를 개수만큼 확보 (파일 줄 수로 한 번에 맞춰 두고, 넘치면 두 배씩 늘어남, 메모리 부족 시 0)
+int dataset_version_reserve(DatasetVersion* version, int elections, int candidates, int pledges);
+
+// 선거/후보자 레코드 하나 추가 (자리가 없으면 늘림, 메모리 부족 시 0)
+int dataset_version_add_election(DatasetVersion* version, const ElectionInfo* info);
+int dataset_version_add_candidate(DatasetVersion* version, const CandidateInfo* info);
+
+// 이 버전이 할당한 메모리 (문자열, 레코드 배열, 공약 표, 인덱스, 인접 목록, 순위표, 바이트)
+size_t dataset_version_memory(DatasetVersion* version);
+
+// 공약 ID -> 공약 표 위치 (없으면 -1)
+int dataset_version_find_pledge(const DatasetVersion* version, const char* pledge_id);
+
+// 문자열 핸들 -> 문자열
+const char* dataset_version_string(const DatasetVersion* version, StringHandle handle);
+
+#endif // DATASET_VERSION_H
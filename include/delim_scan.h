@@ -0,0 +1,35 @@
+#ifndef DELIM_SCAN_H
+#define DELIM_SCAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 구분자 위치 스캔 (XML 태그 '<' '>', 데이터 파일 '|' '\n')
+// - 바이트를 하나씩 비교하는 대신 16/32바이트를 한 번에 비교해 나온 비트 마스크에서 위치를 뽑아 한 번에 기록
+// - x86에서는 실행 중인 CPU를 확인해 AVX2 / SSE2 / 스칼라 구현 중 하나를 처음 호출할 때 고름
+//   (x86이 아니거나 GCC 호환 컴파일러가 아니면 스칼라만 사용, 어느 구현이든 결과는 같음)
+// 입력만 읽으므로 여러 스레드에서 동시에 호출 가능
+
+typedef enum {
+    DELIM_SCAN_SCALAR = 0,
+    DELIM_SCAN_SSE2,
+    DELIM_SCAN_AVX2
+} DelimScanLevel;
+
+// data[0..length)에서 a 또는 b인 바이트 위치를 앞에서부터 positions에 기록 (최대 max_positions개), 개수 반환
+// 위치는 32비트이므로 length는 4GB 미만
+// 구분자가 하나면 a와 b에 같은 문자를 넘김
+// max_positions개가 차면 멈추므로 positions[max_positions - 1] + 1부터 다시 호출해 이어 갈 수 있음
+size_t delim_scan(const char* data, size_t length, char a, char b, uint32_t* positions, size_t max_positions);
+
+// 한 줄을 delim으로 나눠 제자리에서 필드마다 '\0'으로 끝냄 (빈 필드도 필드 하나)
+// fields에는 앞에서부터 max_fields개까지만 넣고 마지막 필드에는 나머지 줄이 구분자째 남음
+// 반환값은 실제 필드 수 (구분자 수 + 1)
+int delim_split(char* line, size_t length, char delim, char** fields, int max_fields);
+
+// 구현 선택
+DelimScanLevel delim_scan_detect(void);             // 이 CPU에서 쓸 수 있는 가장 빠른 구현
+int delim_scan_select(DelimScanLevel level);        // 지원하지 않는 구현이면 0 (벤치마크 비교용)
+const char* delim_scan_name(void);                  // 현재 구현 이름
+
+#endif // DELIM_SCAN_H
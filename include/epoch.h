@@ -0,0 +1,26 @@
+#ifndef EPOCH_H
+#define EPOCH_H
+
+// 에포크 기반 회수 (읽는 쪽은 잠금 없이 공유 데이터를 읽고, 쓰는 쪽은 옛 데이터를 아무도 읽지 않을 때 해제)
+// - 읽는 쪽: token = epoch_enter() -> 포인터를 읽어 사용 -> epoch_exit(token)
+//   현재 에포크 짝수/홀수 칸의 읽기 수만 원자적으로 올렸다 내리므로 쓰는 쪽을 기다리지 않음
+// - 쓰는 쪽: 새 포인터를 게시한 뒤 epoch_synchronize()가 돌아오면 옛 포인터를 읽던 스레드가 모두 끝난 것
+//   (에포크를 넘기고, 넘기기 전에 들어온 읽기가 모두 나갈 때까지 기다림)
+// epoch_synchronize는 한 번에 한 스레드만 호출 (호출자가 직렬화)
+typedef struct {
+    unsigned long epoch;
+    long readers[2];                        // 에포크 짝수/홀수별 읽는 중인 스레드 수
+    unsigned long synchronizations;         // 기다린 횟수와 시간 (서버 상태 출력용)
+    double last_wait_ms;
+} EpochDomain;
+
+void epoch_init(EpochDomain* domain);
+
+// 읽기 구간 시작/끝 (중첩 가능, token은 epoch_exit에 그대로 전달)
+int epoch_enter(EpochDomain* domain);
+void epoch_exit(EpochDomain* domain, int token);
+
+// 이 호출 전에 시작한 읽기 구간이 모두 끝날 때까지 대기
+void epoch_synchronize(EpochDomain* domain);
+
+#endif // EPOCH_H
@@ -0,0 +1,51 @@
+#ifndef EVALUATION_SHARDS_H
+#define EVALUATION_SHARDS_H
+
+#include "evaluation_store.h"
+#include "rw_lock.h"
+#include <stddef.h>
+
+// 공약 기준으로 나눈 평가 저장소 (전역 뮤텍스 하나로 모든 평가를 직렬화하던 구조를 대체)
+// - 공약 ID 해시로 샤드를 고르므로 한 공약의 평가와 그 공약의 카운터 쓰기는 항상 같은 샤드 잠금 아래에서 일어남
+// - 샤드마다 읽기/쓰기 잠금, 평가 저장소, ID 인턴 테이블을 따로 두어 다른 샤드의 평가는 동시에 처리
+//   (한 사용자가 여러 샤드의 공약을 평가하면 사용자 ID는 샤드마다 한 번씩 저장됨)
+// - 조회는 샤드 읽기 잠금, 추가/변경/삭제는 샤드 쓰기 잠금
+// - 전체를 일관되게 봐야 하는 작업(다시 로드, 카운터 검증)은 evaluation_shards_lock_all로 모든 샤드의 쓰기를 멈춤
+//   (게시된 버전의 카운터를 바로잡는 작업은 evaluation_shards_write_lock_all로 다시 로드와 조회까지 막음)
+// 잠금 순서: 샤드 잠금(번호 순) -> 순위표 보드 잠금 -> WAL 잠금 (데이터 버전은 잠금 없이 에포크로 읽음)
+#define EVALUATION_SHARD_BITS 4
+#define EVALUATION_SHARD_COUNT (1 << EVALUATION_SHARD_BITS)
+
+typedef struct {
+    RwLock lock;
+    StringIntern strings;                   // 이 샤드 평가의 user_id/pledge_id (추가만 됨)
+    EvaluationStore store;
+} EvaluationShard;
+
+typedef struct {
+    EvaluationShard shards[EVALUATION_SHARD_COUNT];
+} EvaluationShards;
+
+int evaluation_shards_init(EvaluationShards* shards);
+void evaluation_shards_free(EvaluationShards* shards);
+
+// 모든 샤드의 평가를 비움 (다른 스레드가 없을 때만 호출, 인턴된 문자열은 그대로 둠)
+void evaluation_shards_clear(EvaluationShards* shards);
+
+// 공약 ID가 속한 샤드 번호 / 샤드
+int evaluation_shards_index(const char* pledge_id);
+EvaluationShard* evaluation_shards_for(EvaluationShards* shards, const char* pledge_id);
+
+// 모든 샤드 읽기 잠금 (번호 순, 그동안 평가 추가/변경/삭제가 멈춤) / 해제
+void evaluation_shards_lock_all(EvaluationShards* shards);
+void evaluation_shards_unlock_all(EvaluationShards* shards);
+
+// 모든 샤드 쓰기 잠금 (번호 순, 다른 전체 잠금과 샤드 조회도 기다림) / 해제
+void evaluation_shards_write_lock_all(EvaluationShards* shards);
+void evaluation_shards_write_unlock_all(EvaluationShards* shards);
+
+// 전체 평가 수와 메모리 (샤드마다 읽기 잠금을 잠깐씩 잡고 더함)
+int evaluation_shards_count(EvaluationShards* shards);
+size_t evaluation_shards_memory(EvaluationShards* shards);
+
+#endif // EVALUATION_SHARDS_H
@@ -0,0 +1,65 @@
+#ifndef EVALUATION_SNAPSHOT_H
+#define EVALUATION_SNAPSHOT_H
+
+#include "structures.h"
+#include "evaluation_store.h"
+#include <stddef.h>
+#include <time.h>
+
+// 평가 상태 바이너리 스냅샷
+// 파일 헤더 (20바이트): magic "PLGS" (u32) + 버전 (u32) + 생성 시간 (i64) + 레코드 수 (u32)
+// 레코드: 평가 타입 (i8) + 평가 시간 (i64) + user_id 길이 (u8) + pledge_id 길이 (u8) + user_id + pledge_id
+// 마지막 4바이트: 헤더와 레코드 전체의 CRC32
+// 모든 정수는 네트워크 바이트 순서
+#define EVALUATION_SNAPSHOT_FILE "data/evaluations.snap"
+#define EVALUATION_SNAPSHOT_TEMP_FILE "data/evaluations.snap.tmp"
+#define EVALUATION_SNAPSHOT_MAGIC 0x504C4753u   // "PLGS"
+#define EVALUATION_SNAPSHOT_VERSION 1
+#define EVALUATION_SNAPSHOT_HEADER_SIZE 20
+
+// 주기적 스냅샷 기본 간격 (초, 변경이 있을 때만 저장)
+#define DEFAULT_SNAPSHOT_INTERVAL 60
+
+// 저장할 평가 상태 사본 (ID는 핸들로 복사하고, 기록할 때 인턴 테이블에서 문자열을 읽음)
+// 평가 저장소가 여러 개(샤드)면 저장소마다 사본 하나씩을 모아 한 파일로 기록
+#define EVALUATION_SNAPSHOT_MAX_PARTS 64
+
+typedef struct {
+    EvaluationRecord* items;
+    int count;
+    const StringIntern* strings;            // 추가만 되는 테이블이라 잠금 없이 기존 핸들 조회 가능
+} EvaluationSnapshotPart;
+
+typedef struct {
+    EvaluationSnapshotPart parts[EVALUATION_SNAPSHOT_MAX_PARTS];
+    int part_count;
+    int count;                              // 모든 사본의 평가 수
+    time_t created_at;
+    double capture_ms;                      // 사본을 만드는 데 걸린 시간 합 (저장소마다 이 동안만 잠금 필요)
+} EvaluationSnapshotImage;
+
+// 저장/로드 결과
+typedef struct {
+    int records;
+    long bytes;
+    time_t created_at;
+    double elapsed_ms;                      // 저장 시 기록+fsync+교체, 로드 시 읽기+적용 시간
+} EvaluationSnapshotResult;
+
+// 빈 사본 준비 후 저장소마다 사본 추가 (호출자가 그 저장소의 잠금을 잡은 상태에서 호출, 실패 시 0)
+void evaluation_snapshot_begin(EvaluationSnapshotImage* image);
+int evaluation_snapshot_capture(const EvaluationStore* store, EvaluationSnapshotImage* image);
+void evaluation_snapshot_release(EvaluationSnapshotImage* image);
+
+// 사본을 임시 파일에 쓰고 fsync한 뒤 path로 교체 (잠금 없이 호출 가능)
+int evaluation_snapshot_write(const char* path, const char* temp_path, const EvaluationSnapshotImage* image,
+                              EvaluationSnapshotResult* result);
+
+// 스냅샷의 평가를 하나씩 apply로 넘김 (apply가 0을 반환하면 중단, 저장소는 호출자가 미리 비움)
+// 1: 로드함, 0: 파일 없음, -1: 손상된 파일
+typedef int (*EvaluationSnapshotApplyFunc)(void* context, const char* user_id, const char* pledge_id,
+                                           int evaluation_type, time_t evaluation_time);
+int evaluation_snapshot_load(const char* path, EvaluationSnapshotApplyFunc apply, void* context,
+                             EvaluationSnapshotResult* result);
+
+#endif // EVALUATION_SNAPSHOT_H
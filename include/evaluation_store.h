@@ -0,0 +1,68 @@
+#ifndef EVALUATION_STORE_H
+#define EVALUATION_STORE_H
+
+#include "structures.h"
+#include "string_intern.h"
+#include <stdint.h>
+
+// 평가 저장소
+// - user_id/pledge_id는 인턴 테이블 핸들로 저장해 평가 하나가 32바이트 (문자열 두 개를 품던 때는 약 530바이트)
+// - 평가는 페이지(4096개) 단위로 할당하므로 개수 제한 없이 커지고, 커져도 기존 평가는 옮겨지지 않음
+// - (user, pledge) 핸들 쌍 해시 인덱스로 조회/추가/변경/삭제를 O(1)에 처리
+// - 공약별 포스팅 리스트(평가 위치의 이중 연결 리스트)로 공약 하나의 평가만 순회
+// - 삭제 시 마지막 원소를 빈 자리로 옮기므로 위치 순서는 유지되지 않음
+// 스레드 안전하지 않음 (호출자가 저장소가 속한 평가 샤드 잠금을 잡고 사용)
+#define EVALUATION_PAGE_SHIFT 12
+#define EVALUATION_PAGE_SIZE (1 << EVALUATION_PAGE_SHIFT)
+
+typedef struct {
+    StringHandle user;                      // user_id 핸들
+    StringHandle pledge;                    // pledge_id 핸들
+    int32_t next_in_pledge;                 // 같은 공약의 다음 평가 위치 (-1: 끝)
+    int32_t prev_in_pledge;                 // 같은 공약의 이전 평가 위치 (-1: 처음)
+    int64_t evaluation_time;                // 평가 시간
+    int32_t evaluation_type;                // 1: 좋아요, -1: 싫어요
+    int32_t reserved;
+} EvaluationRecord;
+
+typedef struct {
+    EvaluationRecord** pages;
+    int page_count;
+    int page_capacity;
+    int count;
+
+    int32_t* slots;                         // (user, pledge) -> 위치 (비어 있으면 -1)
+    size_t slot_capacity;                   // 2의 거듭제곱
+
+    int32_t* pledge_heads;                  // pledge 핸들 -> 포스팅 리스트 첫 위치 (-1: 없음)
+    size_t pledge_head_capacity;
+
+    StringIntern* strings;                  // ID 문자열 (저장소가 소유하지 않음)
+} EvaluationStore;
+
+int evaluation_store_init(EvaluationStore* store, StringIntern* strings);
+void evaluation_store_free(EvaluationStore* store);
+void evaluation_store_clear(EvaluationStore* store);   // 인턴된 문자열은 그대로 둠
+
+// 위치 -> 평가 (0 <= slot < count)
+EvaluationRecord* evaluation_store_at(const EvaluationStore* store, int slot);
+
+// 조회 (없으면 NULL)
+EvaluationRecord* evaluation_store_get(EvaluationStore* store, const char* user_id, const char* pledge_id);
+
+// 추가 또는 변경 (old_type에 이전 평가 타입, 없었으면 0) - 1: 성공, 0: 메모리 부족
+int evaluation_store_upsert(EvaluationStore* store, const char* user_id, const char* pledge_id,
+                            int evaluation_type, time_t evaluation_time, int* old_type);
+
+// 삭제 (old_type에 삭제된 평가 타입) - 1: 삭제됨, 0: 없음
+int evaluation_store_remove(EvaluationStore* store, const char* user_id, const char* pledge_id, int* old_type);
+
+// 공약별 평가 순회: for (i = first(...); i >= 0; i = next(...))
+int evaluation_store_first_for_pledge(const EvaluationStore* store, const char* pledge_id);
+int evaluation_store_first_for_handle(const EvaluationStore* store, StringHandle pledge);
+int evaluation_store_next_for_pledge(const EvaluationStore* store, int slot);
+
+// 저장소가 사용하는 메모리 (평가 페이지 + 인덱스, 인턴 테이블 제외)
+size_t evaluation_store_memory(const EvaluationStore* store);
+
+#endif // EVALUATION_STORE_H
@@ -0,0 +1,125 @@
+#ifndef EVALUATION_WAL_H
+#define EVALUATION_WAL_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <time.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+// 평가 이벤트 추가 전용 로그 (write-ahead log)
+// 파일 헤더 (8바이트): magic "PLGW" (u32) + 버전 (u32)
+// 레코드: payload 길이 (u32) + CRC32 (u32) + payload
+//   payload: op (u8) + 평가 타입 (i8) + 평가 시간 (i64) + user_id 길이 (u8) + pledge_id 길이 (u8)
+//            + user_id + pledge_id
+// 모든 정수는 네트워크 바이트 순서
+#define EVALUATION_WAL_FILE "data/evaluations.wal"
+#define EVALUATION_WAL_ARCHIVE_FILE "data/evaluations.wal.old"   // 스냅샷 저장 중 교체된 이전 로그
+#define EVALUATION_WAL_MAGIC 0x504C4757u      // "PLGW"
+#define EVALUATION_WAL_VERSION 1
+#define EVALUATION_WAL_HEADER_SIZE 8
+#define EVALUATION_WAL_RECORD_HEADER_SIZE 8
+
+// 그룹 커밋 기본값: 10ms 또는 256개 레코드마다 한 번 fsync
+#define DEFAULT_WAL_WINDOW_MS 10
+#define DEFAULT_WAL_BATCH_RECORDS 256
+
+typedef enum {
+    WAL_OP_UPSERT = 1,                      // 평가 추가/변경
+    WAL_OP_REMOVE = 2                       // 평가 취소
+} EvaluationWalOp;
+
+// 재생 시 레코드마다 호출 (0을 반환하면 재생 중단)
+typedef int (*EvaluationWalApplyFunc)(void* context, int op, const char* user_id, const char* pledge_id,
+                                      int evaluation_type, time_t evaluation_time);
+
+// 재생 결과
+typedef struct {
+    int records;                            // 적용한 레코드 수
+    int torn;                               // 마지막 레코드가 잘려 있었는지 (중간 기록 중 종료)
+    long valid_length;                      // 마지막 정상 레코드까지의 파일 길이
+} EvaluationWalReplay;
+
+typedef struct {
+    FILE* file;
+    char path[256];
+    int window_ms;                          // 그룹 커밋 대기 시간
+    int batch_records;                      // 이만큼 쌓이면 대기 없이 바로 커밋
+    volatile int running;
+
+    // 버퍼 두 개를 번갈아 사용 (추가는 pending에, 기록은 flushing에서)
+    char* pending;
+    size_t pending_length;
+    size_t pending_capacity;
+    int pending_records;
+    char* flushing;
+    size_t flushing_capacity;
+
+    // 로그 교체 요청 (그룹 커밋 스레드가 처리)
+    int rotate_requested;
+    int rotate_result;
+    char archive_path[256];
+
+#ifdef _WIN32
+    CRITICAL_SECTION mutex;
+    CONDITION_VARIABLE wake;
+    CONDITION_VARIABLE rotated;
+    HANDLE thread;
+#else
+    pthread_mutex_t mutex;
+    pthread_cond_t wake;
+    pthread_cond_t rotated;
+    pthread_t thread;
+#endif
+
+    // 통계 (mutex 안에서 갱신)
+    unsigned long long appended;
+    unsigned long long committed;
+    unsigned long long commits;
+    unsigned long long bytes;
+    unsigned long long errors;
+    unsigned long long rotations;
+    double last_commit_ms;
+    double max_commit_ms;
+} EvaluationWal;
+
+// 통계 스냅샷
+typedef struct {
+    int window_ms;
+    int batch_records;
+    int pending_records;
+    unsigned long long appended;
+    unsigned long long committed;
+    unsigned long long commits;
+    unsigned long long bytes;
+    unsigned long long errors;
+    unsigned long long rotations;
+    double average_batch;
+    double last_commit_ms;
+    double max_commit_ms;
+} EvaluationWalStats;
+
+// 로그 재생 (파일이 없으면 records=0으로 성공)
+int evaluation_wal_replay(const char* path, EvaluationWalApplyFunc apply, void* context, EvaluationWalReplay* result);
+
+// 열기 (truncate가 1이면 기존 내용을 비우고 헤더만 남김) 및 그룹 커밋 스레드 시작
+int evaluation_wal_open(EvaluationWal* wal, const char* path, int truncate, int window_ms, int batch_records);
+// 종료 (남은 레코드를 모두 기록한 뒤 닫음)
+void evaluation_wal_close(EvaluationWal* wal);
+
+// 레코드 추가 (버퍼에만 추가하고 바로 반환, 디스크 기록은 그룹 커밋 스레드가 담당)
+int evaluation_wal_append(EvaluationWal* wal, int op, const char* user_id, const char* pledge_id,
+                          int evaluation_type, time_t evaluation_time);
+
+// 로그 교체: 지금까지 추가된 레코드를 기록한 뒤 현재 로그를 archive_path로 옮기고 빈 로그로 다시 시작
+// (교체가 끝날 때까지 대기, 교체 이후 추가된 레코드는 새 로그에만 기록됨)
+int evaluation_wal_rotate(EvaluationWal* wal, const char* archive_path);
+
+void evaluation_wal_get_stats(EvaluationWal* wal, EvaluationWalStats* stats);
+int evaluation_wal_format_stats(const EvaluationWalStats* stats, char* buffer, size_t buffer_size);
+
+#endif // EVALUATION_WAL_H
@@ -0,0 +1,23 @@
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+#include "server.h"
+
+// 이벤트 루프 설정
+#define DEFAULT_REACTOR_COUNT 4
+#define MAX_REACTOR_COUNT 64
+#define EVENT_LOOP_MAX_EVENTS 256
+#define EVENT_LOOP_TIMEOUT_MS 1000       // 종료 플래그 확인 주기
+#define CONNECTION_BUFFER_INIT 4096      // 연결별 버퍼 초기 크기
+#define CONNECTION_BUFFER_MAX (FRAME_MAX_PAYLOAD + 64 * 1024)  // 처리 대기 중인 수신 데이터 한도 (최대 프레임 + 여유분)
+
+// 이벤트 루프 지원 여부 (epoll은 Linux 전용)
+int event_loop_supported(void);
+
+// epoll 기반 이벤트 루프 실행
+// listen_socket: 이미 listen 상태인 서버 소켓
+// reactor_count: 연결을 나눠 맡을 리액터 스레드 수
+// running: 0이 되면 루프 종료
+int run_event_loop(socket_t listen_socket, int reactor_count, volatile int* running);
+
+#endif // EVENT_LOOP_H
@@ -0,0 +1,46 @@
+#ifndef HASH_INDEX_H
+#define HASH_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 문자열 키 -> 배열 위치 해시 인덱스 (오픈 어드레싱, 선형 탐사)
+// 키 문자열은 인덱스가 복사하지 않고 원본 배열(base + slot * stride + key_offset)에서 읽음
+// 두 번째 키(key2_offset)를 지정하면 (key, key2) 복합 키로 동작
+#define HASH_INDEX_MIN_CAPACITY 64
+#define HASH_INDEX_EMPTY (-1)
+#define HASH_INDEX_NO_KEY2 ((size_t)-1)
+
+// 해시 테이블 칸 (8바이트, 캐시 라인 하나에 8칸)
+typedef struct {
+    uint32_t hash;                          // 비교 전에 먼저 확인해서 strcmp 횟수를 줄임
+    int32_t slot;                           // 원본 배열 위치 (비어 있으면 HASH_INDEX_EMPTY)
+} HashIndexEntry;
+
+typedef struct {
+    HashIndexEntry* entries;
+    size_t capacity;                        // 2의 거듭제곱
+    size_t count;
+    const char* base;                       // 원본 배열 시작 주소
+    size_t stride;                          // 원본 배열 원소 크기
+    size_t key_offset;                      // 원소 안에서 키 문자열 위치
+    size_t key2_offset;                     // 복합 키의 두 번째 문자열 위치 (없으면 HASH_INDEX_NO_KEY2)
+} HashIndex;
+
+uint32_t hash_index_hash(const char* key);
+uint32_t hash_index_hash_pair(const char* key, const char* key2);
+
+int hash_index_init(HashIndex* index, const void* base, size_t stride, size_t key_offset, size_t expected);
+int hash_index_init_pair(HashIndex* index, const void* base, size_t stride,
+                         size_t key_offset, size_t key2_offset, size_t expected);
+void hash_index_free(HashIndex* index);
+void hash_index_clear(HashIndex* index);
+void hash_index_rebind(HashIndex* index, const void* base);                // 원본 배열이 이동한 경우
+int hash_index_rebuild(HashIndex* index, int count);                      // 원본 배열 0..count-1 전체 재구성
+int hash_index_insert(HashIndex* index, int slot);                        // 같은 키가 있으면 위치 갱신
+int hash_index_remove(HashIndex* index, int slot);                        // slot을 가리키는 칸 삭제
+int hash_index_move(HashIndex* index, int from_slot, int to_slot);        // 원소를 옮기기 전에 호출
+int hash_index_find(const HashIndex* index, const char* key);             // 없으면 -1
+int hash_index_find_pair(const HashIndex* index, const char* key, const char* key2);
+
+#endif // HASH_INDEX_H
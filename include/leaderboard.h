@@ -0,0 +1,74 @@
+#ifndef LEADERBOARD_H
+#define LEADERBOARD_H
+
+#include "rw_lock.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// 공약 지지율 순위표 (전체 / 선거별 / 분야별)
+// - 보드마다 공약 위치를 담은 이진 최대 힙을 두고, 공약 -> 힙 위치 인덱스로 평가 한 번당 O(log n) 갱신
+// - 상위 K개 조회는 힙의 루트부터 후보를 넓혀 가며 꺼내 O(K log K) (전체 정렬 없음)
+// - 순위 기준: 지지율(좋아요/총 표, 정수 교차 곱으로 비교) -> 총 표 수 -> 공약 위치 (표가 없는 공약은 맨 뒤, 조회 결과에서 제외)
+// 잠금은 보드마다 따로 둠 (선거/분야 보드 하나, 전체 순위는 공약 위치로 나눈 LEADERBOARD_GLOBAL_STRIPES개 보드)
+// - 평가 갱신은 공약이 속한 보드를 하나씩 잠그므로 다른 선거/분야/줄의 공약 평가는 서로 기다리지 않음
+// - 전체 순위 조회는 모든 줄을 읽기 잠금으로 잡고 줄마다의 힙 루트에서 함께 넓혀 감
+// - 종류마다 카운터 사본을 따로 들고 있어 다른 보드의 갱신 중에도 힙 순서가 흐트러지지 않음
+// 서버 잠금 순서: 평가 샤드 잠금 -> 보드 잠금 (보드 잠금은 한 번에 하나, 전체 조회만 줄 번호 순서로 여러 개)
+
+typedef enum {
+    LEADERBOARD_GLOBAL = 0,
+    LEADERBOARD_ELECTION,
+    LEADERBOARD_CATEGORY,
+    LEADERBOARD_KIND_COUNT
+} LeaderboardKind;
+
+#define LEADERBOARD_MAX_LIMIT 100           // 한 번에 조회할 수 있는 최대 순위 수
+#define LEADERBOARD_GLOBAL_STRIPES 16       // 전체 순위를 나눠 담는 보드 수 (공약 위치 % 줄 수)
+
+// 한 종류의 보드 모음: 보드별 힙을 items 한 배열에 이어 붙여 저장
+// (공약이 속한 보드는 다시 만들 때까지 바뀌지 않으므로 보드 크기가 고정됨)
+typedef struct {
+    int32_t* items;                         // 보드 b의 힙 = items[offsets[b] .. offsets[b + 1])
+    int32_t* offsets;                       // board_count + 1개
+    int32_t* board_of;                      // 공약 위치 -> 보드 번호 (-1: 속한 보드 없음)
+    int32_t* positions;                     // 공약 위치 -> items 안의 위치
+    int32_t* likes;                         // 카운터 사본 (공약 위치 기준, 공약이 속한 보드 잠금으로 보호)
+    int32_t* dislikes;
+    RwLock* locks;                          // 보드별 잠금
+    int board_count;
+} LeaderboardIndex;
+
+typedef struct {
+    LeaderboardIndex kinds[LEADERBOARD_KIND_COUNT];
+    int pledge_count;
+} Leaderboard;
+
+typedef struct {
+    int32_t pledge;                         // 공약 표 위치
+    int32_t likes;
+    int32_t dislikes;
+} LeaderboardEntry;
+
+int leaderboard_init(Leaderboard* board);
+void leaderboard_free(Leaderboard* board);
+
+// 공약 표 전체로 다시 만듦 (O(공약 수), 배열과 보드 잠금을 새로 할당하므로 다른 스레드가 쓰지 않는 순위표에만 호출)
+// election_of/category_of: 공약 위치 -> 선거/분야 보드 번호 (-1이면 해당 종류의 보드에 넣지 않음)
+// 메모리 부족 시 빈 순위표가 되고 0 반환
+int leaderboard_rebuild(Leaderboard* board, const int* likes, const int* dislikes, int pledge_count,
+                        const int32_t* election_of, int election_count,
+                        const int32_t* category_of, int category_count);
+
+// 이미 만든 순위표의 카운터를 새 값으로 바꾸고 힙을 다시 정리 (보드 구성은 그대로, 보드 잠금을 하나씩 잡으므로 사용 중에도 호출 가능)
+void leaderboard_resync(Leaderboard* board, const int* likes, const int* dislikes);
+
+// 공약 하나의 카운터가 바뀌었을 때 속한 보드들의 순서만 고침 (O(log n))
+void leaderboard_update(Leaderboard* board, int pledge, int likes, int dislikes);
+
+// 보드 하나의 상위 limit개 (최대 LEADERBOARD_MAX_LIMIT), 찾은 개수 반환
+int leaderboard_top(Leaderboard* board, LeaderboardKind kind, int board_index, int limit, LeaderboardEntry* entries);
+
+// 순위표가 쓰는 메모리 (바이트)
+size_t leaderboard_memory(Leaderboard* board);
+
+#endif // LEADERBOARD_H
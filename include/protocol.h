@@ -0,0 +1,82 @@
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include "structures.h"
+#include <stddef.h>
+
+#ifdef _WIN32
+    #include <winsock2.h>
+    typedef SOCKET protocol_socket_t;
+#else
+    typedef int protocol_socket_t;
+#endif
+
+// 프레임 프로토콜 설정
+// 헤더 (16바이트, 네트워크 바이트 순서)
+//   0: magic (u32)          4: message_type (u16)   6: status_code (u16)
+//   8: flags (u16)         10: user_id 길이 (u8)    11: session_id 길이 (u8)
+//  12: payload 길이 (u32)
+// 이후 user_id, session_id, payload가 순서대로 이어짐 (NUL 문자 없음)
+#define FRAME_MAGIC 0x504C4746u             // "PLGF"
+#define FRAME_HEADER_SIZE 16
+#define FRAME_MAX_PAYLOAD (16 * 1024 * 1024)
+#define FRAME_READ_CHUNK 4096
+
+// 프레임 플래그 (현재 정의된 플래그 없음, 예약)
+#define FRAME_FLAG_NONE 0x0000
+
+// 연결의 인코딩 방식 (첫 4바이트로 판별)
+typedef enum {
+    FRAME_MODE_UNKNOWN = 0,
+    FRAME_MODE_FRAMED,                      // 길이 접두 프레임
+    FRAME_MODE_LEGACY                       // 기존 고정 크기 NetworkMessage 구조체
+} FrameMode;
+
+// 디코딩된 메시지 (payload는 길이 제한 없음, 항상 NUL 종료)
+typedef struct {
+    int message_type;
+    int status_code;
+    int flags;
+    char user_id[MAX_STRING_LEN];
+    char session_id[MAX_STRING_LEN];
+    char* payload;
+    size_t payload_length;
+    size_t payload_capacity;
+} Frame;
+
+// 부분 수신을 모아서 프레임 단위로 잘라내는 수신기
+typedef struct {
+    char* buffer;
+    size_t length;                          // 버퍼에 쌓인 바이트 수
+    size_t offset;                          // 이미 처리한 바이트 수
+    size_t capacity;
+    FrameMode mode;
+} FrameReader;
+
+// 프레임 관리
+void frame_init(Frame* frame);
+void frame_free(Frame* frame);
+int frame_set_payload(Frame* frame, const char* data, size_t length);
+int frame_append_payload(Frame* frame, const char* data, size_t length);
+int frame_appendf(Frame* frame, const char* format, ...);
+
+// 기존 NetworkMessage와 상호 변환 (호환 계층)
+int frame_from_message(const NetworkMessage* msg, Frame* frame);
+void frame_to_message(const Frame* frame, NetworkMessage* msg);   // payload가 길면 잘림
+
+// 인코딩
+size_t frame_encoded_size(const Frame* frame, FrameMode mode);
+size_t frame_encode(const Frame* frame, FrameMode mode, char* out);
+
+// 수신기
+void frame_reader_init(FrameReader* reader);
+void frame_reader_free(FrameReader* reader);
+char* frame_reader_reserve(FrameReader* reader, size_t min_space, size_t* available);
+void frame_reader_commit(FrameReader* reader, size_t length);
+int frame_reader_next(FrameReader* reader, Frame* frame);         // 1: 프레임, 0: 데이터 부족, -1: 프로토콜 오류
+
+// 블로킹 소켓 송수신 (부분 송수신 반복 처리)
+int frame_send(protocol_socket_t sock, const Frame* frame, FrameMode mode);
+int frame_receive(protocol_socket_t sock, FrameReader* reader, Frame* frame);  // 1: 성공, 0: 연결 종료, -1: 오류
+
+#endif // PROTOCOL_H
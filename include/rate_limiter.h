@@ -0,0 +1,35 @@
+#ifndef RATE_LIMITER_H
+#define RATE_LIMITER_H
+
+// 토큰 버킷 속도 제한
+// - 초당 rate개씩 토큰이 차고, 최대 burst개까지 쌓임 (쉬고 난 뒤 burst개는 바로 보낼 수 있음)
+// - token_bucket_reserve는 토큰 하나를 먼저 가져가고 그 토큰을 쓸 수 있을 때까지 남은 시간을 돌려줌
+//   (토큰이 모자라면 음수로 빌려 가므로 여러 스레드가 동시에 예약해도 전체 속도는 rate를 넘지 않음)
+// - 잠금은 토큰 계산 몇 줄만 감싸는 스핀 잠금이라 정적 초기화(TOKEN_BUCKET_INITIALIZER)로 바로 사용 가능
+typedef struct {
+    double rate;                            // 초당 토큰 수 (0 이하면 제한 없음)
+    double burst;                           // 버킷 크기
+    double tokens;                          // 남은 토큰 (예약으로 음수가 될 수 있음)
+    double updated_ms;                      // 마지막으로 토큰을 채운 시각
+    int lock;
+    unsigned long acquired;                 // 가져간 토큰 수 (상태 출력용)
+    double waited_ms;                       // 토큰을 기다린 시간 합계
+} TokenBucket;
+
+#define TOKEN_BUCKET_INITIALIZER(rate, burst) { (rate), (burst), (burst), 0.0, 0, 0, 0.0 }
+
+void token_bucket_init(TokenBucket* bucket, double rate, double burst);
+
+// 속도/버킷 크기 변경 (burst가 0 이하면 1로, 남은 토큰은 새 버킷 크기를 넘지 않게 자름)
+void token_bucket_configure(TokenBucket* bucket, double rate, double burst);
+
+// 토큰 하나 예약 (바로 쓸 수 있으면 0, 아니면 기다려야 할 밀리초)
+double token_bucket_reserve(TokenBucket* bucket);
+
+// 토큰 하나를 쓸 수 있을 때까지 대기
+void token_bucket_acquire(TokenBucket* bucket);
+
+// 설정과 누적 통계 복사 (잠금 안에서)
+void token_bucket_get_stats(TokenBucket* bucket, TokenBucket* stats);
+
+#endif // RATE_LIMITER_H
@@ -0,0 +1,32 @@
+#ifndef RW_LOCK_H
+#define RW_LOCK_H
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+// 읽기/쓰기 잠금 (읽기는 동시에 여러 스레드, 쓰기는 하나만)
+// 쓰기 대기자가 있으면 새 읽기를 막아서 쓰기가 굶지 않게 함
+typedef struct {
+#ifdef _WIN32
+    SRWLOCK lock;
+#else
+    pthread_mutex_t mutex;
+    pthread_cond_t readers_done;
+    pthread_cond_t writer_done;
+    int readers;                            // 잠금을 가진 읽기 스레드 수
+    int writer;                             // 쓰기 잠금 보유 여부
+    int writers_waiting;
+#endif
+} RwLock;
+
+int rw_lock_init(RwLock* lock);
+void rw_lock_destroy(RwLock* lock);
+void rw_lock_read_lock(RwLock* lock);
+void rw_lock_read_unlock(RwLock* lock);
+void rw_lock_write_lock(RwLock* lock);
+void rw_lock_write_unlock(RwLock* lock);
+
+#endif // RW_LOCK_H
@@ -3,6 +3,14 @@
 
 #include "structures.h"
 #include "utils.h"
+#include "protocol.h"
+#include "dataset.h"
+#include "dataset_version.h"
+#include "epoch.h"
+#include "evaluation_shards.h"
+#include "rw_lock.h"
+#include "evaluation_wal.h"
+#include "evaluation_snapshot.h"
 
 #ifdef _WIN32
     #include <winsock2.h>
@@ -33,6 +41,13 @@
 #define MAX_CLIENTS 10
 #define BUFFER_SIZE 4096
 #define SESSION_TIMEOUT 3600  // 1시간
+#define DEFAULT_COUNTER_CHECK_INTERVAL 300  // 평가 카운터 검증 주기 (초, 0이면 끔)
+
+// 서버 동작 모드
+typedef enum {
+    SERVER_MODE_THREAD = 0,  // 연결당 스레드 (기본값)
+    SERVER_MODE_EPOLL        // epoll 엣지 트리거 + 고정 리액터 스레드 (Linux 전용)
+} ServerMode;
 
 // 클라이언트 세션 정보
 typedef struct {
@@ -54,33 +69,47 @@ typedef struct {
     UserInfo users[MAX_USERS];
     int user_count;
     
-    ElectionInfo elections[MAX_ELECTIONS];
-    int election_count;
-    
-    CandidateInfo candidates[MAX_CANDIDATES];
-    int candidate_count;
+    // 선거/후보자/공약 데이터 현재 버전 (새로고침은 새 버전을 만든 뒤 포인터를 원자적으로 교체)
+    // 읽는 쪽은 dataset_epoch 안에서 포인터를 한 번 읽어 그 버전만 사용 (잠금 없음)
+    DatasetVersion* dataset;
+    EpochDomain dataset_epoch;        // 옛 버전을 읽는 요청이 모두 끝난 뒤 해제하기 위한 에포크
     
-    PledgeInfo pledges[MAX_PLEDGES];
-    int pledge_count;
-    
-    EvaluationInfo evaluations[10000];  // 평가 데이터 최대 10,000개로 제한
-    int evaluation_count;
+    EvaluationShards evaluations;     // 공약 해시로 나눈 평가 저장소 (샤드마다 잠금 + 인턴 테이블 + 평가 표)
     
     ClientSession clients[MAX_CLIENTS];
     int client_count;
     
 #ifdef _WIN32
-    CRITICAL_SECTION data_mutex;
     CRITICAL_SECTION client_mutex;
 #else
-    pthread_mutex_t data_mutex;
     pthread_mutex_t client_mutex;
 #endif
 } ServerData;
 
+// 평가 카운터 검증 통계
+typedef struct {
+    long runs;                              // 검증 횟수
+    long mismatches;                        // 발견한 불일치 공약 수 (누적)
+    int last_checked;                       // 마지막 검증에서 확인한 공약 수
+    int last_mismatches;
+    time_t last_run;
+} CounterCheckStats;
+
+// 평가 스냅샷 통계 (시간은 마이크로초 단위로 저장)
+typedef struct {
+    long snapshots;                         // 저장 횟수
+    long failures;
+    int last_records;
+    long last_bytes;
+    long last_capture_us;                   // 잠금 안에서 사본을 만든 시간 (평가 요청이 기다린 시간)
+    long last_write_us;                     // 잠금 밖에서 기록+fsync+교체에 걸린 시간
+    time_t last_time;                       // 마지막 스냅샷 생성 시각
+} SnapshotStats;
+
 // 서버 초기화 및 종료
 int init_server(void);
 int start_server(int port);
+void set_server_mode(ServerMode mode, int reactor_count);
 void shutdown_server(void);
 void cleanup_server(void);
 
@@ -107,10 +136,28 @@ void* client_handler_thread(void* arg);
 void* session_cleanup_thread(void* arg);
 #endif
 
+// 워커 풀 작업 (I/O 스레드는 송수신만 하고 처리는 워커가 담당)
+typedef struct ClientJob {
+    Frame request;
+    Frame response;
+    void (*on_complete)(struct ClientJob* job);  // 워커 스레드에서 호출됨
+    void* context;
+    struct ClientJob* next;                      // 완료 큐 연결용
+} ClientJob;
+
+int init_worker_pools(int worker_threads, int refresh_threads);
+void shutdown_worker_pools(void);
+int is_refresh_request(const Frame* request);
+int submit_client_job(ClientJob* job);
+void execute_client_request(Frame* request, Frame* response);
+void fill_server_busy_response(Frame* response);
+void handle_get_server_status_request(NetworkMessage* response);
+
 // 메시지 처리
 int receive_message(socket_t client_socket, NetworkMessage* msg);
 int send_message(socket_t client_socket, NetworkMessage* msg);
 void process_client_message(ClientSession* session, NetworkMessage* request, NetworkMessage* response);
+void process_frame_request(Frame* request, Frame* response);
 
 // 인증 처리
 void handle_login_request(NetworkMessage* request, NetworkMessage* response);
@@ -125,6 +172,7 @@ int verify_session(const char* session_id, const char* user_id);
 
 // API 연동
 int collect_api_data(void);
+int collect_api_data_incremental(char* summary, size_t summary_size);  // 새로 나왔거나 바뀐 후보자만 공약을 다시 받음
 int collect_elections_only(void);
 int collect_candidates_only(void);
 int collect_pledges_only(void);
@@ -134,11 +182,14 @@ int fetch_pledge_data(const char* candidate_id);
 int call_public_api(const char* url, char* response_buffer, int buffer_size);
 
 // 데이터 처리
-void handle_get_elections_request(NetworkMessage* response);
-void handle_get_candidates_request(const char* election_id, NetworkMessage* response);
-void handle_get_pledges_request(const char* candidate_id, NetworkMessage* response);
+void handle_get_elections_request(const Frame* request, Frame* response);
+void handle_get_candidates_request(const Frame* request, Frame* response);   // payload: 선거 ID (비면 전체)
+void handle_get_pledges_request(const Frame* request, Frame* response);      // payload: 후보자 ID (비면 전체)
 void handle_evaluate_pledge_request(const char* user_id, const char* pledge_id, int evaluation_type, NetworkMessage* response);
 void handle_get_statistics_request(const char* pledge_id, NetworkMessage* response);
+void handle_get_statistics_batch_request(const Frame* request, Frame* response);
+void handle_get_leaderboard_request(const Frame* request, Frame* response);
+void handle_get_standings_request(const Frame* request, Frame* response);
 
 // 평가 시스템
 int add_evaluation(const char* user_id, const char* pledge_id, int evaluation_type);
@@ -146,19 +197,31 @@ int update_evaluation(const char* user_id, const char* pledge_id, int evaluation
 int cancel_evaluation(const char* user_id, const char* pledge_id);
 int get_user_evaluation(const char* user_id, const char* pledge_id);
 int check_duplicate_evaluation(const char* user_id, const char* pledge_id);
-void update_pledge_statistics(const char* pledge_id);
+void recount_pledge_statistics_locked(DatasetVersion* dataset);  // 모든 평가 샤드 잠금을 잡은 상태에서 호출
+int verify_pledge_counters(int repair);       // 불일치 공약 수 반환 (-1: 실패)
+int start_counter_checker(int interval_seconds);
+void stop_counter_checker(void);
 void handle_cancel_evaluation_request(const char* user_id, const char* pledge_id, NetworkMessage* response);
 void handle_get_user_evaluation_request(const char* user_id, const char* pledge_id, NetworkMessage* response);
-int save_evaluations_to_file(void);
+int save_evaluations_to_file(void);           // 스냅샷 저장 (시작/종료 시처럼 다른 스레드가 없을 때만 호출)
+int take_evaluation_snapshot(void);           // 실행 중 스냅샷 저장 (샤드마다 사본을 만드는 동안만 그 샤드 잠금 사용)
+int start_snapshotter(int interval_seconds);
+void stop_snapshotter(void);
 
 // 데이터 파일 관리
+DatasetVersion* load_dataset_version(void);  // 파일로 새 버전 생성 (게시 전이므로 잠금 없음)
+int refresh_dataset(void);                   // 새 버전을 만들어 게시하고 옛 버전 회수 (새로고침 스레드 하나만 호출)
+void recount_rollups_locked(DatasetVersion* dataset);     // 모든 평가 샤드 잠금을 잡은 상태 또는 게시 전 버전에 호출
+int rebuild_leaderboard_locked(DatasetVersion* dataset);  // 모든 평가 샤드 잠금을 잡은 상태 또는 게시 전 버전에 호출
 int load_server_data(void);
 int save_server_data(void);
 int backup_data_files(void);
 int load_elections_from_file(ElectionInfo elections[], int max_count);
 int load_candidates_from_file(CandidateInfo candidates[], int max_count);
-int load_pledges_from_file(PledgeInfo pledges[], int max_count);
-int load_evaluations_from_file(void);
+int load_election_records(DatasetVersion* version);
+int load_candidate_records(DatasetVersion* version);
+int load_pledge_table(PledgeTable* pledges, StringIntern* strings);
+int load_evaluations_from_file(int* needs_snapshot);  // 실패 시 -1, needs_snapshot: 스냅샷 이후 변경이 있었는지
 
 // 서버 상태 모니터링
 void print_server_status(void);
@@ -0,0 +1,53 @@
+#ifndef STRING_INTERN_H
+#define STRING_INTERN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 문자열 인턴 테이블: 같은 문자열은 한 번만 저장하고 32비트 핸들로 가리킴
+// - 문자열은 청크 단위 아레나에 추가만 하므로 한 번 받은 포인터는 테이블을 해제할 때까지 유효
+// - 핸들 -> 문자열 표는 고정 크기 디렉터리 + 페이지로 나눠 커져도 옮겨지지 않음
+//   (이미 받은 핸들의 조회는 잠금 없이 가능, 추가/검색은 호출자가 직렬화)
+typedef uint32_t StringHandle;
+#define STRING_HANDLE_NONE 0u
+
+#define STRING_INTERN_PAGE_SHIFT 12
+#define STRING_INTERN_PAGE_SIZE (1u << STRING_INTERN_PAGE_SHIFT)   // 페이지당 핸들 4096개
+#define STRING_INTERN_MAX_PAGES 16384                               // 최대 약 6700만 개
+#define STRING_INTERN_CHUNK_SIZE (64 * 1024)
+
+// 해시 테이블 칸
+typedef struct {
+    uint32_t hash;
+    StringHandle handle;                    // 비어 있으면 STRING_HANDLE_NONE
+} StringInternEntry;
+
+typedef struct {
+    char** chunks;                          // 문자열 아레나
+    size_t chunk_count;
+    size_t chunk_capacity;
+    size_t chunk_used;                      // 마지막 청크에서 사용한 바이트
+
+    const char*** pages;                    // 핸들 -> 문자열 (디렉터리는 처음에 한 번만 할당)
+    uint32_t count;                         // 발급한 핸들 수 (0번은 비워 둠)
+
+    StringInternEntry* entries;             // 문자열 -> 핸들 (오픈 어드레싱, 선형 탐사)
+    size_t capacity;                        // 2의 거듭제곱
+
+    size_t bytes;                           // 저장한 문자열 바이트 합 ('\0' 포함)
+} StringIntern;
+
+int string_intern_init(StringIntern* table);
+void string_intern_free(StringIntern* table);
+
+// 문자열 등록 (이미 있으면 기존 핸들, 실패 시 STRING_HANDLE_NONE)
+StringHandle string_intern_add(StringIntern* table, const char* str);
+// 등록된 문자열 검색 (없으면 STRING_HANDLE_NONE)
+StringHandle string_intern_find(const StringIntern* table, const char* str);
+// 핸들 -> 문자열 (STRING_HANDLE_NONE이면 빈 문자열)
+const char* string_intern_get(const StringIntern* table, StringHandle handle);
+
+// 테이블이 사용하는 메모리 (아레나 + 페이지 + 해시 테이블)
+size_t string_intern_memory(const StringIntern* table);
+
+#endif // STRING_INTERN_H
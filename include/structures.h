@@ -7,9 +7,7 @@
 #define MAX_STRING_LEN 256
 #define MAX_CONTENT_LEN 2048
 #define MAX_USERS 100
-#define MAX_ELECTIONS 200  // 50 → 200으로 증가 (181개 + 여유분)
-#define MAX_CANDIDATES 10000
-#define MAX_PLEDGES 100000
+// 선거/후보자/공약 개수는 상한 없음 (데이터 파일 줄 수로 할당하고 모자라면 늘림)
 
 // 선거 정보 구조체
 typedef struct {
@@ -88,7 +86,12 @@ typedef enum {
     MSG_REFRESH_PLEDGES,        // 공약 정보 새로고침
     MSG_REFRESH_ALL,            // 전체 데이터 새로고침
     MSG_ERROR,
-    MSG_SUCCESS
+    MSG_SUCCESS,
+    MSG_GET_SERVER_STATUS,      // 서버 상태 조회 (워커 풀 큐 깊이/가동률)
+    MSG_GET_STATISTICS_BATCH,   // 여러 공약 통계 일괄 조회 (공약 ID 목록/후보자/선거 단위)
+    MSG_GET_LEADERBOARD,        // 공약 지지율 상위 K개 조회 (전체/선거별/분야별)
+    MSG_GET_STANDINGS,          // 후보자별/선거별 평가 합계 순위 조회
+    MSG_REFRESH_INCREMENTAL     // 증분 새로고침 (새로 나왔거나 바뀐 후보자만 공약을 다시 받음)
 } MessageType;
 
 // 응답 상태 코드 정의
@@ -97,7 +100,8 @@ typedef enum {
     STATUS_BAD_REQUEST = 400,
     STATUS_UNAUTHORIZED = 401,
     STATUS_NOT_FOUND = 404,
-    STATUS_INTERNAL_ERROR = 500
+    STATUS_INTERNAL_ERROR = 500,
+    STATUS_SERVICE_UNAVAILABLE = 503       // 작업 큐가 가득 참
 } StatusCode;
 
 #endif // STRUCTURES_H 
\ No newline at end of file
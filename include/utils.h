@@ -10,6 +10,7 @@
 // 파일 입출력 함수
 int load_user_data(const char* filename, UserInfo users[], int max_users);
 int save_user_data(const char* filename, UserInfo users[], int user_count);
+int count_file_lines(const char* filename);   // 줄 수 (표 크기를 파일에 맞춰 정할 때 사용, 파일이 없으면 0)
 
 // 문자열 처리 함수
 void trim_whitespace(char* str);
@@ -22,6 +23,10 @@ void hash_password(const char* password, char* hash_output);
 int verify_password(const char* password, const char* hash);
 void generate_session_id(char* session_id);
 
+// 체크섬 함수 (CRC32, IEEE 802.3)
+// 처음 호출할 때 테이블을 만들므로 여러 스레드에서 쓰기 전에 한 번 호출해 둘 것
+unsigned long crc32_update(unsigned long crc, const void* data, size_t length);  // crc 시작값은 0
+
 // 로그 관리 함수
 void write_log(const char* level, const char* message);
 void write_error_log(const char* function, const char* error_message);
@@ -37,6 +42,10 @@ void* safe_malloc(size_t size);
 void* safe_realloc(void* ptr, size_t size);
 void safe_free(void** ptr);
 
+// 늘어나는 배열: needed개가 들어가도록 두 배씩 늘린 배열을 반환 (새 칸은 0으로 채움)
+// 이미 충분하면 items 그대로, 메모리 부족 시 NULL을 반환하고 items와 *capacity는 그대로 둠
+void* grow_array(void* items, int* capacity, int needed, size_t item_size);
+
 // 화면 관리 함수 (클라이언트용)
 void init_korean_console(void);
 void clear_screen(void);
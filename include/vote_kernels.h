@@ -0,0 +1,39 @@
+#ifndef VOTE_KERNELS_H
+#define VOTE_KERNELS_H
+
+#include <stdint.h>
+
+// 평가 카운터 집계 커널
+// - 좋아요/싫어요 수를 공약 순서대로 뽑아 둔 int 배열 두 개(likes, dislikes)를 입력으로 받음
+// - x86에서는 실행 중인 CPU를 확인해 AVX2 / SSE4.1 / 스칼라 구현 중 하나를 처음 호출할 때 고름
+//   (x86이 아니거나 GCC 호환 컴파일러가 아니면 스칼라만 사용)
+// - 어느 구현이든 결과는 같음 (지지율은 likes * 100 / (likes + dislikes)를 float로 같은 순서로 계산)
+// 입력 배열만 읽으므로 여러 스레드에서 동시에 호출 가능
+
+typedef enum {
+    VOTE_KERNEL_SCALAR = 0,
+    VOTE_KERNEL_SSE41,
+    VOTE_KERNEL_AVX2
+} VoteKernelLevel;
+
+typedef struct {
+    long long likes;
+    long long dislikes;
+} VoteTotals;
+
+// 합계 (totals를 덮어씀)
+void vote_sum(const int* likes, const int* dislikes, int count, VoteTotals* totals);
+// keys[i] == key인 항목만 합계 (후보자/선거 번호별 집계)
+void vote_sum_matching(const int32_t* keys, int32_t key, const int* likes, const int* dislikes, int count,
+                       VoteTotals* totals);
+// 지지율(%) 계산 (표가 없으면 0)
+void vote_approval_rates(const int* likes, const int* dislikes, int count, float* rates);
+// 총 표가 min_votes 이상(최소 1)이고 지지율이 min_rate 이상인 항목 위치를 indices에 기록, 개수 반환
+int vote_filter(const int* likes, const int* dislikes, int count, float min_rate, int min_votes, int32_t* indices);
+
+// 구현 선택
+VoteKernelLevel vote_kernels_detect(void);          // 이 CPU에서 쓸 수 있는 가장 빠른 구현
+int vote_kernels_select(VoteKernelLevel level);     // 지원하지 않는 구현이면 0 (벤치마크 비교용)
+const char* vote_kernels_name(void);                // 현재 구현 이름
+
+#endif // VOTE_KERNELS_H
@@ -0,0 +1,101 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <stddef.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <semaphore.h>
+#endif
+
+// 워커 풀 설정
+#define DEFAULT_WORKER_THREADS 4
+#define DEFAULT_REFRESH_WORKER_THREADS 1
+#define DEFAULT_WORKER_QUEUE_SIZE 1024     // 2의 거듭제곱이어야 함
+#define DEFAULT_REFRESH_QUEUE_SIZE 16
+#define MAX_WORKER_THREADS 64
+#define WORKER_POOL_NAME_LEN 32
+
+// 워커가 실행할 작업 함수
+typedef void (*WorkerJobFunc)(void* arg);
+
+// 플랫폼 독립 세마포어 (워커 대기 및 작업 완료 통지용)
+typedef struct {
+#ifdef _WIN32
+    HANDLE handle;
+#else
+    sem_t sem;
+#endif
+} WorkerSemaphore;
+
+// 작업 큐 슬롯 (sequence 번호로 소유권을 판별)
+typedef struct {
+    size_t sequence;
+    WorkerJobFunc func;
+    void* arg;
+} WorkerQueueCell;
+
+// 고정 크기 lock-free MPMC 큐 (Vyukov 방식)
+typedef struct {
+    WorkerQueueCell* cells;
+    size_t mask;
+    char pad0[64];
+    size_t enqueue_pos;                    // 생산자끼리 경쟁하는 위치
+    char pad1[64];
+    size_t dequeue_pos;                    // 소비자끼리 경쟁하는 위치
+    char pad2[64];
+} WorkerQueue;
+
+// 워커 풀
+typedef struct {
+    char name[WORKER_POOL_NAME_LEN];
+    int thread_count;
+    WorkerQueue queue;
+    WorkerSemaphore available;             // 큐에 들어온 작업 수
+    volatile int running;
+#ifdef _WIN32
+    HANDLE* threads;
+#else
+    pthread_t* threads;
+#endif
+    // 통계 (원자적 연산으로 갱신)
+    long queue_depth;
+    long max_queue_depth;
+    long busy_workers;
+    unsigned long long submitted;
+    unsigned long long completed;
+    unsigned long long rejected;
+    unsigned long long busy_time_ms;
+    unsigned long long started_at_ms;
+} WorkerPool;
+
+// 워커 풀 상태 스냅샷
+typedef struct {
+    char name[WORKER_POOL_NAME_LEN];
+    int thread_count;
+    size_t queue_capacity;
+    long queue_depth;
+    long max_queue_depth;
+    long busy_workers;
+    unsigned long long submitted;
+    unsigned long long completed;
+    unsigned long long rejected;
+    double utilization;                    // 시작 이후 평균 가동률 (0.0 ~ 1.0)
+} WorkerPoolStats;
+
+// 세마포어
+int worker_semaphore_init(WorkerSemaphore* sem, unsigned int initial);
+void worker_semaphore_post(WorkerSemaphore* sem);
+void worker_semaphore_wait(WorkerSemaphore* sem);
+void worker_semaphore_destroy(WorkerSemaphore* sem);
+
+// 워커 풀 관리
+int worker_pool_init(WorkerPool* pool, const char* name, int thread_count, size_t queue_capacity);
+int worker_pool_submit(WorkerPool* pool, WorkerJobFunc func, void* arg);  // 큐가 가득 차면 0 반환
+void worker_pool_shutdown(WorkerPool* pool);
+void worker_pool_get_stats(WorkerPool* pool, WorkerPoolStats* stats);
+int worker_pool_format_stats(const WorkerPoolStats* stats, char* buffer, size_t buffer_size);
+
+#endif // WORKER_POOL_H
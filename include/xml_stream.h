@@ -0,0 +1,56 @@
+#ifndef XML_STREAM_H
+#define XML_STREAM_H
+
+#include <stddef.h>
+#include <string.h>
+
+// 스트리밍 XML 토크나이저 (SAX 방식)
+// - 본문을 한 번만 훑으면서 시작 태그/텍스트/끝 태그마다 콜백을 부름
+// - 이름과 텍스트는 복사하지 않고 입력 버퍼를 가리키는 조각(XmlSlice)으로 넘김 (콜백 안에서만 유효)
+// - xml_stream_feed로 HTTP 본문이 도착하는 대로 조각씩 넣을 수 있음
+//   (조각 경계에 걸친 태그/텍스트 하나만 내부 버퍼에 모았다가 완성되면 넘김)
+// - 공공데이터 응답 파싱용이라 속성, 엔티티(&amp; 등), 네임스페이스는 해석하지 않음
+//   (<?xml ...?>, <!DOCTYPE>, 주석은 건너뛰고 CDATA는 텍스트로 넘김)
+typedef struct {
+    const char* data;
+    size_t length;
+} XmlSlice;
+
+typedef struct XmlStream XmlStream;
+
+typedef struct {
+    void (*start_element)(XmlStream* stream, XmlSlice name);
+    void (*end_element)(XmlStream* stream, XmlSlice name);     // <a/>는 start 다음 바로 end
+    void (*text)(XmlStream* stream, XmlSlice text);            // 태그 사이 텍스트 한 덩어리 (공백만 있어도 호출)
+} XmlHandlers;
+
+struct XmlStream {
+    XmlHandlers handlers;
+    void* context;                          // 콜백에서 stream->context로 사용
+
+    char* carry;                            // 조각 경계에 걸친 토큰 (완성될 때까지 모음)
+    size_t carry_length;
+    size_t carry_capacity;
+
+    int stopped;                            // xml_stream_stop 이후 입력 무시
+    int failed;                             // 메모리 부족
+    size_t bytes;                           // 지금까지 넣은 바이트 수
+};
+
+void xml_stream_init(XmlStream* stream, const XmlHandlers* handlers, void* context);
+void xml_stream_free(XmlStream* stream);
+
+// 본문 일부 처리 (메모리 부족이면 0)
+int xml_stream_feed(XmlStream* stream, const char* data, size_t length);
+
+// 본문 끝 (마지막 태그 뒤 텍스트를 넘김, 닫히지 않은 태그는 버림)
+int xml_stream_finish(XmlStream* stream);
+
+// 콜백 안에서 호출하면 나머지 입력을 읽지 않음 (필요한 항목을 다 찾았을 때)
+void xml_stream_stop(XmlStream* stream);
+
+// 조각이 문자열 상수와 같은지 (길이를 컴파일 때 알아서 태그마다 strlen을 하지 않음)
+#define XML_SLICE_IS(slice, literal) \
+    ((slice).length == sizeof(literal) - 1 && memcmp((slice).data, (literal), sizeof(literal) - 1) == 0)
+
+#endif // XML_STREAM_H
@@ -0,0 +1,416 @@
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#ifdef _WIN32
+    #include <winsock2.h>                   // api.h의 windows.h보다 먼저 (winsock.h 충돌 방지)
+    #include <ws2tcpip.h>
+#endif
+
+#include "bench.h"
+#include "api.h"
+#include "api_cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+    typedef SOCKET mock_socket_t;
+    #define MOCK_INVALID_SOCKET INVALID_SOCKET
+    #define mock_close closesocket
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+    #include <sys/socket.h>
+    typedef int mock_socket_t;
+    #define MOCK_INVALID_SOCKET (-1)
+    #define mock_close close
+#endif
+
+#define CANDIDATE_COUNT 20
+#define MOCK_LATENCY_MS 250                 // 모의 API 서버의 응답 지연 (공공데이터포털 응답 시간 흉내)
+#define LEGACY_WAIT_MS 300                  // 예전 수집 반복문의 호출 간 대기
+#define MOCK_ETAG "\"mock-pledge-1\""       // 모의 서버 응답의 ETag (본문이 바뀌지 않으므로 항상 같음)
+
+// 후보자 한 명의 공약 응답 (공약 10개)
+static char g_pledge_body[8192];
+static size_t g_pledge_body_length;
+
+static mock_socket_t g_listen_socket = MOCK_INVALID_SOCKET;
+static volatile int g_mock_running = 0;
+static int g_mock_requests = 0;             // 받은 요청 수
+static int g_mock_not_modified = 0;         // 그중 If-None-Match가 맞아 304로 답한 수
+
+static void sleep_ms(int ms) {
+#ifdef _WIN32
+    Sleep((DWORD)ms);
+#else
+    struct timespec ts = { ms / 1000, (long)(ms % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+#endif
+}
+
+static void build_pledge_body(void) {
+    size_t used = (size_t)snprintf(g_pledge_body, sizeof(g_pledge_body),
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?><response><header><resultCode>INFO-00</resultCode>"
+        "<resultMsg>NORMAL SERVICE</resultMsg></header><body><items><item>"
+        "<cnddtId>100000</cnddtId><krName>모의후보</krName><prmsCnt>10</prmsCnt>");
+    for (int i = 1; i <= 10 && used < sizeof(g_pledge_body); i++) {
+        used += (size_t)snprintf(g_pledge_body + used, sizeof(g_pledge_body) - used,
+            "<prmsRealmName%d>경제</prmsRealmName%d><prmsTitle%d>공약 %d</prmsTitle%d>"
+            "<prmmCont%d>모의 공약 내용 %d번입니다.</prmmCont%d>", i, i, i, i, i, i, i, i);
+    }
+    if (used < sizeof(g_pledge_body)) {
+        used += (size_t)snprintf(g_pledge_body + used, sizeof(g_pledge_body) - used,
+            "</item></items></body></response>");
+    }
+    g_pledge_body_length = strlen(g_pledge_body);
+}
+
+// 연결 하나: 요청 헤더를 읽고 지연 후 응답 (Connection: close)
+#ifdef _WIN32
+static DWORD WINAPI mock_connection(LPVOID param) {
+#else
+static void* mock_connection(void* param) {
+#endif
+    mock_socket_t client = (mock_socket_t)(size_t)param;
+    char request[4096];
+    size_t received = 0;
+    while (received < sizeof(request) - 1) {
+        int n = recv(client, request + received, (int)(sizeof(request) - 1 - received), 0);
+        if (n <= 0) break;
+        received += (size_t)n;
+        request[received] = '\0';
+        if (strstr(request, "\r\n\r\n")) break;
+    }
+
+    sleep_ms(MOCK_LATENCY_MS);
+    __atomic_add_fetch(&g_mock_requests, 1, __ATOMIC_RELAXED);
+
+    char header[256];
+    if (strstr(request, "If-None-Match: " MOCK_ETAG)) {
+        __atomic_add_fetch(&g_mock_not_modified, 1, __ATOMIC_RELAXED);
+        int header_length = snprintf(header, sizeof(header),
+            "HTTP/1.1 304 Not Modified\r\nETag: %s\r\nConnection: close\r\n\r\n", MOCK_ETAG);
+        send(client, header, header_length, 0);
+    } else {
+        int header_length = snprintf(header, sizeof(header),
+            "HTTP/1.1 200 OK\r\nContent-Type: text/xml; charset=UTF-8\r\nContent-Length: %zu\r\nETag: %s\r\n"
+            "Connection: close\r\n\r\n", g_pledge_body_length, MOCK_ETAG);
+        send(client, header, header_length, 0);
+        send(client, g_pledge_body, (int)g_pledge_body_length, 0);
+    }
+    mock_close(client);
+    return 0;
+}
+
+#ifdef _WIN32
+static DWORD WINAPI mock_accept_loop(LPVOID param) {
+#else
+static void* mock_accept_loop(void* param) {
+#endif
+    (void)param;
+    while (g_mock_running) {
+        mock_socket_t client = accept(g_listen_socket, NULL, NULL);
+        if (client == MOCK_INVALID_SOCKET) continue;
+        if (!g_mock_running) {
+            mock_close(client);
+            break;
+        }
+#ifdef _WIN32
+        HANDLE thread = CreateThread(NULL, 0, mock_connection, (LPVOID)(size_t)client, 0, NULL);
+        if (thread) CloseHandle(thread);
+        else mock_close(client);
+#else
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, mock_connection, (void*)(size_t)client) == 0) {
+            pthread_detach(thread);
+        } else {
+            mock_close(client);
+        }
+#endif
+    }
+    return 0;
+}
+
+// 127.0.0.1의 빈 포트에 모의 API 서버 시작 (실패 시 0)
+static int start_mock_server(int* port) {
+#ifdef _WIN32
+    WSADATA wsa;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0) return 0;
+#endif
+    g_listen_socket = socket(AF_INET, SOCK_STREAM, 0);
+    if (g_listen_socket == MOCK_INVALID_SOCKET) return 0;
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t length = sizeof(address);
+    if (bind(g_listen_socket, (struct sockaddr*)&address, sizeof(address)) != 0 ||
+        listen(g_listen_socket, 64) != 0 ||
+        getsockname(g_listen_socket, (struct sockaddr*)&address, &length) != 0) {
+        mock_close(g_listen_socket);
+        return 0;
+    }
+    *port = ntohs(address.sin_port);
+
+    g_mock_running = 1;
+#ifdef _WIN32
+    HANDLE thread = CreateThread(NULL, 0, mock_accept_loop, NULL, 0, NULL);
+    if (!thread) return 0;
+    CloseHandle(thread);
+#else
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, mock_accept_loop, NULL) != 0) return 0;
+    pthread_detach(thread);
+#endif
+    return 1;
+}
+
+// 대기 중인 accept를 깨우기 위해 한 번 접속한 뒤 닫음
+static void stop_mock_server(int port) {
+    g_mock_running = 0;
+    mock_socket_t wake = socket(AF_INET, SOCK_STREAM, 0);
+    if (wake != MOCK_INVALID_SOCKET) {
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons((unsigned short)port);
+        connect(wake, (struct sockaddr*)&address, sizeof(address));
+        mock_close(wake);
+    }
+    sleep_ms(50);
+    mock_close(g_listen_socket);
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+
+static void count_response(APIFetchRequest* request, void* context) {
+    size_t* bytes = (size_t*)context;
+    if (request->status == 0) *bytes += request->response.size;
+}
+
+static void prepare_requests(APIFetchRequest* requests, int port) {
+    memset(requests, 0, sizeof(APIFetchRequest) * CANDIDATE_COUNT);
+    for (int i = 0; i < CANDIDATE_COUNT; i++) {
+        snprintf(requests[i].url, sizeof(requests[i].url),
+                 "http://127.0.0.1:%d/9760000/ElecPrmsInfoInqireService/getCnddtElecPrmsInfoInqire?cnddtId=%d",
+                 port, 100000 + i);
+        requests[i].endpoint = API_ENDPOINT_PLEDGE;
+    }
+}
+
+// 예전 방식: 요청 하나를 끝까지 기다린 뒤 0.3초 쉬고 다음 요청 (토큰 버킷 없음)
+static int run_legacy(APIClient* client, APIFetchRequest* requests, double* seconds, size_t* bytes) {
+    APIFetchOptions options = { 1 };
+    api_set_rate_limit(API_ENDPOINT_PLEDGE, 0.0, 1.0);
+    int succeeded = 0;
+    double start = bench_now_sec();
+    for (int i = 0; i < CANDIDATE_COUNT; i++) {
+        succeeded += api_fetch_all(client, &requests[i], 1, &options, count_response, bytes, NULL);
+        if (i < CANDIDATE_COUNT - 1) sleep_ms(LEGACY_WAIT_MS);
+    }
+    *seconds = bench_now_sec() - start;
+    return succeeded;
+}
+
+static int run_concurrent(APIClient* client, APIFetchRequest* requests, const APIFetchOptions* options,
+                          double* seconds, size_t* bytes, int* peak) {
+    APIFetchStats stats;
+    double start = bench_now_sec();
+    int succeeded = api_fetch_all(client, requests, CANDIDATE_COUNT, options, count_response, bytes, &stats);
+    *seconds = bench_now_sec() - start;
+    *peak = stats.peak_in_flight;
+    return succeeded;
+}
+
+// 새로고침 두 개가 같은 엔드포인트를 동시에 수집 (토큰 버킷을 함께 쓰므로 합계가 상한을 넘지 않아야 함)
+typedef struct {
+    APIClient* client;
+    APIFetchRequest* requests;
+    size_t bytes;
+    int succeeded;
+} RefreshThread;
+
+#ifdef _WIN32
+static DWORD WINAPI refresh_thread(LPVOID param) {
+#else
+static void* refresh_thread(void* param) {
+#endif
+    RefreshThread* refresh = (RefreshThread*)param;
+    APIFetchOptions options = { API_FETCH_DEFAULT_IN_FLIGHT };
+    refresh->succeeded = api_fetch_all(refresh->client, refresh->requests, CANDIDATE_COUNT, &options,
+                                       count_response, &refresh->bytes, NULL);
+    return 0;
+}
+
+static int run_two_refreshes(APIClient* client, APIFetchRequest* first, APIFetchRequest* second, double* seconds) {
+    RefreshThread refreshes[2] = { { client, first, 0, 0 }, { client, second, 0, 0 } };
+    double start = bench_now_sec();
+#ifdef _WIN32
+    HANDLE threads[2];
+    for (int i = 0; i < 2; i++) threads[i] = CreateThread(NULL, 0, refresh_thread, &refreshes[i], 0, NULL);
+    WaitForMultipleObjects(2, threads, TRUE, INFINITE);
+    for (int i = 0; i < 2; i++) CloseHandle(threads[i]);
+#else
+    pthread_t threads[2];
+    for (int i = 0; i < 2; i++) pthread_create(&threads[i], NULL, refresh_thread, &refreshes[i]);
+    for (int i = 0; i < 2; i++) pthread_join(threads[i], NULL);
+#endif
+    *seconds = bench_now_sec() - start;
+
+    int ok = 1;
+    for (int i = 0; i < 2; i++) {
+        if (refreshes[i].succeeded != CANDIDATE_COUNT || refreshes[i].bytes != g_pledge_body_length * CANDIDATE_COUNT) ok = 0;
+    }
+    return ok;
+}
+
+static void print_fetch_row(const char* label, int succeeded, double seconds, int peak, double speedup) {
+    printf("  %7.2f초  성공 %2d/%d  동시 최대 %2d  %5.1fx  %s\n", seconds, succeeded, CANDIDATE_COUNT, peak, speedup, label);
+}
+
+// 응답 캐시를 켠 채 같은 20건을 다시 수집 (보낸 요청 수와 304 수는 모의 서버에서 셈)
+static int run_cached(APIClient* client, APIFetchRequest* requests, int port, const char* label) {
+    APIFetchOptions options = { API_FETCH_DEFAULT_IN_FLIGHT };
+    APIFetchStats stats;
+    size_t bytes = 0;
+    int requests_before = __atomic_load_n(&g_mock_requests, __ATOMIC_RELAXED);
+    int not_modified_before = __atomic_load_n(&g_mock_not_modified, __ATOMIC_RELAXED);
+
+    prepare_requests(requests, port);
+    double start = bench_now_sec();
+    int succeeded = api_fetch_all(client, requests, CANDIDATE_COUNT, &options, count_response, &bytes, &stats);
+    double seconds = bench_now_sec() - start;
+
+    int sent = __atomic_load_n(&g_mock_requests, __ATOMIC_RELAXED) - requests_before;
+    int not_modified = __atomic_load_n(&g_mock_not_modified, __ATOMIC_RELAXED) - not_modified_before;
+    printf("  %7.2f초  성공 %2d/%d  요청 %2d건 (304 %2d건, 본문 %2d건)  캐시 %2d건  %s\n",
+           seconds, succeeded, CANDIDATE_COUNT, sent, not_modified, sent - not_modified, stats.cached, label);
+    return succeeded == CANDIDATE_COUNT && bytes == g_pledge_body_length * CANDIDATE_COUNT;
+}
+
+int bench_api_fetch(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+
+    build_pledge_body();
+    int port = 0;
+    if (!start_mock_server(&port)) {
+        printf("모의 API 서버 시작 실패\n");
+        return 1;
+    }
+
+    // 모의 서버만 부르므로 API 키 없이 클라이언트를 직접 준비
+    APIClient client;
+    memset(&client, 0, sizeof(client));
+#ifdef _WIN32
+    client.hInternet = InternetOpenA("ElectionAPI/1.0", INTERNET_OPEN_TYPE_DIRECT, NULL, NULL, 0);
+    if (!client.hInternet) {
+        printf("WinINet 초기화 실패\n");
+        stop_mock_server(port);
+        return 1;
+    }
+#else
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+#endif
+    client.is_initialized = 1;
+
+    APIFetchRequest* requests = malloc(sizeof(APIFetchRequest) * CANDIDATE_COUNT * 2);
+    if (!requests) {
+        printf("메모리 할당 실패\n");
+        stop_mock_server(port);
+        return 1;
+    }
+
+    printf("후보자 %d명의 공약 응답 수집 (모의 서버 127.0.0.1:%d, 응답 지연 %dms, 응답 %zu bytes)\n\n",
+           CANDIDATE_COUNT, port, MOCK_LATENCY_MS, g_pledge_body_length);
+
+    // 수집 방식 비교는 매번 네트워크로 받아야 하므로 응답 캐시를 끄고 시작
+    int cache_was_enabled = api_cache_enabled();
+    long pledge_ttl = api_cache_get_ttl(API_ENDPOINT_PLEDGE);
+    api_cache_set_enabled(0);
+
+    int ok = 1;
+    double legacy_seconds = 0.0;
+    size_t bytes = 0;
+    prepare_requests(requests, port);
+    int succeeded = run_legacy(&client, requests, &legacy_seconds, &bytes);
+    print_fetch_row("하나씩 + 0.3초 대기 (예전 반복문)", succeeded, legacy_seconds, 1, 1.0);
+    if (succeeded != CANDIDATE_COUNT || bytes != g_pledge_body_length * CANDIDATE_COUNT) ok = 0;
+
+    // 동시 요청 수, 토큰 버킷 (초당 요청 수, 버스트)
+    static const struct { int in_flight; double rate; double burst; } configs[] = {
+        { 4, API_RATE_DEFAULT, 1.0 },
+        { API_FETCH_DEFAULT_IN_FLIGHT, API_RATE_DEFAULT, API_RATE_DEFAULT_BURST },
+        { API_FETCH_DEFAULT_IN_FLIGHT, 0.0, 1.0 },
+    };
+    for (int c = 0; c < (int)(sizeof(configs) / sizeof(configs[0])); c++) {
+        char label[64];
+        if (configs[c].rate > 0.0) {
+            snprintf(label, sizeof(label), "동시 %d개, 초당 %.0f건 (버스트 %.0f)",
+                     configs[c].in_flight, configs[c].rate, configs[c].burst);
+        } else {
+            snprintf(label, sizeof(label), "동시 %d개, 속도 제한 없음", configs[c].in_flight);
+        }
+
+        APIFetchOptions options = { configs[c].in_flight };
+        api_set_rate_limit(API_ENDPOINT_PLEDGE, configs[c].rate, configs[c].burst);
+        sleep_ms(500);                      // 앞 실행에서 쓴 토큰이 다시 차도록
+
+        double seconds = 0.0;
+        int peak = 0;
+        bytes = 0;
+        prepare_requests(requests, port);
+        succeeded = run_concurrent(&client, requests, &options, &seconds, &bytes, &peak);
+        print_fetch_row(label, succeeded, seconds, peak, seconds > 0.0 ? legacy_seconds / seconds : 0.0);
+        if (succeeded != CANDIDATE_COUNT || bytes != g_pledge_body_length * CANDIDATE_COUNT) ok = 0;
+    }
+
+    // 새로고침 두 개가 동시에 같은 엔드포인트를 부르면 버킷을 나눠 써서 합계가 상한을 넘지 않음
+    api_set_rate_limit(API_ENDPOINT_PLEDGE, API_RATE_DEFAULT, API_RATE_DEFAULT_BURST);
+    sleep_ms(500);
+    prepare_requests(requests, port);
+    prepare_requests(requests + CANDIDATE_COUNT, port);
+    double both_seconds = 0.0;
+    if (!run_two_refreshes(&client, requests, requests + CANDIDATE_COUNT, &both_seconds)) ok = 0;
+    printf("\n  새로고침 2개 동시 (합계 %d건, 초당 %.0f건 + 버스트 %.0f): %.2f초, 실제 초당 %.1f건\n",
+           CANDIDATE_COUNT * 2, API_RATE_DEFAULT, API_RATE_DEFAULT_BURST, both_seconds,
+           both_seconds > 0.0 ? CANDIDATE_COUNT * 2 / both_seconds : 0.0);
+
+    // 응답 캐시: 처음 수집 -> TTL 안에 다시 수집 -> TTL이 지난 뒤 ETag로 재검증
+    printf("\n  [응답 캐시 (%s), 동시 %d개, 초당 %.0f건]\n", API_CACHE_DIR, API_FETCH_DEFAULT_IN_FLIGHT, API_RATE_DEFAULT);
+    api_cache_set_enabled(1);
+    api_cache_set_ttl(API_ENDPOINT_PLEDGE, API_CACHE_DEFAULT_TTL_PLEDGE);
+    prepare_requests(requests, port);
+    for (int i = 0; i < CANDIDATE_COUNT; i++) api_cache_remove(requests[i].url);
+
+    sleep_ms(500);
+    if (!run_cached(&client, requests, port, "캐시 없음 (받아서 저장)")) ok = 0;
+    if (!run_cached(&client, requests, port, "TTL 안 (요청 없음)")) ok = 0;
+    api_cache_set_ttl(API_ENDPOINT_PLEDGE, 0);
+    sleep_ms(500);
+    if (!run_cached(&client, requests, port, "TTL 지남 (If-None-Match -> 304)")) ok = 0;
+
+    for (int i = 0; i < CANDIDATE_COUNT; i++) api_cache_remove(requests[i].url);
+    api_cache_set_ttl(API_ENDPOINT_PLEDGE, pledge_ttl);
+    api_cache_set_enabled(cache_was_enabled);
+
+    printf("\n응답 크기 검증: %s\n", ok ? "모든 방식 동일" : "불일치!");
+
+    free(requests);
+#ifdef _WIN32
+    InternetCloseHandle(client.hInternet);
+#else
+    curl_global_cleanup();
+#endif
+    stop_mock_server(port);
+    return ok ? 0 : 1;
+}
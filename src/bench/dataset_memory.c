@@ -0,0 +1,205 @@
+#include "bench.h"
+#include "structures.h"
+#include "dataset.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ELECTION_COUNT 200
+#define CANDIDATE_COUNT 10000
+#define PLEDGE_COUNT 100000                 // 후보자당 공약 10개
+
+// 예전 서버의 고정 배열 크기 (지금은 파일 줄 수로 맞춰 할당)
+#define LEGACY_MAX_ELECTIONS 200
+#define LEGACY_MAX_CANDIDATES 10000
+#define LEGACY_MAX_PLEDGES 100000
+
+static const char* g_categories[] = {
+    "노동", "정치", "경제", "복지", "교육", "환경", "국방", "통일외교통상", "재정경제", "문화", "보건", "교통"
+};
+static const char* g_parties[] = { "더불어민주당", "국민의힘", "정의당", "개혁신당", "무소속" };
+
+static void make_election(int i, ElectionInfo* election) {
+    memset(election, 0, sizeof(ElectionInfo));
+    snprintf(election->election_id, sizeof(election->election_id), "20%02d%02d%02d", 10 + i % 15, i % 12 + 1, i % 28 + 1);
+    snprintf(election->election_name, sizeof(election->election_name), "제%d회 전국동시지방선거", i + 1);
+    snprintf(election->election_date, sizeof(election->election_date), "%s", election->election_id);
+    snprintf(election->election_type, sizeof(election->election_type), "%s", i % 3 ? "지방선거" : "대통령선거");
+    election->is_active = 1;
+}
+
+static void make_candidate(int i, CandidateInfo* candidate) {
+    memset(candidate, 0, sizeof(CandidateInfo));
+    snprintf(candidate->candidate_id, sizeof(candidate->candidate_id), "1001%05d", i);
+    snprintf(candidate->candidate_name, sizeof(candidate->candidate_name), "후보%d", i);
+    snprintf(candidate->party_name, sizeof(candidate->party_name), "%s", g_parties[i % 5]);
+    snprintf(candidate->election_id, sizeof(candidate->election_id), "20%02d%02d%02d",
+             10 + (i % ELECTION_COUNT) % 15, (i % ELECTION_COUNT) % 12 + 1, (i % ELECTION_COUNT) % 28 + 1);
+    candidate->candidate_number = i % 10 + 1;
+    candidate->pledge_count = 10;
+}
+
+// 실제 pledges.txt와 비슷한 공약 생성 (내용은 약 30%가 비어 있고 나머지는 길이가 제각각)
+static void make_pledge(int i, unsigned int* seed, PledgeInfo* pledge) {
+    memset(pledge, 0, sizeof(PledgeInfo));
+    snprintf(pledge->candidate_id, sizeof(pledge->candidate_id), "1001%05d", i / 10);
+    snprintf(pledge->pledge_id, sizeof(pledge->pledge_id), "1001%05d_%d", i / 10, i % 10 + 1);
+    snprintf(pledge->title, sizeof(pledge->title), "%s을 책임지는 대한민국 %d", g_categories[i % 12], i);
+    snprintf(pledge->category, sizeof(pledge->category), "%s", g_categories[bench_random(seed) % 12]);
+
+    if (bench_random(seed) % 10 >= 3) {
+        size_t length = 100 + bench_random(seed) % 1200;
+        int written = snprintf(pledge->content, sizeof(pledge->content), "공약 %d 세부 내용: ", i);
+        for (size_t p = (size_t)written; p + 3 < length && p + 3 < sizeof(pledge->content); p += 3) {
+            memcpy(pledge->content + p, "가", 3);
+        }
+    }
+    pledge->created_time = 1750245513;
+}
+
+// 서버가 하던 strncpy처럼 고정 배열에 복사 (남은 칸까지 0으로 채우므로 구조체 전체가 상주)
+static void copy_info(char* dest, const char* src, size_t size) {
+    size_t length = strlen(src);
+    if (length > size - 1) length = size - 1;
+    memset(dest, 0, size);
+    memcpy(dest, src, length);
+}
+
+static double to_mb(size_t bytes) {
+    return bytes / (1024.0 * 1024.0);
+}
+
+// 기존 방식: *Info 배열을 예전 최대 크기로 잡고 앞에서부터 채움 (서버 전역 배열과 같이 쓰지 않은 페이지는 상주하지 않음)
+static int run_fixed(size_t* resident) {
+    ElectionInfo* elections = calloc(LEGACY_MAX_ELECTIONS, sizeof(ElectionInfo));
+    CandidateInfo* candidates = calloc(LEGACY_MAX_CANDIDATES, sizeof(CandidateInfo));
+    PledgeInfo* pledges = calloc(LEGACY_MAX_PLEDGES, sizeof(PledgeInfo));
+    if (!elections || !candidates || !pledges) {
+        free(elections);
+        free(candidates);
+        free(pledges);
+        return 0;
+    }
+
+    size_t before = bench_resident_bytes();
+    unsigned int seed = 7;
+    ElectionInfo election;
+    CandidateInfo candidate;
+    PledgeInfo pledge;
+
+    double start = bench_now_sec();
+    for (int i = 0; i < ELECTION_COUNT; i++) {
+        make_election(i, &election);
+        copy_info(elections[i].election_id, election.election_id, MAX_STRING_LEN);
+        copy_info(elections[i].election_name, election.election_name, MAX_STRING_LEN);
+        copy_info(elections[i].election_date, election.election_date, MAX_STRING_LEN);
+        copy_info(elections[i].election_type, election.election_type, MAX_STRING_LEN);
+        elections[i].is_active = election.is_active;
+    }
+    for (int i = 0; i < CANDIDATE_COUNT; i++) {
+        make_candidate(i, &candidate);
+        copy_info(candidates[i].candidate_id, candidate.candidate_id, MAX_STRING_LEN);
+        copy_info(candidates[i].candidate_name, candidate.candidate_name, MAX_STRING_LEN);
+        copy_info(candidates[i].party_name, candidate.party_name, MAX_STRING_LEN);
+        copy_info(candidates[i].election_id, candidate.election_id, MAX_STRING_LEN);
+        candidates[i].candidate_number = candidate.candidate_number;
+        candidates[i].pledge_count = candidate.pledge_count;
+    }
+    for (int i = 0; i < PLEDGE_COUNT; i++) {
+        make_pledge(i, &seed, &pledge);
+        copy_info(pledges[i].pledge_id, pledge.pledge_id, MAX_STRING_LEN);
+        copy_info(pledges[i].candidate_id, pledge.candidate_id, MAX_STRING_LEN);
+        copy_info(pledges[i].title, pledge.title, MAX_STRING_LEN);
+        copy_info(pledges[i].content, pledge.content, MAX_CONTENT_LEN);
+        copy_info(pledges[i].category, pledge.category, MAX_STRING_LEN);
+        pledges[i].created_time = pledge.created_time;
+    }
+    double load_ms = (bench_now_sec() - start) * 1e3;
+
+    *resident = bench_resident_bytes() - before;
+    printf("  %-28s 적재 %.1f ms, RSS 증가 %.1f MB (구조체 %zu/%zu/%zu 바이트)\n",
+           "고정 문자 배열 (*Info)", load_ms, to_mb(*resident),
+           sizeof(ElectionInfo), sizeof(CandidateInfo), sizeof(PledgeInfo));
+
+    free(elections);
+    free(candidates);
+    free(pledges);
+    return 1;
+}
+
+// 새 방식: 문자열은 인턴 테이블에 한 번만 두고 레코드에는 핸들만 저장
+static int run_interned(size_t* resident) {
+    ElectionRecord* elections = calloc(ELECTION_COUNT, sizeof(ElectionRecord));
+    CandidateRecord* candidates = calloc(CANDIDATE_COUNT, sizeof(CandidateRecord));
+    StringIntern strings;
+    PledgeTable pledges;
+    PledgeLookup lookup;
+    pledge_table_init(&pledges);
+    pledge_lookup_init(&lookup);
+
+    size_t before = bench_resident_bytes();
+    int ok = elections && candidates && string_intern_init(&strings);
+    if (!ok) {
+        free(elections);
+        free(candidates);
+        return 0;
+    }
+
+    unsigned int seed = 7;
+    ElectionInfo election;
+    CandidateInfo candidate;
+    PledgeInfo pledge;
+
+    double start = bench_now_sec();
+    for (int i = 0; ok && i < ELECTION_COUNT; i++) {
+        make_election(i, &election);
+        ok = election_record_intern(&elections[i], &election, &strings);
+    }
+    for (int i = 0; ok && i < CANDIDATE_COUNT; i++) {
+        make_candidate(i, &candidate);
+        ok = candidate_record_intern(&candidates[i], &candidate, &strings);
+    }
+    for (int i = 0; ok && i < PLEDGE_COUNT; i++) {
+        make_pledge(i, &seed, &pledge);
+        ok = pledge_table_append(&pledges, &pledge, &strings);
+    }
+    ok = ok && pledge_lookup_rebuild(&lookup, &pledges, &strings);
+    double load_ms = (bench_now_sec() - start) * 1e3;
+
+    if (ok) {
+        *resident = bench_resident_bytes() - before;
+        size_t pledge_bytes = 2 * sizeof(StringHandle) + sizeof(uint16_t) + 2 * sizeof(int) + sizeof(PledgeColdRecord);
+        printf("  %-28s 적재 %.1f ms, RSS 증가 %.1f MB (구조체 %zu/%zu/%zu 바이트, 문자열 %u개 %.1f MB)\n",
+               "문자열 인턴 (*Record)", load_ms, to_mb(*resident),
+               sizeof(ElectionRecord), sizeof(CandidateRecord), pledge_bytes,
+               strings.count, to_mb(string_intern_memory(&strings)));
+    }
+
+    pledge_lookup_free(&lookup);
+    pledge_table_free(&pledges);
+    string_intern_free(&strings);
+    free(elections);
+    free(candidates);
+    return ok;
+}
+
+int bench_dataset_memory(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+
+    size_t fixed = 0;
+    size_t interned = 0;
+
+    printf("  선거 %d개, 후보자 %d개, 공약 %d개 (시작 RSS %.1f MB)\n",
+           ELECTION_COUNT, CANDIDATE_COUNT, PLEDGE_COUNT, to_mb(bench_resident_bytes()));
+
+    // 큰 배열은 해제 시 운영체제에 바로 반환되므로 기존 방식을 먼저 측정
+    if (!run_fixed(&fixed) || !run_interned(&interned)) {
+        printf("벤치마크 실행 실패\n");
+        return 1;
+    }
+    if (interned > 0) {
+        printf("  %-28s %.1f배\n\n", "RSS 감소", (double)fixed / interned);
+    }
+    return 0;
+}
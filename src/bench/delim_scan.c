@@ -0,0 +1,200 @@
+#include "bench.h"
+#include "structures.h"
+#include "delim_scan.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FILE_BYTES (100u * 1024u * 1024u)   // 합성 공약 파일 크기
+#define SCAN_BATCH 1024
+
+// data/pledges.txt와 같은 형식의 공약 파일 (내용 길이는 200~1500바이트)
+static char* make_pledge_file(size_t target, size_t* length, int* lines) {
+    char* data = malloc(target + 4096);
+    if (!data) return NULL;
+
+    unsigned int seed = 2025;
+    size_t pos = (size_t)sprintf(data, "# 공약 정보 데이터\n# 형식: 공약ID|후보자ID|제목|내용|카테고리|좋아요|싫어요|생성시간\n");
+    int count = 0;
+
+    while (pos < target) {
+        int candidate = 100120000 + count / 10;
+        pos += (size_t)sprintf(data + pos, "%d_%d|%d|후보 %d 공약 %d: 지역 균형 발전|", candidate, count % 10 + 1,
+                               candidate, candidate, count % 10 + 1);
+
+        size_t content = 200 + bench_random(&seed) % 1300;
+        for (size_t written = 0; written < content;) {
+            int n = sprintf(data + pos, "세부 과제 %u 재원과 일정 공개, ", bench_random(&seed) % 100);
+            pos += (size_t)n;
+            written += (size_t)n;
+        }
+        pos += (size_t)sprintf(data + pos, "|경제|%u|%u|1792175668\n", bench_random(&seed) % 1000,
+                               bench_random(&seed) % 1000);
+        count++;
+    }
+
+    *length = pos;
+    *lines = count;
+    return data;
+}
+
+// 기존 서버 parse_pledge_line (파이프를 한 바이트씩 세고 필드마다 strchr)
+static int legacy_parse_pledge_line(char* line, PledgeInfo* pledge) {
+    if (line[0] == '#' || line[0] == '\n') return 0;
+
+    line[strcspn(line, "\n")] = 0;
+
+    int pipe_count = 0;
+    for (int i = 0; line[i]; i++) {
+        if (line[i] == '|') pipe_count++;
+    }
+    if (pipe_count != 7) return 0;
+
+    char* tokens[8];
+    int token_count = 0;
+    char* start = line;
+    for (int i = 0; i < 8; i++) {
+        char* end = strchr(start, '|');
+        if (end) {
+            *end = '\0';
+            tokens[token_count++] = start;
+            start = end + 1;
+        } else if (i == 7) {
+            tokens[token_count++] = start;
+        } else {
+            break;
+        }
+    }
+    if (token_count < 8) return 0;
+
+    safe_strcpy(pledge->pledge_id, tokens[0], sizeof(pledge->pledge_id));
+    safe_strcpy(pledge->title, tokens[2], sizeof(pledge->title));
+    pledge->like_count = atoi(tokens[5]);
+    pledge->dislike_count = atoi(tokens[6]);
+    return 1;
+}
+
+// 바뀐 서버 parse_pledge_line (delim_split으로 파이프 위치를 한 번에 찾음)
+static int split_parse_pledge_line(char* line, PledgeInfo* pledge) {
+    if (line[0] == '#' || line[0] == '\n') return 0;
+
+    size_t length = strlen(line);
+    if (length > 0 && line[length - 1] == '\n') line[--length] = '\0';
+
+    char* tokens[8];
+    if (delim_split(line, length, '|', tokens, 8) != 8) return 0;
+
+    safe_strcpy(pledge->pledge_id, tokens[0], sizeof(pledge->pledge_id));
+    safe_strcpy(pledge->title, tokens[2], sizeof(pledge->title));
+    pledge->like_count = atoi(tokens[5]);
+    pledge->dislike_count = atoi(tokens[6]);
+    return 1;
+}
+
+// 파일 전체의 '|'와 '\n' 위치 수 (SCAN_BATCH개씩)
+static size_t count_delimiters(const char* data, size_t length) {
+    uint32_t positions[SCAN_BATCH];
+    size_t total = 0;
+    size_t from = 0;
+
+    for (;;) {
+        size_t found = delim_scan(data + from, length - from, '|', '\n', positions, SCAN_BATCH);
+        total += found;
+        if (found < SCAN_BATCH) return total;
+        from += positions[SCAN_BATCH - 1] + 1;
+    }
+}
+
+// fgets처럼 한 줄씩 줄 버퍼에 복사한 뒤 파싱 (checksum은 결과 비교용)
+static int parse_lines(const char* data, size_t length, int (*parse)(char*, PledgeInfo*), long long* checksum) {
+    char line[4096];
+    PledgeInfo pledge;
+    const char* end = data + length;
+    int count = 0;
+    long long sum = 0;
+
+    for (const char* p = data; p < end;) {
+        const char* newline = memchr(p, '\n', (size_t)(end - p));
+        size_t line_length = newline ? (size_t)(newline - p) + 1 : (size_t)(end - p);
+        if (line_length >= sizeof(line)) line_length = sizeof(line) - 1;
+
+        memcpy(line, p, line_length);
+        line[line_length] = '\0';
+        if (parse(line, &pledge)) {
+            count++;
+            sum += pledge.like_count * 3 + pledge.dislike_count + (long long)strlen(pledge.title);
+        }
+        p += line_length;
+    }
+    *checksum = sum;
+    return count;
+}
+
+static void print_throughput(const char* label, size_t bytes, double seconds) {
+    printf("  %10.1f MB/s  %8.2f ms  %s\n", bytes / (1024.0 * 1024.0) / seconds, seconds * 1000.0, label);
+}
+
+int bench_delim_scan(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+
+    size_t length;
+    int lines;
+    char* data = make_pledge_file(FILE_BYTES, &length, &lines);
+    if (!data) {
+        printf("메모리 할당 실패\n");
+        return 1;
+    }
+    printf("  합성 공약 파일 %.1f MB, 공약 %d줄\n\n", length / (1024.0 * 1024.0), lines);
+
+    DelimScanLevel detected = delim_scan_detect();
+    static const DelimScanLevel levels[] = { DELIM_SCAN_SCALAR, DELIM_SCAN_SSE2, DELIM_SCAN_AVX2 };
+    int status = 0;
+
+    // 1. 구분자 위치 모으기 ('|'와 '\n')
+    printf("  [구분자 위치 모으기]\n");
+    size_t expected = 0;
+    for (int l = 0; l < 3; l++) {
+        if (!delim_scan_select(levels[l])) {
+            printf("  %10s       %8s     %s (이 CPU에서 지원하지 않음)\n", "-", "-", l == 2 ? "avx2" : "sse2");
+            continue;
+        }
+        double start = bench_now_sec();
+        size_t found = count_delimiters(data, length);
+        double seconds = bench_now_sec() - start;
+
+        if (l == 0) expected = found;
+        if (found != expected) status = 1;
+        print_throughput(delim_scan_name(), length, seconds);
+    }
+    printf("  구분자 %zu개, 결과 %s\n\n", expected, status == 0 ? "일치" : "불일치");
+
+    // 2. 서버 공약 줄 파싱 (줄 버퍼 복사 포함)
+    printf("  [공약 줄 파싱]\n");
+    long long legacy_checksum;
+    double start = bench_now_sec();
+    int legacy_count = parse_lines(data, length, legacy_parse_pledge_line, &legacy_checksum);
+    print_throughput("기존 (파이프 세기 + strchr)", length, bench_now_sec() - start);
+
+    for (int l = 0; l < 3; l++) {
+        if (!delim_scan_select(levels[l])) continue;
+
+        long long checksum;
+        start = bench_now_sec();
+        int count = parse_lines(data, length, split_parse_pledge_line, &checksum);
+        double seconds = bench_now_sec() - start;
+
+        char label[64];
+        snprintf(label, sizeof(label), "delim_split (%s)", delim_scan_name());
+        print_throughput(label, length, seconds);
+        if (count != legacy_count || checksum != legacy_checksum) status = 1;
+    }
+    printf("  공약 %d개, 결과 %s\n", legacy_count, status == 0 ? "일치" : "불일치");
+
+    delim_scan_select(detected);
+    printf("\n  %-28s %s\n", "자동 선택 구현", delim_scan_name());
+
+    free(data);
+    return status;
+}
@@ -0,0 +1,219 @@
+#include "bench.h"
+#include "structures.h"
+#include "adjacency.h"
+#include "hash_index.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+
+#define PLEDGES_PER_CANDIDATE 10
+#define CANDIDATES_PER_ELECTION 15
+#define QUERY_COUNT 2000
+#define MAX_BENCH_ELECTIONS 200
+
+// 실제 데이터와 같은 형식의 선거/후보자/공약 생성 (후보자 순서는 섞어서 선거별로 모여 있지 않게 함)
+static void fill_dataset(ElectionInfo* elections, int election_count, CandidateInfo* candidates, int candidate_count,
+                         PledgeInfo* pledges, int pledge_count) {
+    unsigned int seed = 99;
+
+    for (int e = 0; e < election_count; e++) {
+        memset(&elections[e], 0, sizeof(ElectionInfo));
+        snprintf(elections[e].election_id, sizeof(elections[e].election_id), "2%07d", e);
+    }
+    for (int c = 0; c < candidate_count; c++) {
+        memset(&candidates[c], 0, sizeof(CandidateInfo));
+        snprintf(candidates[c].candidate_id, sizeof(candidates[c].candidate_id), "1001%05d", c);
+        int election = (int)(bench_random(&seed) % (unsigned int)election_count);
+        strcpy(candidates[c].election_id, elections[election].election_id);
+    }
+    for (int p = 0; p < pledge_count; p++) {
+        memset(&pledges[p], 0, sizeof(PledgeInfo));
+        int candidate = (int)(bench_random(&seed) % (unsigned int)candidate_count);
+        strcpy(pledges[p].candidate_id, candidates[candidate].candidate_id);
+        snprintf(pledges[p].pledge_id, sizeof(pledges[p].pledge_id), "%s_%d", pledges[p].candidate_id, p);
+        pledges[p].like_count = (int)(bench_random(&seed) % 100);
+    }
+}
+
+// 기존 클라이언트 방식: 후보자 ID를 공약 배열 전체와 strcmp로 비교 (show_pledge_selection)
+static int scan_candidate_pledges(const PledgeInfo* pledges, int count, const char* candidate_id, int32_t* found) {
+    int n = 0;
+    for (int i = 0; i < count; i++) {
+        if (strcmp(pledges[i].candidate_id, candidate_id) == 0) {
+            found[n++] = i;
+        }
+    }
+    return n;
+}
+
+// 기존 방식: 선거 ID를 후보자 배열 전체와 비교 (show_candidate_selection)
+static int scan_election_candidates(const CandidateInfo* candidates, int count, const char* election_id,
+                                    int32_t* found) {
+    int n = 0;
+    for (int i = 0; i < count; i++) {
+        if (strcmp(candidates[i].election_id, election_id) == 0) {
+            found[n++] = i;
+        }
+    }
+    return n;
+}
+
+// 클라이언트와 같은 순서로 인접 목록 생성 (ID -> 위치 해시 인덱스 + 계수 정렬)
+static int build_links(const ElectionInfo* elections, int election_count, const CandidateInfo* candidates,
+                       int candidate_count, const PledgeInfo* pledges, int pledge_count,
+                       AdjacencyIndex* election_candidates, AdjacencyIndex* candidate_pledges) {
+    HashIndex election_lookup;
+    HashIndex candidate_lookup;
+    int32_t* election_of = malloc(sizeof(int32_t) * (size_t)candidate_count);
+    int32_t* candidate_of = malloc(sizeof(int32_t) * (size_t)pledge_count);
+    int ok = hash_index_init(&election_lookup, elections, sizeof(ElectionInfo), offsetof(ElectionInfo, election_id),
+                             (size_t)election_count) &&
+             hash_index_rebuild(&election_lookup, election_count);
+    ok = hash_index_init(&candidate_lookup, candidates, sizeof(CandidateInfo), offsetof(CandidateInfo, candidate_id),
+                         (size_t)candidate_count) &&
+         hash_index_rebuild(&candidate_lookup, candidate_count) && ok;
+
+    if (ok && election_of && candidate_of) {
+        for (int c = 0; c < candidate_count; c++) {
+            election_of[c] = hash_index_find(&election_lookup, candidates[c].election_id);
+        }
+        for (int p = 0; p < pledge_count; p++) {
+            candidate_of[p] = hash_index_find(&candidate_lookup, pledges[p].candidate_id);
+        }
+        ok = adjacency_index_build(election_candidates, election_of, candidate_count, election_count) &&
+             adjacency_index_build(candidate_pledges, candidate_of, pledge_count, candidate_count);
+    } else {
+        ok = 0;
+    }
+
+    hash_index_free(&election_lookup);
+    hash_index_free(&candidate_lookup);
+    free(election_of);
+    free(candidate_of);
+    return ok;
+}
+
+static int run_size(ElectionInfo* elections, CandidateInfo* candidates, PledgeInfo* pledges, int pledge_count) {
+    int candidate_count = pledge_count / PLEDGES_PER_CANDIDATE;
+    int election_count = candidate_count / CANDIDATES_PER_ELECTION;
+    if (election_count < 1) election_count = 1;
+    if (election_count > MAX_BENCH_ELECTIONS) election_count = MAX_BENCH_ELECTIONS;
+
+    fill_dataset(elections, election_count, candidates, candidate_count, pledges, pledge_count);
+
+    int32_t* found = malloc(sizeof(int32_t) * (size_t)pledge_count);
+    AdjacencyIndex election_candidates;
+    AdjacencyIndex candidate_pledges;
+    adjacency_index_init(&election_candidates);
+    adjacency_index_init(&candidate_pledges);
+
+    double start = bench_now_sec();
+    int ok = found && build_links(elections, election_count, candidates, candidate_count, pledges, pledge_count,
+                                  &election_candidates, &candidate_pledges);
+    double build_ms = (bench_now_sec() - start) * 1e3;
+    if (!ok) {
+        free(found);
+        adjacency_index_free(&election_candidates);
+        adjacency_index_free(&candidate_pledges);
+        return 0;
+    }
+
+    // 전체 스캔은 느리므로 큰 데이터에서는 조회 횟수를 줄여서 측정
+    int scan_queries = pledge_count >= 100000 ? 200 : QUERY_COUNT;
+    unsigned int seed = 7;
+    long long checksum = 0;
+    int same = 1;
+
+    start = bench_now_sec();
+    for (int q = 0; q < scan_queries; q++) {
+        int candidate = (int)(bench_random(&seed) % (unsigned int)candidate_count);
+        int n = scan_candidate_pledges(pledges, pledge_count, candidates[candidate].candidate_id, found);
+        for (int i = 0; i < n; i++) checksum += pledges[found[i]].like_count;
+    }
+    double scan_pledges_ns = (bench_now_sec() - start) * 1e9 / scan_queries;
+
+    start = bench_now_sec();
+    for (int q = 0; q < QUERY_COUNT; q++) {
+        int candidate = (int)(bench_random(&seed) % (unsigned int)candidate_count);
+        const int32_t* items;
+        int n = adjacency_index_range(&candidate_pledges, candidate, &items);
+        for (int i = 0; i < n; i++) checksum += pledges[items[i]].like_count;
+    }
+    double csr_pledges_ns = (bench_now_sec() - start) * 1e9 / QUERY_COUNT;
+
+    start = bench_now_sec();
+    for (int q = 0; q < QUERY_COUNT; q++) {
+        int election = (int)(bench_random(&seed) % (unsigned int)election_count);
+        checksum += scan_election_candidates(candidates, candidate_count, elections[election].election_id, found);
+    }
+    double scan_candidates_ns = (bench_now_sec() - start) * 1e9 / QUERY_COUNT;
+
+    start = bench_now_sec();
+    for (int q = 0; q < QUERY_COUNT; q++) {
+        int election = (int)(bench_random(&seed) % (unsigned int)election_count);
+        const int32_t* items;
+        checksum += adjacency_index_range(&election_candidates, election, &items);
+    }
+    double csr_candidates_ns = (bench_now_sec() - start) * 1e9 / QUERY_COUNT;
+
+    // 결과 비교 (같은 항목이 같은 순서로 나와야 함)
+    for (int c = 0; c < candidate_count && same; c += 37) {
+        const int32_t* items;
+        int n = adjacency_index_range(&candidate_pledges, c, &items);
+        same = n == scan_candidate_pledges(pledges, pledge_count, candidates[c].candidate_id, found) &&
+               memcmp(items, found, sizeof(int32_t) * (size_t)n) == 0;
+    }
+    for (int e = 0; e < election_count && same; e++) {
+        const int32_t* items;
+        int n = adjacency_index_range(&election_candidates, e, &items);
+        same = n == scan_election_candidates(candidates, candidate_count, elections[e].election_id, found) &&
+               memcmp(items, found, sizeof(int32_t) * (size_t)n) == 0;
+    }
+
+    printf("  공약 %d개, 후보자 %d명, 선거 %d개\n", pledge_count, candidate_count, election_count);
+    bench_print_row("후보자 -> 공약 전체 스캔", (size_t)pledge_count, scan_pledges_ns);
+    bench_print_row("후보자 -> 공약 인접 목록", (size_t)pledge_count, csr_pledges_ns);
+    bench_print_row("선거 -> 후보자 전체 스캔", (size_t)candidate_count, scan_candidates_ns);
+    bench_print_row("선거 -> 후보자 인접 목록", (size_t)candidate_count, csr_candidates_ns);
+    printf("  %-28s %.2f ms, 메모리 %.1f KB, 결과 %s (checksum %lld)\n\n", "인접 목록 생성", build_ms,
+           (adjacency_index_memory(&election_candidates) + adjacency_index_memory(&candidate_pledges)) / 1024.0,
+           same ? "일치" : "불일치", checksum);
+
+    free(found);
+    adjacency_index_free(&election_candidates);
+    adjacency_index_free(&candidate_pledges);
+    return same;
+}
+
+int bench_drilldown(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+
+    static const int sizes[] = { 1000, 10000, 100000 };
+    int max_size = sizes[2];
+
+    ElectionInfo* elections = malloc(sizeof(ElectionInfo) * MAX_BENCH_ELECTIONS);
+    CandidateInfo* candidates = malloc(sizeof(CandidateInfo) * (size_t)(max_size / PLEDGES_PER_CANDIDATE));
+    PledgeInfo* pledges = malloc(sizeof(PledgeInfo) * (size_t)max_size);
+    if (!elections || !candidates || !pledges) {
+        printf("메모리 할당 실패\n");
+        free(elections);
+        free(candidates);
+        free(pledges);
+        return 1;
+    }
+
+    int status = 0;
+    for (int s = 0; s < 3 && status == 0; s++) {
+        if (!run_size(elections, candidates, pledges, sizes[s])) {
+            printf("벤치마크 실행 실패\n");
+            status = 1;
+        }
+    }
+
+    free(elections);
+    free(candidates);
+    free(pledges);
+    return status;
+}
@@ -0,0 +1,92 @@
+#include "bench.h"
+#include "structures.h"
+#include "evaluation_store.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOOKUP_COUNT 200000
+#define PLEDGE_COUNT 4000                   // 실제 데이터 규모의 공약 수
+
+// 투표자 voters명이 공약 PLEDGE_COUNT개 중 임의로 골라 평가 (평가 수 = votes)
+static int run_size(int votes) {
+    StringIntern strings;
+    EvaluationStore store;
+    if (!string_intern_init(&strings) || !evaluation_store_init(&store, &strings)) {
+        string_intern_free(&strings);
+        return 0;
+    }
+
+    unsigned int seed = 2024;
+    char user_id[32];
+    char pledge_id[32];
+    long checksum = 0;
+
+    double start = bench_now_sec();
+    for (int i = 0; i < votes; i++) {
+        snprintf(user_id, sizeof(user_id), "voter%07d", i / 8);
+        snprintf(pledge_id, sizeof(pledge_id), "1001%05u_%u", bench_random(&seed) % (PLEDGE_COUNT / 10),
+                 bench_random(&seed) % 10 + 1);
+        if (!evaluation_store_upsert(&store, user_id, pledge_id, (i & 1) ? 1 : -1, 0, NULL)) {
+            printf("평가 추가 실패 (%d번째)\n", i);
+            evaluation_store_free(&store);
+            string_intern_free(&strings);
+            return 0;
+        }
+    }
+    double insert_ns = (bench_now_sec() - start) * 1e9 / votes;
+
+    // 저장된 평가를 임의 순서로 조회
+    start = bench_now_sec();
+    for (int i = 0; i < LOOKUP_COUNT; i++) {
+        const EvaluationRecord* record = evaluation_store_at(&store, (int)(bench_random(&seed) % (unsigned int)store.count));
+        strcpy(user_id, string_intern_get(&strings, record->user));
+        const EvaluationRecord* found = evaluation_store_get(&store, user_id, string_intern_get(&strings, record->pledge));
+        checksum += found ? found->evaluation_type : 0;
+    }
+    double get_ns = (bench_now_sec() - start) * 1e9 / LOOKUP_COUNT;
+
+    // 공약별 포스팅 리스트 전체 순회
+    start = bench_now_sec();
+    long walked = 0;
+    for (int p = 0; p < PLEDGE_COUNT / 10; p++) {
+        for (int n = 1; n <= 10; n++) {
+            snprintf(pledge_id, sizeof(pledge_id), "1001%05d_%d", p, n);
+            for (int slot = evaluation_store_first_for_pledge(&store, pledge_id); slot >= 0;
+                 slot = evaluation_store_next_for_pledge(&store, slot)) {
+                checksum += evaluation_store_at(&store, slot)->evaluation_type;
+                walked++;
+            }
+        }
+    }
+    double walk_ns = (bench_now_sec() - start) * 1e9 / (walked > 0 ? walked : 1);
+
+    double store_mb = evaluation_store_memory(&store) / (1024.0 * 1024.0);
+    double strings_mb = string_intern_memory(&strings) / (1024.0 * 1024.0);
+    double fixed_mb = (double)store.count * sizeof(EvaluationInfo) / (1024.0 * 1024.0);
+
+    bench_print_row("추가 (upsert)", (size_t)votes, insert_ns);
+    bench_print_row("조회 (user, pledge)", (size_t)LOOKUP_COUNT, get_ns);
+    bench_print_row("공약별 순회 (평가당)", (size_t)walked, walk_ns);
+    printf("  %-28s 평가 %d개: 저장소 %.1f MB + 문자열 %.1f MB (문자열 %u개), 기존 배열이면 %.1f MB (checksum %ld)\n\n",
+           "메모리", store.count, store_mb, strings_mb, strings.count, fixed_mb, checksum);
+
+    evaluation_store_free(&store);
+    string_intern_free(&strings);
+    return 1;
+}
+
+int bench_evaluation_store(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+
+    static const int sizes[] = { 10000, 1000000, 3000000 };
+
+    for (int s = 0; s < 3; s++) {
+        if (!run_size(sizes[s])) {
+            printf("벤치마크 실행 실패\n");
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,157 @@
+#include "bench.h"
+#include "leaderboard.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PLEDGE_COUNT 100000
+#define ELECTION_COUNT 200
+#define CATEGORY_COUNT 40
+#define TOP_K 10
+#define QUERY_ROUNDS 200
+#define VOTE_COUNT 1000000
+
+// 기존 방식: 조회할 때마다 모든 공약을 훑으며 상위 K개를 삽입 정렬로 유지
+static int scan_top(const int* likes, const int* dislikes, int count, LeaderboardEntry* top) {
+    int found = 0;
+    for (int i = 0; i < count; i++) {
+        long long total = (long long)likes[i] + dislikes[i];
+        if (total == 0) continue;
+
+        int pos = found;
+        while (pos > 0) {
+            const LeaderboardEntry* prev = &top[pos - 1];
+            long long prev_total = (long long)prev->likes + prev->dislikes;
+            long long left = (long long)likes[i] * prev_total;
+            long long right = (long long)prev->likes * total;
+            if (left < right || (left == right && total <= prev_total)) break;
+            if (pos < TOP_K) top[pos] = *prev;
+            pos--;
+        }
+        if (pos < TOP_K) {
+            top[pos].pledge = i;
+            top[pos].likes = likes[i];
+            top[pos].dislikes = dislikes[i];
+            if (found < TOP_K) found++;
+        }
+    }
+    return found;
+}
+
+int bench_leaderboard(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+
+    int* likes = malloc(sizeof(int) * PLEDGE_COUNT);
+    int* dislikes = malloc(sizeof(int) * PLEDGE_COUNT);
+    int32_t* election_of = malloc(sizeof(int32_t) * PLEDGE_COUNT);
+    int32_t* category_of = malloc(sizeof(int32_t) * PLEDGE_COUNT);
+    Leaderboard board;
+    int board_ready = leaderboard_init(&board);
+
+    if (!likes || !dislikes || !election_of || !category_of || !board_ready) {
+        printf("메모리 할당 실패\n");
+        free(likes);
+        free(dislikes);
+        free(election_of);
+        free(category_of);
+        if (board_ready) leaderboard_free(&board);
+        return 1;
+    }
+
+    unsigned int seed = 2024;
+    for (int i = 0; i < PLEDGE_COUNT; i++) {
+        likes[i] = (int)(bench_random(&seed) % 200);
+        dislikes[i] = (int)(bench_random(&seed) % 200);
+        election_of[i] = i / (PLEDGE_COUNT / ELECTION_COUNT);
+        category_of[i] = (int32_t)(bench_random(&seed) % CATEGORY_COUNT);
+    }
+
+    double start = bench_now_sec();
+    int ok = leaderboard_rebuild(&board, likes, dislikes, PLEDGE_COUNT, election_of, ELECTION_COUNT,
+                                 category_of, CATEGORY_COUNT);
+    double rebuild_ms = (bench_now_sec() - start) * 1e3;
+    if (!ok) {
+        printf("순위표 생성 실패\n");
+        leaderboard_free(&board);
+        free(likes);
+        free(dislikes);
+        free(election_of);
+        free(category_of);
+        return 1;
+    }
+
+    // 평가 반영: 무작위 공약의 좋아요/싫어요를 하나씩 바꾸고 순위표 갱신
+    start = bench_now_sec();
+    for (int v = 0; v < VOTE_COUNT; v++) {
+        int pledge = (int)(bench_random(&seed) % PLEDGE_COUNT);
+        if (bench_random(&seed) & 1) {
+            likes[pledge]++;
+        } else {
+            dislikes[pledge]++;
+        }
+        leaderboard_update(&board, pledge, likes[pledge], dislikes[pledge]);
+    }
+    double update_ns = (bench_now_sec() - start) * 1e9 / VOTE_COUNT;
+
+    LeaderboardEntry scanned[TOP_K];
+    LeaderboardEntry heap_top[TOP_K];
+    int scanned_count = 0;
+    int heap_count = 0;
+
+    start = bench_now_sec();
+    for (int r = 0; r < QUERY_ROUNDS; r++) {
+        scanned_count = scan_top(likes, dislikes, PLEDGE_COUNT, scanned);
+    }
+    double scan_ns = (bench_now_sec() - start) * 1e9 / QUERY_ROUNDS;
+
+    start = bench_now_sec();
+    for (int r = 0; r < QUERY_ROUNDS; r++) {
+        heap_count = leaderboard_top(&board, LEADERBOARD_GLOBAL, 0, TOP_K, heap_top);
+    }
+    double heap_ns = (bench_now_sec() - start) * 1e9 / QUERY_ROUNDS;
+
+    // 선거/분야 보드도 전체 스캔 결과와 비교 (보드마다 해당 공약만 남긴 카운터로 스캔)
+    int* board_likes = calloc(PLEDGE_COUNT, sizeof(int));
+    int* board_dislikes = calloc(PLEDGE_COUNT, sizeof(int));
+    int same = heap_count == scanned_count && memcmp(heap_top, scanned, sizeof(LeaderboardEntry) * heap_count) == 0;
+    for (int b = 0; b < 5 && same && board_likes && board_dislikes; b++) {
+        int election = b * (ELECTION_COUNT / 5);
+        for (int i = 0; i < PLEDGE_COUNT; i++) {
+            int member = election_of[i] == election;
+            board_likes[i] = member ? likes[i] : 0;
+            board_dislikes[i] = member ? dislikes[i] : 0;
+        }
+        scanned_count = scan_top(board_likes, board_dislikes, PLEDGE_COUNT, scanned);
+        heap_count = leaderboard_top(&board, LEADERBOARD_ELECTION, election, TOP_K, heap_top);
+        same = heap_count == scanned_count && memcmp(heap_top, scanned, sizeof(LeaderboardEntry) * heap_count) == 0;
+
+        for (int i = 0; i < PLEDGE_COUNT; i++) {
+            int member = category_of[i] == b;
+            board_likes[i] = member ? likes[i] : 0;
+            board_dislikes[i] = member ? dislikes[i] : 0;
+        }
+        scanned_count = scan_top(board_likes, board_dislikes, PLEDGE_COUNT, scanned);
+        heap_count = leaderboard_top(&board, LEADERBOARD_CATEGORY, b, TOP_K, heap_top);
+        same = same && heap_count == scanned_count &&
+               memcmp(heap_top, scanned, sizeof(LeaderboardEntry) * heap_count) == 0;
+    }
+
+    printf("  공약 %d개, 선거 보드 %d개, 분야 보드 %d개, 상위 %d개 조회\n\n", PLEDGE_COUNT, ELECTION_COUNT,
+           CATEGORY_COUNT, TOP_K);
+    bench_print_row("전체 스캔 조회 (조회당)", PLEDGE_COUNT, scan_ns);
+    bench_print_row("순위표 조회 (조회당)", PLEDGE_COUNT, heap_ns);
+    bench_print_row("평가 반영 갱신 (평가당)", VOTE_COUNT, update_ns);
+    printf("  %-28s %.1f ms, 메모리 %.1f MB\n", "순위표 생성", rebuild_ms,
+           leaderboard_memory(&board) / (1024.0 * 1024.0));
+    printf("  %-28s 조회 속도 향상 %.0fx, 결과 %s\n\n", "비교", scan_ns / heap_ns, same ? "일치" : "불일치");
+
+    free(board_likes);
+    free(board_dislikes);
+    leaderboard_free(&board);
+    free(likes);
+    free(dislikes);
+    free(election_of);
+    free(category_of);
+    return same ? 0 : 1;
+}
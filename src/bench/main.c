@@ -0,0 +1,121 @@
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "bench.h"
+#include "utils.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #define PSAPI_VERSION 2                 // kernel32의 K32GetProcessMemoryInfo 사용 (psapi 링크 불필요)
+    #include <psapi.h>
+#else
+    #include <unistd.h>
+#endif
+
+// 벤치마크 목록
+typedef struct {
+    const char* name;
+    const char* description;
+    int (*run)(int argc, char* argv[]);
+} BenchEntry;
+
+static const BenchEntry g_benches[] = {
+    { "pledge-index", "공약 ID 조회: 선형 탐색 vs 해시 인덱스 (1k/10k/100k)", bench_pledge_index },
+    { "evaluation-store", "평가 저장소: 추가/조회/공약별 순회와 메모리 (10k/1M/3M)", bench_evaluation_store },
+    { "pledge-table", "공약 카운터 스캔: PledgeInfo 배열 vs hot 필드 배열 (100k)", bench_pledge_table },
+    { "dataset-memory", "선거/후보자/공약 적재 메모리: 고정 문자 배열 vs 문자열 인턴 (공약 100k)", bench_dataset_memory },
+    { "vote-kernels", "평가 집계 커널: 분기 스칼라 vs 스칼라/SSE4.1/AVX2 (공약 1M)", bench_vote_kernels },
+    { "leaderboard", "공약 지지율 상위 10개: 전체 스캔 vs 순위표 힙 (100k, 평가 1M건 갱신)", bench_leaderboard },
+    { "drilldown", "선거 -> 후보자 -> 공약 탐색: 전체 스캔 vs CSR 인접 목록 (1k/10k/100k)", bench_drilldown },
+    { "vote-contention", "동시 평가 64개 클라이언트: 전역 뮤텍스 vs 샤드 읽기/쓰기 잠금", bench_vote_contention },
+    { "api-fetch", "공약 API 수집 20건: 하나씩 + 0.3초 대기 vs 동시 요청 + 토큰 버킷 (모의 서버)", bench_api_fetch },
+    { "xml-parse", "API 응답 파싱 MB/s: 필드별 strstr vs 스트리밍 토크나이저 (공약/후보자 응답)", bench_xml_parse },
+    { "delim-scan", "구분자 스캔/공약 줄 파싱: 바이트 단위 vs SSE2/AVX2 (합성 공약 파일 100MB)", bench_delim_scan },
+};
+
+#define BENCH_COUNT ((int)(sizeof(g_benches) / sizeof(g_benches[0])))
+
+double bench_now_sec(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+#endif
+}
+
+unsigned int bench_random(unsigned int* state) {
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+void bench_print_row(const char* label, size_t n, double ns_per_op) {
+    printf("  %-28s n=%-9zu %12.1f ns/op\n", label, n, ns_per_op);
+}
+
+size_t bench_resident_bytes(void) {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+    return counters.WorkingSetSize;
+#else
+    // /proc/self/statm 두 번째 값: 상주 페이지 수
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (!file) return 0;
+
+    unsigned long size = 0, resident = 0;
+    int ok = fscanf(file, "%lu %lu", &size, &resident) == 2;
+    fclose(file);
+    return ok ? (size_t)resident * (size_t)sysconf(_SC_PAGESIZE) : 0;
+#endif
+}
+
+static void print_usage(const char* program) {
+    printf("사용법: %s <벤치마크> [옵션]\n\n", program);
+    printf("벤치마크 목록:\n");
+    for (int i = 0; i < BENCH_COUNT; i++) {
+        printf("  %-16s %s\n", g_benches[i].name, g_benches[i].description);
+    }
+    printf("  %-16s 모든 벤치마크 실행\n", "all");
+}
+
+int main(int argc, char* argv[]) {
+    init_korean_console();
+
+    if (argc < 2) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    int run_all = strcmp(argv[1], "all") == 0;
+    int found = 0;
+
+    for (int i = 0; i < BENCH_COUNT; i++) {
+        if (run_all || strcmp(argv[1], g_benches[i].name) == 0) {
+            print_header(g_benches[i].description);
+            if (g_benches[i].run(argc - 2, argv + 2) != 0) {
+                return 1;
+            }
+            found = 1;
+        }
+    }
+
+    if (!found) {
+        printf("알 수 없는 벤치마크: %s\n\n", argv[1]);
+        print_usage(argv[0]);
+        return 1;
+    }
+    return 0;
+}
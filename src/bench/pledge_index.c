@@ -0,0 +1,120 @@
+#include "bench.h"
+#include "structures.h"
+#include "hash_index.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+
+#define LOOKUP_COUNT 20000
+
+// 기존 서버 방식: 공약 배열 전체를 strcmp로 선형 탐색
+static int linear_find(const PledgeInfo* pledges, int count, const char* pledge_id) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(pledges[i].pledge_id, pledge_id) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// 실제 데이터와 같은 형식의 공약 생성 ("후보자ID_번호")
+static void fill_pledges(PledgeInfo* pledges, int count) {
+    for (int i = 0; i < count; i++) {
+        memset(&pledges[i], 0, sizeof(PledgeInfo));
+        snprintf(pledges[i].candidate_id, sizeof(pledges[i].candidate_id), "1001%05d", i / 10);
+        snprintf(pledges[i].pledge_id, sizeof(pledges[i].pledge_id), "%s_%d",
+                 pledges[i].candidate_id, i % 10 + 1);
+        snprintf(pledges[i].title, sizeof(pledges[i].title), "공약 %d", i);
+    }
+}
+
+static int run_size(PledgeInfo* pledges, int count) {
+    unsigned int seed = 12345;
+    int* targets = malloc(sizeof(int) * LOOKUP_COUNT);
+    if (!targets) return 0;
+
+    for (int i = 0; i < LOOKUP_COUNT; i++) {
+        targets[i] = (int)(bench_random(&seed) % (unsigned int)count);
+    }
+
+    // 선형 탐색은 느리므로 조회 횟수를 줄여서 측정
+    int linear_lookups = count >= 100000 ? 500 : (count >= 10000 ? 2000 : LOOKUP_COUNT);
+    long checksum = 0;
+
+    double start = bench_now_sec();
+    for (int i = 0; i < linear_lookups; i++) {
+        checksum += linear_find(pledges, count, pledges[targets[i]].pledge_id);
+    }
+    double linear_ns = (bench_now_sec() - start) * 1e9 / linear_lookups;
+
+    HashIndex index;
+    start = bench_now_sec();
+    if (!hash_index_init(&index, pledges, sizeof(PledgeInfo), offsetof(PledgeInfo, pledge_id), (size_t)count) ||
+        !hash_index_rebuild(&index, count)) {
+        free(targets);
+        return 0;
+    }
+    double build_ms = (bench_now_sec() - start) * 1e3;
+
+    // 조회 키는 배열과 떨어진 곳에 복사해 둬서 키 자체가 캐시에 남지 않게 함
+    char (*keys)[MAX_STRING_LEN] = malloc((size_t)LOOKUP_COUNT * MAX_STRING_LEN);
+    if (!keys) {
+        hash_index_free(&index);
+        free(targets);
+        return 0;
+    }
+    for (int i = 0; i < LOOKUP_COUNT; i++) {
+        strcpy(keys[i], pledges[targets[i]].pledge_id);
+    }
+
+    start = bench_now_sec();
+    for (int i = 0; i < LOOKUP_COUNT; i++) {
+        checksum += hash_index_find(&index, keys[i]);
+    }
+    double hash_ns = (bench_now_sec() - start) * 1e9 / LOOKUP_COUNT;
+
+    start = bench_now_sec();
+    for (int i = 0; i < LOOKUP_COUNT; i++) {
+        keys[i][0] = 'x';  // 존재하지 않는 키
+        checksum += hash_index_find(&index, keys[i]);
+    }
+    double miss_ns = (bench_now_sec() - start) * 1e9 / LOOKUP_COUNT;
+
+    bench_print_row("선형 탐색 (기존)", (size_t)count, linear_ns);
+    bench_print_row("해시 인덱스 (적중)", (size_t)count, hash_ns);
+    bench_print_row("해시 인덱스 (없음)", (size_t)count, miss_ns);
+    printf("  %-28s %.2f ms, 테이블 %zu칸, 속도 향상 %.0fx (checksum %ld)\n\n",
+           "인덱스 생성", build_ms, index.capacity, linear_ns / hash_ns, checksum);
+
+    free(keys);
+    hash_index_free(&index);
+    free(targets);
+    return 1;
+}
+
+int bench_pledge_index(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+
+    static const int sizes[] = { 1000, 10000, 100000 };
+    int max_size = sizes[2];
+
+    PledgeInfo* pledges = malloc(sizeof(PledgeInfo) * (size_t)max_size);
+    if (!pledges) {
+        printf("메모리 할당 실패\n");
+        return 1;
+    }
+
+    for (int s = 0; s < 3; s++) {
+        fill_pledges(pledges, sizes[s]);
+        if (!run_size(pledges, sizes[s])) {
+            printf("벤치마크 실행 실패\n");
+            free(pledges);
+            return 1;
+        }
+    }
+
+    free(pledges);
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include "bench.h"
+#include "structures.h"
+#include "dataset.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PLEDGE_COUNT 100000
+#define SCAN_ROUNDS 20
+
+// 카운터 스캔 결과 (두 배치 방식이 같은 값을 내는지 확인용)
+typedef struct {
+    long likes;
+    long dislikes;
+    int approved;                           // 지지율 50% 이상 공약 수
+    int candidate_pledges;                  // 지정한 후보자의 공약 수
+} ScanResult;
+
+// 기존 배치: PledgeInfo 배열 (공약마다 약 3KB 간격으로 카운터를 읽음)
+static void scan_info(const PledgeInfo* pledges, int count, const char* candidate_id, ScanResult* result) {
+    memset(result, 0, sizeof(ScanResult));
+    for (int i = 0; i < count; i++) {
+        int like_count = pledges[i].like_count;
+        int dislike_count = pledges[i].dislike_count;
+        result->likes += like_count;
+        result->dislikes += dislike_count;
+        result->approved += (like_count + dislike_count > 0 && like_count * 2 >= like_count + dislike_count);
+        result->candidate_pledges += (strcmp(pledges[i].candidate_id, candidate_id) == 0);
+    }
+}
+
+// hot 필드 배열: 카운터/후보자 핸들을 연속으로 읽음 (분기 없는 반복문이라 벡터화 가능)
+static void scan_table(const PledgeTable* pledges, StringHandle candidate, ScanResult* result) {
+    const int* likes = pledges->likes;
+    const int* dislikes = pledges->dislikes;
+    const StringHandle* candidates = pledges->candidates;
+    long like_sum = 0;
+    long dislike_sum = 0;
+    int approved = 0;
+    int candidate_pledges = 0;
+
+    for (int i = 0; i < pledges->count; i++) {
+        int total = likes[i] + dislikes[i];
+        like_sum += likes[i];
+        dislike_sum += dislikes[i];
+        approved += (total > 0) & (likes[i] * 2 >= total);
+        candidate_pledges += (candidates[i] == candidate);
+    }
+
+    result->likes = like_sum;
+    result->dislikes = dislike_sum;
+    result->approved = approved;
+    result->candidate_pledges = candidate_pledges;
+}
+
+static void make_pledge(int i, unsigned int* seed, PledgeInfo* pledge) {
+    memset(pledge, 0, sizeof(PledgeInfo));
+    snprintf(pledge->candidate_id, sizeof(pledge->candidate_id), "1001%05d", i / 10);
+    snprintf(pledge->pledge_id, sizeof(pledge->pledge_id), "1001%05d_%d", i / 10, i % 10 + 1);
+    snprintf(pledge->title, sizeof(pledge->title), "공약 %d", i);
+    snprintf(pledge->category, sizeof(pledge->category), "분야%u", bench_random(seed) % 12);
+    pledge->like_count = (int)(bench_random(seed) % 100);
+    pledge->dislike_count = (int)(bench_random(seed) % 100);
+}
+
+int bench_pledge_table(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+
+    PledgeInfo* infos = malloc(sizeof(PledgeInfo) * PLEDGE_COUNT);
+    StringIntern strings;
+    PledgeTable table;
+    pledge_table_init(&table);
+    if (!infos || !string_intern_init(&strings)) {
+        free(infos);
+        printf("메모리 할당 실패\n");
+        return 1;
+    }
+
+    unsigned int seed = 99;
+    int ok = 1;
+    for (int i = 0; i < PLEDGE_COUNT && ok; i++) {
+        make_pledge(i, &seed, &infos[i]);
+        ok = pledge_table_append(&table, &infos[i], &strings);
+    }
+    if (!ok) {
+        printf("벤치마크 실행 실패\n");
+        pledge_table_free(&table);
+        string_intern_free(&strings);
+        free(infos);
+        return 1;
+    }
+
+    const char* candidate_id = infos[PLEDGE_COUNT / 2].candidate_id;
+    StringHandle candidate = string_intern_find(&strings, candidate_id);
+    ScanResult info_result, table_result;
+
+    double start = bench_now_sec();
+    for (int r = 0; r < SCAN_ROUNDS; r++) {
+        scan_info(infos, PLEDGE_COUNT, candidate_id, &info_result);
+    }
+    double info_ns = (bench_now_sec() - start) * 1e9 / ((double)SCAN_ROUNDS * PLEDGE_COUNT);
+
+    start = bench_now_sec();
+    for (int r = 0; r < SCAN_ROUNDS; r++) {
+        scan_table(&table, candidate, &table_result);
+    }
+    double table_ns = (bench_now_sec() - start) * 1e9 / ((double)SCAN_ROUNDS * PLEDGE_COUNT);
+
+    size_t hot_bytes = (size_t)table.count * (2 * sizeof(StringHandle) + sizeof(uint16_t) + 2 * sizeof(int));
+
+    bench_print_row("PledgeInfo 배열 (공약당)", PLEDGE_COUNT, info_ns);
+    bench_print_row("hot 필드 배열 (공약당)", PLEDGE_COUNT, table_ns);
+    printf("  %-28s %.1f MB -> %.1f MB, 속도 향상 %.1fx\n", "스캔 대상 메모리",
+           (double)sizeof(PledgeInfo) * PLEDGE_COUNT / (1024.0 * 1024.0), hot_bytes / (1024.0 * 1024.0),
+           info_ns / table_ns);
+    printf("  %-28s 좋아요 %ld, 싫어요 %ld, 지지 과반 %d, 후보자 공약 %d (%s)\n\n", "결과",
+           table_result.likes, table_result.dislikes, table_result.approved, table_result.candidate_pledges,
+           memcmp(&info_result, &table_result, sizeof(ScanResult)) == 0 ? "일치" : "불일치");
+
+    pledge_table_free(&table);
+    string_intern_free(&strings);
+    free(infos);
+    return 0;
+}
@@ -0,0 +1,361 @@
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "bench.h"
+#include "evaluation_shards.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+#define CLIENT_COUNT 64
+#define OPS_PER_CLIENT 20000
+#define PLEDGE_COUNT 10000
+#define USERS_PER_CLIENT 50
+#define REFRESH_ROUNDS 3
+#define REFRESH_NETWORK_MS 100              // 새로고침 한 번의 API 호출 시간 (흉내)
+
+typedef enum {
+    LOCKING_GLOBAL_MUTEX,                   // 예전 방식: 저장소 하나 + 전역 뮤텍스
+    LOCKING_SHARDED                         // 공약 해시로 나눈 샤드 + 샤드별 읽기/쓰기 잠금
+} LockingMode;
+
+typedef struct {
+    LockingMode mode;
+    int read_percent;                       // 요청 중 평가 조회 비율 (나머지는 평가 추가/변경)
+    EvaluationShards* shards;
+    EvaluationStore* store;                 // 전역 뮤텍스 방식의 저장소
+#ifdef _WIN32
+    CRITICAL_SECTION* mutex;
+#else
+    pthread_mutex_t* mutex;
+#endif
+    char (*pledge_ids)[32];
+    int* likes;                             // 공약 카운터 (서버와 같이 원자적으로 더함)
+    int refresh;                            // 1이면 클라이언트와 함께 새로고침 스레드 실행
+} ContentionShared;
+
+typedef struct {
+    ContentionShared* shared;
+    int client;
+    long long reads;
+    long long writes;
+    double max_wait_ms;                     // 요청 하나의 최대 지연 (잠금 대기 포함)
+} ContentionClient;
+
+static void global_lock(ContentionShared* shared) {
+#ifdef _WIN32
+    EnterCriticalSection(shared->mutex);
+#else
+    pthread_mutex_lock(shared->mutex);
+#endif
+}
+
+static void global_unlock(ContentionShared* shared) {
+#ifdef _WIN32
+    LeaveCriticalSection(shared->mutex);
+#else
+    pthread_mutex_unlock(shared->mutex);
+#endif
+}
+
+// 서버의 update_evaluation/get_user_evaluation과 같은 순서로 잠금 -> 저장소 -> 카운터
+static void run_client(ContentionClient* client) {
+    ContentionShared* shared = client->shared;
+    unsigned int seed = 0x9e3779b9u ^ (unsigned int)(client->client * 7919 + 1);
+    char user_id[32];
+
+    for (int op = 0; op < OPS_PER_CLIENT; op++) {
+        int user = (int)(bench_random(&seed) % USERS_PER_CLIENT);
+        int pledge = (int)(bench_random(&seed) % PLEDGE_COUNT);
+        int is_read = (int)(bench_random(&seed) % 100) < shared->read_percent;
+        int type = (bench_random(&seed) & 1) ? 1 : -1;
+        const char* pledge_id = shared->pledge_ids[pledge];
+        snprintf(user_id, sizeof(user_id), "user%02d_%03d", client->client, user);
+
+        double start = bench_now_sec();
+        EvaluationStore* store = shared->store;
+        EvaluationShard* shard = NULL;
+        if (shared->mode == LOCKING_SHARDED) {
+            shard = evaluation_shards_for(shared->shards, pledge_id);
+            store = &shard->store;
+            if (is_read) {
+                rw_lock_read_lock(&shard->lock);
+            } else {
+                rw_lock_write_lock(&shard->lock);
+            }
+        } else {
+            global_lock(shared);
+        }
+
+        if (is_read) {
+            client->reads += evaluation_store_get(store, user_id, pledge_id) != NULL;
+        } else {
+            int old_type = 0;
+            if (evaluation_store_upsert(store, user_id, pledge_id, type, 0, &old_type)) {
+                int delta = (type == 1) - (old_type == 1);
+                if (delta) __atomic_add_fetch(&shared->likes[pledge], delta, __ATOMIC_RELAXED);
+                client->writes++;
+            }
+        }
+
+        if (shard) {
+            if (is_read) {
+                rw_lock_read_unlock(&shard->lock);
+            } else {
+                rw_lock_write_unlock(&shard->lock);
+            }
+        } else {
+            global_unlock(shared);
+        }
+
+        double wait_ms = (bench_now_sec() - start) * 1e3;
+        if (wait_ms > client->max_wait_ms) client->max_wait_ms = wait_ms;
+    }
+}
+
+static void pause_ms(int ms) {
+#ifdef _WIN32
+    Sleep(ms);
+#else
+    struct timespec ts = { ms / 1000, (long)(ms % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+#endif
+}
+
+// 새로고침 흉내: API 호출(대기) 후 데이터 다시 로드
+// 전역 뮤텍스 방식은 예전 collect_api_data처럼 API 호출 내내 잠금을 잡고,
+// 샤드 방식은 서버의 refresh_dataset처럼 새 데이터 버전을 게시하는 순간에만 모든 샤드를 잠금
+static void run_refresh(ContentionShared* shared) {
+    for (int round = 0; round < REFRESH_ROUNDS; round++) {
+        if (shared->mode == LOCKING_SHARDED) {
+            pause_ms(REFRESH_NETWORK_MS);
+            evaluation_shards_lock_all(shared->shards);
+            evaluation_shards_unlock_all(shared->shards);
+        } else {
+            global_lock(shared);
+            pause_ms(REFRESH_NETWORK_MS);
+            global_unlock(shared);
+        }
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI client_thread(LPVOID param) {
+    run_client((ContentionClient*)param);
+    return 0;
+}
+
+static DWORD WINAPI refresh_thread(LPVOID param) {
+    run_refresh((ContentionShared*)param);
+    return 0;
+}
+#else
+static void* client_thread(void* param) {
+    run_client((ContentionClient*)param);
+    return NULL;
+}
+
+static void* refresh_thread(void* param) {
+    run_refresh((ContentionShared*)param);
+    return NULL;
+}
+#endif
+
+typedef struct {
+    long long reads;
+    long long writes;
+    double ops_per_sec;
+    double max_wait_ms;
+} ContentionResult;
+
+// 64개 클라이언트 스레드를 동시에 돌리고 처리량과 최대 지연을 구함 (스레드 생성 실패 시 0)
+static int run_clients(ContentionShared* shared, ContentionResult* result) {
+    ContentionClient clients[CLIENT_COUNT];
+#ifdef _WIN32
+    HANDLE threads[CLIENT_COUNT];
+    HANDLE refresher = NULL;
+#else
+    pthread_t threads[CLIENT_COUNT];
+    pthread_t refresher;
+#endif
+    int started = 0;
+    int refreshing = 0;
+
+    memset(result, 0, sizeof(ContentionResult));
+    if (shared->refresh) {
+#ifdef _WIN32
+        refresher = CreateThread(NULL, 0, refresh_thread, shared, 0, NULL);
+        refreshing = refresher != NULL;
+#else
+        refreshing = pthread_create(&refresher, NULL, refresh_thread, shared) == 0;
+#endif
+        if (!refreshing) return 0;
+        pause_ms(10);                       // 새로고침이 먼저 시작되게 함
+    }
+
+    double start = bench_now_sec();
+    for (int i = 0; i < CLIENT_COUNT; i++) {
+        clients[i].shared = shared;
+        clients[i].client = i;
+        clients[i].reads = 0;
+        clients[i].writes = 0;
+        clients[i].max_wait_ms = 0.0;
+#ifdef _WIN32
+        threads[i] = CreateThread(NULL, 0, client_thread, &clients[i], 0, NULL);
+        if (!threads[i]) break;
+#else
+        if (pthread_create(&threads[i], NULL, client_thread, &clients[i]) != 0) break;
+#endif
+        started++;
+    }
+    for (int i = 0; i < started; i++) {
+#ifdef _WIN32
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+#else
+        pthread_join(threads[i], NULL);
+#endif
+    }
+    double elapsed = bench_now_sec() - start;
+    if (refreshing) {
+#ifdef _WIN32
+        WaitForSingleObject(refresher, INFINITE);
+        CloseHandle(refresher);
+#else
+        pthread_join(refresher, NULL);
+#endif
+    }
+    if (started < CLIENT_COUNT) return 0;
+
+    for (int i = 0; i < CLIENT_COUNT; i++) {
+        result->reads += clients[i].reads;
+        result->writes += clients[i].writes;
+        if (clients[i].max_wait_ms > result->max_wait_ms) result->max_wait_ms = clients[i].max_wait_ms;
+    }
+    result->ops_per_sec = (double)CLIENT_COUNT * OPS_PER_CLIENT / elapsed;
+    return 1;
+}
+
+// 카운터 합계 (두 방식의 결과 비교용)
+static long long sum_likes(const int* likes) {
+    long long sum = 0;
+    for (int i = 0; i < PLEDGE_COUNT; i++) sum += likes[i];
+    return sum;
+}
+
+static int run_workload(const char* title, int read_percent, int refresh, char (*pledge_ids)[32], int* likes) {
+    ContentionShared shared;
+    memset(&shared, 0, sizeof(shared));
+    shared.read_percent = read_percent;
+    shared.refresh = refresh;
+    shared.pledge_ids = pledge_ids;
+    shared.likes = likes;
+
+    // 1. 전역 뮤텍스
+    StringIntern strings;
+    EvaluationStore store;
+#ifdef _WIN32
+    CRITICAL_SECTION mutex;
+    InitializeCriticalSection(&mutex);
+#else
+    pthread_mutex_t mutex;
+    pthread_mutex_init(&mutex, NULL);
+#endif
+    if (!string_intern_init(&strings) || !evaluation_store_init(&store, &strings)) {
+        string_intern_free(&strings);
+#ifdef _WIN32
+        DeleteCriticalSection(&mutex);
+#else
+        pthread_mutex_destroy(&mutex);
+#endif
+        return 0;
+    }
+    shared.mode = LOCKING_GLOBAL_MUTEX;
+    shared.store = &store;
+    shared.mutex = &mutex;
+
+    memset(likes, 0, sizeof(int) * PLEDGE_COUNT);
+    ContentionResult global;
+    int ok = run_clients(&shared, &global);
+    int global_count = store.count;
+    long long global_likes = sum_likes(likes);
+
+    evaluation_store_free(&store);
+    string_intern_free(&strings);
+#ifdef _WIN32
+    DeleteCriticalSection(&mutex);
+#else
+    pthread_mutex_destroy(&mutex);
+#endif
+
+    // 2. 샤드별 읽기/쓰기 잠금
+    EvaluationShards* shards = malloc(sizeof(EvaluationShards));
+    if (!shards || !evaluation_shards_init(shards)) {
+        free(shards);
+        return 0;
+    }
+    shared.mode = LOCKING_SHARDED;
+    shared.shards = shards;
+    shared.store = NULL;
+    shared.mutex = NULL;
+
+    memset(likes, 0, sizeof(int) * PLEDGE_COUNT);
+    ContentionResult sharded;
+    ok = run_clients(&shared, &sharded) && ok;
+    int shard_count = evaluation_shards_count(shards);
+    long long shard_likes = sum_likes(likes);
+
+    evaluation_shards_free(shards);
+    free(shards);
+
+    if (!ok) return 0;
+
+    // 클라이언트마다 난수 순서가 같고 사용자가 겹치지 않으므로 최종 상태가 같아야 함
+    int same = global_count == shard_count && global_likes == shard_likes &&
+               global.reads == sharded.reads && global.writes == sharded.writes;
+
+    printf("  %s (클라이언트 %d개 x 요청 %d개, 공약 %d개)\n", title, CLIENT_COUNT, OPS_PER_CLIENT, PLEDGE_COUNT);
+    printf("  %-28s %12.0f ops/s, 최대 지연 %8.2f ms\n", "전역 뮤텍스", global.ops_per_sec, global.max_wait_ms);
+    printf("  %-28s %12.0f ops/s, 최대 지연 %8.2f ms  (처리량 %.1fx)\n", "샤드 읽기/쓰기 잠금",
+           sharded.ops_per_sec, sharded.max_wait_ms, sharded.ops_per_sec / global.ops_per_sec);
+    printf("  %-28s 평가 %d개, 좋아요 합계 %lld, 결과 %s\n\n", "최종 상태", shard_count, shard_likes,
+           same ? "일치" : "불일치");
+    return same;
+}
+
+int bench_vote_contention(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+
+    char (*pledge_ids)[32] = malloc(sizeof(*pledge_ids) * PLEDGE_COUNT);
+    int* likes = malloc(sizeof(int) * PLEDGE_COUNT);
+    if (!pledge_ids || !likes) {
+        printf("메모리 할당 실패\n");
+        free(pledge_ids);
+        free(likes);
+        return 1;
+    }
+    for (int i = 0; i < PLEDGE_COUNT; i++) {
+        snprintf(pledge_ids[i], sizeof(pledge_ids[i]), "1001%05d_%d", i / 10, i);
+    }
+
+    int status = 0;
+    if (!run_workload("평가 추가/변경만", 0, 0, pledge_ids, likes) ||
+        !run_workload("조회 90% + 추가/변경 10%", 90, 0, pledge_ids, likes) ||
+        !run_workload("새로고침 중 조회 90% + 추가/변경 10%", 90, 1, pledge_ids, likes)) {
+        printf("벤치마크 실행 실패\n");
+        status = 1;
+    }
+
+    free(pledge_ids);
+    free(likes);
+    return status;
+}
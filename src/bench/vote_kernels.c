@@ -0,0 +1,221 @@
+#include "bench.h"
+#include "vote_kernels.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PLEDGE_COUNT 1000000
+#define ELECTION_COUNT 200
+#define KERNEL_ROUNDS 20
+#define FILTER_MIN_RATE 50.0f
+#define FILTER_MIN_VOTES 10
+
+// 한 번의 측정 결과 (구현끼리 같은 값을 내는지 확인용)
+typedef struct {
+    VoteTotals election;                    // 지정한 선거의 합계
+    VoteTotals all;                         // 전체 합계
+    int passed;                             // 필터 통과 공약 수
+} KernelResult;
+
+typedef struct {
+    double election_ns;
+    double all_ns;
+    double rates_ns;
+    double filter_ns;
+} KernelTiming;
+
+// 기존 방식: 공약마다 분기하는 스칼라 반복문 (클라이언트 통계 화면의 반복문과 같은 형태)
+static void baseline_election(const int32_t* keys, int32_t key, const int* likes, const int* dislikes, int count,
+                              VoteTotals* totals) {
+    totals->likes = 0;
+    totals->dislikes = 0;
+    for (int i = 0; i < count; i++) {
+        if (keys[i] == key) {
+            totals->likes += likes[i];
+            totals->dislikes += dislikes[i];
+        }
+    }
+}
+
+static void baseline_rates(const int* likes, const int* dislikes, int count, float* rates) {
+    for (int i = 0; i < count; i++) {
+        int total_votes = likes[i] + dislikes[i];
+        if (total_votes > 0) {
+            rates[i] = (float)likes[i] * 100.0f / (float)total_votes;
+        } else {
+            rates[i] = 0.0f;
+        }
+    }
+}
+
+static int baseline_filter(const int* likes, const int* dislikes, int count, int32_t* indices) {
+    int found = 0;
+    for (int i = 0; i < count; i++) {
+        int total_votes = likes[i] + dislikes[i];
+        if (total_votes >= FILTER_MIN_VOTES) {
+            float approval_rate = (float)likes[i] * 100.0f / (float)total_votes;
+            if (approval_rate >= FILTER_MIN_RATE) {
+                indices[found++] = i;
+            }
+        }
+    }
+    return found;
+}
+
+// 반복 측정 결과를 버리지 않게 누적 (컴파일러가 반복문을 지우지 못하게 함)
+static volatile long long g_sink;
+
+static double per_pledge_ns(double start) {
+    return (bench_now_sec() - start) * 1e9 / ((double)KERNEL_ROUNDS * PLEDGE_COUNT);
+}
+
+static void run_baseline(const int32_t* keys, const int* likes, const int* dislikes, float* rates, int32_t* indices,
+                         KernelResult* result, KernelTiming* timing) {
+    double start = bench_now_sec();
+    for (int r = 0; r < KERNEL_ROUNDS; r++) {
+        baseline_election(keys, r % ELECTION_COUNT, likes, dislikes, PLEDGE_COUNT, &result->election);
+        g_sink += result->election.likes;
+    }
+    timing->election_ns = per_pledge_ns(start);
+    baseline_election(keys, ELECTION_COUNT / 2, likes, dislikes, PLEDGE_COUNT, &result->election);
+
+    // 전체 합계 = 키 조건 없는 같은 반복문
+    start = bench_now_sec();
+    for (int r = 0; r < KERNEL_ROUNDS; r++) {
+        result->all.likes = 0;
+        result->all.dislikes = 0;
+        for (int i = 0; i < PLEDGE_COUNT; i++) {
+            result->all.likes += likes[i];
+            result->all.dislikes += dislikes[i];
+        }
+    }
+    timing->all_ns = per_pledge_ns(start);
+
+    start = bench_now_sec();
+    for (int r = 0; r < KERNEL_ROUNDS; r++) {
+        baseline_rates(likes, dislikes, PLEDGE_COUNT, rates);
+    }
+    timing->rates_ns = per_pledge_ns(start);
+
+    start = bench_now_sec();
+    for (int r = 0; r < KERNEL_ROUNDS; r++) {
+        result->passed = baseline_filter(likes, dislikes, PLEDGE_COUNT, indices);
+    }
+    timing->filter_ns = per_pledge_ns(start);
+}
+
+static void run_kernels(const int32_t* keys, const int* likes, const int* dislikes, float* rates, int32_t* indices,
+                        KernelResult* result, KernelTiming* timing) {
+    double start = bench_now_sec();
+    for (int r = 0; r < KERNEL_ROUNDS; r++) {
+        vote_sum_matching(keys, r % ELECTION_COUNT, likes, dislikes, PLEDGE_COUNT, &result->election);
+        g_sink += result->election.likes;
+    }
+    timing->election_ns = per_pledge_ns(start);
+    vote_sum_matching(keys, ELECTION_COUNT / 2, likes, dislikes, PLEDGE_COUNT, &result->election);
+
+    start = bench_now_sec();
+    for (int r = 0; r < KERNEL_ROUNDS; r++) {
+        vote_sum(likes, dislikes, PLEDGE_COUNT, &result->all);
+    }
+    timing->all_ns = per_pledge_ns(start);
+
+    start = bench_now_sec();
+    for (int r = 0; r < KERNEL_ROUNDS; r++) {
+        vote_approval_rates(likes, dislikes, PLEDGE_COUNT, rates);
+    }
+    timing->rates_ns = per_pledge_ns(start);
+
+    start = bench_now_sec();
+    for (int r = 0; r < KERNEL_ROUNDS; r++) {
+        result->passed = vote_filter(likes, dislikes, PLEDGE_COUNT, FILTER_MIN_RATE, FILTER_MIN_VOTES, indices);
+    }
+    timing->filter_ns = per_pledge_ns(start);
+}
+
+static void print_timing(const char* name, const KernelTiming* timing, const KernelTiming* baseline) {
+    printf("  %-10s 선거 합계 %5.2f  전체 합계 %5.2f  지지율 %5.2f  필터 %5.2f ns/공약",
+           name, timing->election_ns, timing->all_ns, timing->rates_ns, timing->filter_ns);
+    if (baseline) {
+        printf("  (%.1fx / %.1fx / %.1fx / %.1fx)",
+               baseline->election_ns / timing->election_ns, baseline->all_ns / timing->all_ns,
+               baseline->rates_ns / timing->rates_ns, baseline->filter_ns / timing->filter_ns);
+    }
+    printf("\n");
+}
+
+int bench_vote_kernels(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+
+    int32_t* keys = malloc(sizeof(int32_t) * PLEDGE_COUNT);
+    int* likes = malloc(sizeof(int) * PLEDGE_COUNT);
+    int* dislikes = malloc(sizeof(int) * PLEDGE_COUNT);
+    float* baseline_rate_values = malloc(sizeof(float) * PLEDGE_COUNT);
+    float* rates = malloc(sizeof(float) * PLEDGE_COUNT);
+    int32_t* baseline_indices = malloc(sizeof(int32_t) * PLEDGE_COUNT);
+    int32_t* indices = malloc(sizeof(int32_t) * PLEDGE_COUNT);
+    int status = 0;
+
+    if (!keys || !likes || !dislikes || !baseline_rate_values || !rates || !baseline_indices || !indices) {
+        printf("메모리 할당 실패\n");
+        status = 1;
+        goto cleanup;
+    }
+
+    // 선거 200개에 공약 100만 개를 고르게 나누고, 평가가 없는 공약도 섞음
+    unsigned int seed = 7;
+    for (int i = 0; i < PLEDGE_COUNT; i++) {
+        keys[i] = (int32_t)(bench_random(&seed) % ELECTION_COUNT);
+        int unrated = bench_random(&seed) % 8 == 0;
+        likes[i] = unrated ? 0 : (int)(bench_random(&seed) % 1000);
+        dislikes[i] = unrated ? 0 : (int)(bench_random(&seed) % 1000);
+    }
+
+    KernelResult baseline_result;
+    KernelTiming baseline_timing;
+    run_baseline(keys, likes, dislikes, baseline_rate_values, baseline_indices, &baseline_result, &baseline_timing);
+    printf("  공약 %d개, 선거 %d개, 필터: 지지율 %.0f%% 이상 & %d표 이상\n\n",
+           PLEDGE_COUNT, ELECTION_COUNT, FILTER_MIN_RATE, FILTER_MIN_VOTES);
+    print_timing("기존 반복문", &baseline_timing, NULL);
+
+    static const VoteKernelLevel levels[] = { VOTE_KERNEL_SCALAR, VOTE_KERNEL_SSE41, VOTE_KERNEL_AVX2 };
+    VoteKernelLevel detected = vote_kernels_detect();
+
+    for (int l = 0; l < (int)(sizeof(levels) / sizeof(levels[0])); l++) {
+        if (!vote_kernels_select(levels[l])) {
+            printf("  %-10s (이 CPU에서 지원하지 않음)\n", l == 1 ? "sse4.1" : "avx2");
+            continue;
+        }
+
+        KernelResult result;
+        KernelTiming timing;
+        run_kernels(keys, likes, dislikes, rates, indices, &result, &timing);
+        print_timing(vote_kernels_name(), &timing, &baseline_timing);
+
+        int same = memcmp(&result.election, &baseline_result.election, sizeof(VoteTotals)) == 0 &&
+                   memcmp(&result.all, &baseline_result.all, sizeof(VoteTotals)) == 0 &&
+                   result.passed == baseline_result.passed &&
+                   memcmp(rates, baseline_rate_values, sizeof(float) * PLEDGE_COUNT) == 0 &&
+                   memcmp(indices, baseline_indices, sizeof(int32_t) * (size_t)result.passed) == 0;
+        if (!same) {
+            printf("  ❌ %s 결과가 기존 반복문과 다릅니다\n", vote_kernels_name());
+            status = 1;
+        }
+    }
+
+    vote_kernels_select(detected);
+    printf("\n  %-28s %s (결과 %s)\n", "자동 선택 구현", vote_kernels_name(), status == 0 ? "모두 일치" : "불일치");
+    printf("  %-28s 좋아요 %lld, 싫어요 %lld, 필터 통과 %d개\n\n", "결과",
+           baseline_result.all.likes, baseline_result.all.dislikes, baseline_result.passed);
+
+cleanup:
+    free(keys);
+    free(likes);
+    free(dislikes);
+    free(baseline_rate_values);
+    free(rates);
+    free(baseline_indices);
+    free(indices);
+    return status;
+}
@@ -0,0 +1,383 @@
+#include "bench.h"
+#include "api.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PLEDGE_RESPONSES 64
+#define CANDIDATE_RESPONSES 8
+#define CANDIDATES_PER_RESPONSE API_PAGE_ROWS
+#define CHUNK_SIZE 1460                     // TCP 세그먼트 하나 크기로 잘라 넣기 (본문이 도착하는 대로 파싱)
+#define TARGET_BYTES (64u * 1024u * 1024u)  // 방식마다 이만큼 파싱한 시간으로 MB/s 계산
+
+typedef struct {
+    char* data;
+    size_t length;
+    size_t capacity;
+} TextBuffer;
+
+// 버퍼 끝에 형식 문자열 추가 (모자라면 늘림)
+static void buffer_printf(TextBuffer* buffer, const char* format, ...) {
+    for (;;) {
+        va_list args;
+        va_start(args, format);
+        size_t room = buffer->capacity - buffer->length;
+        int written = vsnprintf(buffer->data + buffer->length, room, format, args);
+        va_end(args);
+
+        if (written >= 0 && (size_t)written < room) {
+            buffer->length += (size_t)written;
+            return;
+        }
+        buffer->capacity = buffer->capacity * 2 + (size_t)written;
+        buffer->data = realloc(buffer->data, buffer->capacity);
+    }
+}
+
+static const char* RESPONSE_HEAD =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+    "<response><header><resultCode>INFO-00</resultCode><resultMsg>NORMAL SERVICE</resultMsg></header>"
+    "<body><items>";
+
+// 공공데이터 공약 API 응답과 같은 형식 (후보자 한 명, 공약 10개, 공약 내용은 여러 줄)
+static char* make_pledge_response(int index, size_t* length) {
+    TextBuffer buffer = { malloc(16384), 0, 16384 };
+
+    buffer_printf(&buffer, "%s<item><num>1</num><sgId>20220309</sgId><sgTypecode>1</sgTypecode>", RESPONSE_HEAD);
+    buffer_printf(&buffer, "<cnddtId>10001%04d</cnddtId><sggName>대한민국</sggName><sidoName>전국</sidoName>"
+                  "<wiwName></wiwName><partyName>정당%d</partyName><krName>후보%d</krName><cnName>候補</cnName>"
+                  "<prmsCnt>10</prmsCnt>", index, index % 7, index);
+
+    for (int p = 1; p <= 10; p++) {
+        buffer_printf(&buffer, "<prmsOrd%d>%d</prmsOrd%d><prmsRealmName%d>분야 %d</prmsRealmName%d>"
+                      "<prmsTitle%d>후보%d 공약 %d: 지역 균형 발전과 일자리</prmsTitle%d><prmmCont%d>",
+                      p, p, p, p, (index + p) % 12, p, p, index, p, p, p);
+        for (int line = 0; line < 8; line++) {
+            buffer_printf(&buffer, "\n\t○ 세부 과제 %d-%d :  재원 마련 방안과  추진 일정을 단계별로 제시하고\r\n"
+                          "    지방 정부와 협력해 이행 상황을 공개", p, line);
+        }
+        buffer_printf(&buffer, "\n</prmmCont%d>", p);
+    }
+    buffer_printf(&buffer, "</item></items><numOfRows>10</numOfRows><pageNo>1</pageNo>"
+                  "<totalCount>1</totalCount></body></response>");
+
+    *length = buffer.length;
+    return buffer.data;
+}
+
+// 공공데이터 후보자 API 응답과 같은 형식 (한 페이지 100명)
+static char* make_candidate_response(int index, size_t* length) {
+    TextBuffer buffer = { malloc(65536), 0, 65536 };
+
+    buffer_printf(&buffer, "%s", RESPONSE_HEAD);
+    for (int c = 0; c < CANDIDATES_PER_RESPONSE; c++) {
+        buffer_printf(&buffer, "<item><num>%d</num><sgId>20220309</sgId><sgTypecode>1</sgTypecode>"
+                      "<huboid>1000%02d%03d</huboid><sggName>대한민국</sggName><sdName>전국</sdName>"
+                      "<wiwName></wiwName><giho>%d</giho><gihoSangse></gihoSangse><jdName>정당%d</jdName>"
+                      "<name>후보%d</name><hanjaName>候補</hanjaName><gender>남</gender>"
+                      "<birthday>19600101</birthday><age>62</age><addr>서울특별시 종로구</addr>"
+                      "<jobId>90</jobId><job>정당인</job><eduId>68</eduId><edu>대학교 졸업</edu>"
+                      "<career1>(전)국회의원</career1><career2>(전)도지사</career2><regdate>20220214</regdate>"
+                      "<status>등록</status></item>",
+                      c + 1, index, c, c + 1, c % 9, c);
+    }
+    buffer_printf(&buffer, "</items><numOfRows>100</numOfRows><pageNo>1</pageNo>"
+                  "<totalCount>100</totalCount></body></response>");
+
+    *length = buffer.length;
+    return buffer.data;
+}
+
+// 기존 후보자 파서 (필드마다 item 시작부터 strstr, 디버깅 출력만 뺌)
+static int legacy_parse_candidates(const char* json_data, const char* election_id, CandidateInfo candidates[],
+                                   int max_candidates) {
+    int count = 0;
+    if (!strstr(json_data, "<resultCode>INFO-00</resultCode>") && !strstr(json_data, "NORMAL SERVICE")) return 0;
+    if (!strstr(json_data, "<items>")) return 0;
+
+    char* items_start = strstr(json_data, "<items>");
+    char* items_end = strstr(json_data, "</items>");
+    if (!items_end) items_end = (char*)json_data + strlen(json_data);
+
+    char* pos = items_start;
+    while ((pos = strstr(pos, "<item>")) != NULL && count < max_candidates) {
+        char* item_end = strstr(pos, "</item>");
+        if (!item_end || item_end > items_end) break;
+
+        static const char* open_tags[] = { "<name>", "<jdName>", "<huboid>", "<giho>" };
+        static const char* close_tags[] = { "</name>", "</jdName>", "</huboid>", "</giho>" };
+        char* fields[] = { candidates[count].candidate_name, candidates[count].party_name,
+                           candidates[count].candidate_id, NULL };
+
+        for (int f = 0; f < 4; f++) {
+            char* start = strstr(pos, open_tags[f]);
+            if (!start || start >= item_end) continue;
+            start += strlen(open_tags[f]);
+            char* end = strstr(start, close_tags[f]);
+            if (!end || end >= item_end) continue;
+
+            int len = end - start;
+            if (fields[f] && len < MAX_STRING_LEN) {
+                strncpy(fields[f], start, len);
+                fields[f][len] = '\0';
+            } else if (!fields[f] && len < 10) {
+                char num_str[10];
+                strncpy(num_str, start, len);
+                num_str[len] = '\0';
+                candidates[count].candidate_number = atoi(num_str);
+            }
+        }
+
+        strcpy(candidates[count].election_id, election_id);
+        candidates[count].pledge_count = 3 + (count % 5);
+        count++;
+        pos = item_end + 1;
+    }
+    return count;
+}
+
+// 기존 공약 파서 (번호마다 snprintf로 태그를 만들어 item 시작부터 strstr, 디버깅 출력만 뺌)
+static int legacy_parse_pledges(const char* json_data, PledgeInfo pledges[], int max_pledges) {
+    int count = 0;
+    if (!strstr(json_data, "<resultCode>INFO-00</resultCode>") && !strstr(json_data, "NORMAL SERVICE")) return 0;
+
+    char* item_start = strstr(json_data, "<item>");
+    if (!item_start) return 0;
+    char* item_end = strstr(item_start, "</item>");
+    if (!item_end) return 0;
+
+    char candidate_id[MAX_STRING_LEN - 16] = {0};
+    char count_str[10] = {0};
+    static const char* open_tags[] = { "<cnddtId>", "<prmsCnt>" };
+    static const char* close_tags[] = { "</cnddtId>", "</prmsCnt>" };
+    char* fields[] = { candidate_id, count_str };
+    size_t sizes[] = { sizeof(candidate_id), sizeof(count_str) };
+
+    for (int f = 0; f < 2; f++) {
+        char* start = strstr(item_start, open_tags[f]);
+        if (!start || start >= item_end) continue;
+        start += strlen(open_tags[f]);
+        char* end = strstr(start, close_tags[f]);
+        if (!end || end >= item_end) continue;
+        int len = end - start;
+        if ((size_t)len < sizes[f]) {
+            strncpy(fields[f], start, len);
+            fields[f][len] = '\0';
+        }
+    }
+    if (strlen(candidate_id) == 0) return 0;
+    int pledge_count = atoi(count_str);
+
+    for (int i = 1; i <= pledge_count && i <= 10 && count < max_pledges; i++) {
+        char tag_name[50];
+
+        snprintf(tag_name, sizeof(tag_name), "<prmsTitle%d>", i);
+        char* title_start = strstr(item_start, tag_name);
+        if (title_start && title_start < item_end) {
+            title_start += strlen(tag_name);
+            snprintf(tag_name, sizeof(tag_name), "</prmsTitle%d>", i);
+            char* title_end = strstr(title_start, tag_name);
+            if (title_end && title_end < item_end && title_end - title_start < MAX_STRING_LEN) {
+                int len = title_end - title_start;
+                strncpy(pledges[count].title, title_start, len);
+                pledges[count].title[len] = '\0';
+            }
+        }
+
+        snprintf(tag_name, sizeof(tag_name), "<prmmCont%d>", i);
+        char* content_start = strstr(item_start, tag_name);
+        if (content_start && content_start < item_end) {
+            content_start += strlen(tag_name);
+            snprintf(tag_name, sizeof(tag_name), "</prmmCont%d>", i);
+            char* content_end = strstr(content_start, tag_name);
+            if (content_end && content_end < item_end && content_end - content_start < MAX_CONTENT_LEN) {
+                int len = content_end - content_start;
+                char temp_content[MAX_CONTENT_LEN];
+                strncpy(temp_content, content_start, len);
+                temp_content[len] = '\0';
+
+                char* src = temp_content;
+                char* dst = pledges[count].content;
+                int dst_pos = 0;
+                while (*src && dst_pos < MAX_CONTENT_LEN - 1) {
+                    if (*src == '\n' || *src == '\r' || *src == '\t' || *src == ' ') {
+                        if (dst_pos > 0 && dst[dst_pos - 1] != ' ') dst[dst_pos++] = ' ';
+                    } else {
+                        dst[dst_pos++] = *src;
+                    }
+                    src++;
+                }
+                dst[dst_pos] = '\0';
+
+                char* trimmed = pledges[count].content;
+                while (*trimmed == ' ') trimmed++;
+                if (trimmed != pledges[count].content) {
+                    memmove(pledges[count].content, trimmed, strlen(trimmed) + 1);
+                }
+                int content_len = strlen(pledges[count].content);
+                while (content_len > 0 && pledges[count].content[content_len - 1] == ' ') {
+                    pledges[count].content[--content_len] = '\0';
+                }
+            }
+        }
+
+        snprintf(tag_name, sizeof(tag_name), "<prmsRealmName%d>", i);
+        char* realm_start = strstr(item_start, tag_name);
+        if (realm_start && realm_start < item_end) {
+            realm_start += strlen(tag_name);
+            snprintf(tag_name, sizeof(tag_name), "</prmsRealmName%d>", i);
+            char* realm_end = strstr(realm_start, tag_name);
+            if (realm_end && realm_end < item_end && realm_end - realm_start < MAX_STRING_LEN) {
+                int len = realm_end - realm_start;
+                strncpy(pledges[count].category, realm_start, len);
+                pledges[count].category[len] = '\0';
+            }
+        }
+
+        snprintf(pledges[count].pledge_id, MAX_STRING_LEN, "%s_%d", candidate_id, i);
+        strcpy(pledges[count].candidate_id, candidate_id);
+        count++;
+    }
+    return count;
+}
+
+// 스트리밍 파서 (chunk가 0이면 응답 전체를 한 번에, 아니면 chunk 바이트씩)
+static int stream_parse(APIEndpoint endpoint, const char* data, size_t length, void* records, int max_records,
+                        size_t chunk) {
+    APIResponseParser parser;
+    api_parser_init(&parser, endpoint, records, max_records, "20220309");
+    if (chunk == 0) {
+        api_parser_feed(&parser, data, length);
+    } else {
+        for (size_t pos = 0; pos < length; pos += chunk) {
+            api_parser_feed(&parser, data + pos, length - pos < chunk ? length - pos : chunk);
+        }
+    }
+    return api_parser_finish(&parser);
+}
+
+static int same_candidates(const CandidateInfo* a, const CandidateInfo* b, int count) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(a[i].candidate_id, b[i].candidate_id) != 0 || strcmp(a[i].candidate_name, b[i].candidate_name) != 0 ||
+            strcmp(a[i].party_name, b[i].party_name) != 0 || strcmp(a[i].election_id, b[i].election_id) != 0 ||
+            a[i].candidate_number != b[i].candidate_number || a[i].pledge_count != b[i].pledge_count) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int same_pledges(const PledgeInfo* a, const PledgeInfo* b, int count) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(a[i].pledge_id, b[i].pledge_id) != 0 || strcmp(a[i].candidate_id, b[i].candidate_id) != 0 ||
+            strcmp(a[i].title, b[i].title) != 0 || strcmp(a[i].content, b[i].content) != 0 ||
+            strcmp(a[i].category, b[i].category) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void print_throughput(const char* label, size_t bytes, double seconds) {
+    printf("  %10.1f MB/s  %8.2f ms  %s\n", bytes / (1024.0 * 1024.0) / seconds, seconds * 1000.0, label);
+}
+
+// 응답 묶음을 TARGET_BYTES 이상 파싱하는 시간 측정 (mode 0 기존, 1 스트리밍 전체, 2 스트리밍 조각)
+static double time_parse(int mode, APIEndpoint endpoint, char** responses, size_t* lengths, int count,
+                         void* records, int max_records, size_t* bytes) {
+    size_t total = 0;
+    for (int i = 0; i < count; i++) total += lengths[i];
+    int rounds = (int)(TARGET_BYTES / total) + 1;
+
+    double start = bench_now_sec();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < count; i++) {
+            if (mode == 0 && endpoint == API_ENDPOINT_PLEDGE) {
+                legacy_parse_pledges(responses[i], records, max_records);
+            } else if (mode == 0) {
+                legacy_parse_candidates(responses[i], "20220309", records, max_records);
+            } else {
+                stream_parse(endpoint, responses[i], lengths[i], records, max_records, mode == 2 ? CHUNK_SIZE : 0);
+            }
+        }
+    }
+    *bytes = total * (size_t)rounds;
+    return bench_now_sec() - start;
+}
+
+static int run_endpoint(const char* title, APIEndpoint endpoint, int response_count) {
+    char* responses[PLEDGE_RESPONSES];
+    size_t lengths[PLEDGE_RESPONSES];
+    size_t total = 0;
+
+    for (int i = 0; i < response_count; i++) {
+        responses[i] = endpoint == API_ENDPOINT_PLEDGE ? make_pledge_response(i, &lengths[i])
+                                                       : make_candidate_response(i, &lengths[i]);
+        total += lengths[i];
+    }
+
+    int max_records = endpoint == API_ENDPOINT_PLEDGE ? API_MAX_PLEDGES_PER_CANDIDATE : CANDIDATES_PER_RESPONSE;
+    size_t record_size = endpoint == API_ENDPOINT_PLEDGE ? sizeof(PledgeInfo) : sizeof(CandidateInfo);
+    void* legacy = calloc((size_t)max_records, record_size);
+    void* whole = calloc((size_t)max_records, record_size);
+    void* chunked = calloc((size_t)max_records, record_size);
+    if (!legacy || !whole || !chunked) {
+        free(legacy);
+        free(whole);
+        free(chunked);
+        for (int i = 0; i < response_count; i++) free(responses[i]);
+        return 0;
+    }
+
+    // 결과 비교 (모든 응답에서 기존 파서와 같은 레코드가 나와야 함)
+    int same = 1;
+    for (int i = 0; i < response_count && same; i++) {
+        int n;
+        memset(legacy, 0, (size_t)max_records * record_size);
+        if (endpoint == API_ENDPOINT_PLEDGE) {
+            n = legacy_parse_pledges(responses[i], legacy, max_records);
+        } else {
+            n = legacy_parse_candidates(responses[i], "20220309", legacy, max_records);
+        }
+        int n_whole = stream_parse(endpoint, responses[i], lengths[i], whole, max_records, 0);
+        int n_chunked = stream_parse(endpoint, responses[i], lengths[i], chunked, max_records, CHUNK_SIZE);
+
+        same = n > 0 && n == n_whole && n == n_chunked;
+        if (same && endpoint == API_ENDPOINT_PLEDGE) {
+            same = same_pledges(legacy, whole, n) && same_pledges(legacy, chunked, n);
+        } else if (same) {
+            same = same_candidates(legacy, whole, n) && same_candidates(legacy, chunked, n);
+        }
+    }
+
+    static const char* labels[] = { "기존 strstr 파서", "스트리밍 (응답 전체)", "스트리밍 (1460바이트 조각)" };
+    printf("  %s: 응답 %d개, 평균 %.1f KB, 결과 %s\n", title, response_count,
+           total / 1024.0 / response_count, same ? "일치" : "불일치");
+    for (int mode = 0; mode < 3; mode++) {
+        size_t bytes;
+        double seconds = time_parse(mode, endpoint, responses, lengths, response_count, mode == 0 ? legacy : whole,
+                                    max_records, &bytes);
+        print_throughput(labels[mode], bytes, seconds);
+    }
+    printf("\n");
+
+    free(legacy);
+    free(whole);
+    free(chunked);
+    for (int i = 0; i < response_count; i++) free(responses[i]);
+    return same;
+}
+
+int bench_xml_parse(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+
+    int ok = run_endpoint("공약 응답 (후보자 1명, 공약 10개)", API_ENDPOINT_PLEDGE, PLEDGE_RESPONSES);
+    ok = run_endpoint("후보자 응답 (100명)", API_ENDPOINT_CANDIDATE, CANDIDATE_RESPONSES) && ok;
+    if (!ok) {
+        printf("벤치마크 실행 실패 (결과 불일치)\n");
+        return 1;
+    }
+    return 0;
+}
@@ -1,6 +1,12 @@
 #include "client.h"
 #include "api.h"
 #include "utils.h"
+#include "protocol.h"
+#include "vote_kernels.h"
+#include "adjacency.h"
+#include "hash_index.h"
+#include "delim_scan.h"
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -12,17 +18,30 @@
 #define PLEDGES_FILE "data/pledges.txt"
 #define UPDATE_TIME_FILE "data/last_update.txt"
 
-// 전역 데이터
-static ElectionInfo g_elections[MAX_ELECTIONS];
-static CandidateInfo g_candidates[MAX_CANDIDATES];
-static PledgeInfo g_pledges[MAX_PLEDGES];
+// 전역 데이터 (파일을 읽을 때 줄 수에 맞춰 늘어나는 배열, 다시 읽어도 줄어들지 않고 재사용)
+static ElectionInfo* g_elections = NULL;
+static CandidateInfo* g_candidates = NULL;
+static PledgeInfo* g_pledges = NULL;
 static int g_election_count = 0;
 static int g_candidate_count = 0;
 static int g_pledge_count = 0;
+static int g_election_capacity = 0;
+static int g_candidate_capacity = 0;
+static int g_pledge_capacity = 0;
+
+// 선거 -> 후보자, 후보자 -> 공약 인접 목록 (데이터를 다시 읽으면 무효화하고 처음 쓸 때 다시 만듦)
+static AdjacencyIndex g_election_candidates;
+static AdjacencyIndex g_candidate_pledges;
+static HashIndex g_candidate_lookup;        // 후보자 ID -> g_candidates 위치
+static int g_navigation_ready = 0;
+static int find_candidate_pledges(int candidate_index, const int32_t** pledges);
 
 // 전역 클라이언트 상태
 static ClientState g_client_state;
 
+// 서버 응답 수신 버퍼 (프레임이 완성될 때까지 부분 수신 데이터를 보관)
+static FrameReader g_frame_reader;
+
 // 새로운 네비게이션 함수들
 int show_login_screen(void);
 void show_main_menu(void);
@@ -34,6 +53,7 @@ int authenticate_user(const char* user_id, const char* password);
 int register_user_on_server(const char* user_id, const char* password);
 void show_refresh_menu(void);
 void refresh_data(void);
+void refresh_data_incremental(void);
 void refresh_elections_only(void);
 void refresh_candidates_only(void);
 void refresh_pledges_only(void);
@@ -131,6 +151,7 @@ int connect_to_server(const char* server_ip, int port) {
     }
     
     g_client_state.is_connected = 1;
+    frame_reader_init(&g_frame_reader);
     write_log("INFO", "Connected to server successfully");
     return 1;
 }
@@ -149,6 +170,7 @@ void disconnect_from_server(void) {
         g_client_state.server_socket = INVALID_SOCKET;
         g_client_state.is_connected = 0;
         g_client_state.is_logged_in = 0;
+        frame_reader_free(&g_frame_reader);
         
         // 로그인 관련 데이터 초기화
         memset(g_client_state.user_id, 0, sizeof(g_client_state.user_id));
@@ -160,6 +182,41 @@ void disconnect_from_server(void) {
     }
 }
 
+// 서버로 요청 전송 (길이 접두 프레임으로 필요한 만큼만 전송)
+int send_request_to_server(NetworkMessage* request) {
+    Frame frame;
+    
+    if (!frame_from_message(request, &frame)) {
+        return 0;
+    }
+    
+    int result = frame_send(g_client_state.server_socket, &frame, FRAME_MODE_FRAMED);
+    frame_free(&frame);
+    return result;
+}
+
+// 서버 응답 수신 (프레임이 완성될 때까지 반복 수신)
+// NetworkMessage로 옮기므로 로그인/새로고침처럼 짧은 응답 전용 (목록/통계는 exchange_frame_with_server로 Frame을 그대로 받음)
+int receive_response_from_server(NetworkMessage* response) {
+    Frame frame;
+    
+    if (frame_receive(g_client_state.server_socket, &g_frame_reader, &frame) != 1) {
+        return 0;
+    }
+    
+    frame_to_message(&frame, response);
+    frame_free(&frame);
+    return 1;
+}
+
+// 프레임 요청 전송 후 응답 수신 (응답 크기 제한 없음, response는 호출자가 frame_free)
+static int exchange_frame_with_server(Frame* request, Frame* response) {
+    if (!frame_send(g_client_state.server_socket, request, FRAME_MODE_FRAMED)) {
+        return 0;
+    }
+    return frame_receive(g_client_state.server_socket, &g_frame_reader, response) == 1;
+}
+
 // 테스트용 서버 연결 해제 (로그인 정보 유지)
 void disconnect_test_connection(SOCKET test_socket) {
     if (test_socket != INVALID_SOCKET) {
@@ -185,6 +242,17 @@ void cleanup_client(void) {
     WSACleanup();
 #endif
     
+    // 데이터 표 해제
+    free(g_elections);
+    free(g_candidates);
+    free(g_pledges);
+    g_elections = NULL;
+    g_candidates = NULL;
+    g_pledges = NULL;
+    g_election_count = g_candidate_count = g_pledge_count = 0;
+    g_election_capacity = g_candidate_capacity = g_pledge_capacity = 0;
+    g_navigation_ready = 0;
+    
     write_log("INFO", "Client cleanup completed");
 }
 
@@ -534,19 +602,12 @@ void test_api_functions(void) {
     
     printf("✅ API 클라이언트 초기화 성공!\n\n");
     
-    // 안전한 메모리 할당을 위한 구조체들
-    ElectionInfo* elections = NULL;
-    CandidateInfo* candidates = NULL; 
-    PledgeInfo* pledges = NULL;
-    char* response_buffer = NULL;
-    
-    // 메모리 할당
-    elections = (ElectionInfo*)calloc(MAX_ELECTIONS, sizeof(ElectionInfo));
-    candidates = (CandidateInfo*)calloc(MAX_CANDIDATES, sizeof(CandidateInfo));
-    pledges = (PledgeInfo*)calloc(MAX_PLEDGES, sizeof(PledgeInfo));
-    response_buffer = (char*)calloc(16384, sizeof(char)); // 16KB 버퍼
+    // 안전한 메모리 할당을 위한 구조체들 (선거 배열은 응답 하나에 들어갈 수 있는 만큼만)
+    int election_capacity = 0;
+    ElectionInfo* elections = grow_array(NULL, &election_capacity, API_MAX_ELECTIONS_PER_RESPONSE, sizeof(ElectionInfo));
+    char* response_buffer = (char*)calloc(16384, sizeof(char)); // 16KB 버퍼
     
-    if (!elections || !candidates || !pledges || !response_buffer) {
+    if (!elections || !response_buffer) {
         printf("❌ 메모리 할당 실패\n");
         goto cleanup;
     }
@@ -556,7 +617,7 @@ void test_api_functions(void) {
     
     int api_result = api_get_election_info(&api_client, response_buffer, 16384);
     if (api_result == 0) {
-        int election_count = parse_election_json(response_buffer, elections, MAX_ELECTIONS);
+        int election_count = parse_election_json(response_buffer, elections, election_capacity);
         
         if (election_count > 0) {
             printf("✅ 선거 정보 %d개 조회 성공!\n", election_count);
@@ -593,13 +654,21 @@ void test_api_functions(void) {
 cleanup:
     if (response_buffer) free(response_buffer);
     if (elections) free(elections);
-    if (candidates) free(candidates);
-    if (pledges) free(pledges);
     
     cleanup_api_client(&api_client);
     wait_for_enter();
 }
 
+// 데이터 표 용량 출력 (항목 수/할당 칸 수, 표는 파일 줄 수에 맞춰 할당)
+static void print_data_capacity(void) {
+    size_t bytes = (size_t)g_election_capacity * sizeof(ElectionInfo) +
+                   (size_t)g_candidate_capacity * sizeof(CandidateInfo) +
+                   (size_t)g_pledge_capacity * sizeof(PledgeInfo);
+    printf("📦 데이터 용량: 선거 %d/%d, 후보자 %d/%d, 공약 %d/%d (%.1f MB)\n",
+           g_election_count, g_election_capacity, g_candidate_count, g_candidate_capacity,
+           g_pledge_count, g_pledge_capacity, bytes / (1024.0 * 1024.0));
+}
+
 // 메인 UI 루프 (새로운 계층적 네비게이션)
 void run_client_ui(void) {
     // 서버 연결 시도
@@ -619,6 +688,7 @@ void run_client_ui(void) {
     g_pledge_count = load_pledges_from_file();
     printf("로드 완료: 선거 %d개, 후보자 %d개, 공약 %d개\n", 
            g_election_count, g_candidate_count, g_pledge_count);
+    print_data_capacity();
     
     // 로그인 루프
     while (1) {
@@ -654,6 +724,7 @@ void show_refresh_menu(void) {
         printf("2. 후보자 정보 새로고침\n");
         printf("3. 공약 정보 새로고침\n");
         printf("4. 전체 데이터 새로고침\n");
+        printf("5. 바뀐 데이터만 새로고침 (증분)\n");
         printf("0. 메인 메뉴로 돌아가기\n");
         print_separator();
         
@@ -681,6 +752,10 @@ void show_refresh_menu(void) {
                 refresh_data();
                 break;
                 
+            case 5: // 바뀐 후보자만 공약을 다시 받음
+                refresh_data_incremental();
+                break;
+                
             case 0: // 메인 메뉴로 돌아가기
                 return;
                 
@@ -726,9 +801,7 @@ void refresh_elections_only(void) {
     
     // 서버로 요청 전송
     printf("📤 서버로 선거 정보 새로고침 요청 전송 중...\n");
-    int bytes_sent = send(g_client_state.server_socket, (char*)&refresh_request, sizeof(NetworkMessage), 0);
-    
-    if (bytes_sent <= 0) {
+    if (!send_request_to_server(&refresh_request)) {
         printf("❌ 서버로 새로고침 요청 전송 실패\n");
         printf("네트워크 연결을 확인해주세요.\n");
         wait_for_enter();
@@ -738,9 +811,7 @@ void refresh_elections_only(void) {
     // 서버 응답 수신
     printf("📥 서버 응답 대기 중...\n");
     memset(&refresh_response, 0, sizeof(NetworkMessage));
-    int bytes_received = recv(g_client_state.server_socket, (char*)&refresh_response, sizeof(NetworkMessage), 0);
-    
-    if (bytes_received <= 0) {
+    if (!receive_response_from_server(&refresh_response)) {
         printf("❌ 서버로부터 응답을 받지 못했습니다\n");
         printf("서버가 응답하지 않거나 네트워크 문제가 있을 수 있습니다.\n");
         wait_for_enter();
@@ -806,9 +877,7 @@ void refresh_candidates_only(void) {
     
     // 서버로 요청 전송
     printf("📤 서버로 후보자 정보 새로고침 요청 전송 중...\n");
-    int bytes_sent = send(g_client_state.server_socket, (char*)&refresh_request, sizeof(NetworkMessage), 0);
-    
-    if (bytes_sent <= 0) {
+    if (!send_request_to_server(&refresh_request)) {
         printf("❌ 서버로 새로고침 요청 전송 실패\n");
         printf("네트워크 연결을 확인해주세요.\n");
         wait_for_enter();
@@ -818,9 +887,7 @@ void refresh_candidates_only(void) {
     // 서버 응답 수신
     printf("📥 서버 응답 대기 중...\n");
     memset(&refresh_response, 0, sizeof(NetworkMessage));
-    int bytes_received = recv(g_client_state.server_socket, (char*)&refresh_response, sizeof(NetworkMessage), 0);
-    
-    if (bytes_received <= 0) {
+    if (!receive_response_from_server(&refresh_response)) {
         printf("❌ 서버로부터 응답을 받지 못했습니다\n");
         printf("서버가 응답하지 않거나 네트워크 문제가 있을 수 있습니다.\n");
         wait_for_enter();
@@ -893,9 +960,7 @@ void refresh_pledges_only(void) {
     
     // 서버로 요청 전송
     printf("📤 서버로 공약 정보 새로고침 요청 전송 중...\n");
-    int bytes_sent = send(g_client_state.server_socket, (char*)&refresh_request, sizeof(NetworkMessage), 0);
-    
-    if (bytes_sent <= 0) {
+    if (!send_request_to_server(&refresh_request)) {
         printf("❌ 서버로 새로고침 요청 전송 실패\n");
         printf("네트워크 연결을 확인해주세요.\n");
         wait_for_enter();
@@ -905,9 +970,7 @@ void refresh_pledges_only(void) {
     // 서버 응답 수신
     printf("📥 서버 응답 대기 중...\n");
     memset(&refresh_response, 0, sizeof(NetworkMessage));
-    int bytes_received = recv(g_client_state.server_socket, (char*)&refresh_response, sizeof(NetworkMessage), 0);
-    
-    if (bytes_received <= 0) {
+    if (!receive_response_from_server(&refresh_response)) {
         printf("❌ 서버로부터 응답을 받지 못했습니다\n");
         printf("서버가 응답하지 않거나 네트워크 문제가 있을 수 있습니다.\n");
         wait_for_enter();
@@ -946,13 +1009,20 @@ void refresh_pledges_only(void) {
     wait_for_enter();
 }
 
-// 전체 데이터 새로고침
-void refresh_data(void) {
+// 전체/증분 새로고침 요청 후 로컬 데이터 다시 로드 (incremental이면 서버가 바뀐 후보자만 공약을 다시 받음)
+static void request_data_refresh(int incremental) {
+    const char* title = incremental ? "증분 데이터 새로고침" : "전체 데이터 새로고침";
+    
     clear_screen();
-    print_header("전체 데이터 새로고침");
+    print_header(title);
     
-    printf("🔄 전체 데이터를 새로고침합니다...\n");
-    printf("이 작업은 몇 분이 소요될 수 있습니다.\n\n");
+    if (incremental) {
+        printf("🔄 선거/후보자 목록을 비교해 바뀐 후보자의 공약만 새로고침합니다...\n");
+        printf("바뀐 것이 없으면 서버 데이터는 그대로 유지됩니다.\n\n");
+    } else {
+        printf("🔄 전체 데이터를 새로고침합니다...\n");
+        printf("이 작업은 몇 분이 소요될 수 있습니다.\n\n");
+    }
     
     printf("계속하시겠습니까? (y/n): ");
     char input[10];
@@ -984,18 +1054,16 @@ void refresh_data(void) {
     NetworkMessage refresh_request, refresh_response;
     memset(&refresh_request, 0, sizeof(NetworkMessage));
     
-    refresh_request.message_type = MSG_REFRESH_ALL;
+    refresh_request.message_type = incremental ? MSG_REFRESH_INCREMENTAL : MSG_REFRESH_ALL;
     strcpy(refresh_request.user_id, g_logged_in_user);
     strcpy(refresh_request.session_id, g_session_id);
-    strcpy(refresh_request.data, "refresh_all_data");
+    strcpy(refresh_request.data, incremental ? "refresh_incremental" : "refresh_all_data");
     refresh_request.data_length = strlen(refresh_request.data);
     refresh_request.status_code = STATUS_SUCCESS;
     
     // 서버로 요청 전송
     printf("📤 서버로 새로고침 요청 전송 중...\n");
-    int bytes_sent = send(g_client_state.server_socket, (char*)&refresh_request, sizeof(NetworkMessage), 0);
-    
-    if (bytes_sent <= 0) {
+    if (!send_request_to_server(&refresh_request)) {
         printf("❌ 서버로 새로고침 요청 전송 실패\n");
         printf("네트워크 연결을 확인해주세요.\n");
         wait_for_enter();
@@ -1005,9 +1073,7 @@ void refresh_data(void) {
     // 서버 응답 수신
     printf("📥 서버 응답 대기 중...\n");
     memset(&refresh_response, 0, sizeof(NetworkMessage));
-    int bytes_received = recv(g_client_state.server_socket, (char*)&refresh_response, sizeof(NetworkMessage), 0);
-    
-    if (bytes_received <= 0) {
+    if (!receive_response_from_server(&refresh_response)) {
         printf("❌ 서버로부터 응답을 받지 못했습니다\n");
         printf("서버가 응답하지 않거나 네트워크 문제가 있을 수 있습니다.\n");
         wait_for_enter();
@@ -1041,9 +1107,12 @@ void refresh_data(void) {
     
     // 최종 결과 표시
     clear_screen();
-    print_header("전체 데이터 새로고침 완료");
+    print_header(incremental ? "증분 데이터 새로고침 완료" : "전체 데이터 새로고침 완료");
     
-    printf("🎉 전체 데이터 새로고침이 완료되었습니다!\n\n");
+    printf("🎉 %s이 완료되었습니다!\n\n", title);
+    if (incremental && refresh_response.status_code == STATUS_SUCCESS) {
+        printf("📨 %s\n\n", refresh_response.data);
+    }
     
     printf("📊 업데이트 결과:\n");
     printf("   - 선거 정보: %d개 (이전: %d개)\n", g_election_count, old_election_count);
@@ -1057,6 +1126,16 @@ void refresh_data(void) {
     wait_for_enter();
 }
 
+// 전체 데이터 새로고침
+void refresh_data(void) {
+    request_data_refresh(0);
+}
+
+// 바뀐 데이터만 새로고침 (새로 나왔거나 정보가 바뀐 후보자만 공약을 다시 받음)
+void refresh_data_incremental(void) {
+    request_data_refresh(1);
+}
+
 // 선거 정보 표시
 void show_elections(void) {
     clear_screen();
@@ -1165,18 +1244,11 @@ void evaluate_pledge_interactive(void) {
         return;
     }
     
-    // 현재 선택된 후보자의 공약들 표시
-    int pledge_count_for_candidate = 0;
-    int pledge_indices[MAX_PLEDGES];
+    // 현재 선택된 후보자의 공약들 표시 (인접 목록에서 바로 꺼냄)
+    const int32_t* pledge_indices = NULL;
+    int pledge_count_for_candidate = find_candidate_pledges(g_current_candidate, &pledge_indices);
     
-    for (int i = 0; i < g_pledge_count; i++) {
-        if (strcmp(g_pledges[i].candidate_id, g_candidates[g_current_candidate].candidate_id) == 0) {
-            pledge_indices[pledge_count_for_candidate] = i;
-            pledge_count_for_candidate++;
-        }
-    }
-    
-    if (pledge_count_for_candidate == 0) {
+    if (pledge_count_for_candidate <= 0) {
         printf("❌ 선택된 후보자의 공약이 없습니다.\n");
     wait_for_enter();
         return;
@@ -1266,8 +1338,14 @@ void show_pledge_statistics(void) {
         int has_server_stats;
     } EvaluatedPledge;
     
-    EvaluatedPledge evaluated_pledges[MAX_PLEDGES];
+    EvaluatedPledge* evaluated_pledges = malloc(sizeof(EvaluatedPledge) * (size_t)(g_pledge_count > 0 ? g_pledge_count : 1));
     int evaluated_count = 0;
+    
+    if (!evaluated_pledges) {
+        printf("❌ 메모리 할당 실패\n");
+        wait_for_enter();
+        return;
+    }
     int server_query_limit = 10;  // 서버 쿼리 제한
     int server_queries_used = 0;
     
@@ -1374,6 +1452,7 @@ void show_pledge_statistics(void) {
         printf("\n⚠️ 성능상 이유로 상위 %d개 공약만 실시간 서버 데이터를 조회합니다.\n", server_query_limit);
     }
     
+    free(evaluated_pledges);
     wait_for_enter();
 }
 
@@ -1552,8 +1631,7 @@ int authenticate_user(const char* user_id, const char* password) {
     
     // 서버로 로그인 요청 전송
     printf("🔄 서버에 로그인 요청을 전송합니다...\n");
-    if (send(g_client_state.server_socket, (char*)&login_request, 
-             sizeof(NetworkMessage), 0) == SOCKET_ERROR) {
+    if (!send_request_to_server(&login_request)) {
         printf("❌ 서버로 로그인 요청 전송 실패\n");
         return 0;
     }
@@ -1562,10 +1640,7 @@ int authenticate_user(const char* user_id, const char* password) {
     NetworkMessage login_response;
     memset(&login_response, 0, sizeof(NetworkMessage));
     
-    int bytes_received = recv(g_client_state.server_socket, (char*)&login_response, 
-                             sizeof(NetworkMessage), 0);
-    
-    if (bytes_received <= 0) {
+    if (!receive_response_from_server(&login_response)) {
         printf("❌ 서버로부터 응답을 받지 못했습니다\n");
         return 0;
     }
@@ -1661,8 +1736,7 @@ int register_user_on_server(const char* user_id, const char* password) {
     register_request.status_code = STATUS_SUCCESS;
     
     // 서버로 회원가입 요청 전송
-    if (send(g_client_state.server_socket, (char*)&register_request, 
-             sizeof(NetworkMessage), 0) == SOCKET_ERROR) {
+    if (!send_request_to_server(&register_request)) {
         printf("❌ 서버로 회원가입 요청 전송 실패\n");
         return 0;
     }
@@ -1671,10 +1745,7 @@ int register_user_on_server(const char* user_id, const char* password) {
     NetworkMessage register_response;
     memset(&register_response, 0, sizeof(NetworkMessage));
     
-    int bytes_received = recv(g_client_state.server_socket, (char*)&register_response, 
-                             sizeof(NetworkMessage), 0);
-    
-    if (bytes_received <= 0) {
+    if (!receive_response_from_server(&register_response)) {
         printf("❌ 서버로부터 응답을 받지 못했습니다\n");
         return 0;
     }
@@ -1878,19 +1949,135 @@ int main(int argc, char* argv[]) {
     return 0;
 }
 
-// 파일에서 선거 데이터 읽기
+// 데이터 배열이 바뀌었으므로 인접 목록을 다음에 쓸 때 다시 만들게 함
+static void invalidate_navigation_index(void) {
+    g_navigation_ready = 0;
+}
+
+// 선거/후보자 ID를 해시 인덱스로 위치에 연결한 뒤 계수 정렬로 인접 목록 생성 (O(선거 + 후보자 + 공약 수))
+// 같은 ID가 여러 번 나오면 마지막 위치로 연결, 메모리 부족 시 0
+static int ensure_navigation_index(void) {
+    if (g_navigation_ready) return 1;
+    
+    HashIndex election_lookup;
+    int32_t* election_of = malloc(sizeof(int32_t) * (g_candidate_count > 0 ? g_candidate_count : 1));
+    int32_t* candidate_of = malloc(sizeof(int32_t) * (g_pledge_count > 0 ? g_pledge_count : 1));
+    int ok = hash_index_init(&election_lookup, g_elections, sizeof(ElectionInfo),
+                             offsetof(ElectionInfo, election_id), (size_t)g_election_count) &&
+             hash_index_rebuild(&election_lookup, g_election_count);
+    
+    // 후보자 배열은 다시 읽을 때 옮겨질 수 있으므로 매번 현재 주소로 다시 연결
+    if (ok && !g_candidate_lookup.entries) {
+        ok = hash_index_init(&g_candidate_lookup, g_candidates, sizeof(CandidateInfo),
+                             offsetof(CandidateInfo, candidate_id), (size_t)g_candidate_count);
+    } else if (ok) {
+        hash_index_rebind(&g_candidate_lookup, g_candidates);
+    }
+    ok = ok && election_of && candidate_of && hash_index_rebuild(&g_candidate_lookup, g_candidate_count);
+    
+    if (ok) {
+        for (int c = 0; c < g_candidate_count; c++) {
+            election_of[c] = hash_index_find(&election_lookup, g_candidates[c].election_id);
+        }
+        for (int p = 0; p < g_pledge_count; p++) {
+            candidate_of[p] = hash_index_find(&g_candidate_lookup, g_pledges[p].candidate_id);
+        }
+        ok = adjacency_index_build(&g_election_candidates, election_of, g_candidate_count, g_election_count) &&
+             adjacency_index_build(&g_candidate_pledges, candidate_of, g_pledge_count, g_candidate_count);
+    }
+    
+    hash_index_free(&election_lookup);
+    free(election_of);
+    free(candidate_of);
+    g_navigation_ready = ok;
+    return ok;
+}
+
+// 선거의 후보자 위치 목록 (개수 반환, 인덱스를 만들 수 없으면 -1)
+static int find_election_candidates(int election_index, const int32_t** candidates) {
+    if (!ensure_navigation_index()) return -1;
+    return adjacency_index_range(&g_election_candidates, election_index, candidates);
+}
+
+// 후보자의 공약 위치 목록 (개수 반환, 인덱스를 만들 수 없으면 -1)
+static int find_candidate_pledges(int candidate_index, const int32_t** pledges) {
+    if (!ensure_navigation_index()) return -1;
+    return adjacency_index_range(&g_candidate_pledges, candidate_index, pledges);
+}
+
+// 서버 목록 응답을 임시 파일로 넘김 (응답이 데이터 파일과 같은 형식이라 파일 로더를 그대로 사용, 실패 시 NULL)
+// 프레임으로 받으므로 목록 크기 제한 없음
+static FILE* fetch_data_list(int message_type, int* line_count) {
+    Frame request, response;
+    frame_init(&request);
+    request.message_type = message_type;
+    request.status_code = STATUS_SUCCESS;
+    safe_strcpy(request.user_id, g_client_state.user_id, sizeof(request.user_id));
+    safe_strcpy(request.session_id, g_client_state.session_id, sizeof(request.session_id));
+    
+    int ok = exchange_frame_with_server(&request, &response);
+    frame_free(&request);
+    if (!ok) {
+        return NULL;
+    }
+    
+    FILE* file = NULL;
+    if (response.status_code == STATUS_SUCCESS && response.payload &&
+        strncmp(response.payload, "COUNT=", 6) == 0) {
+        file = tmpfile();
+        if (file && fwrite(response.payload, 1, response.payload_length, file) == response.payload_length) {
+            rewind(file);
+            *line_count = 0;
+            for (size_t i = 0; i < response.payload_length; i++) {
+                if (response.payload[i] == '\n') (*line_count)++;
+            }
+        } else if (file) {
+            fclose(file);
+            file = NULL;
+        }
+    }
+    
+    frame_free(&response);
+    return file;
+}
+
+// 목록 데이터 열기 (서버에 연결돼 있으면 서버의 현재 데이터, 아니거나 실패하면 로컬 데이터 파일)
+// line_count에는 줄 수 (한 줄에 많아야 한 항목이므로 표 크기로 사용)
+static FILE* open_data_list(int message_type, const char* path, int* line_count) {
+    if (g_client_state.is_connected) {
+        FILE* file = fetch_data_list(message_type, line_count);
+        if (file) return file;
+    }
+    
+    *line_count = count_file_lines(path);
+    return fopen(path, "r");
+}
+
+// 선거 데이터 읽기 (서버 목록 또는 로컬 파일, open_data_list)
 int load_elections_from_file(void) {
-    FILE* file = fopen(ELECTIONS_FILE, "r");
+    invalidate_navigation_index();
+    int line_count = 0;
+    FILE* file = open_data_list(MSG_GET_ELECTIONS, ELECTIONS_FILE, &line_count);
     if (!file) {
         printf("❌ 선거 데이터 파일을 찾을 수 없습니다: %s\n", ELECTIONS_FILE);
         printf("   서버를 먼저 실행해주세요.\n");
         return 0;
     }
     
+    // 한 줄에 많아야 한 항목이므로 파일 줄 수만큼 자리를 먼저 확보
+    ElectionInfo* elections = grow_array(g_elections, &g_election_capacity, line_count,
+                                         sizeof(ElectionInfo));
+    if (!elections) {
+        printf("❌ 선거 데이터를 담을 메모리가 부족합니다.\n");
+        fclose(file);
+        return 0;
+    }
+    g_elections = elections;
+    
     char line[1024];
     g_election_count = 0;
     
-    while (fgets(line, sizeof(line), file) && g_election_count < MAX_ELECTIONS) {
+    while (fgets(line, sizeof(line), file) && g_election_count < g_election_capacity) {
         // 주석과 빈 줄 건너뛰기
         if (line[0] == '#' || line[0] == '\n') continue;
         if (strncmp(line, "COUNT=", 6) == 0) continue;
@@ -1929,18 +2116,30 @@ int load_elections_from_file(void) {
     return g_election_count;
 }
 
-// 파일에서 후보자 데이터 읽기
+// 후보자 데이터 읽기 (서버 목록 또는 로컬 파일)
 int load_candidates_from_file(void) {
-    FILE* file = fopen(CANDIDATES_FILE, "r");
+    invalidate_navigation_index();
+    int line_count = 0;
+    FILE* file = open_data_list(MSG_GET_CANDIDATES, CANDIDATES_FILE, &line_count);
     if (!file) {
         printf("⚠️  후보자 데이터 파일을 찾을 수 없습니다: %s\n", CANDIDATES_FILE);
         return 0;
     }
     
+    // 한 줄에 많아야 한 항목이므로 파일 줄 수만큼 자리를 먼저 확보
+    CandidateInfo* candidates = grow_array(g_candidates, &g_candidate_capacity, line_count,
+                                           sizeof(CandidateInfo));
+    if (!candidates) {
+        printf("❌ 후보자 데이터를 담을 메모리가 부족합니다.\n");
+        fclose(file);
+        return 0;
+    }
+    g_candidates = candidates;
+    
     char line[1024];
     g_candidate_count = 0;
     
-    while (fgets(line, sizeof(line), file) && g_candidate_count < MAX_CANDIDATES) {
+    while (fgets(line, sizeof(line), file) && g_candidate_count < g_candidate_capacity) {
         // 주석과 빈 줄 건너뛰기
         if (line[0] == '#' || line[0] == '\n') continue;
         if (strncmp(line, "COUNT=", 6) == 0) continue;
@@ -1983,51 +2182,63 @@ int load_candidates_from_file(void) {
     return g_candidate_count;
 }
 
-// 파일에서 공약 데이터 읽기
+// 공약 데이터 읽기 (서버 목록 또는 로컬 파일, 좋아요/싫어요는 서버의 지금 카운터 값)
 int load_pledges_from_file(void) {
-    FILE* file = fopen(PLEDGES_FILE, "r");
+    invalidate_navigation_index();
+    int line_count = 0;
+    FILE* file = open_data_list(MSG_GET_PLEDGES, PLEDGES_FILE, &line_count);
     if (!file) {
         printf("⚠️  공약 데이터 파일을 찾을 수 없습니다: %s\n", PLEDGES_FILE);
         return 0;
     }
     
+    // 공약 내용이 여러 줄에 걸칠 수 있으므로 줄 수는 공약 수의 상한 (넘치면 parse_pledge_data에서 늘림)
+    PledgeInfo* pledges = grow_array(g_pledges, &g_pledge_capacity, line_count, sizeof(PledgeInfo));
+    if (!pledges) {
+        printf("❌ 공약 데이터를 담을 메모리가 부족합니다.\n");
+        fclose(file);
+        return 0;
+    }
+    g_pledges = pledges;
+    
     char line[4096];
     g_pledge_count = 0;
     char current_pledge_data[8192] = "";  // 여러 줄에 걸친 공약 데이터를 저장할 버퍼
+    size_t current_length = 0;            // 버퍼에 모은 길이 (이어 붙일 때 다시 세지 않음)
     int collecting_pledge = 0;  // 공약 데이터를 수집 중인지 여부
     
-    while (fgets(line, sizeof(line), file) && g_pledge_count < MAX_PLEDGES) {
+    while (fgets(line, sizeof(line), file)) {
         // 주석과 빈 줄 건너뛰기
         if (line[0] == '#' || strncmp(line, "COUNT=", 6) == 0) continue;
         
         // 개행 문자 제거
-        char* newline = strchr(line, '\n');
-        if (newline) *newline = '\0';
-        newline = strchr(line, '\r');
-        if (newline) *newline = '\0';
+        size_t length = strcspn(line, "\r\n");
+        line[length] = '\0';
         
         // 빈 줄인 경우 건너뛰기
-        if (strlen(line) == 0) continue;
+        if (length == 0) continue;
         
         // 새로운 공약 시작인지 확인 (숫자_숫자| 패턴으로 시작하는 줄)
-        if (strstr(line, "_") && strchr(line, '|')) {
+        if (memchr(line, '_', length) && memchr(line, '|', length)) {
             // 이전 공약 데이터가 있다면 처리
-            if (collecting_pledge && strlen(current_pledge_data) > 0) {
+            if (collecting_pledge && current_length > 0) {
                 parse_pledge_data(current_pledge_data);
             }
             
             // 새로운 공약 데이터 시작
-            strcpy(current_pledge_data, line);
+            memcpy(current_pledge_data, line, length + 1);
+            current_length = length;
             collecting_pledge = 1;
-        } else if (collecting_pledge) {
+        } else if (collecting_pledge && current_length + 1 + length < sizeof(current_pledge_data)) {
             // 이전 공약의 연속 데이터인 경우, 내용에 추가
-            strcat(current_pledge_data, " ");
-            strcat(current_pledge_data, line);
+            current_pledge_data[current_length++] = ' ';
+            memcpy(current_pledge_data + current_length, line, length + 1);
+            current_length += length;
         }
     }
     
     // 마지막 공약 데이터 처리
-    if (collecting_pledge && strlen(current_pledge_data) > 0) {
+    if (collecting_pledge && current_length > 0) {
         parse_pledge_data(current_pledge_data);
     }
     
@@ -2038,82 +2249,57 @@ int load_pledges_from_file(void) {
 
 // 공약 데이터 파싱 함수
 void parse_pledge_data(const char* pledge_data) {
-    if (g_pledge_count >= MAX_PLEDGES) return;
+    // 자리가 없으면 늘림 (파일 줄 수로 미리 잡아 두므로 보통은 그대로)
+    PledgeInfo* pledges = grow_array(g_pledges, &g_pledge_capacity, g_pledge_count + 1, sizeof(PledgeInfo));
+    if (!pledges) return;
+    g_pledges = pledges;
     
     // 복사본 생성
     char data_copy[8192];
-    strncpy(data_copy, pledge_data, sizeof(data_copy) - 1);
-    data_copy[sizeof(data_copy) - 1] = '\0';
-    
-    // 파이프(|) 개수 확인
-    int pipe_count = 0;
-    for (int i = 0; data_copy[i]; i++) {
-        if (data_copy[i] == '|') pipe_count++;
-    }
-    
-    // 최소 4개의 파이프가 있어야 함
-    if (pipe_count < 4) return;
-    
-    // 더 안정적인 파싱을 위해 처음 3개 필드와 마지막 4개 필드를 분리해서 처리
-    char* pledge_id = NULL;
-    char* candidate_id = NULL;
-    char* title = NULL;
-    char* content = NULL;
-    char* category = NULL;
-    char* likes = NULL;
-    char* dislikes = NULL;
-    char* timestamp = NULL;
-    
-    // 첫 번째 | 찾기 (공약 ID)
-    char* ptr = data_copy;
-    pledge_id = ptr;
-    ptr = strchr(ptr, '|');
-    if (!ptr) return;
-    *ptr = '\0';
-    ptr++;
-    
-    // 두 번째 | 찾기 (후보자 ID)
-    candidate_id = ptr;
-    ptr = strchr(ptr, '|');
-    if (!ptr) return;
-    *ptr = '\0';
-    ptr++;
-    
-    // 세 번째 | 찾기 (제목)
-    title = ptr;
-    ptr = strchr(ptr, '|');
-    if (!ptr) return;
-    *ptr = '\0';
-    ptr++;
-    
-    // 나머지 문자열에서 마지막 3개 | 찾기 (역순으로)
-    char* rest_data = ptr;
-    char* last_pipe = strrchr(rest_data, '|');
-    if (!last_pipe) return;
-    
-    timestamp = last_pipe + 1;
-    *last_pipe = '\0';
-    
-    char* second_last_pipe = strrchr(rest_data, '|');
-    if (!second_last_pipe) return;
-    
-    dislikes = second_last_pipe + 1;
-    *second_last_pipe = '\0';
-    
-    char* third_last_pipe = strrchr(rest_data, '|');
-    if (!third_last_pipe) return;
-    
-    likes = third_last_pipe + 1;
-    *third_last_pipe = '\0';
-    
-    char* fourth_last_pipe = strrchr(rest_data, '|');
-    if (!fourth_last_pipe) return;
-    
-    category = fourth_last_pipe + 1;
-    *fourth_last_pipe = '\0';
-    
-    // 나머지는 content
-    content = rest_data;
+    size_t length = strlen(pledge_data);
+    if (length >= sizeof(data_copy)) length = sizeof(data_copy) - 1;
+    memcpy(data_copy, pledge_data, length);
+    data_copy[length] = '\0';
+    
+    // 파이프(|) 위치를 한 번에 모음: 앞의 3개(ID/후보자/제목 뒤)와 뒤의 4개(내용/카테고리/좋아요/싫어요 뒤)
+    // 내용에 파이프가 들어 있어도 그 사이는 모두 내용
+    uint32_t positions[64];
+    size_t first[3];
+    size_t last[4];
+    size_t pipe_count = 0;
+    size_t from = 0;
+    for (;;) {
+        size_t found = delim_scan(data_copy + from, length - from, '|', '|', positions, 64);
+        for (size_t i = 0; i < found; i++) {
+            size_t at = from + positions[i];
+            if (pipe_count < 3) first[pipe_count] = at;
+            last[pipe_count % 4] = at;
+            pipe_count++;
+        }
+        if (found < 64) break;
+        from += positions[63] + 1;
+    }
+    
+    // 최소 7개의 파이프가 있어야 함
+    if (pipe_count < 7) return;
+    
+    size_t tail[4];
+    for (int i = 0; i < 3; i++) {
+        data_copy[first[i]] = '\0';
+    }
+    for (int i = 0; i < 4; i++) {
+        tail[i] = last[(pipe_count - 4 + (size_t)i) % 4];
+        data_copy[tail[i]] = '\0';
+    }
+    
+    char* pledge_id = data_copy;
+    char* candidate_id = data_copy + first[0] + 1;
+    char* title = data_copy + first[1] + 1;
+    char* content = data_copy + first[2] + 1;
+    char* category = data_copy + tail[0] + 1;
+    char* likes = data_copy + tail[1] + 1;
+    char* dislikes = data_copy + tail[2] + 1;
+    char* timestamp = data_copy + tail[3] + 1;
     
     // 각 필드 설정
     strncpy(g_pledges[g_pledge_count].pledge_id, pledge_id, 
@@ -2349,6 +2535,81 @@ void show_last_update_time(void) {
     fclose(file);
 }
 
+// 후보자 ID -> 이름 (로드된 후보자 목록에 없으면 "알 수 없음")
+static const char* find_candidate_name(const char* candidate_id) {
+    int index = ensure_navigation_index() ? hash_index_find(&g_candidate_lookup, candidate_id) : -1;
+    return index >= 0 ? g_candidates[index].candidate_name : "알 수 없음";
+}
+
+// 로컬 공약 데이터로 지지율 상위 max_count개 계산 (서버 순위표를 쓸 수 없을 때)
+// 평가 카운터를 연속 배열로 뽑아 지지율 계산과 평가된 공약 선별을 한 번에 처리 (SIMD 커널)
+static int compute_local_pledge_ranking(PledgeRankingEntry ranking[], int max_count, int* rated_count) {
+    int* pledge_likes = malloc(sizeof(int) * (g_pledge_count > 0 ? g_pledge_count : 1));
+    int* pledge_dislikes = malloc(sizeof(int) * (g_pledge_count > 0 ? g_pledge_count : 1));
+    float* approval_rates = malloc(sizeof(float) * (g_pledge_count > 0 ? g_pledge_count : 1));
+    int32_t* rated_indices = malloc(sizeof(int32_t) * (g_pledge_count > 0 ? g_pledge_count : 1));
+    int top_count = 0;
+    
+    *rated_count = 0;
+    if (!pledge_likes || !pledge_dislikes || !approval_rates || !rated_indices) {
+        printf("❌ 메모리 할당 실패\n");
+    } else {
+        for (int i = 0; i < g_pledge_count; i++) {
+            pledge_likes[i] = g_pledges[i].like_count;
+            pledge_dislikes[i] = g_pledges[i].dislike_count;
+        }
+        vote_approval_rates(pledge_likes, pledge_dislikes, g_pledge_count, approval_rates);
+        *rated_count = vote_filter(pledge_likes, pledge_dislikes, g_pledge_count, 0.0f, 1, rated_indices);
+    }
+    
+    // 평가된 공약만 검사하여 상위 max_count개 유지 (지지율 우선, 같으면 총 투표수 우선)
+    for (int r = 0; r < *rated_count; r++) {
+        int i = rated_indices[r];
+        int total_votes = pledge_likes[i] + pledge_dislikes[i];
+        double approval_rate = approval_rates[i];
+        
+        if (top_count == max_count &&
+            (approval_rate < ranking[max_count - 1].stats.approval_rate ||
+             (approval_rate == ranking[max_count - 1].stats.approval_rate &&
+              total_votes <= ranking[max_count - 1].stats.total_votes))) {
+            continue;
+        }
+        
+        // 올바른 위치에 삽입
+        int insert_pos = top_count;
+        for (int k = 0; k < top_count; k++) {
+            if (approval_rate > ranking[k].stats.approval_rate || 
+                (approval_rate == ranking[k].stats.approval_rate && total_votes > ranking[k].stats.total_votes)) {
+                insert_pos = k;
+                break;
+            }
+        }
+        
+        // 기존 항목들을 뒤로 이동
+        for (int k = (top_count < max_count ? top_count : max_count - 1); k > insert_pos; k--) {
+            ranking[k] = ranking[k - 1];
+        }
+        
+        PledgeRankingEntry* entry = &ranking[insert_pos];
+        safe_strcpy(entry->pledge_id, g_pledges[i].pledge_id, sizeof(entry->pledge_id));
+        safe_strcpy(entry->candidate_id, g_pledges[i].candidate_id, sizeof(entry->candidate_id));
+        safe_strcpy(entry->category, g_pledges[i].category, sizeof(entry->category));
+        safe_strcpy(entry->title, g_pledges[i].title, sizeof(entry->title));
+        entry->stats.like_count = pledge_likes[i];
+        entry->stats.dislike_count = pledge_dislikes[i];
+        entry->stats.total_votes = total_votes;
+        entry->stats.approval_rate = approval_rate;
+        
+        if (top_count < max_count) top_count++;
+    }
+    
+    free(pledge_likes);
+    free(pledge_dislikes);
+    free(approval_rates);
+    free(rated_indices);
+    return top_count;
+}
+
 // 통계 메뉴
 void show_statistics_menu(void) {
     int choice;
@@ -2379,88 +2640,31 @@ void show_statistics_menu(void) {
                 clear_screen();
                 print_header("공약 평가 통계 - 상위 10위");
                 
-                // 공약 데이터 로드
-                if (g_pledge_count == 0) {
-                    printf("🔄 공약 데이터를 로드하는 중...\n");
-                    g_pledge_count = load_pledges_from_file();
-                }
-                
-                if (g_pledge_count == 0) {
-                    printf("❌ 공약 데이터가 없습니다.\n");
-                    printf("💡 데이터 새로고침 메뉴에서 API를 통해 데이터를 먼저 받아주세요.\n");
-                    wait_for_enter();
-                    break;
-                }
-                
-                // 후보자 데이터도 로드
+                // 후보자 이름 표시용
                 if (g_candidate_count == 0) {
                     g_candidate_count = load_candidates_from_file();
                 }
                 
-                printf("📊 총 %d개 공약 분석 중...\n\n", g_pledge_count);
-                
-                // 간단한 배열로 상위 10개만 추적 (메모리 안전)
-                typedef struct {
-                    int pledge_index;
-                    int like_count;
-                    int total_votes;
-                    float approval_rate;
-                    char candidate_name[100];
-                } TopPledge;
-                
-                TopPledge top_pledges[10];
-                int top_count = 0;
+                // 서버 순위표에서 한 번에 조회 (실패 시 로컬 공약 데이터로 계산)
+                PledgeRankingEntry ranking[10];
+                int rated_count = -1;
+                int top_count = get_leaderboard_from_server("global", NULL, ranking, 10);
                 
-                // 모든 공약 검사하여 상위 10개 유지
-                for (int i = 0; i < g_pledge_count && i < 100; i++) { // 처음 100개만 검사 (안전성)
-                    int total_votes = g_pledges[i].like_count + g_pledges[i].dislike_count;
+                if (top_count < 0) {
+                    if (g_pledge_count == 0) {
+                        printf("🔄 공약 데이터를 로드하는 중...\n");
+                        g_pledge_count = load_pledges_from_file();
+                    }
                     
-                    if (total_votes > 0) {
-                        float approval_rate = ((float)g_pledges[i].like_count / total_votes) * 100.0f;
-                        
-                        // 상위 10개에 들어갈 수 있는지 확인 (지지율 우선, 같으면 총 투표수 우선)
-                        if (top_count < 10 || 
-                            approval_rate > top_pledges[9].approval_rate ||
-                            (approval_rate == top_pledges[9].approval_rate && total_votes > top_pledges[9].total_votes)) {
-                            // 후보자 이름 찾기
-                            char candidate_name[100] = "알 수 없음";
-                            for (int j = 0; j < g_candidate_count; j++) {
-                                if (strcmp(g_candidates[j].candidate_id, g_pledges[i].candidate_id) == 0) {
-                                    strncpy(candidate_name, g_candidates[j].candidate_name, 99);
-                                    candidate_name[99] = '\0';
-                                    break;
-                                }
-                            }
-                            
-                            // 새 항목 생성
-                            TopPledge new_pledge;
-                            new_pledge.pledge_index = i;
-                            new_pledge.like_count = g_pledges[i].like_count;
-                            new_pledge.total_votes = total_votes;
-                            new_pledge.approval_rate = approval_rate;
-                            strcpy(new_pledge.candidate_name, candidate_name);
-                            
-                            // 올바른 위치에 삽입 (지지율 우선, 같으면 총 투표수 우선)
-                            int insert_pos = top_count;
-                            for (int k = 0; k < top_count; k++) {
-                                if (approval_rate > top_pledges[k].approval_rate || 
-                                    (approval_rate == top_pledges[k].approval_rate && total_votes > top_pledges[k].total_votes)) {
-                                    insert_pos = k;
-                                    break;
-                                }
-                            }
-                            
-                            // 기존 항목들을 뒤로 이동
-                            for (int k = (top_count < 10 ? top_count : 9); k > insert_pos; k--) {
-                                top_pledges[k] = top_pledges[k-1];
-                            }
-                            
-                            // 새 항목 삽입
-                            top_pledges[insert_pos] = new_pledge;
-                            
-                            if (top_count < 10) top_count++;
-                        }
+                    if (g_pledge_count == 0) {
+                        printf("❌ 공약 데이터가 없습니다.\n");
+                        printf("💡 데이터 새로고침 메뉴에서 API를 통해 데이터를 먼저 받아주세요.\n");
+                        wait_for_enter();
+                        break;
                     }
+                    
+                    printf("📊 총 %d개 공약 분석 중...\n\n", g_pledge_count);
+                    top_count = compute_local_pledge_ranking(ranking, 10, &rated_count);
                 }
                 
                 if (top_count == 0) {
@@ -2471,10 +2675,9 @@ void show_statistics_menu(void) {
                 }
                 
                 // 상위 10개 출력
-                printf("🏆 공약 지지율 상위 %d위:\n\n", top_count);
+                printf("🏆 공약 지지율 상위 %d위%s:\n\n", top_count, rated_count < 0 ? " (실시간)" : "");
                 
                 for (int i = 0; i < top_count; i++) {
-                    int idx = top_pledges[i].pledge_index;
                     printf("%d위. ", i + 1);
                     
                     // 1위는 금메달, 2위는 은메달, 3위는 동메달
@@ -2484,19 +2687,23 @@ void show_statistics_menu(void) {
                     else printf("   ");
                     
                     printf("%.1f%% 지지율 (%d표 중 %d표)\n", 
-                           top_pledges[i].approval_rate, 
-                           top_pledges[i].total_votes, 
-                           top_pledges[i].like_count);
+                           ranking[i].stats.approval_rate, 
+                           ranking[i].stats.total_votes, 
+                           ranking[i].stats.like_count);
                     
-                    printf("    📋 제목: %s\n", g_pledges[idx].title);
-                    printf("    👤 후보: %s\n", top_pledges[i].candidate_name);
-                    printf("    📂 분야: %s\n", g_pledges[idx].category);
+                    printf("    📋 제목: %s\n", ranking[i].title);
+                    printf("    👤 후보: %s\n", find_candidate_name(ranking[i].candidate_id));
+                    printf("    📂 분야: %s\n", ranking[i].category);
                     printf("\n");
                 }
                 
                 printf("📊 통계 요약:\n");
-                printf("   - 평가된 공약 수: %d개 이상\n", top_count);
-                printf("   - 전체 공약 수: %d개\n", g_pledge_count);
+                if (rated_count >= 0) {
+                    printf("   - 평가된 공약 수: %d개\n", rated_count);
+                    printf("   - 전체 공약 수: %d개\n", g_pledge_count);
+                } else {
+                    printf("   - 서버 순위표 기준 (평가할 때마다 갱신)\n");
+                }
                 
                 wait_for_enter();
                 break;
@@ -2566,6 +2773,115 @@ void show_election_rankings(void) {
     }
 }
 
+// candidate_id가 선거 후보자 목록(candidate_indices)의 몇 번째인지 (없으면 -1)
+static int32_t find_candidate_position(const int32_t* candidate_indices, int count, const char* candidate_id) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(g_candidates[candidate_indices[i]].candidate_id, candidate_id) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// 후보자별 평균 지지율
+typedef struct {
+    int candidate_index;
+    double avg_approval;
+    int total_votes;
+    int total_pledges;
+    int server_data_count;  // 서버에서 가져온 데이터 개수
+} CandidateRanking;
+
+// 지지율 높은 순 (같으면 총 투표수 많은 순)
+static int compare_candidate_rankings(const void* a, const void* b) {
+    const CandidateRanking* left = (const CandidateRanking*)a;
+    const CandidateRanking* right = (const CandidateRanking*)b;
+    if (left->avg_approval != right->avg_approval) {
+        return left->avg_approval > right->avg_approval ? -1 : 1;
+    }
+    return right->total_votes - left->total_votes;
+}
+
+// 공약 단위 통계로 후보자별 합계 계산 (서버 합계 조회를 쓸 수 없을 때)
+// 선거 전체 공약 통계를 한 번에 요청하고, 실패하면 후보자별 로컬 공약 목록(인접 목록)의 평가 사용
+static int sum_candidate_votes(const int32_t* candidate_indices, int candidate_count, const char* election_id,
+                               CandidateRanking rankings[]) {
+    PledgeStatisticsEntry* batch = NULL;
+    int batch_count = get_statistics_batch_from_server("election", election_id, &batch);
+    
+    // 서버 통계에 후보자 순번(candidate_indices 위치, 다른 후보자는 -1)을 붙여
+    // 후보자별 합계를 연속 배열 스캔(SIMD 커널)으로 구함
+    int32_t* batch_keys = malloc(sizeof(int32_t) * (batch_count > 0 ? batch_count : 1));
+    int* batch_likes = malloc(sizeof(int) * (batch_count > 0 ? batch_count : 1));
+    int* batch_dislikes = malloc(sizeof(int) * (batch_count > 0 ? batch_count : 1));
+    
+    if (!batch_keys || !batch_likes || !batch_dislikes) {
+        free(batch_keys);
+        free(batch_likes);
+        free(batch_dislikes);
+        free(batch);
+        return -1;
+    }
+    
+    for (int b = 0; b < batch_count; b++) {
+        batch_keys[b] = find_candidate_position(candidate_indices, candidate_count, batch[b].candidate_id);
+        batch_likes[b] = batch[b].stats.like_count;
+        batch_dislikes[b] = batch[b].stats.dislike_count;
+    }
+    
+    for (int i = 0; i < candidate_count; i++) {
+        int candidate_idx = candidate_indices[i];
+        long long total_likes = 0, total_dislikes = 0;
+        int server_data_count = 0;  // 서버에서 가져온 데이터 개수
+        VoteTotals totals;
+        
+        // 서버 실시간 통계 합계
+        for (int b = 0; b < batch_count; b++) {
+            server_data_count += (batch_keys[b] == i);
+        }
+        if (server_data_count > 0) {
+            vote_sum_matching(batch_keys, i, batch_likes, batch_dislikes, batch_count, &totals);
+            total_likes = totals.likes;
+            total_dislikes = totals.dislikes;
+        }
+        
+        // 해당 후보자의 공약 수 (서버 데이터가 없으면 로컬 평가 합계 사용)
+        const int32_t* pledge_indices = NULL;
+        int pledge_count = find_candidate_pledges(candidate_idx, &pledge_indices);
+        if (pledge_count < 0) {
+            pledge_count = 0;
+        }
+        if (server_data_count == 0) {
+            for (int p = 0; p < pledge_count; p++) {
+                total_likes += g_pledges[pledge_indices[p]].like_count;
+                total_dislikes += g_pledges[pledge_indices[p]].dislike_count;
+            }
+        }
+        if (server_data_count > pledge_count) {
+            pledge_count = server_data_count;
+        }
+        
+        double avg_approval = 0.0;
+        int total_votes = (int)(total_likes + total_dislikes);
+        
+        if (total_votes > 0) {
+            avg_approval = ((double)total_likes / total_votes) * 100.0;
+        }
+        
+        rankings[i].candidate_index = candidate_idx;
+        rankings[i].avg_approval = avg_approval;
+        rankings[i].total_votes = total_votes;
+        rankings[i].total_pledges = pledge_count;
+        rankings[i].server_data_count = server_data_count;  // 서버 데이터 개수 저장
+    }
+    
+    free(batch_keys);
+    free(batch_likes);
+    free(batch_dislikes);
+    free(batch);
+    return candidate_count;
+}
+
 // 후보자별 순위
 void show_candidate_rankings(int election_index) {
     clear_screen();
@@ -2582,18 +2898,11 @@ void show_candidate_rankings(int election_index) {
         g_pledge_count = load_pledges_from_file();
     }
     
-    // 해당 선거의 후보자들 찾기
-    int candidate_indices[MAX_CANDIDATES];
-    int candidate_count_for_election = 0;
+    // 해당 선거의 후보자들 (인접 목록에서 바로 꺼냄)
+    const int32_t* candidate_indices = NULL;
+    int candidate_count_for_election = find_election_candidates(election_index, &candidate_indices);
     
-    for (int i = 0; i < g_candidate_count; i++) {
-        if (strcmp(g_candidates[i].election_id, g_elections[election_index].election_id) == 0) {
-            candidate_indices[candidate_count_for_election] = i;
-            candidate_count_for_election++;
-        }
-    }
-    
-    if (candidate_count_for_election == 0) {
+    if (candidate_count_for_election <= 0) {
         printf("❌ 해당 선거의 후보자 정보가 없습니다.\n");
         wait_for_enter();
         return;
@@ -2602,66 +2911,51 @@ void show_candidate_rankings(int election_index) {
     // 순위 헤더는 아래에서 출력
     
     // 각 후보자의 평균 지지율 계산
-    typedef struct {
-        int candidate_index;
-        double avg_approval;
-        int total_votes;
-        int total_pledges;
-        int server_data_count;  // 서버에서 가져온 데이터 개수
-    } CandidateRanking;
-    
-    CandidateRanking rankings[MAX_CANDIDATES];
+    CandidateRanking* rankings = malloc(sizeof(CandidateRanking) * (size_t)candidate_count_for_election);
     int ranking_count = 0;
     
-    for (int i = 0; i < candidate_count_for_election; i++) {
-        int candidate_idx = candidate_indices[i];
-        int total_likes = 0, total_dislikes = 0, pledge_count = 0;
-        int server_data_count = 0;  // 서버에서 가져온 데이터 개수
-        
-        // 해당 후보자의 모든 공약 평가 합계
-        for (int j = 0; j < g_pledge_count; j++) {
-            if (strcmp(g_pledges[j].candidate_id, g_candidates[candidate_idx].candidate_id) == 0) {
-                // 서버에서 실시간 통계 가져오기 시도
-                PledgeStatistics stats;
-                if (get_pledge_statistics_from_server(g_pledges[j].pledge_id, &stats)) {
-                    // 서버 실시간 데이터 사용
-                    total_likes += stats.like_count;
-                    total_dislikes += stats.dislike_count;
-                    server_data_count++;
-                } else {
-                    // 서버 연결 실패 시 로컬 데이터 사용
-                total_likes += g_pledges[j].like_count;
-                total_dislikes += g_pledges[j].dislike_count;
+    if (!rankings) {
+        printf("❌ 메모리 할당 실패\n");
+        wait_for_enter();
+        return;
+    }
+    
+    // 서버가 평가마다 갱신하는 후보자별 합계를 한 번에 조회 (공약을 훑지 않음)
+    VoteStandingEntry* standings = NULL;
+    int standing_count = get_standings_from_server("election", g_elections[election_index].election_id, &standings);
+    
+    if (standing_count >= 0) {
+        for (int i = 0; i < candidate_count_for_election; i++) {
+            CandidateRanking* ranking = &rankings[ranking_count++];
+            memset(ranking, 0, sizeof(CandidateRanking));
+            ranking->candidate_index = candidate_indices[i];
+            
+            for (int s = 0; s < standing_count; s++) {
+                if (strcmp(standings[s].id, g_candidates[candidate_indices[i]].candidate_id) == 0) {
+                    ranking->total_votes = standings[s].stats.total_votes;
+                    if (ranking->total_votes > 0) {
+                        ranking->avg_approval = ((double)standings[s].stats.like_count / ranking->total_votes) * 100.0;
+                    }
+                    ranking->total_pledges = standings[s].pledge_count;
+                    ranking->server_data_count = standings[s].pledge_count;
+                    break;
                 }
-                pledge_count++;
             }
         }
-        
-        double avg_approval = 0.0;
-        int total_votes = total_likes + total_dislikes;
-        
-        if (total_votes > 0) {
-            avg_approval = ((double)total_likes / total_votes) * 100.0;
+        free(standings);
+    } else {
+        ranking_count = sum_candidate_votes(candidate_indices, candidate_count_for_election,
+                                            g_elections[election_index].election_id, rankings);
+        if (ranking_count < 0) {
+            printf("❌ 메모리 할당 실패\n");
+            free(rankings);
+            wait_for_enter();
+            return;
         }
-        
-        rankings[ranking_count].candidate_index = candidate_idx;
-        rankings[ranking_count].avg_approval = avg_approval;
-        rankings[ranking_count].total_votes = total_votes;
-        rankings[ranking_count].total_pledges = pledge_count;
-        rankings[ranking_count].server_data_count = server_data_count;  // 서버 데이터 개수 저장
-        ranking_count++;
     }
     
-    // 지지율 기준으로 정렬 (버블 정렬)
-    for (int i = 0; i < ranking_count - 1; i++) {
-        for (int j = 0; j < ranking_count - i - 1; j++) {
-            if (rankings[j].avg_approval < rankings[j + 1].avg_approval) {
-                CandidateRanking temp = rankings[j];
-                rankings[j] = rankings[j + 1];
-                rankings[j + 1] = temp;
-            }
-        }
-    }
+    // 지지율 기준으로 정렬
+    qsort(rankings, (size_t)ranking_count, sizeof(CandidateRanking), compare_candidate_rankings);
     
     // 순위 표시
     printf("📊 후보자별 공약 지지율 순위 (실시간 데이터):\n\n");
@@ -2700,6 +2994,7 @@ void show_candidate_rankings(int election_index) {
     printf("🔄📁 = 실시간 + 로컬 데이터 혼합\n");
     printf("📁 = 로컬 캐시 데이터만 사용 (서버 연결 실패)\n\n");
     
+    free(rankings);
     wait_for_enter();
 }
 
@@ -2759,20 +3054,19 @@ void show_election_selection(void) {
 void show_candidate_selection(int election_index) {
     int choice;
     char input[MAX_INPUT_LEN];
-    int candidate_count_for_election = 0;
-    int candidate_indices[MAX_CANDIDATES];
+    const int32_t* candidate_indices = NULL;
     
     // 후보자 데이터 로드
     if (g_candidate_count == 0) {
         g_candidate_count = load_candidates_from_file();
     }
     
-    // 해당 선거의 후보자들 찾기
-    for (int i = 0; i < g_candidate_count; i++) {
-        if (strcmp(g_candidates[i].election_id, g_elections[election_index].election_id) == 0) {
-            candidate_indices[candidate_count_for_election] = i;
-            candidate_count_for_election++;
-        }
+    // 해당 선거의 후보자들 (인접 목록에서 바로 꺼냄)
+    int candidate_count_for_election = find_election_candidates(election_index, &candidate_indices);
+    if (candidate_count_for_election < 0) {
+        printf("❌ 메모리 할당 실패\n");
+        wait_for_enter();
+        return;
     }
     
     while (1) {
@@ -2824,20 +3118,19 @@ void show_candidate_selection(int election_index) {
 void show_pledge_selection(int candidate_index) {
     int choice;
     char input[MAX_INPUT_LEN];
-    int pledge_count_for_candidate = 0;
-    int pledge_indices[MAX_PLEDGES];
+    const int32_t* pledge_indices = NULL;
     
     // 공약 데이터 로드
     if (g_pledge_count == 0) {
         g_pledge_count = load_pledges_from_file();
     }
     
-    // 해당 후보자의 공약들 찾기
-    for (int i = 0; i < g_pledge_count; i++) {
-        if (strcmp(g_pledges[i].candidate_id, g_candidates[candidate_index].candidate_id) == 0) {
-            pledge_indices[pledge_count_for_candidate] = i;
-            pledge_count_for_candidate++;
-        }
+    // 해당 후보자의 공약들 (인접 목록에서 바로 꺼냄)
+    int pledge_count_for_candidate = find_candidate_pledges(candidate_index, &pledge_indices);
+    if (pledge_count_for_candidate < 0) {
+        printf("❌ 메모리 할당 실패\n");
+        wait_for_enter();
+        return;
     }
     
     while (1) {
@@ -2912,13 +3205,13 @@ int send_evaluation_to_server(const char* pledge_id, int evaluation_type) {
     request.data_length = strlen(message_data);
     
     // 서버로 요청 전송
-    if (send(g_client_state.server_socket, (char*)&request, sizeof(NetworkMessage), 0) == SOCKET_ERROR) {
+    if (!send_request_to_server(&request)) {
         printf("❌ 서버로 평가 요청 전송 실패\n");
         return 0;
     }
     
     // 서버 응답 받기
-    if (recv(g_client_state.server_socket, (char*)&response, sizeof(NetworkMessage), 0) <= 0) {
+    if (!receive_response_from_server(&response)) {
         printf("❌ 서버 응답 수신 실패\n");
         return 0;
     }
@@ -2950,12 +3243,12 @@ int get_user_evaluation_from_server(const char* pledge_id) {
     request.data_length = strlen(pledge_id);
     
     // 서버로 요청 전송
-    if (send(g_client_state.server_socket, (char*)&request, sizeof(NetworkMessage), 0) == SOCKET_ERROR) {
+    if (!send_request_to_server(&request)) {
         return 0;
     }
     
     // 서버 응답 받기
-    if (recv(g_client_state.server_socket, (char*)&response, sizeof(NetworkMessage), 0) <= 0) {
+    if (!receive_response_from_server(&response)) {
         return 0;
     }
     
@@ -2985,13 +3278,13 @@ int cancel_evaluation_on_server(const char* pledge_id) {
     request.data_length = strlen(pledge_id);
     
     // 서버로 요청 전송
-    if (send(g_client_state.server_socket, (char*)&request, sizeof(NetworkMessage), 0) == SOCKET_ERROR) {
+    if (!send_request_to_server(&request)) {
         printf("❌ 서버로 취소 요청 전송 실패\n");
         return 0;
     }
     
     // 서버 응답 받기
-    if (recv(g_client_state.server_socket, (char*)&response, sizeof(NetworkMessage), 0) <= 0) {
+    if (!receive_response_from_server(&response)) {
         printf("❌ 서버 응답 수신 실패\n");
         return 0;
     }
@@ -3023,7 +3316,7 @@ int get_pledge_statistics_from_server(const char* pledge_id, PledgeStatistics* s
     request.data_length = strlen(pledge_id);
     
     // 서버로 요청 전송
-    if (send(g_client_state.server_socket, (char*)&request, sizeof(NetworkMessage), 0) == SOCKET_ERROR) {
+    if (!send_request_to_server(&request)) {
         return 0;
     }
     
@@ -3039,7 +3332,7 @@ int get_pledge_statistics_from_server(const char* pledge_id, PledgeStatistics* s
         return 0; // 타임아웃 또는 오류
     }
     
-    if (recv(g_client_state.server_socket, (char*)&response, sizeof(NetworkMessage), 0) <= 0) {
+    if (!receive_response_from_server(&response)) {
         return 0;
     }
     
@@ -3062,6 +3355,166 @@ int get_pledge_statistics_from_server(const char* pledge_id, PledgeStatistics* s
     return 0;
 }
 
+// 공약 통계 일괄 조회 (한 번의 왕복으로 후보자/선거 단위 통계를 모두 받음)
+// scope: "pledges" | "candidate" | "election"
+// 반환값: 항목 수 (실패 시 -1), *entries는 호출자가 free
+int get_statistics_batch_from_server(const char* scope, const char* value, PledgeStatisticsEntry** entries) {
+    *entries = NULL;
+    if (!g_client_state.is_connected || !g_client_state.is_logged_in || !scope || !value) {
+        return -1;
+    }
+    
+    Frame request, response;
+    frame_init(&request);
+    request.message_type = MSG_GET_STATISTICS_BATCH;
+    request.status_code = STATUS_SUCCESS;
+    safe_strcpy(request.user_id, g_client_state.user_id, sizeof(request.user_id));
+    safe_strcpy(request.session_id, g_client_state.session_id, sizeof(request.session_id));
+    if (!frame_appendf(&request, "%s:%s", scope, value)) {
+        frame_free(&request);
+        return -1;
+    }
+    
+    int ok = exchange_frame_with_server(&request, &response);
+    frame_free(&request);
+    if (!ok) {
+        return -1;
+    }
+    
+    int count = -1;
+    if (response.status_code == STATUS_SUCCESS && response.payload &&
+        sscanf(response.payload, "COUNT=%d", &count) == 1 && count >= 0) {
+        *entries = calloc(count > 0 ? (size_t)count : 1, sizeof(PledgeStatisticsEntry));
+        if (!*entries) {
+            count = -1;
+        } else {
+            // 줄 형식: 공약ID|후보자ID|좋아요|싫어요|총투표|지지율
+            int parsed = 0;
+            char* line = strchr(response.payload, '\n');
+            while (line && parsed < count) {
+                line++;
+                PledgeStatisticsEntry* entry = &(*entries)[parsed];
+                if (sscanf(line, "%255[^|]|%255[^|]|%d|%d|%d|%lf",
+                           entry->pledge_id, entry->candidate_id,
+                           &entry->stats.like_count, &entry->stats.dislike_count,
+                           &entry->stats.total_votes, &entry->stats.approval_rate) == 6) {
+                    parsed++;
+                }
+                line = strchr(line, '\n');
+            }
+            count = parsed;
+        }
+    }
+    
+    frame_free(&response);
+    return count;
+}
+
+// 공약 지지율 순위 조회 (scope: "global" | "election" | "category", value는 global일 때 NULL)
+// 서버가 유지하는 순위표에서 상위 max_count개를 한 번에 받아옴, 실패 시 -1
+int get_leaderboard_from_server(const char* scope, const char* value, PledgeRankingEntry entries[], int max_count) {
+    if (!g_client_state.is_connected || !g_client_state.is_logged_in || !scope || max_count <= 0) {
+        return -1;
+    }
+    
+    Frame request, response;
+    frame_init(&request);
+    request.message_type = MSG_GET_LEADERBOARD;
+    request.status_code = STATUS_SUCCESS;
+    safe_strcpy(request.user_id, g_client_state.user_id, sizeof(request.user_id));
+    safe_strcpy(request.session_id, g_client_state.session_id, sizeof(request.session_id));
+    int ok = value ? frame_appendf(&request, "%d|%s:%s", max_count, scope, value)
+                   : frame_appendf(&request, "%d|%s", max_count, scope);
+    if (!ok) {
+        frame_free(&request);
+        return -1;
+    }
+    
+    ok = exchange_frame_with_server(&request, &response);
+    frame_free(&request);
+    if (!ok) {
+        return -1;
+    }
+    
+    int count = -1;
+    if (response.status_code == STATUS_SUCCESS && response.payload &&
+        sscanf(response.payload, "COUNT=%d", &count) == 1 && count >= 0) {
+        // 줄 형식: 공약ID|후보자ID|분야|좋아요|싫어요|총투표|지지율|제목
+        int parsed = 0;
+        char* line = strchr(response.payload, '\n');
+        while (line && parsed < count && parsed < max_count) {
+            line++;
+            PledgeRankingEntry* entry = &entries[parsed];
+            memset(entry, 0, sizeof(PledgeRankingEntry));
+            if (sscanf(line, "%255[^|]|%255[^|]|%255[^|]|%d|%d|%d|%lf|%255[^\n]",
+                       entry->pledge_id, entry->candidate_id, entry->category,
+                       &entry->stats.like_count, &entry->stats.dislike_count,
+                       &entry->stats.total_votes, &entry->stats.approval_rate, entry->title) >= 7) {
+                parsed++;
+            }
+            line = strchr(line, '\n');
+        }
+        count = parsed;
+    }
+    
+    frame_free(&response);
+    return count;
+}
+
+// 후보자별/선거별 평가 합계 조회 (scope: "election"이면 value 선거의 후보자별, "elections"면 선거별, value는 NULL)
+// 서버가 평가마다 갱신하는 합계를 지지율 순서로 받아옴, 실패 시 -1
+int get_standings_from_server(const char* scope, const char* value, VoteStandingEntry** entries) {
+    *entries = NULL;
+    if (!g_client_state.is_connected || !g_client_state.is_logged_in || !scope) {
+        return -1;
+    }
+    
+    Frame request, response;
+    frame_init(&request);
+    request.message_type = MSG_GET_STANDINGS;
+    request.status_code = STATUS_SUCCESS;
+    safe_strcpy(request.user_id, g_client_state.user_id, sizeof(request.user_id));
+    safe_strcpy(request.session_id, g_client_state.session_id, sizeof(request.session_id));
+    int ok = value ? frame_appendf(&request, "%s:%s", scope, value) : frame_appendf(&request, "%s", scope);
+    if (!ok) {
+        frame_free(&request);
+        return -1;
+    }
+    
+    ok = exchange_frame_with_server(&request, &response);
+    frame_free(&request);
+    if (!ok) {
+        return -1;
+    }
+    
+    int count = -1;
+    if (response.status_code == STATUS_SUCCESS && response.payload &&
+        sscanf(response.payload, "COUNT=%d", &count) == 1 && count >= 0) {
+        *entries = calloc(count > 0 ? (size_t)count : 1, sizeof(VoteStandingEntry));
+        if (!*entries) {
+            count = -1;
+        } else {
+            // 줄 형식: ID|좋아요|싫어요|총투표|지지율|공약수
+            int parsed = 0;
+            char* line = strchr(response.payload, '\n');
+            while (line && parsed < count) {
+                line++;
+                VoteStandingEntry* entry = &(*entries)[parsed];
+                if (sscanf(line, "%255[^|]|%d|%d|%d|%lf|%d",
+                           entry->id, &entry->stats.like_count, &entry->stats.dislike_count,
+                           &entry->stats.total_votes, &entry->stats.approval_rate, &entry->pledge_count) == 6) {
+                    parsed++;
+                }
+                line = strchr(line, '\n');
+            }
+            count = parsed;
+        }
+    }
+    
+    frame_free(&response);
+    return count;
+}
+
 // 공약 상세 내용 및 평가
 void show_pledge_detail(int pledge_index) {
     int choice;
@@ -0,0 +1,73 @@
+#include "adjacency.h"
+#include <stdlib.h>
+#include <string.h>
+
+void adjacency_index_init(AdjacencyIndex* index) {
+    memset(index, 0, sizeof(AdjacencyIndex));
+}
+
+void adjacency_index_free(AdjacencyIndex* index) {
+    free(index->offsets);
+    free(index->items);
+    memset(index, 0, sizeof(AdjacencyIndex));
+}
+
+// 크기가 모자랄 때만 늘림 (실패하면 기존 배열 유지)
+static int reserve(int32_t** array, size_t* capacity, size_t needed) {
+    if (needed <= *capacity) return 1;
+
+    int32_t* grown = realloc(*array, needed * sizeof(int32_t));
+    if (!grown) return 0;
+    *array = grown;
+    *capacity = needed;
+    return 1;
+}
+
+int adjacency_index_build(AdjacencyIndex* index, const int32_t* group_of, int item_count, int group_count) {
+    if (item_count < 0) item_count = 0;
+    if (group_count < 0) group_count = 0;
+
+    if (!reserve(&index->offsets, &index->group_capacity, (size_t)group_count + 1) ||
+        !reserve(&index->items, &index->item_capacity, (size_t)(item_count > 0 ? item_count : 1))) {
+        index->group_count = 0;
+        index->item_count = 0;
+        return 0;
+    }
+
+    // 그룹별 항목 수 -> 시작 위치
+    memset(index->offsets, 0, ((size_t)group_count + 1) * sizeof(int32_t));
+    for (int i = 0; i < item_count; i++) {
+        int32_t g = group_of[i];
+        if (g >= 0 && g < group_count) index->offsets[g + 1]++;
+    }
+    for (int g = 0; g < group_count; g++) {
+        index->offsets[g + 1] += index->offsets[g];
+    }
+
+    // 항목 배치 (offsets를 채우는 커서로 잠시 빌려 쓴 뒤 되돌림, 원래 순서 유지)
+    for (int i = 0; i < item_count; i++) {
+        int32_t g = group_of[i];
+        if (g >= 0 && g < group_count) index->items[index->offsets[g]++] = i;
+    }
+    for (int g = group_count; g > 0; g--) {
+        index->offsets[g] = index->offsets[g - 1];
+    }
+    index->offsets[0] = 0;
+
+    index->group_count = group_count;
+    index->item_count = index->offsets[group_count];
+    return 1;
+}
+
+int adjacency_index_range(const AdjacencyIndex* index, int group, const int32_t** items) {
+    if (group < 0 || group >= index->group_count) {
+        *items = NULL;
+        return 0;
+    }
+    *items = index->items + index->offsets[group];
+    return index->offsets[group + 1] - index->offsets[group];
+}
+
+size_t adjacency_index_memory(const AdjacencyIndex* index) {
+    return (index->group_capacity + index->item_capacity) * sizeof(int32_t);
+}
@@ -1,8 +1,14 @@
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "api.h"
+#include "api_cache.h"
 #include "utils.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #ifdef _WIN32
     #include <windows.h>
@@ -151,6 +157,14 @@ size_t write_callback(void* contents, size_t size, size_t nmemb, APIResponse* re
     return total_size;
 }
 
+#ifdef _WIN32
+typedef HINTERNET HttpHandle;
+#else
+typedef CURL* HttpHandle;
+#endif
+
+static int cached_get(HttpHandle handle, const char* url, APIResponse* response, APIResponseSource* source);
+
 // API 요청 실행
 int make_api_request(APIClient* client, const char* url, APIResponse* response) {
     if (!client || !client->is_initialized || !url || !response) return 0;
@@ -158,80 +172,258 @@ int make_api_request(APIClient* client, const char* url, APIResponse* response)
     write_log("INFO", "API 요청 시작");
     printf("🌐 API 호출 중: %s\n", url);
     
-    // 응답 구조체 초기화
-    response->data = malloc(1);
-    response->size = 0;
-    
+    APIResponseSource source;
 #ifdef _WIN32
-    // Windows Internet API 사용
-    HINTERNET hRequest = InternetOpenUrlA(client->hInternet, url, NULL, 0, 
-                                         INTERNET_FLAG_RELOAD, 0);
-    if (!hRequest) {
-        write_error_log("make_api_request", "URL 열기 실패");
-        printf("❌ API 요청 실패: URL 열기 실패\n");
-        free(response->data);
+    int ok = cached_get(client->hInternet, url, response, &source);
+#else
+    int ok = cached_get(client->curl, url, response, &source);
+#endif
+    if (!ok) {
+        write_error_log("make_api_request", "API 요청 실패");
+        printf("❌ API 요청 실패\n");
         return 0;
     }
     
-    // 데이터 읽기
-    char buffer[4096];
-    DWORD bytesRead;
-    
-    while (InternetReadFile(hRequest, buffer, sizeof(buffer), &bytesRead) && bytesRead > 0) {
-        response->data = realloc(response->data, response->size + bytesRead + 1);
-        if (!response->data) {
-            write_error_log("make_api_request", "메모리 할당 실패");
-            InternetCloseHandle(hRequest);
-            return 0;
-        }
-        
-        memcpy(response->data + response->size, buffer, bytesRead);
-        response->size += bytesRead;
+    // 빈 응답도 호출자가 문자열로 쓸 수 있게
+    if (!response->data) {
+        response->data = calloc(1, 1);
+        if (!response->data) return 0;
     }
     
-    response->data[response->size] = '\0';
-    InternetCloseHandle(hRequest);
+    write_log("INFO", "API 요청 완료");
+    printf("✅ API 응답 수신 완료 (%zu bytes%s)\n", response->size,
+           source == API_SOURCE_NETWORK ? "" : ", 캐시");
+    return 1;
+}
+
+// API 엔드포인트 정의 - 공공데이터포털 문서 기준으로 수정
+#define ELECTION_CODE_ENDPOINT "/9760000/CommonCodeService/getCommonSgCodeList"
+#define CANDIDATE_INFO_ENDPOINT "/9760000/PofelcddInfoInqireService/getPofelcddRegistSttusInfoInqire"
+#define PLEDGE_INFO_ENDPOINT "/9760000/ElecPrmsInfoInqireService/getCnddtElecPrmsInfoInqire"
+
+// API 서버 주소 (시험용 모의 서버로 바꿀 수 있음)
+static char g_api_base_url[MAX_URL_LEN] = API_BASE_URL;
+
+void api_set_base_url(const char* base_url) {
+    if (!base_url || !base_url[0]) return;
+    strncpy(g_api_base_url, base_url, sizeof(g_api_base_url) - 1);
+    g_api_base_url[sizeof(g_api_base_url) - 1] = '\0';
+
+    // 끝의 '/'는 엔드포인트 경로와 겹치므로 제거
+    size_t len = strlen(g_api_base_url);
+    while (len > 0 && g_api_base_url[len - 1] == '/') {
+        g_api_base_url[--len] = '\0';
+    }
+}
+
+const char* api_get_base_url(void) {
+    return g_api_base_url;
+}
+
+// 엔드포인트별 토큰 버킷 (프로세스 전체에서 공유)
+static TokenBucket g_api_rate_limits[API_ENDPOINT_COUNT] = {
+    TOKEN_BUCKET_INITIALIZER(API_RATE_DEFAULT, API_RATE_DEFAULT_BURST),
+    TOKEN_BUCKET_INITIALIZER(API_RATE_DEFAULT, API_RATE_DEFAULT_BURST),
+    TOKEN_BUCKET_INITIALIZER(API_RATE_DEFAULT, API_RATE_DEFAULT_BURST)
+};
+
+static const char* g_api_endpoint_names[API_ENDPOINT_COUNT] = { "election", "candidate", "pledge" };
+
+void api_set_rate_limit(APIEndpoint endpoint, double requests_per_second, double burst) {
+    if (endpoint < 0 || endpoint >= API_ENDPOINT_COUNT) return;
+    token_bucket_configure(&g_api_rate_limits[endpoint], requests_per_second, burst);
+}
+
+void api_get_rate_limit(APIEndpoint endpoint, TokenBucket* stats) {
+    if (endpoint < 0 || endpoint >= API_ENDPOINT_COUNT) return;
+    token_bucket_get_stats(&g_api_rate_limits[endpoint], stats);
+}
+
+int api_find_endpoint(const char* name) {
+    for (int i = 0; i < API_ENDPOINT_COUNT; i++) {
+        if (strcmp(name, g_api_endpoint_names[i]) == 0) return i;
+    }
+    return -1;
+}
+
+const char* api_endpoint_name(APIEndpoint endpoint) {
+    if (endpoint < 0 || endpoint >= API_ENDPOINT_COUNT) return "unknown";
+    return g_api_endpoint_names[endpoint];
+}
+
+// =====================================================
+// 응답 캐시를 거치는 요청 (api_cache.h)
+// =====================================================
+
+#ifdef _WIN32
+// 조건부 요청 헤더 ("If-None-Match: ...\r\nIf-Modified-Since: ...\r\n", TTL이 지난 캐시가 없으면 빈 문자열)
+static void format_conditional_headers(const APICacheEntry* cached, char* headers, size_t size) {
+    int offset = 0;
+    headers[0] = '\0';
+    if (cached->state != API_CACHE_STALE) return;
+    if (cached->validators.etag[0]) {
+        offset = snprintf(headers, size, "If-None-Match: %s\r\n", cached->validators.etag);
+    }
+    if (cached->validators.last_modified[0] && offset >= 0 && (size_t)offset < size) {
+        snprintf(headers + offset, size - offset, "If-Modified-Since: %s\r\n", cached->validators.last_modified);
+    }
+}
+
+// WinINet GET 하나 (status에 HTTP 상태 코드, received에 ETag/Last-Modified, 연결/읽기 실패 시 0)
+static int wininet_fetch(HINTERNET internet, const char* url, const APICacheEntry* cached, APIResponse* response,
+                         long* status, APICacheValidators* received) {
+    char headers[2 * API_CACHE_MAX_VALIDATOR + 64];
+    format_conditional_headers(cached, headers, sizeof(headers));
     
-#else
-    // curl 옵션 설정
-    curl_easy_setopt(client->curl, CURLOPT_URL, url);
-    curl_easy_setopt(client->curl, CURLOPT_WRITEFUNCTION, write_callback);
-    curl_easy_setopt(client->curl, CURLOPT_WRITEDATA, response);
-    curl_easy_setopt(client->curl, CURLOPT_TIMEOUT, 30L);  // 30초 타임아웃
-    curl_easy_setopt(client->curl, CURLOPT_FOLLOWLOCATION, 1L);
+    DWORD flags = INTERNET_FLAG_RELOAD | INTERNET_FLAG_NO_CACHE_WRITE;
+    if (strncmp(url, "https://", 8) == 0) {
+        flags |= INTERNET_FLAG_SECURE;
+    }
+    HINTERNET request = InternetOpenUrlA(internet, url, headers[0] ? headers : NULL, headers[0] ? (DWORD)-1L : 0, flags, 0);
+    if (!request) return 0;
+    
+    DWORD code = 0;
+    DWORD size = sizeof(code);
+    HttpQueryInfoA(request, HTTP_QUERY_STATUS_CODE | HTTP_QUERY_FLAG_NUMBER, &code, &size, NULL);
+    *status = (long)code;
+    
+    size = sizeof(received->etag);
+    if (!HttpQueryInfoA(request, HTTP_QUERY_ETAG, received->etag, &size, NULL)) received->etag[0] = '\0';
+    size = sizeof(received->last_modified);
+    if (!HttpQueryInfoA(request, HTTP_QUERY_LAST_MODIFIED, received->last_modified, &size, NULL)) {
+        received->last_modified[0] = '\0';
+    }
     
-    // 요청 실행
-    CURLcode res = curl_easy_perform(client->curl);
+    char buffer[4096];
+    DWORD bytes_read;
+    int ok = 1;
+    while (InternetReadFile(request, buffer, sizeof(buffer), &bytes_read) && bytes_read > 0) {
+        if (write_callback(buffer, 1, bytes_read, response) != bytes_read) {
+            ok = 0;
+            break;
+        }
+    }
+    InternetCloseHandle(request);
+    return ok;
+}
+#else
+// 응답 헤더 한 줄마다 호출 (ETag/Last-Modified만 모음)
+static size_t header_callback(char* buffer, size_t size, size_t nitems, void* userdata) {
+    api_cache_parse_header((APICacheValidators*)userdata, buffer, size * nitems);
+    return size * nitems;
+}
+
+// curl 핸들에 GET 하나 설정 (TTL이 지난 캐시가 있으면 조건부 요청 헤더 목록을 돌려줌, curl_slist_free_all로 해제)
+static struct curl_slist* setup_curl_get(CURL* curl, const char* url, const APICacheEntry* cached,
+                                         APIResponse* response, APICacheValidators* received) {
+    curl_easy_setopt(curl, CURLOPT_URL, url);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, response);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, header_callback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, received);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 30L);  // 30초 타임아웃
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    
+    struct curl_slist* headers = NULL;
+    if (cached->state == API_CACHE_STALE) {
+        char header[API_CACHE_MAX_VALIDATOR + 32];
+        if (cached->validators.etag[0]) {
+            snprintf(header, sizeof(header), "If-None-Match: %s", cached->validators.etag);
+            headers = curl_slist_append(headers, header);
+        }
+        if (cached->validators.last_modified[0]) {
+            snprintf(header, sizeof(header), "If-Modified-Since: %s", cached->validators.last_modified);
+            headers = curl_slist_append(headers, header);
+        }
+    }
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    return headers;
+}
+
+// curl GET 하나 (status에 HTTP 상태 코드, received에 ETag/Last-Modified, 연결 실패 시 0)
+static int curl_fetch(CURL* curl, const char* url, const APICacheEntry* cached, APIResponse* response,
+                      long* status, APICacheValidators* received) {
+    struct curl_slist* headers = setup_curl_get(curl, url, cached, response, received);
+    CURLcode res = curl_easy_perform(curl);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, NULL);
+    curl_slist_free_all(headers);
     
     if (res != CURLE_OK) {
-        write_error_log("make_api_request", curl_easy_strerror(res));
-        printf("❌ API 요청 실패: %s\n", curl_easy_strerror(res));
-        free(response->data);
+        write_error_log("curl_fetch", curl_easy_strerror(res));
+        printf("❌ HTTP 요청 실패: %s\n", curl_easy_strerror(res));
         return 0;
     }
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, status);
+    return 1;
+}
+#endif
+
+// 네트워크 결과를 캐시와 맞춤 (응답을 쓸 수 있으면 1)
+// 200이면 저장, 304면 저장된 본문으로 바꾸고, 실패했어도 TTL이 지난 캐시가 있으면 그 응답을 대신 사용
+static int settle_response(const char* url, APICacheEntry* cached, int transferred, long status,
+                           const APICacheValidators* received, APIResponse* response, APIResponseSource* source) {
+    if (transferred && status == 200) {
+        api_cache_store(url, received, response->data, response->size);
+        *source = API_SOURCE_NETWORK;
+        return 1;
+    }
+    if (cached->state != API_CACHE_STALE) return 0;
     
-    // HTTP 응답 코드 확인
-    long response_code;
-    curl_easy_getinfo(client->curl, CURLINFO_RESPONSE_CODE, &response_code);
+    if (transferred && status == 304) {
+        api_cache_revalidated(url, cached, received);
+        *source = API_SOURCE_REVALIDATED;
+    } else {
+        api_cache_served_stale();
+        *source = API_SOURCE_STALE;
+    }
+    free(response->data);
+    *response = cached->body;
+    cached->body.data = NULL;
+    cached->body.size = 0;
+    return 1;
+}
+
+// 캐시를 거친 GET 하나 (TTL 안이면 요청하지 않고, API 엔드포인트면 보내기 전에 토큰을 받음, 실패 시 0)
+static int cached_get(HttpHandle handle, const char* url, APIResponse* response, APIResponseSource* source) {
+    APICacheEntry cached;
+    response->data = NULL;
+    response->size = 0;
     
-    if (response_code != 200) {
-        write_error_log("make_api_request", "HTTP 오류");
-        printf("❌ HTTP 오류: %ld\n", response_code);
-        free(response->data);
-        return 0;
+    if (api_cache_lookup(url, &cached) == API_CACHE_FRESH) {
+        *response = cached.body;
+        *source = API_SOURCE_CACHE;
+        printf("💾 캐시된 응답 사용 (%zu bytes, %lld초 전 수신)\n", response->size,
+               (long long)(time(NULL) - cached.fetched_at));
+        return 1;
     }
+    
+    int endpoint = api_cache_endpoint_for_url(url);
+    if (endpoint >= 0) token_bucket_acquire(&g_api_rate_limits[endpoint]);
+    
+    long status = 0;
+    APICacheValidators received;
+    memset(&received, 0, sizeof(received));
+#ifdef _WIN32
+    int transferred = wininet_fetch(handle, url, &cached, response, &status, &received);
+#else
+    int transferred = curl_fetch(handle, url, &cached, response, &status, &received);
 #endif
     
-    write_log("INFO", "API 요청 완료");
-    printf("✅ API 응답 수신 완료 (%zu bytes)\n", response->size);
-    return 1;
+    int ok = settle_response(url, &cached, transferred, status, &received, response, source);
+    if (!ok) {
+        if (transferred) printf("❌ HTTP 오류: %ld\n", status);
+        free(response->data);
+        response->data = NULL;
+        response->size = 0;
+    } else if (*source == API_SOURCE_REVALIDATED) {
+        printf("💾 변경 없음 (304), 캐시된 응답 사용 (%zu bytes)\n", response->size);
+    } else if (*source == API_SOURCE_STALE) {
+        printf("⚠️ 요청 실패, 이전에 받은 응답 사용 (%zu bytes)\n", response->size);
+    }
+    api_cache_entry_free(&cached);
+    return ok;
 }
 
-// API 엔드포인트 정의 - 공공데이터포털 문서 기준으로 수정
-#define ELECTION_CODE_ENDPOINT "/9760000/CommonCodeService/getCommonSgCodeList"
-#define CANDIDATE_INFO_ENDPOINT "/9760000/PofelcddInfoInqireService/getPofelcddRegistSttusInfoInqire"
-#define PLEDGE_INFO_ENDPOINT "/9760000/ElecPrmsInfoInqireService/getCnddtElecPrmsInfoInqire"
-
 // URL 인코딩 함수 추가
 char* url_encode(const char* str) {
     if (!str) return NULL;
@@ -254,81 +446,361 @@ char* url_encode(const char* str) {
     return encoded;
 }
 
-// HTTP 요청 함수 (Windows Internet API 사용) - HTTPS 지원 추가
+// HTTP 요청 함수 (Windows Internet API / curl) - HTTPS 지원
 int http_request(const char* url, char* response_buffer, size_t buffer_size) {
     if (!url || !response_buffer || buffer_size == 0) return -1;
     
-#ifdef _WIN32
     printf("🔗 HTTP 요청 시작: %s\n", url);
     
-    HINTERNET hInternet = NULL;
-    HINTERNET hRequest = NULL;
-    int result = -1;
-    
-    // 응답 버퍼 초기화
     response_buffer[0] = '\0';
     
+#ifdef _WIN32
     // Internet API 초기화
-    hInternet = InternetOpenA("ElectionAPI/1.0", 
-                             INTERNET_OPEN_TYPE_PRECONFIG, 
-                             NULL, NULL, 0);
-    if (!hInternet) {
+    HttpHandle handle = InternetOpenA("ElectionAPI/1.0", INTERNET_OPEN_TYPE_PRECONFIG, NULL, NULL, 0);
+    if (!handle) {
         printf("❌ InternetOpen 실패\n");
-        goto cleanup;
+        return -1;
     }
-    
-    // HTTPS 지원을 위한 플래그 추가
-    DWORD flags = INTERNET_FLAG_RELOAD | INTERNET_FLAG_NO_CACHE_WRITE;
-    if (strncmp(url, "https://", 8) == 0) {
-        flags |= INTERNET_FLAG_SECURE;
+#else
+    HttpHandle handle = curl_easy_init();
+    if (!handle) {
+        printf("❌ curl 핸들 생성 실패\n");
+        return -1;
     }
+#endif
     
-    // URL 요청
-    hRequest = InternetOpenUrlA(hInternet, url, NULL, 0, flags, 0);
-    if (!hRequest) {
-        printf("❌ InternetOpenUrl 실패\n");
-        goto cleanup;
-    }
+    APIResponse response;
+    APIResponseSource source;
+    int ok = cached_get(handle, url, &response, &source);
     
-    // 데이터 읽기
-    DWORD bytesRead;
-    DWORD totalBytes = 0;
-    char buffer[4096];
+#ifdef _WIN32
+    InternetCloseHandle(handle);
+#else
+    curl_easy_cleanup(handle);
+#endif
     
-    while (InternetReadFile(hRequest, buffer, sizeof(buffer) - 1, &bytesRead) && bytesRead > 0) {
-        // 버퍼 크기 검사
-        if (totalBytes + bytesRead >= buffer_size - 1) {
+    int result = -1;
+    if (!ok) {
+        printf("❌ HTTP 요청 실패\n");
+    } else if (response.size == 0) {
+        printf("❌ HTTP 응답 데이터 없음\n");
+    } else {
+        size_t copy = response.size;
+        if (copy >= buffer_size) {
             printf("⚠️ 응답 버퍼 크기 초과, 데이터 잘림 (최대: %zu)\n", buffer_size - 1);
+            copy = buffer_size - 1;
+        }
+        memcpy(response_buffer, response.data, copy);
+        response_buffer[copy] = '\0';
+        if (source == API_SOURCE_NETWORK) {
+            printf("✅ HTTP 응답 수신 완료: %zu bytes\n", response.size);
+        }
+        result = 0;
+    }
+    
+    free(response.data);
+    return result;
+}
+
+// 경과 시간 측정 (밀리초)
+static double now_ms(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+#endif
+}
+
+// 요청의 엔드포인트 토큰 예약 (기다려야 할 밀리초)
+static double reserve_request(const APIFetchRequest* request) {
+    APIEndpoint endpoint = request->endpoint;
+    if (endpoint < 0 || endpoint >= API_ENDPOINT_COUNT) endpoint = API_ENDPOINT_PLEDGE;
+    return token_bucket_reserve(&g_api_rate_limits[endpoint]);
+}
+
+// 요청마다 캐시 상태 (api_fetch_all 안에서만 사용)
+typedef struct {
+    APICacheEntry cached;                   // 조회한 캐시 (TTL이 지났으면 조건부 요청에 사용)
+    APICacheValidators received;            // 응답의 ETag/Last-Modified
+    long status;                            // HTTP 상태 코드
+#ifndef _WIN32
+    struct curl_slist* headers;             // 조건부 요청 헤더
+#endif
+} FetchCacheSlot;
+
+// 요청 하나 마무리 (캐시와 맞춘 뒤 status/source 설정, 응답을 쓸 수 있으면 1)
+static int finish_request(APIFetchRequest* request, FetchCacheSlot* slot, int transferred) {
+    APIResponseSource source = API_SOURCE_NETWORK;
+    int ok = settle_response(request->url, &slot->cached, transferred, slot->status, &slot->received,
+                             &request->response, &source);
+    request->status = ok ? 0 : -1;
+    request->source = source;
+    api_cache_entry_free(&slot->cached);
+    return ok;
+}
+
+static void count_finished(APIFetchStats* stats, const APIFetchRequest* request) {
+    if (request->status != 0) {
+        stats->failed++;
+        return;
+    }
+    stats->succeeded++;
+    if (request->source == API_SOURCE_REVALIDATED) stats->revalidated++;
+}
+
+#ifdef _WIN32
+// Windows: 작업 스레드들이 다음 요청 번호를 나눠 갖고 WinINet으로 받음 (완료 콜백은 임계 구역 안에서)
+typedef struct {
+    APIClient* client;
+    APIFetchRequest* requests;
+    FetchCacheSlot* slots;
+    const int* pending;                     // 캐시에서 바로 넘기지 못해 보낼 요청 번호
+    int pending_count;
+    int next;
+    int in_flight;
+    APIFetchCallback on_complete;
+    void* context;
+    APIFetchStats* stats;
+    CRITICAL_SECTION lock;
+} FetchShared;
+
+static DWORD WINAPI fetch_worker(LPVOID param) {
+    FetchShared* shared = (FetchShared*)param;
+    
+    for (;;) {
+        EnterCriticalSection(&shared->lock);
+        if (shared->next >= shared->pending_count) {
+            LeaveCriticalSection(&shared->lock);
             break;
         }
+        int index = shared->pending[shared->next++];
+        APIFetchRequest* request = &shared->requests[index];
+        FetchCacheSlot* slot = &shared->slots[index];
+        if (++shared->in_flight > shared->stats->peak_in_flight) {
+            shared->stats->peak_in_flight = shared->in_flight;
+        }
+        LeaveCriticalSection(&shared->lock);
+        
+        // 엔드포인트 토큰을 받을 때까지 대기
+        double wait_ms = reserve_request(request);
+        if (wait_ms > 0.0) Sleep((DWORD)(wait_ms + 0.5));
         
-        // 안전한 문자열 복사
-        buffer[bytesRead] = '\0';
+        double begin = now_ms();
+        int transferred = wininet_fetch(shared->client->hInternet, request->url, &slot->cached, &request->response,
+                                        &slot->status, &slot->received);
+        finish_request(request, slot, transferred);
+        request->elapsed_ms = now_ms() - begin;
         
-        // strcat 대신 더 안전한 방법 사용
-        if (totalBytes + bytesRead < buffer_size) {
-            memcpy(response_buffer + totalBytes, buffer, bytesRead);
-            totalBytes += bytesRead;
-            response_buffer[totalBytes] = '\0';
+        EnterCriticalSection(&shared->lock);
+        shared->in_flight--;
+        count_finished(shared->stats, request);
+        if (shared->on_complete) shared->on_complete(request, shared->context);
+        LeaveCriticalSection(&shared->lock);
+        
+        free(request->response.data);
+        request->response.data = NULL;
+        request->response.size = 0;
+    }
+    return 0;
+}
+#endif
+
+int api_fetch_all(APIClient* client, APIFetchRequest* requests, int count, const APIFetchOptions* options,
+                  APIFetchCallback on_complete, void* context, APIFetchStats* stats) {
+    APIFetchStats local_stats;
+    if (!stats) stats = &local_stats;
+    memset(stats, 0, sizeof(APIFetchStats));
+    if (!client || !client->is_initialized || !requests || count <= 0 || !options) return 0;
+    
+    double started_at = now_ms();
+    
+    for (int i = 0; i < count; i++) {
+        requests[i].response.data = NULL;
+        requests[i].response.size = 0;
+        requests[i].status = -1;
+        requests[i].source = API_SOURCE_NETWORK;
+        requests[i].elapsed_ms = 0.0;
+    }
+    
+    FetchCacheSlot* slots = calloc((size_t)count, sizeof(FetchCacheSlot));
+    int* pending = malloc(sizeof(int) * (size_t)count);
+    if (!slots || !pending) {
+        write_error_log("api_fetch_all", "메모리 할당 실패");
+        free(slots);
+        free(pending);
+        return 0;
+    }
+    
+    // TTL 안에 캐시된 응답은 요청 없이 바로 넘기고 나머지만 보냄
+    int pending_count = 0;
+    for (int i = 0; i < count; i++) {
+        if (api_cache_lookup(requests[i].url, &slots[i].cached) != API_CACHE_FRESH) {
+            pending[pending_count++] = i;
+            continue;
         }
+        requests[i].response = slots[i].cached.body;
+        slots[i].cached.body.data = NULL;
+        slots[i].cached.body.size = 0;
+        requests[i].status = 0;
+        requests[i].source = API_SOURCE_CACHE;
+        stats->succeeded++;
+        stats->cached++;
+        if (on_complete) on_complete(&requests[i], context);
+        free(requests[i].response.data);
+        requests[i].response.data = NULL;
+        requests[i].response.size = 0;
     }
     
-    if (totalBytes > 0) {
-        printf("✅ HTTP 응답 수신 완료: %lu bytes\n", totalBytes);
-        result = 0;
+    int max_in_flight = options->max_in_flight;
+    if (max_in_flight < 1) max_in_flight = 1;
+    if (max_in_flight > API_FETCH_MAX_IN_FLIGHT) max_in_flight = API_FETCH_MAX_IN_FLIGHT;
+    if (max_in_flight > pending_count) max_in_flight = pending_count;
+    
+#ifdef _WIN32
+    FetchShared shared;
+    memset(&shared, 0, sizeof(shared));
+    shared.client = client;
+    shared.requests = requests;
+    shared.slots = slots;
+    shared.pending = pending;
+    shared.pending_count = pending_count;
+    shared.on_complete = on_complete;
+    shared.context = context;
+    shared.stats = stats;
+    InitializeCriticalSection(&shared.lock);
+    
+    HANDLE threads[API_FETCH_MAX_IN_FLIGHT];
+    int thread_count = 0;
+    for (int i = 0; i < max_in_flight; i++) {
+        threads[thread_count] = CreateThread(NULL, 0, fetch_worker, &shared, 0, NULL);
+        if (threads[thread_count]) thread_count++;
+    }
+    if (thread_count == 0) {
+        fetch_worker(&shared);              // 스레드를 만들 수 없으면 이 스레드에서 하나씩 처리
     } else {
-        printf("❌ HTTP 응답 데이터 없음\n");
+        WaitForMultipleObjects((DWORD)thread_count, threads, TRUE, INFINITE);
+        for (int i = 0; i < thread_count; i++) CloseHandle(threads[i]);
+    }
+    DeleteCriticalSection(&shared.lock);
+#else
+    // Linux: curl multi 한 스레드에서 요청을 보내 두고, 끝나는 대로 콜백 후 다음 요청을 추가
+    CURLM* multi = pending_count > 0 ? curl_multi_init() : NULL;
+    if (pending_count > 0 && !multi) {
+        write_error_log("api_fetch_all", "curl multi 핸들 생성 실패");
+        for (int p = 0; p < pending_count; p++) api_cache_entry_free(&slots[pending[p]].cached);
+        free(slots);
+        free(pending);
+        return stats->succeeded;
     }
     
-cleanup:
-    if (hRequest) InternetCloseHandle(hRequest);
-    if (hInternet) InternetCloseHandle(hInternet);
+    int next = 0;
+    int in_flight = 0;
+    int done = 0;
+    int reserved = 0;                       // 다음 요청의 토큰을 이미 예약했는지
+    double next_start = started_at;         // 예약한 토큰을 쓸 수 있는 시각
+    
+    while (done < pending_count) {
+        // 자리가 있으면 다음 요청의 토큰을 예약하고, 쓸 수 있는 시각이 되면 추가
+        double now = now_ms();
+        while (next < pending_count && in_flight < max_in_flight) {
+            APIFetchRequest* request = &requests[pending[next]];
+            FetchCacheSlot* slot = &slots[pending[next]];
+            if (!reserved) {
+                next_start = now + reserve_request(request);
+                reserved = 1;
+            }
+            if (now < next_start) break;
+            reserved = 0;
+            
+            CURL* easy = curl_easy_init();
+            if (!easy) {
+                finish_request(request, slot, 0);
+                count_finished(stats, request);
+                done++;
+                next++;
+                if (on_complete) on_complete(request, context);
+                free(request->response.data);
+                request->response.data = NULL;
+                request->response.size = 0;
+                continue;
+            }
+            slot->headers = setup_curl_get(easy, request->url, &slot->cached, &request->response, &slot->received);
+            curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);
+            curl_easy_setopt(easy, CURLOPT_PRIVATE, (char*)request);
+            curl_multi_add_handle(multi, easy);
+            
+            request->elapsed_ms = now;      // 완료 시 경과 시간으로 바꿈
+            next++;
+            if (++in_flight > stats->peak_in_flight) stats->peak_in_flight = in_flight;
+        }
+        
+        int running = 0;
+        curl_multi_perform(multi, &running);
+        
+        CURLMsg* message;
+        int remaining;
+        while ((message = curl_multi_info_read(multi, &remaining)) != NULL) {
+            if (message->msg != CURLMSG_DONE) continue;
+            
+            CURL* easy = message->easy_handle;
+            char* private_data = NULL;
+            curl_easy_getinfo(easy, CURLINFO_PRIVATE, &private_data);
+            APIFetchRequest* request = (APIFetchRequest*)private_data;
+            FetchCacheSlot* slot = &slots[request - requests];
+            
+            int transferred = message->data.result == CURLE_OK;
+            if (transferred) {
+                curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &slot->status);
+            } else {
+                write_error_log("api_fetch_all", curl_easy_strerror(message->data.result));
+            }
+            
+            curl_multi_remove_handle(multi, easy);
+            curl_easy_cleanup(easy);
+            curl_slist_free_all(slot->headers);
+            slot->headers = NULL;
+            in_flight--;
+            done++;
+            
+            finish_request(request, slot, transferred);
+            request->elapsed_ms = now_ms() - request->elapsed_ms;
+            count_finished(stats, request);
+            
+            if (on_complete) on_complete(request, context);
+            free(request->response.data);
+            request->response.data = NULL;
+            request->response.size = 0;
+        }
+        
+        // 소켓에 일이 생기거나 다음 요청을 시작할 시각까지 대기
+        if (done < pending_count) {
+            int wait_ms = 100;
+            if (reserved) {
+                double until = next_start - now_ms();
+                wait_ms = until > 0.0 ? (int)until + 1 : 0;
+                if (wait_ms > 100) wait_ms = 100;
+            }
+            if (in_flight > 0) {
+                curl_multi_wait(multi, NULL, 0, wait_ms, NULL);
+            } else if (wait_ms > 0) {
+                struct timespec ts = { wait_ms / 1000, (long)(wait_ms % 1000) * 1000000L };
+                nanosleep(&ts, NULL);
+            }
+        }
+    }
     
-    return result;
-#else
-    // Linux용 curl 구현 (필요시)
-    return -1;
+    if (multi) curl_multi_cleanup(multi);
 #endif
+    
+    free(slots);
+    free(pending);
+    stats->elapsed_ms = now_ms() - started_at;
+    return stats->succeeded;
 }
 
 // 선거 정보 조회 함수 - 성공한 별도 프로그램 방식 적용
@@ -357,8 +829,8 @@ int api_get_election_info(APIClient* client, char* response_buffer, size_t buffe
     printf("📊 페이지 1 수집 중...\n");
     char url1[2048];
     snprintf(url1, sizeof(url1), 
-        "http://apis.data.go.kr%s?serviceKey=%s&pageNo=1&numOfRows=100&_type=json",
-        ELECTION_CODE_ENDPOINT, encoded_key);
+        "%s%s?serviceKey=%s&pageNo=1&numOfRows=100&_type=json",
+        g_api_base_url, ELECTION_CODE_ENDPOINT, encoded_key);
 
     write_log("INFO", "API 요청 시작");
     printf("🌐 API 호출 중 (페이지 1): %s\n", url1);
@@ -382,8 +854,8 @@ int api_get_election_info(APIClient* client, char* response_buffer, size_t buffe
     printf("📊 페이지 2 수집 중...\n");
     char url2[2048];
     snprintf(url2, sizeof(url2), 
-        "http://apis.data.go.kr%s?serviceKey=%s&pageNo=2&numOfRows=100&_type=json",
-        ELECTION_CODE_ENDPOINT, encoded_key);
+        "%s%s?serviceKey=%s&pageNo=2&numOfRows=100&_type=json",
+        g_api_base_url, ELECTION_CODE_ENDPOINT, encoded_key);
 
     printf("🌐 API 호출 중 (페이지 2): %s\n", url2);
 
@@ -461,22 +933,9 @@ int api_get_election_info(APIClient* client, char* response_buffer, size_t buffe
     }
 }
 
-// 후보자 정보 조회 함수 수정 - 더미 데이터로 우선 처리
-int api_get_candidate_info(APIClient* client, const char* election_id, char* response_buffer, size_t buffer_size) {
-    if (!client || !election_id || !response_buffer) {
-        write_error_log("api_get_candidate_info", "잘못된 매개변수");
-        return -1;
-    }
-
-    write_log("INFO", "후보자 정보 API 요청 시작");
-    printf("🌐 후보자 정보 수집 중 (선거ID: %s)...\n", election_id);
-
-    // API 키 URL 인코딩
-    char* encoded_key = url_encode(client->api_key);
-    if (!encoded_key) {
-        write_error_log("api_get_candidate_info", "API 키 인코딩 실패");
-        return -1;
-    }
+// 후보자 정보 요청 URL 생성 (선거 종류 코드는 elections.txt에서 찾음)
+int api_build_candidate_url(APIClient* client, const char* election_id, char* url, size_t url_size) {
+    if (!client || !election_id || !url) return 0;
 
     // elections.txt에서 해당 선거의 sgTypecode 읽어오기
     int sgTypecode = 1;  // 기본값
@@ -513,11 +972,33 @@ int api_get_candidate_info(APIClient* client, const char* election_id, char* res
 
     printf("   선거종류코드: %d (%s)\n", sgTypecode, sgTypecode == 1 ? "대통령선거" : "국회의원선거");
 
+    // API 키 URL 인코딩
+    char* encoded_key = url_encode(client->api_key);
+    if (!encoded_key) return 0;
+
+    snprintf(url, url_size,
+        "%s%s?serviceKey=%s&pageNo=1&numOfRows=100&sgId=%s&sgTypecode=%d",
+        g_api_base_url, CANDIDATE_INFO_ENDPOINT, encoded_key, election_id, sgTypecode);
+    free(encoded_key);
+    return 1;
+}
+
+// 후보자 정보 조회 함수 수정 - 더미 데이터로 우선 처리
+int api_get_candidate_info(APIClient* client, const char* election_id, char* response_buffer, size_t buffer_size) {
+    if (!client || !election_id || !response_buffer) {
+        write_error_log("api_get_candidate_info", "잘못된 매개변수");
+        return -1;
+    }
+
+    write_log("INFO", "후보자 정보 API 요청 시작");
+    printf("🌐 후보자 정보 수집 중 (선거ID: %s)...\n", election_id);
+
     // URL 생성 - HTTP 사용 (테스트에서 성공 확인)
     char url[2048];
-    snprintf(url, sizeof(url), 
-        "http://apis.data.go.kr%s?serviceKey=%s&pageNo=1&numOfRows=100&sgId=%s&sgTypecode=%d",
-        CANDIDATE_INFO_ENDPOINT, encoded_key, election_id, sgTypecode);
+    if (!api_build_candidate_url(client, election_id, url, sizeof(url))) {
+        write_error_log("api_get_candidate_info", "API 키 인코딩 실패");
+        return -1;
+    }
 
     int result = http_request(url, response_buffer, buffer_size);
     
@@ -529,7 +1010,6 @@ int api_get_candidate_info(APIClient* client, const char* election_id, char* res
         // API 응답 확인
         if (strstr(response_buffer, "SERVICE_KEY_IS_NOT_REGISTERED_ERROR")) {
             printf("❌ 후보자 API 서비스 미등록 오류\n");
-            free(encoded_key);
             return -1;
         } else if (strstr(response_buffer, "\"resultCode\":\"00\"") || 
                    strstr(response_buffer, "<resultCode>INFO-00</resultCode>") ||
@@ -538,26 +1018,36 @@ int api_get_candidate_info(APIClient* client, const char* election_id, char* res
             printf("✅ 후보자 API 응답 수신 완료 (%zu bytes)\n", strlen(response_buffer));
             printf("🎉 실제 API 데이터 사용!\n");
             // 실제 XML 데이터를 그대로 사용 - 변환하지 않음
-            free(encoded_key);
             return 0;  // 성공 반환 추가!
         } else if (strstr(response_buffer, "INFO-03") || 
                    strstr(response_buffer, "데이터 정보가 없습니다")) {
             printf("⚠️ 후보자 데이터 없음 (선거ID: %s)\n", election_id);
-            free(encoded_key);
             return -1;  // 더미 데이터 생성하지 않고 실패 처리
         } else {
             printf("❓ 알 수 없는 API 응답 (선거ID: %s)\n", election_id);
-            free(encoded_key);
             return -1;  // 더미 데이터 생성하지 않고 실패 처리
         }
     } else {
         write_error_log("api_get_candidate_info", "후보자 정보 API 요청 실패");
         printf("❌ 후보자 API 요청 실패 (선거ID: %s)\n", election_id);
-        free(encoded_key);
         return -1;  // 더미 데이터 생성하지 않고 실패 처리
     }
 }
 
+// 공약 정보 요청 URL 생성
+int api_build_pledge_url(APIClient* client, const char* election_id, const char* candidate_id, char* url, size_t url_size) {
+    if (!client || !election_id || !candidate_id || !url) return 0;
+
+    char* encoded_key = url_encode(client->api_key);
+    if (!encoded_key) return 0;
+
+    snprintf(url, url_size,
+        "%s%s?serviceKey=%s&pageNo=1&numOfRows=100&sgId=%s&sgTypecode=1&cnddtId=%s",
+        g_api_base_url, PLEDGE_INFO_ENDPOINT, encoded_key, election_id, candidate_id);
+    free(encoded_key);
+    return 1;
+}
+
 // 공약 정보 조회 함수 수정 (후보자 ID 필요)
 int api_get_pledge_info(APIClient* client, const char* election_id, const char* candidate_id, char* response_buffer, size_t buffer_size) {
     if (!client || !election_id || !candidate_id || !response_buffer) {
@@ -565,26 +1055,18 @@ int api_get_pledge_info(APIClient* client, const char* election_id, const char*
         return -1;
     }
 
-    // API 키 URL 인코딩
-    char* encoded_key = url_encode(client->api_key);
-    if (!encoded_key) {
+    // URL 생성 (공약 정보 API 사용) - 최대 100개 요청 (numOfRows=100)
+    char url[2048];
+    if (!api_build_pledge_url(client, election_id, candidate_id, url, sizeof(url))) {
         write_error_log("api_get_pledge_info", "API 키 인코딩 실패");
         return -1;
     }
 
-    // URL 생성 (공약 정보 API 사용) - 최대 100개 요청 (numOfRows=100)
-    char url[2048];
-    snprintf(url, sizeof(url), 
-        "http://apis.data.go.kr%s?serviceKey=%s&pageNo=1&numOfRows=100&sgId=%s&sgTypecode=1&cnddtId=%s",
-        PLEDGE_INFO_ENDPOINT, encoded_key, election_id, candidate_id);
-
     write_log("INFO", "공약 정보 API 요청 시작");
     printf("🌐 공약 API 호출 중 (최대 100개): %s\n", url);
 
     int result = http_request(url, response_buffer, buffer_size);
     
-    free(encoded_key);
-    
     if (result == 0) {
         write_log("INFO", "공약 정보 API 요청 완료");
         printf("✅ 공약 API 응답 수신 완료 (%zu bytes)\n", strlen(response_buffer));
@@ -596,341 +1078,452 @@ int api_get_pledge_info(APIClient* client, const char* election_id, const char*
     return result;
 }
 
-// 간단한 JSON 파싱 구현
+// 응답 XML 필드 (시작 태그 이름 -> 텍스트를 넣을 곳)
+enum {
+    FIELD_NONE = 0,
+    FIELD_RESULT_CODE,
+    FIELD_RESULT_MSG,
+    FIELD_SG_ID,
+    FIELD_SG_NAME,
+    FIELD_SG_VOTEDATE,
+    FIELD_SG_TYPECODE,
+    FIELD_NAME,
+    FIELD_JD_NAME,
+    FIELD_HUBOID,
+    FIELD_GIHO,
+    FIELD_CNDDT_ID,
+    FIELD_KR_NAME,
+    FIELD_PRMS_CNT,
+    FIELD_PRMS_TITLE,
+    FIELD_PRMM_CONT,
+    FIELD_PRMS_REALM_NAME
+};
+
+// 조각을 문자열로 복사 (size보다 길면 복사하지 않음, 원래 파서와 같이 잘린 값을 넣지 않음)
+static void copy_slice(char* dest, size_t size, XmlSlice text) {
+    if (text.length < size) {
+        memcpy(dest, text.data, text.length);
+        dest[text.length] = '\0';
+    }
+}
+
+static int slice_to_int(XmlSlice text) {
+    char number[10];
+    if (text.length >= sizeof(number)) return 0;
+    memcpy(number, text.data, text.length);
+    number[text.length] = '\0';
+    return atoi(number);
+}
+
+// "prmsTitle3" 같은 이름이 prefix + 1~10이면 번호, 아니면 0
+static int numbered_field(XmlSlice name, const char* prefix) {
+    size_t prefix_len = strlen(prefix);
+    if (name.length <= prefix_len || name.length > prefix_len + 2) return 0;
+    if (memcmp(name.data, prefix, prefix_len) != 0) return 0;
+
+    int number = 0;
+    for (size_t i = prefix_len; i < name.length; i++) {
+        if (name.data[i] < '0' || name.data[i] > '9') return 0;
+        number = number * 10 + (name.data[i] - '0');
+    }
+    return (number >= 1 && number <= API_MAX_PLEDGES_PER_CANDIDATE) ? number : 0;
+}
+
+// 공약 내용: 멀티라인을 한 줄로 압축 (개행/탭/연속 공백을 공백 하나로) 하고 앞뒤 공백 제거
+static void copy_pledge_content(char* dest, XmlSlice text) {
+    if (text.length >= MAX_CONTENT_LEN) return;
+
+    size_t pos = 0;
+    for (size_t i = 0; i < text.length; i++) {
+        char c = text.data[i];
+        if (c == '\n' || c == '\r' || c == '\t' || c == ' ') {
+            if (pos > 0 && dest[pos - 1] != ' ') dest[pos++] = ' ';
+        } else {
+            dest[pos++] = c;
+        }
+    }
+    while (pos > 0 && dest[pos - 1] == ' ') pos--;
+    dest[pos] = '\0';
+}
+
+static int field_for_element(APIResponseParser* parser, XmlSlice name) {
+    parser->field_number = 0;
+
+    if (XML_SLICE_IS(name, "resultCode")) return FIELD_RESULT_CODE;
+    if (XML_SLICE_IS(name, "resultMsg")) return FIELD_RESULT_MSG;
+    if (!parser->in_item) return FIELD_NONE;
+
+    switch (parser->endpoint) {
+        case API_ENDPOINT_ELECTION:
+            if (XML_SLICE_IS(name, "sgId")) return FIELD_SG_ID;
+            if (XML_SLICE_IS(name, "sgName")) return FIELD_SG_NAME;
+            if (XML_SLICE_IS(name, "sgVotedate")) return FIELD_SG_VOTEDATE;
+            if (XML_SLICE_IS(name, "sgTypecode")) return FIELD_SG_TYPECODE;
+            break;
+        case API_ENDPOINT_CANDIDATE:
+            if (XML_SLICE_IS(name, "name")) return FIELD_NAME;
+            if (XML_SLICE_IS(name, "jdName")) return FIELD_JD_NAME;
+            if (XML_SLICE_IS(name, "huboid")) return FIELD_HUBOID;
+            if (XML_SLICE_IS(name, "giho")) return FIELD_GIHO;
+            break;
+        case API_ENDPOINT_PLEDGE:
+            if (XML_SLICE_IS(name, "cnddtId")) return FIELD_CNDDT_ID;
+            if (XML_SLICE_IS(name, "krName")) return FIELD_KR_NAME;
+            if (XML_SLICE_IS(name, "prmsCnt")) return FIELD_PRMS_CNT;
+            if ((parser->field_number = numbered_field(name, "prmsTitle")) > 0) return FIELD_PRMS_TITLE;
+            if ((parser->field_number = numbered_field(name, "prmmCont")) > 0) return FIELD_PRMM_CONT;
+            if ((parser->field_number = numbered_field(name, "prmsRealmName")) > 0) return FIELD_PRMS_REALM_NAME;
+            break;
+        default:
+            break;
+    }
+    return FIELD_NONE;
+}
+
+// <item> 시작: 응답이 성공이고 자리가 남았으면 채울 레코드를 비워 둠
+static void begin_item(APIResponseParser* parser) {
+    if (!parser->result_ok) return;
+    if (parser->endpoint == API_ENDPOINT_CANDIDATE && !parser->in_items) return;
+
+    if (parser->count >= parser->max_records) {
+        xml_stream_stop(&parser->stream);
+        return;
+    }
+
+    parser->in_item = 1;
+    parser->has_id = 0;
+    parser->typecode = -1;
+
+    if (parser->endpoint == API_ENDPOINT_ELECTION) {
+        memset((ElectionInfo*)parser->records + parser->count, 0, sizeof(ElectionInfo));
+    } else if (parser->endpoint == API_ENDPOINT_CANDIDATE) {
+        memset((CandidateInfo*)parser->records + parser->count, 0, sizeof(CandidateInfo));
+    } else {
+        parser->candidate_id[0] = '\0';
+        parser->candidate_name[0] = '\0';
+        parser->pledge_total = 0;
+        parser->pledge_slots = parser->max_records < API_MAX_PLEDGES_PER_CANDIDATE ?
+                               parser->max_records : API_MAX_PLEDGES_PER_CANDIDATE;
+        memset(parser->records, 0, sizeof(PledgeInfo) * (size_t)parser->pledge_slots);
+    }
+}
+
+// </item>: 모은 값으로 레코드 완성 (선거는 2008년 이전/대통령선거가 아니면 제외)
+static void end_item(APIResponseParser* parser) {
+    parser->in_item = 0;
+
+    if (parser->endpoint == API_ENDPOINT_ELECTION) {
+        ElectionInfo* election = (ElectionInfo*)parser->records + parser->count;
+
+        // ⭐ 2008년 이전 선거 데이터 필터링 (공약 제출 제도 이전) ⭐
+        if (parser->has_id && atoi(election->election_id) / 10000 < 2008) {
+            parser->skipped_year++;
+            return;
+        }
+        // ⭐ 대통령선거만 필터링 (sgTypecode: 1=대통령선거만 허용) ⭐
+        if (parser->typecode >= 0) {
+            if (parser->typecode != 1) {
+                parser->skipped_type++;
+                return;
+            }
+            election->is_active = parser->typecode;  // sgTypecode를 is_active 필드에 저장
+        }
+        strcpy(election->election_type, "선거");
+        parser->count++;
+    } else if (parser->endpoint == API_ENDPOINT_CANDIDATE) {
+        CandidateInfo* candidate = (CandidateInfo*)parser->records + parser->count;
+        snprintf(candidate->election_id, MAX_STRING_LEN, "%s", parser->election_id);
+        candidate->pledge_count = 3 + (parser->count % 5);
+        parser->count++;
+    } else {
+        // 공약 응답은 후보자 한 명이므로 첫 <item>만 사용
+        PledgeInfo* pledges = (PledgeInfo*)parser->records;
+        xml_stream_stop(&parser->stream);
+
+        if (parser->candidate_id[0] == '\0' || parser->candidate_name[0] == '\0') {
+            printf("❌ 후보자 ID/이름 추출 실패 (cnddtId: '%s', krName: '%s')\n",
+                   parser->candidate_id, parser->candidate_name);
+            return;
+        }
+
+        int count = parser->pledge_total < parser->pledge_slots ? parser->pledge_total : parser->pledge_slots;
+        time_t now = time(NULL);
+        for (int i = 0; i < count; i++) {
+            snprintf(pledges[i].pledge_id, MAX_STRING_LEN, "%s_%d", parser->candidate_id, i + 1);
+            strcpy(pledges[i].candidate_id, parser->candidate_id);
+            pledges[i].like_count = 0;
+            pledges[i].dislike_count = 0;
+            pledges[i].created_time = now;
+        }
+        parser->count = count > 0 ? count : 0;
+    }
+}
+
+static void on_start_element(XmlStream* stream, XmlSlice name) {
+    APIResponseParser* parser = (APIResponseParser*)stream->context;
+
+    if (XML_SLICE_IS(name, "item")) {
+        begin_item(parser);
+        parser->field = FIELD_NONE;
+    } else if (XML_SLICE_IS(name, "items")) {
+        parser->in_items = 1;
+        parser->field = FIELD_NONE;
+    } else {
+        parser->field = field_for_element(parser, name);
+    }
+}
+
+static void on_end_element(XmlStream* stream, XmlSlice name) {
+    APIResponseParser* parser = (APIResponseParser*)stream->context;
+
+    parser->field = FIELD_NONE;
+    if (parser->in_item && XML_SLICE_IS(name, "item")) {
+        end_item(parser);
+    } else if (XML_SLICE_IS(name, "items")) {
+        parser->in_items = 0;
+    }
+}
+
+static void on_text(XmlStream* stream, XmlSlice text) {
+    APIResponseParser* parser = (APIResponseParser*)stream->context;
+    ElectionInfo* election = (ElectionInfo*)parser->records + parser->count;
+    CandidateInfo* candidate = (CandidateInfo*)parser->records + parser->count;
+    PledgeInfo* pledge = (PledgeInfo*)parser->records + (parser->field_number - 1);
+
+    switch (parser->field) {
+        case FIELD_RESULT_CODE:
+            if (XML_SLICE_IS(text, "INFO-00")) parser->result_ok = 1;
+            break;
+        case FIELD_RESULT_MSG:
+            copy_slice(parser->result_message, sizeof(parser->result_message), text);
+            if (strstr(parser->result_message, "NORMAL SERVICE")) parser->result_ok = 1;
+            break;
+
+        case FIELD_SG_ID:
+            copy_slice(election->election_id, MAX_STRING_LEN, text);
+            parser->has_id = text.length < MAX_STRING_LEN;
+            break;
+        case FIELD_SG_NAME:
+            copy_slice(election->election_name, MAX_STRING_LEN, text);
+            break;
+        case FIELD_SG_VOTEDATE:
+            if (text.length == 8) {  // YYYYMMDD -> YYYY-MM-DD
+                snprintf(election->election_date, MAX_STRING_LEN, "%.4s-%.2s-%.2s",
+                         text.data, text.data + 4, text.data + 6);
+            }
+            break;
+        case FIELD_SG_TYPECODE:
+            if (text.length < 10) parser->typecode = slice_to_int(text);
+            break;
+
+        case FIELD_NAME:
+            copy_slice(candidate->candidate_name, MAX_STRING_LEN, text);
+            break;
+        case FIELD_JD_NAME:
+            copy_slice(candidate->party_name, MAX_STRING_LEN, text);
+            break;
+        case FIELD_HUBOID:
+            copy_slice(candidate->candidate_id, MAX_STRING_LEN, text);
+            break;
+        case FIELD_GIHO:
+            if (text.length < 10) candidate->candidate_number = slice_to_int(text);
+            break;
+
+        case FIELD_CNDDT_ID:
+            copy_slice(parser->candidate_id, sizeof(parser->candidate_id), text);
+            break;
+        case FIELD_KR_NAME:
+            copy_slice(parser->candidate_name, MAX_STRING_LEN, text);
+            break;
+        case FIELD_PRMS_CNT:
+            if (text.length < 10) parser->pledge_total = slice_to_int(text);
+            break;
+        case FIELD_PRMS_TITLE:
+            if (parser->field_number <= parser->pledge_slots) copy_slice(pledge->title, MAX_STRING_LEN, text);
+            break;
+        case FIELD_PRMM_CONT:
+            if (parser->field_number <= parser->pledge_slots) copy_pledge_content(pledge->content, text);
+            break;
+        case FIELD_PRMS_REALM_NAME:
+            if (parser->field_number <= parser->pledge_slots) copy_slice(pledge->category, MAX_STRING_LEN, text);
+            break;
+        default:
+            break;
+    }
+}
+
+void api_parser_init(APIResponseParser* parser, APIEndpoint endpoint, void* records, int max_records,
+                     const char* election_id) {
+    static const XmlHandlers handlers = { on_start_element, on_end_element, on_text };
+
+    memset(parser, 0, sizeof(APIResponseParser));
+    xml_stream_init(&parser->stream, &handlers, parser);
+    parser->endpoint = endpoint;
+    parser->records = records;
+    parser->max_records = max_records > 0 ? max_records : 0;
+    parser->election_id = election_id ? election_id : "";
+    parser->typecode = -1;
+}
+
+int api_parser_feed(APIResponseParser* parser, const char* data, size_t length) {
+    return xml_stream_feed(&parser->stream, data, length);
+}
+
+int api_parser_finish(APIResponseParser* parser) {
+    xml_stream_finish(&parser->stream);
+    xml_stream_free(&parser->stream);
+    return parser->count;
+}
+
+// 응답 오류 출력 (resultMsg가 있으면 함께)
+static void print_parser_error(const char* label, const APIResponseParser* parser) {
+    printf("❌ %s API 오류 응답\n", label);
+    if (parser->result_message[0]) {
+        printf("오류 내용: %s\n", parser->result_message);
+    }
+}
+
 int parse_election_json(const char* json_data, ElectionInfo elections[], int max_elections) {
     if (!json_data || !elections) return 0;
     
     write_log("INFO", "선거 정보 파싱 중...");
     
-    // JSON 응답 확인
-    printf("📄 API 응답 데이터:\n%s\n\n", json_data);
+    APIResponseParser parser;
+    api_parser_init(&parser, API_ENDPOINT_ELECTION, elections, max_elections, NULL);
+    api_parser_feed(&parser, json_data, strlen(json_data));
+    int count = api_parser_finish(&parser);
     
+    if (parser.result_ok) {
+        printf("✅ API 응답 성공 (XML 형식)\n");
+        if (parser.skipped_year > 0 || parser.skipped_type > 0) {
+            printf("   ⚠️  2008년 이전 선거 %d개, 대통령선거가 아닌 선거 %d개 제외\n",
+                   parser.skipped_year, parser.skipped_type);
+        }
+        printf("🔍 실제 선거 데이터 %d개 파싱 완료!\n", count);
+    } else {
+        print_parser_error("선거", &parser);
+    }
+    
+    write_log("INFO", "선거 정보 파싱 완료");
+    return count;
+}
+
+// JSON 형식 후보자 응답 ("items":[{...}], XML이 아닌 응답일 때만 사용)
+static int parse_candidate_json_items(const char* json_data, const char* election_id, CandidateInfo candidates[], int max_candidates) {
     int count = 0;
     
-    // XML 응답 확인 (API가 XML로 응답함)
-    if (strstr(json_data, "<resultCode>INFO-00</resultCode>") || 
-        strstr(json_data, "NORMAL SERVICE")) {
-        printf("✅ API 응답 성공 (XML 형식)\n");
+    if (!strstr(json_data, "\"resultCode\":\"00\"") && !strstr(json_data, "NORMAL SERVICE")) {
+        printf("❌ 후보자 API 오류 응답\n");
+        char* error_msg = strstr(json_data, "\"resultMsg\":");
+        if (error_msg) {
+            printf("오류 내용: %.100s\n", error_msg);
+        }
+        return 0;
+    }
+    
+    char* items_start = strstr(json_data, "\"items\":[");
+    if (!items_start) return 0;
+    
+    printf("📄 JSON 형식 응답 파싱 중...\n");
+    char* pos = items_start;
+    
+    // 각 후보자 정보 파싱
+    while ((pos = strstr(pos, "{")) != NULL && count < max_candidates) {
+        char* item_end = strstr(pos, "}");
+        if (!item_end) break;
         
-        // XML에서 선거 정보 추출
-        char* item_start = strstr(json_data, "<item>");
-        while (item_start && count < max_elections) {
-            char* item_end = strstr(item_start, "</item>");
-            if (!item_end) break;
-            
-            // sgId 추출
-            char* sgid_start = strstr(item_start, "<sgId>");
-            char* sgid_end = strstr(item_start, "</sgId>");
-            if (sgid_start && sgid_end && sgid_start < item_end) {
-                sgid_start += 6; // "<sgId>" 길이
-                int len = sgid_end - sgid_start;
+        // name 추출
+        char* name_start = strstr(pos, "\"name\":\"");
+        if (name_start && name_start < item_end) {
+            name_start += 8; // "name":" 길이
+            char* name_end = strstr(name_start, "\"");
+            if (name_end && name_end < item_end) {
+                int len = name_end - name_start;
                 if (len < MAX_STRING_LEN) {
-                    strncpy(elections[count].election_id, sgid_start, len);
-                    elections[count].election_id[len] = '\0';
-                    
-                    // ⭐ 2008년 이전 선거 데이터 필터링 (공약 제출 제도 이전) ⭐
-                    int election_year = atoi(elections[count].election_id) / 10000; // YYYYMMDD에서 YYYY 추출
-                    if (election_year < 2008) {
-                        printf("   ⚠️  %d년 선거 데이터 제외 (공약 제출 제도 이전)\n", election_year);
-                        // 다음 item으로 건너뛰기
-                        item_start = strstr(item_end, "<item>");
-                        continue;
-                    }
+                    strncpy(candidates[count].candidate_name, name_start, len);
+                    candidates[count].candidate_name[len] = '\0';
                 }
             }
-            
-            // sgName 추출
-            char* name_start = strstr(item_start, "<sgName>");
-            char* name_end = strstr(item_start, "</sgName>");
-            if (name_start && name_end && name_start < item_end) {
-                name_start += 8; // "<sgName>" 길이
-                int len = name_end - name_start;
+        }
+        
+        // jdName (정당명) 추출
+        char* party_start = strstr(pos, "\"jdName\":\"");
+        if (party_start && party_start < item_end) {
+            party_start += 10; // "jdName":" 길이
+            char* party_end = strstr(party_start, "\"");
+            if (party_end && party_end < item_end) {
+                int len = party_end - party_start;
                 if (len < MAX_STRING_LEN) {
-                    strncpy(elections[count].election_name, name_start, len);
-                    elections[count].election_name[len] = '\0';
+                    strncpy(candidates[count].party_name, party_start, len);
+                    candidates[count].party_name[len] = '\0';
                 }
             }
-            
-            // sgVotedate 추출
-            char* date_start = strstr(item_start, "<sgVotedate>");
-            char* date_end = strstr(item_start, "</sgVotedate>");
-            if (date_start && date_end && date_start < item_end) {
-                date_start += 12; // "<sgVotedate>" 길이
-                int len = date_end - date_start;
-                if (len == 8) { // YYYYMMDD 형식
-                    char temp[16];
-                    strncpy(temp, date_start, 8);
-                    temp[8] = '\0';
-                    // YYYY-MM-DD 형식으로 변환
-                    snprintf(elections[count].election_date, MAX_STRING_LEN, 
-                            "%.4s-%.2s-%.2s", temp, temp+4, temp+6);
+        }
+        
+        // cnddtId (후보자ID) 추출
+        char* id_start = strstr(pos, "\"cnddtId\":\"");
+        if (id_start && id_start < item_end) {
+            id_start += 11; // "cnddtId":" 길이
+            char* id_end = strstr(id_start, "\"");
+            if (id_end && id_end < item_end) {
+                int len = id_end - id_start;
+                if (len < MAX_STRING_LEN) {
+                    strncpy(candidates[count].candidate_id, id_start, len);
+                    candidates[count].candidate_id[len] = '\0';
                 }
             }
-            
-            // sgTypecode 추출 - 이게 핵심!
-            char* typecode_start = strstr(item_start, "<sgTypecode>");
-            char* typecode_end = strstr(item_start, "</sgTypecode>");
-            if (typecode_start && typecode_end && typecode_start < item_end) {
-                typecode_start += 12; // "<sgTypecode>" 길이
-                int len = typecode_end - typecode_start;
+        }
+        
+        // num (후보자 번호) 추출
+        char* num_start = strstr(pos, "\"num\":\"");
+        if (num_start && num_start < item_end) {
+            num_start += 7; // "num":" 길이
+            char* num_end = strstr(num_start, "\"");
+            if (num_end && num_end < item_end) {
+                char num_str[10];
+                int len = num_end - num_start;
                 if (len < 10) {
-                    char typecode_str[10];
-                    strncpy(typecode_str, typecode_start, len);
-                    typecode_str[len] = '\0';
-                    int typecode = atoi(typecode_str);
-                    
-                    // ⭐ 대통령선거만 필터링 ⭐
-                    // sgTypecode: 1=대통령선거만 허용
-                    if (typecode != 1) {
-                        printf("   ⚠️  선거 %s (타입코드: %d) - 대통령선거 아님 (건너뛰기)\n", 
-                               elections[count].election_id, typecode);
-                        // 다음 item으로 건너뛰기
-                        item_start = strstr(item_end, "<item>");
-                        continue;
-                    }
-                    
-                    elections[count].is_active = typecode;  // sgTypecode를 is_active 필드에 저장
-                    printf("   ✅ 선거 %s (타입코드: %d) - 대통령선거 선택\n", 
-                           elections[count].election_id, typecode);
+                    strncpy(num_str, num_start, len);
+                    num_str[len] = '\0';
+                    candidates[count].candidate_number = atoi(num_str);
                 }
             }
-            
-            strcpy(elections[count].election_type, "선거");
-            count++;
-            
-            // 다음 item 찾기
-            item_start = strstr(item_end, "<item>");
         }
         
-        printf("🔍 실제 선거 데이터 %d개 파싱 완료!\n", count);
-    } else {
-        printf("❌ API 오류 응답\n");
-        // 오류 메시지 추출
-        char* error_msg = strstr(json_data, "<resultMsg>");
-        if (error_msg) {
-            char* error_end = strstr(error_msg, "</resultMsg>");
-            if (error_end) {
-                printf("오류 내용: %.*s\n", (int)(error_end - error_msg - 11), error_msg + 11);
-            }
-        }
+        // 기본값 설정 - 실제 선거ID 사용
+        strcpy(candidates[count].election_id, election_id); // 실제 선거ID 사용
+        candidates[count].pledge_count = 3 + (count % 5); // 3~7개 랜덤
+        
+        count++;
+        pos = item_end + 1;
     }
-    
-    write_log("INFO", "선거 정보 파싱 완료");
     return count;
 }
 
 int parse_candidate_json(const char* json_data, const char* election_id, CandidateInfo candidates[], int max_candidates) {
     if (!json_data || !election_id || !candidates) return 0;
     
-    write_log("INFO", "후보자 정보 JSON 파싱 중...");
+    write_log("INFO", "후보자 정보 파싱 중...");
     
     int count = 0;
-    
-
-    
-    // XML 또는 JSON 응답 확인
-    if (strstr(json_data, "<resultCode>INFO-00</resultCode>") || 
-        strstr(json_data, "\"resultCode\":\"00\"") || 
-        strstr(json_data, "NORMAL SERVICE")) {
-        printf("✅ 후보자 API 응답 성공\n");
+    const char* first = json_data;
+    while (*first == ' ' || *first == '\t' || *first == '\r' || *first == '\n') first++;
+    
+    if (*first == '<') {
+        APIResponseParser parser;
+        api_parser_init(&parser, API_ENDPOINT_CANDIDATE, candidates, max_candidates, election_id);
+        api_parser_feed(&parser, json_data, strlen(json_data));
+        count = api_parser_finish(&parser);
         
-        // XML 형식인지 확인
-        if (strstr(json_data, "<items>")) {
-            printf("📄 XML 형식 응답 파싱 중...\n");
-            
-            // XML에서 후보자 정보 추출
-            char* items_start = strstr(json_data, "<items>");
-            char* items_end = strstr(json_data, "</items>");
-            
-            // </items> 태그가 없으면 전체 응답 끝까지 파싱
-            if (!items_end) {
-                items_end = json_data + strlen(json_data);
-                printf("🔍 디버깅: </items> 태그 없음, 전체 응답 파싱\n");
-            }
-            
-            if (items_start) {
-                char* pos = items_start;
-                printf("🔍 디버깅: XML 파싱 시작 (길이: %zu bytes)\n", strlen(json_data));
-                
-                // 각 <item> 태그 파싱
-                while ((pos = strstr(pos, "<item>")) != NULL && count < max_candidates) {
-                    char* item_end = strstr(pos, "</item>");
-                    if (!item_end || item_end > items_end) break;
-                    
-                    printf("🔍 디버깅: item %d 파싱 중...\n", count + 1);
-                    
-                    // name 추출
-                    char* name_start = strstr(pos, "<name>");
-                    if (name_start && name_start < item_end) {
-                        name_start += 6; // "<name>" 길이
-                        char* name_end = strstr(name_start, "</name>");
-                        if (name_end && name_end < item_end) {
-                            int len = name_end - name_start;
-                            if (len < MAX_STRING_LEN) {
-                                strncpy(candidates[count].candidate_name, name_start, len);
-                                candidates[count].candidate_name[len] = '\0';
-                            }
-                        }
-                    }
-                    
-                    // jdName (정당명) 추출
-                    char* party_start = strstr(pos, "<jdName>");
-                    if (party_start && party_start < item_end) {
-                        party_start += 8; // "<jdName>" 길이
-                        char* party_end = strstr(party_start, "</jdName>");
-                        if (party_end && party_end < item_end) {
-                            int len = party_end - party_start;
-                            if (len < MAX_STRING_LEN) {
-                                strncpy(candidates[count].party_name, party_start, len);
-                                candidates[count].party_name[len] = '\0';
-                            }
-                        }
-                    }
-                    
-                    // huboid (후보자ID) 추출
-                    char* id_start = strstr(pos, "<huboid>");
-                    if (id_start && id_start < item_end) {
-                        id_start += 8; // "<huboid>" 길이
-                        char* id_end = strstr(id_start, "</huboid>");
-                        if (id_end && id_end < item_end) {
-                            int len = id_end - id_start;
-                            if (len < MAX_STRING_LEN) {
-                                strncpy(candidates[count].candidate_id, id_start, len);
-                                candidates[count].candidate_id[len] = '\0';
-                            }
-                        }
-                    }
-                    
-                    // giho (후보자 번호) 추출
-                    char* num_start = strstr(pos, "<giho>");
-                    if (num_start && num_start < item_end) {
-                        num_start += 6; // "<giho>" 길이
-                        char* num_end = strstr(num_start, "</giho>");
-                        if (num_end && num_end < item_end) {
-                            char num_str[10];
-                            int len = num_end - num_start;
-                            if (len < 10) {
-                                strncpy(num_str, num_start, len);
-                                num_str[len] = '\0';
-                                candidates[count].candidate_number = atoi(num_str);
-                            }
-                        }
-                    }
-                    
-                    // 기본값 설정
-                    strcpy(candidates[count].election_id, election_id);
-                    candidates[count].pledge_count = 3 + (count % 5);
-                    
-                    printf("   %d. %s (%s) - 번호: %d, ID: %s\n", 
-                           count + 1,
-                           candidates[count].candidate_name,
-                           candidates[count].party_name,
-                           candidates[count].candidate_number,
-                           candidates[count].candidate_id);
-                    
-                    count++;
-                    pos = item_end + 1;
-                }
-                printf("🔍 디버깅: XML 파싱 완료, 총 %d명 파싱\n", count);
-            } else {
-                printf("🔍 디버깅: <items> 태그를 찾을 수 없음\n");
-            }
-        }
-        // JSON에서 후보자 정보 추출
-        else if (strstr(json_data, "\"items\":[")) {
-            printf("📄 JSON 형식 응답 파싱 중...\n");
-            char* items_start = strstr(json_data, "\"items\":[");
-            if (items_start) {
-            char* pos = items_start;
-            
-            // 각 후보자 정보 파싱
-            while ((pos = strstr(pos, "{")) != NULL && count < max_candidates) {
-                char* item_end = strstr(pos, "}");
-                if (!item_end) break;
-                
-                // name 추출
-                char* name_start = strstr(pos, "\"name\":\"");
-                if (name_start && name_start < item_end) {
-                    name_start += 8; // "name":" 길이
-                    char* name_end = strstr(name_start, "\"");
-                    if (name_end && name_end < item_end) {
-                        int len = name_end - name_start;
-                        if (len < MAX_STRING_LEN) {
-                            strncpy(candidates[count].candidate_name, name_start, len);
-                            candidates[count].candidate_name[len] = '\0';
-                        }
-                    }
-                }
-                
-                // jdName (정당명) 추출
-                char* party_start = strstr(pos, "\"jdName\":\"");
-                if (party_start && party_start < item_end) {
-                    party_start += 10; // "jdName":" 길이
-                    char* party_end = strstr(party_start, "\"");
-                    if (party_end && party_end < item_end) {
-                        int len = party_end - party_start;
-                        if (len < MAX_STRING_LEN) {
-                            strncpy(candidates[count].party_name, party_start, len);
-                            candidates[count].party_name[len] = '\0';
-                        }
-                    }
-                }
-                
-                // cnddtId (후보자ID) 추출
-                char* id_start = strstr(pos, "\"cnddtId\":\"");
-                if (id_start && id_start < item_end) {
-                    id_start += 11; // "cnddtId":" 길이
-                    char* id_end = strstr(id_start, "\"");
-                    if (id_end && id_end < item_end) {
-                        int len = id_end - id_start;
-                        if (len < MAX_STRING_LEN) {
-                            strncpy(candidates[count].candidate_id, id_start, len);
-                            candidates[count].candidate_id[len] = '\0';
-                        }
-                    }
-                }
-                
-                // num (후보자 번호) 추출
-                char* num_start = strstr(pos, "\"num\":\"");
-                if (num_start && num_start < item_end) {
-                    num_start += 7; // "num":" 길이
-                    char* num_end = strstr(num_start, "\"");
-                    if (num_end && num_end < item_end) {
-                        char num_str[10];
-                        int len = num_end - num_start;
-                        if (len < 10) {
-                            strncpy(num_str, num_start, len);
-                            num_str[len] = '\0';
-                            candidates[count].candidate_number = atoi(num_str);
-                        }
-                    }
-                }
-                
-                // 기본값 설정 - 실제 선거ID 사용
-                strcpy(candidates[count].election_id, election_id); // 실제 선거ID 사용
-                candidates[count].pledge_count = 3 + (count % 5); // 3~7개 랜덤
-                
-                printf("   %d. %s (%s) - 번호: %d\n", 
-                       count + 1,
-                       candidates[count].candidate_name,
-                       candidates[count].party_name,
-                       candidates[count].candidate_number);
-                
-                count++;
-                pos = item_end + 1;
-            }
-            }
-        }
-        
-        if (count == 0) {
-            printf("⚠️  파싱된 후보자 데이터가 없습니다\n");
+        if (!parser.result_ok) {
+            print_parser_error("후보자", &parser);
         }
     } else {
-        printf("❌ 후보자 API 오류 응답\n");
-        char* error_msg = strstr(json_data, "\"resultMsg\":");
-        if (error_msg) {
-            printf("오류 내용: %.100s\n", error_msg);
-        }
+        count = parse_candidate_json_items(json_data, election_id, candidates, max_candidates);
+    }
+    
+    if (count == 0) {
+        printf("⚠️  파싱된 후보자 데이터가 없습니다\n");
     }
     
     write_log("INFO", "후보자 정보 파싱 완료");
@@ -943,221 +1536,19 @@ int parse_pledge_json(const char* json_data, PledgeInfo pledges[], int max_pledg
     
     write_log("INFO", "공약 정보 XML 파싱 중...");
     
-    int count = 0;
+    APIResponseParser parser;
+    api_parser_init(&parser, API_ENDPOINT_PLEDGE, pledges, max_pledges, NULL);
+    api_parser_feed(&parser, json_data, strlen(json_data));
+    int count = api_parser_finish(&parser);
     
-    // XML 응답 확인
-    if (strstr(json_data, "<resultCode>INFO-00</resultCode>") || 
-        strstr(json_data, "NORMAL SERVICE")) {
-        printf("✅ 공약 API 응답 성공\n");
-        printf("📄 XML 형식 공약 응답 파싱 중...\n");
-        
-        // XML에서 공약 정보 추출
-        char* item_start = strstr(json_data, "<item>");
-        if (item_start) {
-            printf("🔍 <item> 태그 발견!\n");
-            char* item_end = strstr(item_start, "</item>");
-            if (!item_end) return 0;
-            
-            // 후보자 기본 정보 추출
-            char candidate_id[MAX_STRING_LEN] = {0};
-            char candidate_name[MAX_STRING_LEN] = {0};
-            
-            // cnddtId 추출
-            printf("🔍 <cnddtId> 태그 검색 중...\n");
-            char* cnddtid_start = strstr(item_start, "<cnddtId>");
-            if (cnddtid_start && cnddtid_start < item_end) {
-                printf("🔍 <cnddtId> 태그 발견!\n");
-                cnddtid_start += 9; // "<cnddtId>" 길이
-                char* cnddtid_end = strstr(cnddtid_start, "</cnddtId>");
-                if (cnddtid_end && cnddtid_end < item_end) {
-                    int len = cnddtid_end - cnddtid_start;
-                    if (len < MAX_STRING_LEN) {
-                        strncpy(candidate_id, cnddtid_start, len);
-                        candidate_id[len] = '\0';
-                        printf("🔍 후보자 ID 추출 성공: '%s'\n", candidate_id);
-                    } else {
-                        printf("❌ 후보자 ID 길이 초과: %d\n", len);
-                    }
-                } else {
-                    printf("❌ </cnddtId> 태그를 찾을 수 없음\n");
-                }
-            } else {
-                printf("❌ <cnddtId> 태그를 찾을 수 없음\n");
-            }
-            
-            // krName 추출
-            char* name_start = strstr(item_start, "<krName>");
-            if (name_start && name_start < item_end) {
-                name_start += 8; // "<krName>" 길이
-                char* name_end = strstr(name_start, "</krName>");
-                if (name_end && name_end < item_end) {
-                    int len = name_end - name_start;
-                    if (len < MAX_STRING_LEN) {
-                        strncpy(candidate_name, name_start, len);
-                        candidate_name[len] = '\0';
-                        printf("🔍 후보자 이름 추출 성공: '%s'\n", candidate_name);
-                    } else {
-                        printf("❌ 후보자 이름 길이 초과: %d\n", len);
-                    }
-                } else {
-                    printf("❌ </krName> 태그를 찾을 수 없음\n");
-                }
-            } else {
-                printf("❌ <krName> 태그를 찾을 수 없음\n");
-            }
-            
-            printf("🔍 후보자 '%s' (ID: %s')의 공약 파싱 중...\n", candidate_name, candidate_id);
-            printf("🔍 후보자 ID 길이: %zu, 이름 길이: %zu\n", strlen(candidate_id), strlen(candidate_name));
-            
-            if (strlen(candidate_id) == 0) {
-                printf("❌ 후보자 ID 추출 실패! XML 내용 일부:\n");
-                printf("%.1000s\n", item_start);
-                return 0;
-            }
-            
-            if (strlen(candidate_name) == 0) {
-                printf("❌ 후보자 이름 추출 실패! XML 내용 일부:\n");
-                printf("%.1000s\n", item_start);
-                return 0;
-            }
-            
-            // 공약 개수 확인
-            int pledge_count = 0;
-            char* prmscnt_start = strstr(item_start, "<prmsCnt>");
-            if (prmscnt_start && prmscnt_start < item_end) {
-                prmscnt_start += 9; // "<prmsCnt>" 길이
-                char* prmscnt_end = strstr(prmscnt_start, "</prmsCnt>");
-                if (prmscnt_end && prmscnt_end < item_end) {
-                    char count_str[10];
-                    int len = prmscnt_end - prmscnt_start;
-                    if (len < 10) {
-                        strncpy(count_str, prmscnt_start, len);
-                        count_str[len] = '\0';
-                        pledge_count = atoi(count_str);
-                    }
-                }
-            }
-            
-            printf("📋 총 %d개 공약 발견\n", pledge_count);
-            
-            if (pledge_count == 0) {
-                printf("⚠️  공약 개수가 0입니다. XML 내용 일부 출력:\n");
-                printf("%.500s\n", json_data);
-            }
-            
-            // 각 공약 파싱 (최대 10개)
-            for (int i = 1; i <= pledge_count && i <= 10 && count < max_pledges; i++) {
-                char tag_name[50];
-                
-                // 공약 제목 추출
-                snprintf(tag_name, sizeof(tag_name), "<prmsTitle%d>", i);
-                char* title_start = strstr(item_start, tag_name);
-                if (title_start && title_start < item_end) {
-                    title_start += strlen(tag_name);
-                    snprintf(tag_name, sizeof(tag_name), "</prmsTitle%d>", i);
-                    char* title_end = strstr(title_start, tag_name);
-                    if (title_end && title_end < item_end) {
-                        int len = title_end - title_start;
-                        if (len < MAX_STRING_LEN) {
-                            strncpy(pledges[count].title, title_start, len);
-                            pledges[count].title[len] = '\0';
-                        }
-                    }
-                }
-                
-                // 공약 내용 추출
-                snprintf(tag_name, sizeof(tag_name), "<prmmCont%d>", i);
-                char* content_start = strstr(item_start, tag_name);
-                if (content_start && content_start < item_end) {
-                    content_start += strlen(tag_name);
-                    snprintf(tag_name, sizeof(tag_name), "</prmmCont%d>", i);
-                    char* content_end = strstr(content_start, tag_name);
-                    if (content_end && content_end < item_end) {
-                        int len = content_end - content_start;
-                        if (len < MAX_CONTENT_LEN) {
-                            // 임시 버퍼에 원본 내용 복사
-                            char temp_content[MAX_CONTENT_LEN];
-                            strncpy(temp_content, content_start, len);
-                            temp_content[len] = '\0';
-                            
-                            // 멀티라인을 한 줄로 압축 (개행문자들을 공백으로 변환)
-                            char* src = temp_content;
-                            char* dst = pledges[count].content;
-                            int dst_pos = 0;
-                            
-                            while (*src && dst_pos < MAX_CONTENT_LEN - 1) {
-                                if (*src == '\n' || *src == '\r' || *src == '\t') {
-                                    // 연속된 공백 방지
-                                    if (dst_pos > 0 && dst[dst_pos - 1] != ' ') {
-                                        dst[dst_pos++] = ' ';
-                                    }
-                                } else if (*src == ' ') {
-                                    // 연속된 공백 방지
-                                    if (dst_pos > 0 && dst[dst_pos - 1] != ' ') {
-                                        dst[dst_pos++] = ' ';
-                                    }
-                                } else {
-                                    dst[dst_pos++] = *src;
-                                }
-                                src++;
-                            }
-                            dst[dst_pos] = '\0';
-                            
-                            // 앞뒤 공백 제거
-                            char* trimmed = pledges[count].content;
-                            while (*trimmed == ' ') trimmed++;
-                            if (trimmed != pledges[count].content) {
-                                memmove(pledges[count].content, trimmed, strlen(trimmed) + 1);
-                            }
-                            int content_len = strlen(pledges[count].content);
-                            while (content_len > 0 && pledges[count].content[content_len - 1] == ' ') {
-                                pledges[count].content[--content_len] = '\0';
-                            }
-                        }
-                    }
-                }
-                
-                // 공약 분야 추출
-                snprintf(tag_name, sizeof(tag_name), "<prmsRealmName%d>", i);
-                char* realm_start = strstr(item_start, tag_name);
-                if (realm_start && realm_start < item_end) {
-                    realm_start += strlen(tag_name);
-                    snprintf(tag_name, sizeof(tag_name), "</prmsRealmName%d>", i);
-                    char* realm_end = strstr(realm_start, tag_name);
-                    if (realm_end && realm_end < item_end) {
-                        int len = realm_end - realm_start;
-                        if (len < MAX_STRING_LEN) {
-                            strncpy(pledges[count].category, realm_start, len);
-                            pledges[count].category[len] = '\0';
-                        }
-                    }
-                }
-                
-                // 기본 정보 설정
-                snprintf(pledges[count].pledge_id, MAX_STRING_LEN, "%s_%d", candidate_id, i);
-                strcpy(pledges[count].candidate_id, candidate_id);
-                pledges[count].like_count = 0;
-                pledges[count].dislike_count = 0;
-                pledges[count].created_time = time(NULL);
-                
-                printf("   %d. [%s] %s\n", i, pledges[count].category, pledges[count].title);
-                count++;
-            }
-        } else {
-            printf("❌ <item> 태그를 찾을 수 없습니다. XML 내용 일부 출력:\n");
-            printf("%.500s\n", json_data);
+    if (parser.result_ok) {
+        if (parser.pledge_total == 0) {
+            printf("⚠️  후보자 '%s'의 공약 개수가 0입니다\n", parser.candidate_id);
         }
-        
-        printf("🎉 공약 정보 %d개 파싱 완료!\n", count);
+        printf("🎉 후보자 '%s' (ID: %s) 공약 정보 %d개 파싱 완료!\n",
+               parser.candidate_name, parser.candidate_id, count);
     } else {
-        printf("❌ 공약 API 오류 응답\n");
-        char* error_msg = strstr(json_data, "<resultMsg>");
-        if (error_msg) {
-            char* error_end = strstr(error_msg, "</resultMsg>");
-            if (error_end) {
-                printf("오류 내용: %.*s\n", (int)(error_end - error_msg - 11), error_msg + 11);
-            }
-        }
+        print_parser_error("공약", &parser);
     }
     
     write_log("INFO", "공약 정보 파싱 완료");
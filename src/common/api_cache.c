@@ -0,0 +1,349 @@
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "api_cache.h"
+#include "utils.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <direct.h>
+    #include <process.h>
+#else
+    #include <sys/stat.h>
+    #include <sys/types.h>
+    #include <unistd.h>
+#endif
+
+#define API_CACHE_MAX_PARAMS 32
+#define API_CACHE_SAMPLE_BYTES 2048         // 결과 코드를 찾을 본문 앞부분 (header가 맨 앞에 옴)
+
+static int g_cache_enabled = 1;
+static long g_cache_ttl[API_ENDPOINT_COUNT] = {
+    API_CACHE_DEFAULT_TTL_ELECTION,
+    API_CACHE_DEFAULT_TTL_CANDIDATE,
+    API_CACHE_DEFAULT_TTL_PLEDGE
+};
+static APICacheStats g_cache_stats;
+static unsigned long g_temp_counter;        // 임시 파일 이름 (프로세스 안에서 쓰기마다 다름)
+
+void api_cache_set_enabled(int enabled) {
+    __atomic_store_n(&g_cache_enabled, enabled ? 1 : 0, __ATOMIC_RELAXED);
+}
+
+int api_cache_enabled(void) {
+    return __atomic_load_n(&g_cache_enabled, __ATOMIC_RELAXED);
+}
+
+void api_cache_set_ttl(APIEndpoint endpoint, long seconds) {
+    if (endpoint < 0 || endpoint >= API_ENDPOINT_COUNT) return;
+    __atomic_store_n(&g_cache_ttl[endpoint], seconds < 0 ? 0 : seconds, __ATOMIC_RELAXED);
+}
+
+long api_cache_get_ttl(APIEndpoint endpoint) {
+    if (endpoint < 0 || endpoint >= API_ENDPOINT_COUNT) return 0;
+    return __atomic_load_n(&g_cache_ttl[endpoint], __ATOMIC_RELAXED);
+}
+
+int api_cache_endpoint_for_url(const char* url) {
+    if (!url) return -1;
+    if (strstr(url, "/CommonCodeService/")) return API_ENDPOINT_ELECTION;
+    if (strstr(url, "/PofelcddInfoInqireService/")) return API_ENDPOINT_CANDIDATE;
+    if (strstr(url, "/ElecPrmsInfoInqireService/")) return API_ENDPOINT_PLEDGE;
+    return -1;
+}
+
+// 대소문자 구분 없이 앞부분 비교
+static int starts_with_nocase(const char* text, size_t length, const char* prefix) {
+    size_t prefix_length = strlen(prefix);
+    if (length < prefix_length) return 0;
+    for (size_t i = 0; i < prefix_length; i++) {
+        if (tolower((unsigned char)text[i]) != tolower((unsigned char)prefix[i])) return 0;
+    }
+    return 1;
+}
+
+static int compare_params(const void* a, const void* b) {
+    return strcmp(*(const char* const*)a, *(const char* const*)b);
+}
+
+int api_cache_normalize_url(const char* url, char* key, size_t size) {
+    char copy[MAX_URL_LEN * 2];
+    size_t length = strcspn(url, "#");
+    if (length >= sizeof(copy) || size == 0) return 0;
+    memcpy(copy, url, length);
+    copy[length] = '\0';
+
+    // 스킴과 호스트는 대소문자 구분이 없으므로 소문자로
+    char* scheme_end = strstr(copy, "://");
+    char* p = scheme_end ? scheme_end + 3 : copy;
+    for (char* c = copy; c < p; c++) *c = (char)tolower((unsigned char)*c);
+    for (; *p && *p != '/' && *p != '?'; p++) *p = (char)tolower((unsigned char)*p);
+
+    char* query = strchr(p, '?');
+    if (query) *query++ = '\0';
+
+    int written = snprintf(key, size, "%s", copy);
+    if (written < 0 || (size_t)written >= size) return 0;
+    if (!query) return 1;
+
+    // 쿼리 매개변수를 이름순으로 정렬 (serviceKey와 빈 항목은 뺌)
+    char* params[API_CACHE_MAX_PARAMS];
+    int count = 0;
+    for (char* param = query; param && *param;) {
+        char* next = strchr(param, '&');
+        if (next) *next++ = '\0';
+        if (*param && !starts_with_nocase(param, strlen(param), "serviceKey=")) {
+            if (count == API_CACHE_MAX_PARAMS) return 0;
+            params[count++] = param;
+        }
+        param = next;
+    }
+    qsort(params, (size_t)count, sizeof(char*), compare_params);
+
+    size_t offset = (size_t)written;
+    for (int i = 0; i < count; i++) {
+        written = snprintf(key + offset, size - offset, "%c%s", i == 0 ? '?' : '&', params[i]);
+        if (written < 0 || (size_t)written >= size - offset) return 0;
+        offset += (size_t)written;
+    }
+    return 1;
+}
+
+// 키 -> 캐시 파일 경로 (키의 FNV-1a 64비트 해시)
+static void cache_path(const char* key, const char* extension, char* path, size_t size) {
+    unsigned long long hash = 1469598103934665603ULL;
+    for (const unsigned char* c = (const unsigned char*)key; *c; c++) {
+        hash ^= *c;
+        hash *= 1099511628211ULL;
+    }
+    snprintf(path, size, "%s/%016llx.%s", API_CACHE_DIR, hash, extension);
+}
+
+// "이름=값\n" 줄에서 값 복사 (이름이 다르면 0)
+static int read_field(const char* line, const char* name, char* value, size_t size) {
+    size_t name_length = strlen(name);
+    if (strncmp(line, name, name_length) != 0 || line[name_length] != '=') return 0;
+    safe_strcpy(value, line + name_length + 1, size);
+    value[strcspn(value, "\r\n")] = '\0';
+    return 1;
+}
+
+// 키가 같은 항목을 읽음 (파일이 없거나 형식이 다르거나 해시만 같은 다른 키면 0)
+static int read_entry(const char* key, APICacheEntry* entry) {
+    char path[256];
+    cache_path(key, "cache", path, sizeof(path));
+    FILE* file = fopen(path, "rb");
+    if (!file) return 0;
+
+    char line[MAX_URL_LEN * 2 + 16];
+    char value[MAX_URL_LEN * 2];
+    long size = -1;
+    int ok = fgets(line, sizeof(line), file) && strncmp(line, API_CACHE_MAGIC, strlen(API_CACHE_MAGIC)) == 0;
+    int key_matches = 0;
+
+    // 빈 줄까지 헤더, 그 뒤는 본문
+    while (ok && fgets(line, sizeof(line), file) && line[0] != '\n') {
+        if (read_field(line, "key", value, sizeof(value))) {
+            key_matches = strcmp(value, key) == 0;
+        } else if (read_field(line, "fetched", value, sizeof(value))) {
+            entry->fetched_at = (time_t)atoll(value);
+        } else if (read_field(line, "etag", value, sizeof(value))) {
+            safe_strcpy(entry->validators.etag, value, sizeof(entry->validators.etag));
+        } else if (read_field(line, "last_modified", value, sizeof(value))) {
+            safe_strcpy(entry->validators.last_modified, value, sizeof(entry->validators.last_modified));
+        } else if (read_field(line, "size", value, sizeof(value))) {
+            size = atol(value);
+        }
+    }
+
+    ok = ok && key_matches && size >= 0 && size < MAX_RESPONSE_SIZE;
+    if (ok) {
+        entry->body.data = malloc((size_t)size + 1);
+        ok = entry->body.data && fread(entry->body.data, 1, (size_t)size, file) == (size_t)size;
+    }
+    fclose(file);
+
+    if (!ok) {
+        free(entry->body.data);
+        entry->body.data = NULL;
+        return 0;
+    }
+    entry->body.data[size] = '\0';
+    entry->body.size = (size_t)size;
+    return 1;
+}
+
+APICacheState api_cache_lookup(const char* url, APICacheEntry* entry) {
+    memset(entry, 0, sizeof(APICacheEntry));
+    int endpoint = api_cache_endpoint_for_url(url);
+    if (!api_cache_enabled() || endpoint < 0) return API_CACHE_MISS;
+
+    char key[MAX_URL_LEN * 2];
+    if (!api_cache_normalize_url(url, key, sizeof(key)) || !read_entry(key, entry)) {
+        __atomic_add_fetch(&g_cache_stats.misses, 1, __ATOMIC_RELAXED);
+        return API_CACHE_MISS;
+    }
+
+    time_t now = time(NULL);
+    long ttl = api_cache_get_ttl((APIEndpoint)endpoint);
+    if (ttl > 0 && entry->fetched_at <= now && now - entry->fetched_at < ttl) {
+        entry->state = API_CACHE_FRESH;
+        __atomic_add_fetch(&g_cache_stats.hits, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&g_cache_stats.bytes_saved, (unsigned long long)entry->body.size, __ATOMIC_RELAXED);
+    } else {
+        entry->state = API_CACHE_STALE;
+    }
+    return entry->state;
+}
+
+void api_cache_entry_free(APICacheEntry* entry) {
+    free(entry->body.data);
+    entry->body.data = NULL;
+    entry->body.size = 0;
+    entry->state = API_CACHE_MISS;
+}
+
+// 결과 코드가 정상(INFO-00)이거나 데이터 없음(INFO-03)인 응답만 저장
+static int is_cacheable(const char* data, size_t size) {
+    char sample[API_CACHE_SAMPLE_BYTES + 1];
+    size_t length = size < API_CACHE_SAMPLE_BYTES ? size : API_CACHE_SAMPLE_BYTES;
+    memcpy(sample, data, length);
+    sample[length] = '\0';
+
+    return strstr(sample, "INFO-00") || strstr(sample, "INFO-03") || strstr(sample, "NORMAL SERVICE") ||
+           strstr(sample, "\"resultCode\":\"00\"");
+}
+
+static void ensure_cache_dir(void) {
+#ifdef _WIN32
+    _mkdir("data");
+    _mkdir(API_CACHE_DIR);
+#else
+    mkdir("data", 0755);
+    mkdir(API_CACHE_DIR, 0755);
+#endif
+}
+
+// 임시 파일에 쓴 뒤 교체 (실패 시 0)
+// 임시 파일 이름에 프로세스 ID와 쓰기 번호를 붙여 같은 키를 동시에 쓰는 스레드/프로세스가 서로의 파일을 덮지 않음
+static int write_entry(const char* key, time_t fetched_at, const APICacheValidators* validators,
+                       const char* data, size_t size) {
+    char path[256];
+    char temp_path[256];
+    char temp_extension[64];
+#ifdef _WIN32
+    long pid = (long)_getpid();
+#else
+    long pid = (long)getpid();
+#endif
+    snprintf(temp_extension, sizeof(temp_extension), "%ld.%lu.tmp",
+             pid, __atomic_add_fetch(&g_temp_counter, 1, __ATOMIC_RELAXED));
+    cache_path(key, "cache", path, sizeof(path));
+    cache_path(key, temp_extension, temp_path, sizeof(temp_path));
+
+    ensure_cache_dir();
+    FILE* file = fopen(temp_path, "wb");
+    if (!file) return 0;
+
+    fprintf(file, "%s\nkey=%s\nfetched=%lld\n", API_CACHE_MAGIC, key, (long long)fetched_at);
+    if (validators && validators->etag[0]) fprintf(file, "etag=%s\n", validators->etag);
+    if (validators && validators->last_modified[0]) fprintf(file, "last_modified=%s\n", validators->last_modified);
+    fprintf(file, "size=%zu\n\n", size);
+    int ok = fwrite(data, 1, size, file) == size;
+
+    if (fclose(file) != 0 || !ok) {
+        remove(temp_path);
+        return 0;
+    }
+#ifdef _WIN32
+    // Windows의 rename은 대상 파일이 있으면 실패함
+    remove(path);
+#endif
+    if (rename(temp_path, path) != 0) {
+        remove(temp_path);
+        return 0;
+    }
+    return 1;
+}
+
+int api_cache_store(const char* url, const APICacheValidators* validators, const char* data, size_t size) {
+    if (!api_cache_enabled() || api_cache_endpoint_for_url(url) < 0 || !data) return 0;
+    if (!is_cacheable(data, size)) return 0;
+
+    char key[MAX_URL_LEN * 2];
+    if (!api_cache_normalize_url(url, key, sizeof(key))) return 0;
+    if (!write_entry(key, time(NULL), validators, data, size)) {
+        write_error_log("api_cache_store", "응답 캐시 기록 실패");
+        return 0;
+    }
+    __atomic_add_fetch(&g_cache_stats.stored, 1, __ATOMIC_RELAXED);
+    return 1;
+}
+
+void api_cache_revalidated(const char* url, APICacheEntry* entry, const APICacheValidators* validators) {
+    if (validators && validators->etag[0]) {
+        safe_strcpy(entry->validators.etag, validators->etag, sizeof(entry->validators.etag));
+    }
+    if (validators && validators->last_modified[0]) {
+        safe_strcpy(entry->validators.last_modified, validators->last_modified, sizeof(entry->validators.last_modified));
+    }
+    entry->fetched_at = time(NULL);
+
+    char key[MAX_URL_LEN * 2];
+    if (api_cache_normalize_url(url, key, sizeof(key))) {
+        write_entry(key, entry->fetched_at, &entry->validators, entry->body.data, entry->body.size);
+    }
+    __atomic_add_fetch(&g_cache_stats.revalidated, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&g_cache_stats.bytes_saved, (unsigned long long)entry->body.size, __ATOMIC_RELAXED);
+}
+
+void api_cache_remove(const char* url) {
+    char key[MAX_URL_LEN * 2];
+    char path[256];
+    if (!api_cache_normalize_url(url, key, sizeof(key))) return;
+    cache_path(key, "cache", path, sizeof(path));
+    remove(path);
+}
+
+void api_cache_served_stale(void) {
+    __atomic_add_fetch(&g_cache_stats.stale_served, 1, __ATOMIC_RELAXED);
+}
+
+// "Name: value\r\n" 헤더 값 복사 (앞뒤 공백과 줄 끝 제거)
+static void copy_header_value(char* dest, size_t size, const char* value, size_t length) {
+    while (length > 0 && (*value == ' ' || *value == '\t')) {
+        value++;
+        length--;
+    }
+    while (length > 0 && (value[length - 1] == '\r' || value[length - 1] == '\n' || value[length - 1] == ' ')) {
+        length--;
+    }
+    if (length >= size) return;                 // 너무 긴 값은 재검증에 쓰지 않음
+    memcpy(dest, value, length);
+    dest[length] = '\0';
+}
+
+void api_cache_parse_header(APICacheValidators* validators, const char* line, size_t length) {
+    // 새 응답(리다이렉트 뒤 등)의 상태 줄이 오면 앞 응답의 값은 버림
+    if (starts_with_nocase(line, length, "HTTP/")) {
+        validators->etag[0] = '\0';
+        validators->last_modified[0] = '\0';
+    } else if (starts_with_nocase(line, length, "ETag:")) {
+        copy_header_value(validators->etag, sizeof(validators->etag), line + 5, length - 5);
+    } else if (starts_with_nocase(line, length, "Last-Modified:")) {
+        copy_header_value(validators->last_modified, sizeof(validators->last_modified), line + 14, length - 14);
+    }
+}
+
+void api_cache_get_stats(APICacheStats* stats) {
+    stats->hits = __atomic_load_n(&g_cache_stats.hits, __ATOMIC_RELAXED);
+    stats->revalidated = __atomic_load_n(&g_cache_stats.revalidated, __ATOMIC_RELAXED);
+    stats->stored = __atomic_load_n(&g_cache_stats.stored, __ATOMIC_RELAXED);
+    stats->stale_served = __atomic_load_n(&g_cache_stats.stale_served, __ATOMIC_RELAXED);
+    stats->misses = __atomic_load_n(&g_cache_stats.misses, __ATOMIC_RELAXED);
+    stats->bytes_saved = __atomic_load_n(&g_cache_stats.bytes_saved, __ATOMIC_RELAXED);
+}
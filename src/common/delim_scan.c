@@ -0,0 +1,167 @@
+#include "delim_scan.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define DELIM_SCAN_X86 1
+    #include <immintrin.h>
+#endif
+
+// 구현 하나
+typedef struct {
+    const char* name;
+    DelimScanLevel level;
+    size_t (*scan)(const char* data, size_t length, char a, char b, uint32_t* positions, size_t max_positions);
+} DelimScanTable;
+
+// =====================================================
+// 스칼라 구현 (벡터 구현의 나머지 바이트 처리에도 사용)
+// =====================================================
+
+static size_t scan_scalar_from(const char* data, size_t start, size_t length, char a, char b,
+                               uint32_t* positions, size_t found, size_t max_positions) {
+    for (size_t i = start; i < length && found < max_positions; i++) {
+        if (data[i] == a || data[i] == b) {
+            positions[found++] = (uint32_t)i;
+        }
+    }
+    return found;
+}
+
+static size_t scan_scalar(const char* data, size_t length, char a, char b, uint32_t* positions,
+                          size_t max_positions) {
+    return scan_scalar_from(data, 0, length, a, b, positions, 0, max_positions);
+}
+
+static const DelimScanTable g_scalar_scan = { "scalar", DELIM_SCAN_SCALAR, scan_scalar };
+
+#ifdef DELIM_SCAN_X86
+
+// =====================================================
+// SSE2 구현 (16바이트씩 비교, 일치한 바이트의 비트 마스크에서 위치를 하나씩 꺼냄)
+// =====================================================
+
+__attribute__((target("sse2")))
+static size_t scan_sse2(const char* data, size_t length, char a, char b, uint32_t* positions,
+                        size_t max_positions) {
+    __m128i match_a = _mm_set1_epi8(a);
+    __m128i match_b = _mm_set1_epi8(b);
+    size_t found = 0;
+    size_t i = 0;
+
+    for (; i + 16 <= length; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(data + i));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, match_a), _mm_cmpeq_epi8(chunk, match_b)));
+
+        while (mask) {
+            if (found == max_positions) return found;
+            positions[found++] = (uint32_t)(i + (size_t)__builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+    return scan_scalar_from(data, i, length, a, b, positions, found, max_positions);
+}
+
+static const DelimScanTable g_sse2_scan = { "sse2", DELIM_SCAN_SSE2, scan_sse2 };
+
+// =====================================================
+// AVX2 구현 (32바이트씩)
+// =====================================================
+
+__attribute__((target("avx2")))
+static size_t scan_avx2(const char* data, size_t length, char a, char b, uint32_t* positions,
+                        size_t max_positions) {
+    __m256i match_a = _mm256_set1_epi8(a);
+    __m256i match_b = _mm256_set1_epi8(b);
+    size_t found = 0;
+    size_t i = 0;
+
+    for (; i + 32 <= length; i += 32) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i*)(data + i));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, match_a), _mm256_cmpeq_epi8(chunk, match_b)));
+
+        while (mask) {
+            if (found == max_positions) return found;
+            positions[found++] = (uint32_t)(i + (size_t)__builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+    return scan_scalar_from(data, i, length, a, b, positions, found, max_positions);
+}
+
+static const DelimScanTable g_avx2_scan = { "avx2", DELIM_SCAN_AVX2, scan_avx2 };
+
+#endif // DELIM_SCAN_X86
+
+// =====================================================
+// 구현 선택
+// =====================================================
+
+static const DelimScanTable* g_active_scan = NULL;
+
+static const DelimScanTable* scan_for(DelimScanLevel level) {
+#ifdef DELIM_SCAN_X86
+    if (level == DELIM_SCAN_AVX2) return &g_avx2_scan;
+    if (level == DELIM_SCAN_SSE2) return &g_sse2_scan;
+#else
+    (void)level;
+#endif
+    return &g_scalar_scan;
+}
+
+DelimScanLevel delim_scan_detect(void) {
+#ifdef DELIM_SCAN_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return DELIM_SCAN_AVX2;
+    if (__builtin_cpu_supports("sse2")) return DELIM_SCAN_SSE2;
+#endif
+    return DELIM_SCAN_SCALAR;
+}
+
+// 처음 호출할 때 CPU를 확인 (여러 스레드가 동시에 정해도 같은 값을 기록하므로 안전)
+static const DelimScanTable* active_scan(void) {
+    const DelimScanTable* table = __atomic_load_n(&g_active_scan, __ATOMIC_ACQUIRE);
+    if (!table) {
+        table = scan_for(delim_scan_detect());
+        __atomic_store_n(&g_active_scan, table, __ATOMIC_RELEASE);
+    }
+    return table;
+}
+
+int delim_scan_select(DelimScanLevel level) {
+    if (level > delim_scan_detect()) return 0;
+    __atomic_store_n(&g_active_scan, scan_for(level), __ATOMIC_RELEASE);
+    return 1;
+}
+
+const char* delim_scan_name(void) {
+    return active_scan()->name;
+}
+
+size_t delim_scan(const char* data, size_t length, char a, char b, uint32_t* positions, size_t max_positions) {
+    if (max_positions == 0) return 0;
+    return active_scan()->scan(data, length, a, b, positions, max_positions);
+}
+
+int delim_split(char* line, size_t length, char delim, char** fields, int max_fields) {
+    uint32_t positions[64];
+    size_t from = 0;
+    int delimiters = 0;
+
+    if (max_fields > 0) fields[0] = line;
+
+    for (;;) {
+        size_t found = delim_scan(line + from, length - from, delim, delim, positions, 64);
+        for (size_t i = 0; i < found; i++) {
+            size_t at = from + positions[i];
+            delimiters++;
+            if (delimiters < max_fields) {
+                line[at] = '\0';
+                fields[delimiters] = line + at + 1;
+            }
+        }
+        if (found < 64) break;
+        from += positions[63] + 1;
+    }
+    return delimiters + 1;
+}
@@ -0,0 +1,239 @@
+#include "hash_index.h"
+#include <stdlib.h>
+#include <string.h>
+
+// FNV-1a 32비트 해시
+uint32_t hash_index_hash(const char* key) {
+    uint32_t hash = 2166136261u;
+    while (*key) {
+        hash ^= (unsigned char)*key++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// 복합 키 해시 (구분자를 섞어서 "ab"+"c"와 "a"+"bc"가 겹치지 않게 함)
+uint32_t hash_index_hash_pair(const char* key, const char* key2) {
+    uint32_t hash = hash_index_hash(key);
+    hash ^= 0x1f;
+    hash *= 16777619u;
+    while (*key2) {
+        hash ^= (unsigned char)*key2++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static const char* key_at(const HashIndex* index, int slot) {
+    return index->base + (size_t)slot * index->stride + index->key_offset;
+}
+
+static const char* key2_at(const HashIndex* index, int slot) {
+    return index->base + (size_t)slot * index->stride + index->key2_offset;
+}
+
+static uint32_t hash_keys(const HashIndex* index, const char* key, const char* key2) {
+    return index->key2_offset == HASH_INDEX_NO_KEY2 ? hash_index_hash(key) : hash_index_hash_pair(key, key2);
+}
+
+static uint32_t slot_hash(const HashIndex* index, int slot) {
+    return index->key2_offset == HASH_INDEX_NO_KEY2 ? hash_index_hash(key_at(index, slot))
+                                                    : hash_index_hash_pair(key_at(index, slot), key2_at(index, slot));
+}
+
+static int slot_matches(const HashIndex* index, int slot, const char* key, const char* key2) {
+    if (strcmp(key_at(index, slot), key) != 0) return 0;
+    return index->key2_offset == HASH_INDEX_NO_KEY2 || strcmp(key2_at(index, slot), key2) == 0;
+}
+
+static int allocate_entries(HashIndex* index, size_t capacity) {
+    HashIndexEntry* entries = malloc(capacity * sizeof(HashIndexEntry));
+    if (!entries) return 0;
+
+    for (size_t i = 0; i < capacity; i++) {
+        entries[i].hash = 0;
+        entries[i].slot = HASH_INDEX_EMPTY;
+    }
+
+    free(index->entries);
+    index->entries = entries;
+    index->capacity = capacity;
+    index->count = 0;
+    return 1;
+}
+
+// 키 비교 없이 바로 빈 칸에 넣음 (재구성/확장 시 사용)
+static void place_entry(HashIndex* index, uint32_t hash, int slot) {
+    size_t mask = index->capacity - 1;
+    size_t pos = hash & mask;
+
+    while (index->entries[pos].slot != HASH_INDEX_EMPTY) {
+        pos = (pos + 1) & mask;
+    }
+    index->entries[pos].hash = hash;
+    index->entries[pos].slot = slot;
+    index->count++;
+}
+
+// 적재율 50% 이하 유지
+static int grow_if_needed(HashIndex* index, size_t needed) {
+    if (needed * 2 <= index->capacity) return 1;
+
+    size_t capacity = index->capacity;
+    while (needed * 2 > capacity) capacity *= 2;
+
+    HashIndexEntry* old_entries = index->entries;
+    size_t old_capacity = index->capacity;
+    index->entries = NULL;
+
+    if (!allocate_entries(index, capacity)) {
+        index->entries = old_entries;
+        return 0;
+    }
+
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_entries[i].slot != HASH_INDEX_EMPTY) {
+            place_entry(index, old_entries[i].hash, old_entries[i].slot);
+        }
+    }
+    free(old_entries);
+    return 1;
+}
+
+int hash_index_init(HashIndex* index, const void* base, size_t stride, size_t key_offset, size_t expected) {
+    return hash_index_init_pair(index, base, stride, key_offset, HASH_INDEX_NO_KEY2, expected);
+}
+
+int hash_index_init_pair(HashIndex* index, const void* base, size_t stride,
+                         size_t key_offset, size_t key2_offset, size_t expected) {
+    memset(index, 0, sizeof(HashIndex));
+    index->base = (const char*)base;
+    index->stride = stride;
+    index->key_offset = key_offset;
+    index->key2_offset = key2_offset;
+
+    size_t capacity = HASH_INDEX_MIN_CAPACITY;
+    while (expected * 2 > capacity) capacity *= 2;
+    return allocate_entries(index, capacity);
+}
+
+void hash_index_free(HashIndex* index) {
+    free(index->entries);
+    memset(index, 0, sizeof(HashIndex));
+}
+
+void hash_index_clear(HashIndex* index) {
+    for (size_t i = 0; i < index->capacity; i++) {
+        index->entries[i].slot = HASH_INDEX_EMPTY;
+    }
+    index->count = 0;
+}
+
+void hash_index_rebind(HashIndex* index, const void* base) {
+    index->base = (const char*)base;
+}
+
+// 원본 배열 전체로 다시 구성 (중복 키는 뒤쪽 위치가 우선)
+int hash_index_rebuild(HashIndex* index, int count) {
+    hash_index_clear(index);
+    if (count <= 0) return 1;
+    if (!grow_if_needed(index, (size_t)count)) return 0;
+
+    for (int slot = 0; slot < count; slot++) {
+        if (!hash_index_insert(index, slot)) return 0;
+    }
+    return 1;
+}
+
+int hash_index_insert(HashIndex* index, int slot) {
+    if (!grow_if_needed(index, index->count + 1)) return 0;
+
+    const char* key = key_at(index, slot);
+    const char* key2 = index->key2_offset == HASH_INDEX_NO_KEY2 ? NULL : key2_at(index, slot);
+    uint32_t hash = hash_keys(index, key, key2);
+    size_t mask = index->capacity - 1;
+    size_t pos = hash & mask;
+
+    while (index->entries[pos].slot != HASH_INDEX_EMPTY) {
+        HashIndexEntry* entry = &index->entries[pos];
+        if (entry->hash == hash && slot_matches(index, entry->slot, key, key2)) {
+            entry->slot = slot;
+            return 1;
+        }
+        pos = (pos + 1) & mask;
+    }
+
+    index->entries[pos].hash = hash;
+    index->entries[pos].slot = slot;
+    index->count++;
+    return 1;
+}
+
+// slot을 가리키는 칸의 위치 (없으면 -1)
+static long position_of_slot(const HashIndex* index, int slot) {
+    if (!index->entries) return -1;
+
+    size_t mask = index->capacity - 1;
+    size_t pos = slot_hash(index, slot) & mask;
+
+    while (index->entries[pos].slot != HASH_INDEX_EMPTY) {
+        if (index->entries[pos].slot == slot) return (long)pos;
+        pos = (pos + 1) & mask;
+    }
+    return -1;
+}
+
+// 삭제 후 뒤따르는 칸들을 당겨서 탐사 체인을 유지 (삭제 표시 없이 처리)
+int hash_index_remove(HashIndex* index, int slot) {
+    long found = position_of_slot(index, slot);
+    if (found < 0) return 0;
+
+    size_t mask = index->capacity - 1;
+    size_t hole = (size_t)found;
+    size_t next = (hole + 1) & mask;
+
+    while (index->entries[next].slot != HASH_INDEX_EMPTY) {
+        size_t home = index->entries[next].hash & mask;
+        // home에서 next까지의 거리가 hole까지보다 멀면 hole로 당길 수 있음
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            index->entries[hole] = index->entries[next];
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+
+    index->entries[hole].slot = HASH_INDEX_EMPTY;
+    index->count--;
+    return 1;
+}
+
+// 원본 배열에서 원소가 from_slot -> to_slot으로 옮겨질 때 사용 (from_slot의 키가 아직 남아 있어야 함)
+int hash_index_move(HashIndex* index, int from_slot, int to_slot) {
+    long found = position_of_slot(index, from_slot);
+    if (found < 0) return 0;
+
+    index->entries[found].slot = to_slot;
+    return 1;
+}
+
+int hash_index_find(const HashIndex* index, const char* key) {
+    return hash_index_find_pair(index, key, NULL);
+}
+
+int hash_index_find_pair(const HashIndex* index, const char* key, const char* key2) {
+    if (!index->entries || !key) return -1;
+    if (index->key2_offset != HASH_INDEX_NO_KEY2 && !key2) return -1;
+
+    uint32_t hash = hash_keys(index, key, key2);
+    size_t mask = index->capacity - 1;
+    size_t pos = hash & mask;
+
+    while (index->entries[pos].slot != HASH_INDEX_EMPTY) {
+        const HashIndexEntry* entry = &index->entries[pos];
+        if (entry->hash == hash && slot_matches(index, entry->slot, key, key2)) {
+            return entry->slot;
+        }
+        pos = (pos + 1) & mask;
+    }
+    return -1;
+}
@@ -0,0 +1,313 @@
+#include "protocol.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#ifndef _WIN32
+    #include <sys/types.h>
+    #include <sys/socket.h>
+    #include <errno.h>
+#endif
+
+// 빅엔디안 정수 읽기/쓰기
+static void put_u16(unsigned char* p, unsigned int value) {
+    p[0] = (unsigned char)(value >> 8);
+    p[1] = (unsigned char)value;
+}
+
+static void put_u32(unsigned char* p, unsigned long value) {
+    p[0] = (unsigned char)(value >> 24);
+    p[1] = (unsigned char)(value >> 16);
+    p[2] = (unsigned char)(value >> 8);
+    p[3] = (unsigned char)value;
+}
+
+static unsigned int get_u16(const unsigned char* p) {
+    return ((unsigned int)p[0] << 8) | p[1];
+}
+
+static unsigned long get_u32(const unsigned char* p) {
+    return ((unsigned long)p[0] << 24) | ((unsigned long)p[1] << 16) |
+           ((unsigned long)p[2] << 8) | p[3];
+}
+
+// 고정 크기 배열 안의 문자열 길이 (NUL이 없으면 max_len)
+static size_t bounded_strlen(const char* str, size_t max_len) {
+    const char* end = memchr(str, '\0', max_len);
+    return end ? (size_t)(end - str) : max_len;
+}
+
+void frame_init(Frame* frame) {
+    memset(frame, 0, sizeof(Frame));
+}
+
+void frame_free(Frame* frame) {
+    if (!frame) return;
+    free(frame->payload);
+    frame->payload = NULL;
+    frame->payload_length = 0;
+    frame->payload_capacity = 0;
+}
+
+int frame_set_payload(Frame* frame, const char* data, size_t length) {
+    frame->payload_length = 0;
+    return frame_append_payload(frame, data, length);
+}
+
+// payload 공간 확보 (NUL 문자 포함, 부족하면 두 배씩 증가)
+static int frame_reserve_payload(Frame* frame, size_t length) {
+    if (length > FRAME_MAX_PAYLOAD) return 0;
+    if (frame->payload && frame->payload_capacity > length) return 1;
+
+    size_t new_capacity = frame->payload_capacity ? frame->payload_capacity : 64;
+    while (new_capacity <= length) new_capacity *= 2;
+
+    char* new_payload = realloc(frame->payload, new_capacity);
+    if (!new_payload) return 0;
+
+    frame->payload = new_payload;
+    frame->payload_capacity = new_capacity;
+    return 1;
+}
+
+// payload 뒤에 데이터 추가 (큰 응답을 나눠서 만들 때 사용)
+int frame_append_payload(Frame* frame, const char* data, size_t length) {
+    size_t new_length = frame->payload_length + length;
+    if (!frame_reserve_payload(frame, new_length)) return 0;
+
+    if (length > 0) {
+        memcpy(frame->payload + frame->payload_length, data, length);
+    }
+    frame->payload[new_length] = '\0';
+    frame->payload_length = new_length;
+    return 1;
+}
+
+// printf 형식으로 payload 뒤에 추가
+int frame_appendf(Frame* frame, const char* format, ...) {
+    char small[512];
+    va_list args;
+
+    va_start(args, format);
+    int needed = vsnprintf(small, sizeof(small), format, args);
+    va_end(args);
+    if (needed < 0) return 0;
+
+    if ((size_t)needed < sizeof(small)) {
+        return frame_append_payload(frame, small, (size_t)needed);
+    }
+
+    // 긴 문자열은 payload에 바로 기록
+    if (!frame_reserve_payload(frame, frame->payload_length + (size_t)needed)) return 0;
+    va_start(args, format);
+    vsnprintf(frame->payload + frame->payload_length, (size_t)needed + 1, format, args);
+    va_end(args);
+    frame->payload_length += (size_t)needed;
+    return 1;
+}
+
+// NetworkMessage -> Frame (data는 문자열로 취급)
+int frame_from_message(const NetworkMessage* msg, Frame* frame) {
+    frame_init(frame);
+    frame->message_type = msg->message_type;
+    frame->status_code = msg->status_code;
+    frame->flags = FRAME_FLAG_NONE;
+
+    size_t uid_len = bounded_strlen(msg->user_id, MAX_STRING_LEN - 1);
+    size_t sid_len = bounded_strlen(msg->session_id, MAX_STRING_LEN - 1);
+    memcpy(frame->user_id, msg->user_id, uid_len);
+    memcpy(frame->session_id, msg->session_id, sid_len);
+
+    return frame_set_payload(frame, msg->data, bounded_strlen(msg->data, MAX_CONTENT_LEN - 1));
+}
+
+// Frame -> NetworkMessage (기존 핸들러/구버전 클라이언트용, 긴 payload는 잘림)
+void frame_to_message(const Frame* frame, NetworkMessage* msg) {
+    memset(msg, 0, sizeof(NetworkMessage));
+    msg->message_type = frame->message_type;
+    msg->status_code = frame->status_code;
+    safe_strcpy(msg->user_id, frame->user_id, sizeof(msg->user_id));
+    safe_strcpy(msg->session_id, frame->session_id, sizeof(msg->session_id));
+
+    size_t length = frame->payload_length;
+    if (length > MAX_CONTENT_LEN - 1) length = MAX_CONTENT_LEN - 1;
+    if (length > 0) {
+        memcpy(msg->data, frame->payload, length);
+    }
+    msg->data[length] = '\0';
+    msg->data_length = (int)length;
+}
+
+size_t frame_encoded_size(const Frame* frame, FrameMode mode) {
+    if (mode == FRAME_MODE_LEGACY) {
+        return sizeof(NetworkMessage);
+    }
+    return FRAME_HEADER_SIZE + strlen(frame->user_id) + strlen(frame->session_id) + frame->payload_length;
+}
+
+// out에는 frame_encoded_size() 이상의 공간이 있어야 함
+size_t frame_encode(const Frame* frame, FrameMode mode, char* out) {
+    if (mode == FRAME_MODE_LEGACY) {
+        NetworkMessage msg;
+        frame_to_message(frame, &msg);
+        memcpy(out, &msg, sizeof(NetworkMessage));
+        return sizeof(NetworkMessage);
+    }
+
+    unsigned char* p = (unsigned char*)out;
+    size_t uid_len = strlen(frame->user_id);
+    size_t sid_len = strlen(frame->session_id);
+
+    put_u32(p, FRAME_MAGIC);
+    put_u16(p + 4, (unsigned int)frame->message_type);
+    put_u16(p + 6, (unsigned int)frame->status_code);
+    put_u16(p + 8, (unsigned int)frame->flags);
+    p[10] = (unsigned char)uid_len;
+    p[11] = (unsigned char)sid_len;
+    put_u32(p + 12, (unsigned long)frame->payload_length);
+
+    size_t pos = FRAME_HEADER_SIZE;
+    memcpy(out + pos, frame->user_id, uid_len);
+    pos += uid_len;
+    memcpy(out + pos, frame->session_id, sid_len);
+    pos += sid_len;
+    if (frame->payload_length > 0) {
+        memcpy(out + pos, frame->payload, frame->payload_length);
+        pos += frame->payload_length;
+    }
+    return pos;
+}
+
+void frame_reader_init(FrameReader* reader) {
+    memset(reader, 0, sizeof(FrameReader));
+}
+
+void frame_reader_free(FrameReader* reader) {
+    free(reader->buffer);
+    memset(reader, 0, sizeof(FrameReader));
+}
+
+// 최소 min_space 바이트를 받을 공간을 확보하고 쓰기 위치를 반환
+char* frame_reader_reserve(FrameReader* reader, size_t min_space, size_t* available) {
+    // 처리가 끝난 앞부분 정리
+    if (reader->offset > 0) {
+        memmove(reader->buffer, reader->buffer + reader->offset, reader->length - reader->offset);
+        reader->length -= reader->offset;
+        reader->offset = 0;
+    }
+
+    if (reader->capacity - reader->length < min_space) {
+        size_t new_capacity = reader->capacity ? reader->capacity : FRAME_READ_CHUNK;
+        while (new_capacity - reader->length < min_space) new_capacity *= 2;
+
+        char* new_buffer = realloc(reader->buffer, new_capacity);
+        if (!new_buffer) return NULL;
+        reader->buffer = new_buffer;
+        reader->capacity = new_capacity;
+    }
+
+    *available = reader->capacity - reader->length;
+    return reader->buffer + reader->length;
+}
+
+void frame_reader_commit(FrameReader* reader, size_t length) {
+    reader->length += length;
+}
+
+// 버퍼에서 완전한 프레임 하나를 꺼냄
+int frame_reader_next(FrameReader* reader, Frame* frame) {
+    const unsigned char* p = (const unsigned char*)reader->buffer + reader->offset;
+    size_t pending = reader->length - reader->offset;
+
+    // 첫 4바이트로 구버전 클라이언트인지 판별 (구조체는 작은 정수 message_type으로 시작)
+    if (reader->mode == FRAME_MODE_UNKNOWN) {
+        if (pending < 4) return 0;
+        reader->mode = (get_u32(p) == FRAME_MAGIC) ? FRAME_MODE_FRAMED : FRAME_MODE_LEGACY;
+    }
+
+    if (reader->mode == FRAME_MODE_LEGACY) {
+        if (pending < sizeof(NetworkMessage)) return 0;
+
+        NetworkMessage msg;
+        memcpy(&msg, p, sizeof(NetworkMessage));
+        reader->offset += sizeof(NetworkMessage);
+        return frame_from_message(&msg, frame) ? 1 : -1;
+    }
+
+    if (pending < FRAME_HEADER_SIZE) return 0;
+    if (get_u32(p) != FRAME_MAGIC) return -1;
+
+    size_t uid_len = p[10];
+    size_t sid_len = p[11];
+    size_t payload_length = get_u32(p + 12);
+    if (payload_length > FRAME_MAX_PAYLOAD) return -1;
+
+    size_t total = FRAME_HEADER_SIZE + uid_len + sid_len + payload_length;
+    if (pending < total) return 0;
+
+    frame_init(frame);
+    frame->message_type = (int)get_u16(p + 4);
+    frame->status_code = (int)get_u16(p + 6);
+    frame->flags = (int)get_u16(p + 8);
+
+    const char* body = (const char*)p + FRAME_HEADER_SIZE;
+    memcpy(frame->user_id, body, uid_len);
+    memcpy(frame->session_id, body + uid_len, sid_len);
+    if (!frame_set_payload(frame, body + uid_len + sid_len, payload_length)) {
+        return -1;
+    }
+
+    reader->offset += total;
+    return 1;
+}
+
+// 전체 프레임을 보낼 때까지 반복 전송
+int frame_send(protocol_socket_t sock, const Frame* frame, FrameMode mode) {
+    size_t size = frame_encoded_size(frame, mode);
+    char* buffer = malloc(size);
+    if (!buffer) return 0;
+
+    frame_encode(frame, mode, buffer);
+
+    size_t sent_total = 0;
+    while (sent_total < size) {
+        int chunk = (size - sent_total > 65536) ? 65536 : (int)(size - sent_total);
+        int sent = send(sock, buffer + sent_total, chunk, 0);
+        if (sent <= 0) {
+#ifndef _WIN32
+            if (sent < 0 && errno == EINTR) continue;
+#endif
+            free(buffer);
+            return 0;
+        }
+        sent_total += (size_t)sent;
+    }
+
+    free(buffer);
+    return 1;
+}
+
+// 프레임 하나를 받을 때까지 반복 수신 (남은 데이터는 reader에 보관)
+int frame_receive(protocol_socket_t sock, FrameReader* reader, Frame* frame) {
+    while (1) {
+        int result = frame_reader_next(reader, frame);
+        if (result != 0) return result;
+
+        size_t available;
+        char* space = frame_reader_reserve(reader, FRAME_READ_CHUNK, &available);
+        if (!space) return -1;
+
+        int chunk = available > 65536 ? 65536 : (int)available;
+        int received = recv(sock, space, chunk, 0);
+        if (received == 0) return 0;
+        if (received < 0) {
+#ifndef _WIN32
+            if (errno == EINTR) continue;
+#endif
+            return -1;
+        }
+        frame_reader_commit(reader, (size_t)received);
+    }
+}
@@ -0,0 +1,94 @@
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "rate_limiter.h"
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+// 경과 시간 측정 (밀리초)
+static double now_ms(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+#endif
+}
+
+static void bucket_lock(TokenBucket* bucket) {
+    while (__atomic_exchange_n(&bucket->lock, 1, __ATOMIC_ACQUIRE)) {
+        while (__atomic_load_n(&bucket->lock, __ATOMIC_RELAXED)) {
+            // 다른 스레드가 토큰 계산 중 (몇 줄이므로 잠깐만 기다림)
+        }
+    }
+}
+
+static void bucket_unlock(TokenBucket* bucket) {
+    __atomic_store_n(&bucket->lock, 0, __ATOMIC_RELEASE);
+}
+
+void token_bucket_init(TokenBucket* bucket, double rate, double burst) {
+    memset(bucket, 0, sizeof(TokenBucket));
+    token_bucket_configure(bucket, rate, burst);
+    bucket->tokens = bucket->burst;
+}
+
+void token_bucket_configure(TokenBucket* bucket, double rate, double burst) {
+    bucket_lock(bucket);
+    bucket->rate = rate;
+    bucket->burst = burst > 0.0 ? burst : 1.0;
+    if (bucket->tokens > bucket->burst) bucket->tokens = bucket->burst;
+    bucket_unlock(bucket);
+}
+
+double token_bucket_reserve(TokenBucket* bucket) {
+    double wait_ms = 0.0;
+    double now = now_ms();
+
+    bucket_lock(bucket);
+    if (bucket->rate > 0.0) {
+        // 마지막 계산 이후 찬 만큼 채움 (처음 호출이면 updated_ms가 0이라 가득 참)
+        bucket->tokens += (now - bucket->updated_ms) * bucket->rate / 1000.0;
+        if (bucket->tokens > bucket->burst) bucket->tokens = bucket->burst;
+        bucket->updated_ms = now;
+
+        bucket->tokens -= 1.0;
+        if (bucket->tokens < 0.0) {
+            wait_ms = -bucket->tokens * 1000.0 / bucket->rate;
+        }
+    }
+    bucket->acquired++;
+    bucket->waited_ms += wait_ms;
+    bucket_unlock(bucket);
+
+    return wait_ms;
+}
+
+void token_bucket_acquire(TokenBucket* bucket) {
+    double wait_ms = token_bucket_reserve(bucket);
+    if (wait_ms <= 0.0) return;
+
+#ifdef _WIN32
+    Sleep((DWORD)(wait_ms + 0.5));
+#else
+    long total_ns = (long)(wait_ms * 1e6);
+    struct timespec ts = { total_ns / 1000000000L, total_ns % 1000000000L };
+    nanosleep(&ts, NULL);
+#endif
+}
+
+void token_bucket_get_stats(TokenBucket* bucket, TokenBucket* stats) {
+    bucket_lock(bucket);
+    *stats = *bucket;
+    bucket_unlock(bucket);
+    stats->lock = 0;
+}
@@ -5,6 +5,8 @@
 #include <time.h>
 #include <ctype.h>
 #include <stdarg.h>
+#include <limits.h>
+#include <stdint.h>
 
 #ifdef _WIN32
     #include <windows.h>
@@ -104,6 +106,33 @@ void generate_session_id(char* session_id) {
     sprintf(session_id, "sess_%08x_%08x", rand(), (unsigned int)time(NULL));
 }
 
+// CRC32 테이블 (처음 사용할 때 생성)
+static unsigned long g_crc_table[256];
+static int g_crc_table_ready = 0;
+
+static void build_crc_table(void) {
+    for (unsigned long n = 0; n < 256; n++) {
+        unsigned long c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xEDB88320UL ^ (c >> 1) : c >> 1;
+        }
+        g_crc_table[n] = c;
+    }
+    g_crc_table_ready = 1;
+}
+
+// CRC32 누적 계산 (이어서 계산하려면 이전 결과를 crc로 넘김)
+unsigned long crc32_update(unsigned long crc, const void* data, size_t length) {
+    if (!g_crc_table_ready) build_crc_table();
+    
+    const unsigned char* bytes = (const unsigned char*)data;
+    crc ^= 0xFFFFFFFFUL;
+    for (size_t i = 0; i < length; i++) {
+        crc = g_crc_table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFUL;
+}
+
 // 로그 기록 함수
 void write_log(const char* level, const char* message) {
     if (!level || !message) return;
@@ -180,6 +209,22 @@ void safe_free(void** ptr) {
     }
 }
 
+void* grow_array(void* items, int* capacity, int needed, size_t item_size) {
+    if (needed <= *capacity) return items;
+    
+    size_t new_capacity = *capacity > 0 ? (size_t)*capacity : 16;
+    while (new_capacity < (size_t)needed) new_capacity *= 2;
+    if (new_capacity > (size_t)INT_MAX) new_capacity = (size_t)needed;
+    if (new_capacity > SIZE_MAX / item_size) return NULL;
+    
+    char* grown = realloc(items, new_capacity * item_size);
+    if (!grown) return NULL;
+    
+    memset(grown + (size_t)*capacity * item_size, 0, (new_capacity - (size_t)*capacity) * item_size);
+    *capacity = (int)new_capacity;
+    return grown;
+}
+
 // 화면 지우기 함수
 void clear_screen(void) {
 #ifdef _WIN32
@@ -305,6 +350,27 @@ int load_user_data(const char* filename, UserInfo users[], int max_users) {
     return count;
 }
 
+// 줄 수 세기 (마지막 줄에 개행이 없어도 한 줄로 셈)
+int count_file_lines(const char* filename) {
+    FILE* file = fopen(filename, "rb");
+    if (!file) return 0;
+    
+    char buffer[65536];
+    int lines = 0;
+    char last = '\n';
+    size_t read;
+    
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        for (const char* p = buffer; (p = memchr(p, '\n', (size_t)(buffer + read - p))) != NULL; p++) {
+            lines++;
+        }
+        last = buffer[read - 1];
+    }
+    
+    fclose(file);
+    return last == '\n' ? lines : lines + 1;
+}
+
 int save_user_data(const char* filename, UserInfo users[], int user_count) {
     if (!filename || !users) return 0;
     
@@ -0,0 +1,349 @@
+#include "vote_kernels.h"
+#include <stddef.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define VOTE_KERNELS_X86 1
+    #include <immintrin.h>
+#endif
+
+// 구현 하나의 함수 모음
+typedef struct {
+    const char* name;
+    VoteKernelLevel level;
+    void (*sum)(const int* likes, const int* dislikes, int count, VoteTotals* totals);
+    void (*sum_matching)(const int32_t* keys, int32_t key, const int* likes, const int* dislikes, int count,
+                         VoteTotals* totals);
+    void (*approval_rates)(const int* likes, const int* dislikes, int count, float* rates);
+    int (*filter)(const int* likes, const int* dislikes, int count, float min_rate, int min_votes, int32_t* indices);
+} VoteKernelTable;
+
+// =====================================================
+// 스칼라 구현 (벡터 구현의 나머지 원소 처리에도 사용)
+// =====================================================
+
+static float approval_rate(int like_count, int total_votes) {
+    return total_votes > 0 ? (float)like_count * 100.0f / (float)total_votes : 0.0f;
+}
+
+static void sum_scalar(const int* likes, const int* dislikes, int count, VoteTotals* totals) {
+    long long like_sum = 0;
+    long long dislike_sum = 0;
+    for (int i = 0; i < count; i++) {
+        like_sum += likes[i];
+        dislike_sum += dislikes[i];
+    }
+    totals->likes = like_sum;
+    totals->dislikes = dislike_sum;
+}
+
+static void sum_matching_scalar(const int32_t* keys, int32_t key, const int* likes, const int* dislikes, int count,
+                                VoteTotals* totals) {
+    long long like_sum = 0;
+    long long dislike_sum = 0;
+    for (int i = 0; i < count; i++) {
+        int mask = -(keys[i] == key);
+        like_sum += likes[i] & mask;
+        dislike_sum += dislikes[i] & mask;
+    }
+    totals->likes = like_sum;
+    totals->dislikes = dislike_sum;
+}
+
+static void approval_rates_scalar(const int* likes, const int* dislikes, int count, float* rates) {
+    for (int i = 0; i < count; i++) {
+        rates[i] = approval_rate(likes[i], likes[i] + dislikes[i]);
+    }
+}
+
+static int filter_scalar_from(const int* likes, const int* dislikes, int start, int count, float min_rate,
+                              int min_votes, int32_t* indices, int found) {
+    for (int i = start; i < count; i++) {
+        int total_votes = likes[i] + dislikes[i];
+        if (total_votes >= min_votes && approval_rate(likes[i], total_votes) >= min_rate) {
+            indices[found++] = i;
+        }
+    }
+    return found;
+}
+
+static int filter_scalar(const int* likes, const int* dislikes, int count, float min_rate, int min_votes,
+                         int32_t* indices) {
+    return filter_scalar_from(likes, dislikes, 0, count, min_rate, min_votes, indices, 0);
+}
+
+static const VoteKernelTable g_scalar_kernels = {
+    "scalar", VOTE_KERNEL_SCALAR,
+    sum_scalar, sum_matching_scalar, approval_rates_scalar, filter_scalar
+};
+
+#ifdef VOTE_KERNELS_X86
+
+// =====================================================
+// SSE4.1 구현 (4개씩, 합계는 64비트로 넓혀 누적)
+// =====================================================
+
+__attribute__((target("sse4.1")))
+static __m128i widen_add_sse41(__m128i acc, __m128i values) {
+    acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(values));
+    return _mm_add_epi64(acc, _mm_cvtepi32_epi64(_mm_srli_si128(values, 8)));
+}
+
+__attribute__((target("sse4.1")))
+static long long horizontal_sum_sse41(__m128i acc) {
+    long long lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    return lanes[0] + lanes[1];
+}
+
+__attribute__((target("sse4.1")))
+static void sum_sse41(const int* likes, const int* dislikes, int count, VoteTotals* totals) {
+    __m128i like_acc = _mm_setzero_si128();
+    __m128i dislike_acc = _mm_setzero_si128();
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        like_acc = widen_add_sse41(like_acc, _mm_loadu_si128((const __m128i*)(likes + i)));
+        dislike_acc = widen_add_sse41(dislike_acc, _mm_loadu_si128((const __m128i*)(dislikes + i)));
+    }
+
+    VoteTotals tail;
+    sum_scalar(likes + i, dislikes + i, count - i, &tail);
+    totals->likes = horizontal_sum_sse41(like_acc) + tail.likes;
+    totals->dislikes = horizontal_sum_sse41(dislike_acc) + tail.dislikes;
+}
+
+__attribute__((target("sse4.1")))
+static void sum_matching_sse41(const int32_t* keys, int32_t key, const int* likes, const int* dislikes, int count,
+                               VoteTotals* totals) {
+    __m128i key_vector = _mm_set1_epi32(key);
+    __m128i like_acc = _mm_setzero_si128();
+    __m128i dislike_acc = _mm_setzero_si128();
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        __m128i mask = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(keys + i)), key_vector);
+        like_acc = widen_add_sse41(like_acc, _mm_and_si128(mask, _mm_loadu_si128((const __m128i*)(likes + i))));
+        dislike_acc = widen_add_sse41(dislike_acc, _mm_and_si128(mask, _mm_loadu_si128((const __m128i*)(dislikes + i))));
+    }
+
+    VoteTotals tail;
+    sum_matching_scalar(keys + i, key, likes + i, dislikes + i, count - i, &tail);
+    totals->likes = horizontal_sum_sse41(like_acc) + tail.likes;
+    totals->dislikes = horizontal_sum_sse41(dislike_acc) + tail.dislikes;
+}
+
+// 4개 지지율 (표가 없는 칸은 0으로 가림), total_out에 총 표 수
+__attribute__((target("sse4.1")))
+static __m128 rates_sse41(const int* likes, const int* dislikes, __m128i* total_out) {
+    __m128i like_values = _mm_loadu_si128((const __m128i*)likes);
+    __m128i total = _mm_add_epi32(like_values, _mm_loadu_si128((const __m128i*)dislikes));
+    __m128 rate = _mm_div_ps(_mm_mul_ps(_mm_cvtepi32_ps(like_values), _mm_set1_ps(100.0f)), _mm_cvtepi32_ps(total));
+    __m128i has_votes = _mm_cmpgt_epi32(total, _mm_setzero_si128());
+    *total_out = total;
+    return _mm_and_ps(rate, _mm_castsi128_ps(has_votes));
+}
+
+__attribute__((target("sse4.1")))
+static void approval_rates_sse41(const int* likes, const int* dislikes, int count, float* rates) {
+    int i = 0;
+    __m128i total;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(rates + i, rates_sse41(likes + i, dislikes + i, &total));
+    }
+    approval_rates_scalar(likes + i, dislikes + i, count - i, rates + i);
+}
+
+__attribute__((target("sse4.1")))
+static int filter_sse41(const int* likes, const int* dislikes, int count, float min_rate, int min_votes,
+                        int32_t* indices) {
+    __m128 min_rate_vector = _mm_set1_ps(min_rate);
+    __m128i min_votes_vector = _mm_set1_epi32(min_votes - 1);
+    int found = 0;
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        __m128i total;
+        __m128 rate = rates_sse41(likes + i, dislikes + i, &total);
+        __m128 pass = _mm_and_ps(_mm_cmpge_ps(rate, min_rate_vector),
+                                 _mm_castsi128_ps(_mm_cmpgt_epi32(total, min_votes_vector)));
+        unsigned int bits = (unsigned int)_mm_movemask_ps(pass);
+        while (bits) {
+            indices[found++] = i + __builtin_ctz(bits);
+            bits &= bits - 1;
+        }
+    }
+    return filter_scalar_from(likes, dislikes, i, count, min_rate, min_votes, indices, found);
+}
+
+static const VoteKernelTable g_sse41_kernels = {
+    "sse4.1", VOTE_KERNEL_SSE41,
+    sum_sse41, sum_matching_sse41, approval_rates_sse41, filter_sse41
+};
+
+// =====================================================
+// AVX2 구현 (8개씩)
+// =====================================================
+
+__attribute__((target("avx2")))
+static __m256i widen_add_avx2(__m256i acc, __m256i values) {
+    acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(values)));
+    return _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(values, 1)));
+}
+
+__attribute__((target("avx2")))
+static long long horizontal_sum_avx2(__m256i acc) {
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+__attribute__((target("avx2")))
+static void sum_avx2(const int* likes, const int* dislikes, int count, VoteTotals* totals) {
+    __m256i like_acc = _mm256_setzero_si256();
+    __m256i dislike_acc = _mm256_setzero_si256();
+    int i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        like_acc = widen_add_avx2(like_acc, _mm256_loadu_si256((const __m256i*)(likes + i)));
+        dislike_acc = widen_add_avx2(dislike_acc, _mm256_loadu_si256((const __m256i*)(dislikes + i)));
+    }
+
+    VoteTotals tail;
+    sum_scalar(likes + i, dislikes + i, count - i, &tail);
+    totals->likes = horizontal_sum_avx2(like_acc) + tail.likes;
+    totals->dislikes = horizontal_sum_avx2(dislike_acc) + tail.dislikes;
+}
+
+__attribute__((target("avx2")))
+static void sum_matching_avx2(const int32_t* keys, int32_t key, const int* likes, const int* dislikes, int count,
+                              VoteTotals* totals) {
+    __m256i key_vector = _mm256_set1_epi32(key);
+    __m256i like_acc = _mm256_setzero_si256();
+    __m256i dislike_acc = _mm256_setzero_si256();
+    int i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        __m256i mask = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(keys + i)), key_vector);
+        like_acc = widen_add_avx2(like_acc, _mm256_and_si256(mask, _mm256_loadu_si256((const __m256i*)(likes + i))));
+        dislike_acc = widen_add_avx2(dislike_acc,
+                                     _mm256_and_si256(mask, _mm256_loadu_si256((const __m256i*)(dislikes + i))));
+    }
+
+    VoteTotals tail;
+    sum_matching_scalar(keys + i, key, likes + i, dislikes + i, count - i, &tail);
+    totals->likes = horizontal_sum_avx2(like_acc) + tail.likes;
+    totals->dislikes = horizontal_sum_avx2(dislike_acc) + tail.dislikes;
+}
+
+__attribute__((target("avx2")))
+static __m256 rates_avx2(const int* likes, const int* dislikes, __m256i* total_out) {
+    __m256i like_values = _mm256_loadu_si256((const __m256i*)likes);
+    __m256i total = _mm256_add_epi32(like_values, _mm256_loadu_si256((const __m256i*)dislikes));
+    __m256 rate = _mm256_div_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(like_values), _mm256_set1_ps(100.0f)),
+                                _mm256_cvtepi32_ps(total));
+    __m256i has_votes = _mm256_cmpgt_epi32(total, _mm256_setzero_si256());
+    *total_out = total;
+    return _mm256_and_ps(rate, _mm256_castsi256_ps(has_votes));
+}
+
+__attribute__((target("avx2")))
+static void approval_rates_avx2(const int* likes, const int* dislikes, int count, float* rates) {
+    int i = 0;
+    __m256i total;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(rates + i, rates_avx2(likes + i, dislikes + i, &total));
+    }
+    approval_rates_scalar(likes + i, dislikes + i, count - i, rates + i);
+}
+
+__attribute__((target("avx2")))
+static int filter_avx2(const int* likes, const int* dislikes, int count, float min_rate, int min_votes,
+                       int32_t* indices) {
+    __m256 min_rate_vector = _mm256_set1_ps(min_rate);
+    __m256i min_votes_vector = _mm256_set1_epi32(min_votes - 1);
+    int found = 0;
+    int i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        __m256i total;
+        __m256 rate = rates_avx2(likes + i, dislikes + i, &total);
+        __m256 pass = _mm256_and_ps(_mm256_cmp_ps(rate, min_rate_vector, _CMP_GE_OQ),
+                                    _mm256_castsi256_ps(_mm256_cmpgt_epi32(total, min_votes_vector)));
+        unsigned int bits = (unsigned int)_mm256_movemask_ps(pass);
+        while (bits) {
+            indices[found++] = i + __builtin_ctz(bits);
+            bits &= bits - 1;
+        }
+    }
+    return filter_scalar_from(likes, dislikes, i, count, min_rate, min_votes, indices, found);
+}
+
+static const VoteKernelTable g_avx2_kernels = {
+    "avx2", VOTE_KERNEL_AVX2,
+    sum_avx2, sum_matching_avx2, approval_rates_avx2, filter_avx2
+};
+
+#endif // VOTE_KERNELS_X86
+
+// =====================================================
+// 구현 선택
+// =====================================================
+
+static const VoteKernelTable* g_active_kernels = NULL;
+
+static const VoteKernelTable* kernels_for(VoteKernelLevel level) {
+#ifdef VOTE_KERNELS_X86
+    if (level == VOTE_KERNEL_AVX2) return &g_avx2_kernels;
+    if (level == VOTE_KERNEL_SSE41) return &g_sse41_kernels;
+#else
+    (void)level;
+#endif
+    return &g_scalar_kernels;
+}
+
+VoteKernelLevel vote_kernels_detect(void) {
+#ifdef VOTE_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return VOTE_KERNEL_AVX2;
+    if (__builtin_cpu_supports("sse4.1")) return VOTE_KERNEL_SSE41;
+#endif
+    return VOTE_KERNEL_SCALAR;
+}
+
+// 처음 호출할 때 CPU를 확인 (여러 스레드가 동시에 정해도 같은 값을 기록하므로 안전)
+static const VoteKernelTable* active_kernels(void) {
+    const VoteKernelTable* kernels = __atomic_load_n(&g_active_kernels, __ATOMIC_ACQUIRE);
+    if (!kernels) {
+        kernels = kernels_for(vote_kernels_detect());
+        __atomic_store_n(&g_active_kernels, kernels, __ATOMIC_RELEASE);
+    }
+    return kernels;
+}
+
+int vote_kernels_select(VoteKernelLevel level) {
+    if (level > vote_kernels_detect()) return 0;
+    __atomic_store_n(&g_active_kernels, kernels_for(level), __ATOMIC_RELEASE);
+    return 1;
+}
+
+const char* vote_kernels_name(void) {
+    return active_kernels()->name;
+}
+
+void vote_sum(const int* likes, const int* dislikes, int count, VoteTotals* totals) {
+    active_kernels()->sum(likes, dislikes, count, totals);
+}
+
+void vote_sum_matching(const int32_t* keys, int32_t key, const int* likes, const int* dislikes, int count,
+                       VoteTotals* totals) {
+    active_kernels()->sum_matching(keys, key, likes, dislikes, count, totals);
+}
+
+void vote_approval_rates(const int* likes, const int* dislikes, int count, float* rates) {
+    active_kernels()->approval_rates(likes, dislikes, count, rates);
+}
+
+int vote_filter(const int* likes, const int* dislikes, int count, float min_rate, int min_votes, int32_t* indices) {
+    // 표가 없는 공약은 지지율이 정의되지 않으므로 항상 제외
+    return active_kernels()->filter(likes, dislikes, count, min_rate, min_votes > 0 ? min_votes : 1, indices);
+}
@@ -0,0 +1,232 @@
+#include "xml_stream.h"
+#include "delim_scan.h"
+#include <stdlib.h>
+#include <string.h>
+
+void xml_stream_init(XmlStream* stream, const XmlHandlers* handlers, void* context) {
+    memset(stream, 0, sizeof(XmlStream));
+    if (handlers) stream->handlers = *handlers;
+    stream->context = context;
+}
+
+void xml_stream_free(XmlStream* stream) {
+    free(stream->carry);
+    stream->carry = NULL;
+    stream->carry_length = 0;
+    stream->carry_capacity = 0;
+}
+
+void xml_stream_stop(XmlStream* stream) {
+    stream->stopped = 1;
+}
+
+static void emit_text(XmlStream* stream, const char* data, size_t length) {
+    if (stream->handlers.text) {
+        XmlSlice slice = { data, length };
+        stream->handlers.text(stream, slice);
+    }
+}
+
+#define XML_MARK_BATCH 128
+
+// 버퍼의 '<' '>' 위치 (delim_scan으로 XML_MARK_BATCH개씩 미리 모아 두고 앞에서부터 소비)
+typedef struct {
+    const char* buf;
+    size_t length;
+    uint32_t marks[XML_MARK_BATCH];         // base 기준 위치
+    size_t base;
+    size_t count;
+    size_t next;
+    size_t scanned;                         // 여기까지는 이미 모음
+} MarkCursor;
+
+static void mark_cursor_init(MarkCursor* cursor, const char* buf, size_t length) {
+    cursor->buf = buf;
+    cursor->length = length;
+    cursor->base = 0;
+    cursor->count = 0;
+    cursor->next = 0;
+    cursor->scanned = 0;
+}
+
+// from 이후 첫 c('<' 또는 '>') 위치 (없으면 NULL)
+static const char* next_mark(MarkCursor* cursor, const char* from, char c) {
+    size_t pos = (size_t)(from - cursor->buf);
+
+    for (;;) {
+        while (cursor->next < cursor->count) {
+            size_t at = cursor->base + cursor->marks[cursor->next];
+            if (at >= pos && cursor->buf[at] == c) return cursor->buf + at;
+            cursor->next++;
+        }
+
+        size_t start = pos > cursor->scanned ? pos : cursor->scanned;
+        if (start >= cursor->length) return NULL;
+
+        cursor->base = start;
+        cursor->count = delim_scan(cursor->buf + start, cursor->length - start, '<', '>', cursor->marks,
+                                   XML_MARK_BATCH);
+        cursor->next = 0;
+        cursor->scanned = cursor->count == XML_MARK_BATCH ? start + cursor->marks[XML_MARK_BATCH - 1] + 1
+                                                          : cursor->length;
+    }
+}
+
+// from 이후 "cc>"로 끝나는 위치의 '>' (주석 "-->", CDATA "]]>", 없으면 NULL)
+static const char* find_close(const char* from, const char* end, char c) {
+    const char* p = from;
+    while (p < end) {
+        const char* gt = memchr(p, '>', (size_t)(end - p));
+        if (!gt) return NULL;
+        if (gt - from >= 2 && gt[-1] == c && gt[-2] == c) return gt;
+        p = gt + 1;
+    }
+    return NULL;
+}
+
+// "<!" / "<?"로 시작하는 마크업 (주석, CDATA, 선언) 처리, 다음 위치 반환 (아직 다 도착하지 않았으면 NULL)
+static const char* parse_special(XmlStream* stream, const char* p, const char* end) {
+    static const char comment[] = "<!--";
+    static const char cdata[] = "<![CDATA[";
+    size_t remaining = (size_t)(end - p);
+
+    if (p[1] == '!') {
+        // 접두어만 도착했으면 주석/CDATA인지 알 수 없으므로 더 기다림
+        if (remaining < sizeof(comment) - 1 && memcmp(p, comment, remaining) == 0) return NULL;
+        if (remaining < sizeof(cdata) - 1 && memcmp(p, cdata, remaining) == 0) return NULL;
+
+        if (remaining >= sizeof(comment) - 1 && memcmp(p, comment, sizeof(comment) - 1) == 0) {
+            const char* close = find_close(p + 4, end, '-');
+            return close ? close + 1 : NULL;
+        }
+        if (remaining >= sizeof(cdata) - 1 && memcmp(p, cdata, sizeof(cdata) - 1) == 0) {
+            const char* close = find_close(p + 9, end, ']');
+            if (!close) return NULL;
+            emit_text(stream, p + 9, (size_t)(close - 2 - (p + 9)));
+            return close + 1;
+        }
+    }
+
+    // <?xml ...?>, <!DOCTYPE ...>
+    const char* gt = memchr(p, '>', remaining);
+    return gt ? gt + 1 : NULL;
+}
+
+// p의 '<'로 시작하는 마크업 하나 처리, 다음 위치 반환 (아직 다 도착하지 않았으면 NULL)
+// 태그 이름은 한 번만 훑고, 이름 바로 뒤가 '>'가 아닐 때(속성, 공백, "/>")만 '>'를 따로 찾음
+static const char* parse_markup(XmlStream* stream, MarkCursor* cursor, const char* p, const char* end) {
+    const char* name = p + 1;
+    if (name >= end) return NULL;
+    if (*name == '!' || *name == '?') return parse_special(stream, p, end);
+
+    int closing = *name == '/';
+    if (closing && ++name >= end) return NULL;
+
+    const char* q = name;
+    while (q < end && *q != '>' && *q != '/' && (unsigned char)*q > ' ') q++;
+    const char* gt = (q < end && *q == '>') ? q : next_mark(cursor, q, '>');
+    if (!gt) return NULL;
+
+    XmlSlice slice = { name, (size_t)(q - name) };
+    if (closing) {
+        if (stream->handlers.end_element) stream->handlers.end_element(stream, slice);
+    } else {
+        if (stream->handlers.start_element) stream->handlers.start_element(stream, slice);
+        if (gt[-1] == '/' && !stream->stopped && stream->handlers.end_element) {
+            stream->handlers.end_element(stream, slice);
+        }
+    }
+    return gt + 1;
+}
+
+// buf를 훑으며 완성된 토큰마다 콜백, 처리한 바이트 수 반환 (나머지는 다음 조각과 이어 붙여야 함)
+static size_t scan(XmlStream* stream, const char* buf, size_t length) {
+    MarkCursor cursor;
+    size_t pos = 0;
+
+    mark_cursor_init(&cursor, buf, length);
+    while (pos < length && !stream->stopped) {
+        const char* lt = next_mark(&cursor, buf + pos, '<');
+        if (!lt) return pos;
+
+        size_t at = (size_t)(lt - buf);
+        if (at > pos) {
+            emit_text(stream, buf + pos, at - pos);
+            if (stream->stopped) break;
+        }
+
+        const char* next = parse_markup(stream, &cursor, lt, buf + length);
+        if (!next) return at;
+        pos = (size_t)(next - buf);
+    }
+    return stream->stopped ? length : pos;
+}
+
+static int carry_append(XmlStream* stream, const char* data, size_t length) {
+    if (stream->carry_length + length > stream->carry_capacity) {
+        size_t capacity = stream->carry_capacity ? stream->carry_capacity : 256;
+        while (capacity < stream->carry_length + length) capacity *= 2;
+
+        char* grown = realloc(stream->carry, capacity);
+        if (!grown) {
+            stream->failed = 1;
+            return 0;
+        }
+        stream->carry = grown;
+        stream->carry_capacity = capacity;
+    }
+    memcpy(stream->carry + stream->carry_length, data, length);
+    stream->carry_length += length;
+    return 1;
+}
+
+int xml_stream_feed(XmlStream* stream, const char* data, size_t length) {
+    if (stream->failed) return 0;
+    if (stream->stopped) return 1;
+    stream->bytes += length;
+
+    // 지난 조각 끝에 걸친 토큰부터 완성 (그 토큰에 필요한 만큼만 이어 붙임)
+    while (stream->carry_length > 0 && length > 0) {
+        if (stream->carry[0] != '<') {
+            // 텍스트: 다음 '<'까지
+            const char* lt = memchr(data, '<', length);
+            size_t take = lt ? (size_t)(lt - data) : length;
+            if (!carry_append(stream, data, take)) return 0;
+            data += take;
+            length -= take;
+            if (!lt) return 1;
+
+            emit_text(stream, stream->carry, stream->carry_length);
+            stream->carry_length = 0;
+        } else {
+            // 태그: '>'까지 붙여 보고, 주석/CDATA처럼 아직 안 끝났으면 다음 '>'까지 반복
+            const char* gt = memchr(data, '>', length);
+            size_t take = gt ? (size_t)(gt - data) + 1 : length;
+            if (!carry_append(stream, data, take)) return 0;
+            data += take;
+            length -= take;
+            if (!gt) return 1;
+
+            if (scan(stream, stream->carry, stream->carry_length) == stream->carry_length) {
+                stream->carry_length = 0;
+            }
+        }
+        if (stream->stopped) return 1;
+    }
+    if (length == 0) return 1;
+
+    // 나머지는 입력 버퍼를 그대로 가리키며 처리하고, 끝에 걸친 토큰만 모아 둠
+    size_t used = scan(stream, data, length);
+    if (used < length && !stream->stopped) {
+        return carry_append(stream, data + used, length - used);
+    }
+    return 1;
+}
+
+int xml_stream_finish(XmlStream* stream) {
+    if (stream->carry_length > 0 && !stream->stopped && stream->carry[0] != '<') {
+        emit_text(stream, stream->carry, stream->carry_length);
+    }
+    stream->carry_length = 0;
+    return !stream->failed;
+}
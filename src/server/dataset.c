@@ -0,0 +1,260 @@
+#include "dataset.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define PLEDGE_LOOKUP_EMPTY (-1)
+
+// 필드 하나 등록 (빈 문자열도 핸들을 받아 두어 조회 시 구분하지 않아도 되게 함)
+static int intern_field(StringHandle* handle, const char* str, StringIntern* strings) {
+    *handle = string_intern_add(strings, str);
+    return *handle != STRING_HANDLE_NONE;
+}
+
+int election_record_intern(ElectionRecord* record, const ElectionInfo* info, StringIntern* strings) {
+    memset(record, 0, sizeof(ElectionRecord));
+    record->is_active = info->is_active;
+    return intern_field(&record->election_id, info->election_id, strings) &&
+           intern_field(&record->election_name, info->election_name, strings) &&
+           intern_field(&record->election_date, info->election_date, strings) &&
+           intern_field(&record->election_type, info->election_type, strings);
+}
+
+int candidate_record_intern(CandidateRecord* record, const CandidateInfo* info, StringIntern* strings) {
+    memset(record, 0, sizeof(CandidateRecord));
+    record->candidate_number = info->candidate_number;
+    record->pledge_count = info->pledge_count;
+    record->election_index = -1;
+    return intern_field(&record->candidate_id, info->candidate_id, strings) &&
+           intern_field(&record->candidate_name, info->candidate_name, strings) &&
+           intern_field(&record->party_name, info->party_name, strings) &&
+           intern_field(&record->election_id, info->election_id, strings);
+}
+
+void pledge_table_init(PledgeTable* table) {
+    memset(table, 0, sizeof(PledgeTable));
+}
+
+void pledge_table_free(PledgeTable* table) {
+    free(table->ids);
+    free(table->candidates);
+    free(table->candidate_indices);
+    free(table->category_ids);
+    free(table->likes);
+    free(table->dislikes);
+    free(table->cold);
+    free(table->categories);
+    memset(table, 0, sizeof(PledgeTable));
+}
+
+void pledge_table_clear(PledgeTable* table) {
+    table->count = 0;
+    table->category_count = 0;
+}
+
+// 모든 배열을 같은 크기(capacity)로 늘림 (하나라도 실패하면 capacity는 그대로)
+int pledge_table_reserve(PledgeTable* table, int capacity) {
+    if (capacity <= table->capacity) return 1;
+
+    size_t size = (size_t)capacity;
+
+    StringHandle* ids = realloc(table->ids, size * sizeof(StringHandle));
+    if (ids) table->ids = ids;
+    StringHandle* candidates = realloc(table->candidates, size * sizeof(StringHandle));
+    if (candidates) table->candidates = candidates;
+    int32_t* candidate_indices = realloc(table->candidate_indices, size * sizeof(int32_t));
+    if (candidate_indices) table->candidate_indices = candidate_indices;
+    uint16_t* category_ids = realloc(table->category_ids, size * sizeof(uint16_t));
+    if (category_ids) table->category_ids = category_ids;
+    int* likes = realloc(table->likes, size * sizeof(int));
+    if (likes) table->likes = likes;
+    int* dislikes = realloc(table->dislikes, size * sizeof(int));
+    if (dislikes) table->dislikes = dislikes;
+    PledgeColdRecord* cold = realloc(table->cold, size * sizeof(PledgeColdRecord));
+    if (cold) table->cold = cold;
+
+    if (!ids || !candidates || !candidate_indices || !category_ids || !likes || !dislikes || !cold) return 0;
+    table->capacity = capacity;
+    return 1;
+}
+
+// 공약 하나를 더 넣을 자리 확보 (미리 잡은 크기를 넘으면 두 배씩)
+static int reserve_pledge(PledgeTable* table) {
+    if (table->count < table->capacity) return 1;
+    return pledge_table_reserve(table, table->capacity ? table->capacity * 2 : 1024);
+}
+
+size_t pledge_table_memory(const PledgeTable* table) {
+    size_t per_pledge = sizeof(StringHandle) * 2 + sizeof(int32_t) + sizeof(uint16_t) + sizeof(int) * 2 +
+                        sizeof(PledgeColdRecord);
+    return (size_t)table->capacity * per_pledge + (size_t)table->category_capacity * sizeof(StringHandle);
+}
+
+// 분야 문자열 핸들 -> 분야 번호 (처음 보는 분야면 목록에 추가, 실패 시 -1)
+// 분야는 수십 개 수준이라 목록을 직접 훑음
+static int category_id(PledgeTable* table, StringHandle category) {
+    for (int i = table->category_count - 1; i >= 0; i--) {
+        if (table->categories[i] == category) return i;
+    }
+    if (table->category_count >= PLEDGE_TABLE_MAX_CATEGORIES) return -1;
+
+    if (table->category_count == table->category_capacity) {
+        int capacity = table->category_capacity ? table->category_capacity * 2 : 32;
+        StringHandle* categories = realloc(table->categories, (size_t)capacity * sizeof(StringHandle));
+        if (!categories) return -1;
+        table->categories = categories;
+        table->category_capacity = capacity;
+    }
+    table->categories[table->category_count] = category;
+    return table->category_count++;
+}
+
+int pledge_table_append(PledgeTable* table, const PledgeInfo* info, StringIntern* strings) {
+    StringHandle id, candidate, category;
+    PledgeColdRecord cold;
+
+    if (!reserve_pledge(table) ||
+        !intern_field(&id, info->pledge_id, strings) ||
+        !intern_field(&candidate, info->candidate_id, strings) ||
+        !intern_field(&category, info->category, strings) ||
+        !intern_field(&cold.title, info->title, strings) ||
+        !intern_field(&cold.content, info->content, strings)) {
+        return 0;
+    }
+
+    int category_index = category_id(table, category);
+    if (category_index < 0) return 0;
+    cold.created_time = (int64_t)info->created_time;
+
+    int index = table->count;
+    table->ids[index] = id;
+    table->candidates[index] = candidate;
+    table->candidate_indices[index] = -1;
+    table->category_ids[index] = (uint16_t)category_index;
+    table->likes[index] = info->like_count;
+    table->dislikes[index] = info->dislike_count;
+    table->cold[index] = cold;
+    table->count++;
+    return 1;
+}
+
+StringHandle pledge_table_category(const PledgeTable* table, int index) {
+    return table->categories[table->category_ids[index]];
+}
+
+void pledge_lookup_init(PledgeLookup* lookup) {
+    memset(lookup, 0, sizeof(PledgeLookup));
+}
+
+void pledge_lookup_free(PledgeLookup* lookup) {
+    free(lookup->positions);
+    memset(lookup, 0, sizeof(PledgeLookup));
+}
+
+// 인턴 테이블의 핸들 수만큼 표를 잡고 공약 위치를 채움
+int pledge_lookup_rebuild(PledgeLookup* lookup, const PledgeTable* pledges, const StringIntern* strings) {
+    size_t capacity = (size_t)strings->count + 1;
+
+    if (capacity > lookup->capacity) {
+        int32_t* positions = realloc(lookup->positions, capacity * sizeof(int32_t));
+        if (!positions) return 0;
+        lookup->positions = positions;
+        lookup->capacity = capacity;
+    }
+
+    for (size_t i = 0; i < lookup->capacity; i++) {
+        lookup->positions[i] = PLEDGE_LOOKUP_EMPTY;
+    }
+    for (int i = 0; i < pledges->count; i++) {
+        lookup->positions[pledges->ids[i]] = i;
+    }
+    return 1;
+}
+
+int pledge_lookup_find(const PledgeLookup* lookup, StringHandle pledge_id) {
+    if (pledge_id == STRING_HANDLE_NONE || pledge_id >= lookup->capacity) return PLEDGE_LOOKUP_EMPTY;
+    return lookup->positions[pledge_id];
+}
+
+void dataset_links_init(DatasetLinks* links) {
+    memset(links, 0, sizeof(DatasetLinks));
+    adjacency_index_init(&links->election_candidates);
+    adjacency_index_init(&links->candidate_pledges);
+}
+
+void dataset_links_free(DatasetLinks* links) {
+    adjacency_index_free(&links->election_candidates);
+    adjacency_index_free(&links->candidate_pledges);
+    free(links->election_positions);
+    free(links->candidate_positions);
+    memset(links, 0, sizeof(DatasetLinks));
+}
+
+int dataset_links_rebuild(DatasetLinks* links, const ElectionRecord* elections, int election_count,
+                          CandidateRecord* candidates, int candidate_count,
+                          PledgeTable* pledges, const StringIntern* strings) {
+    size_t capacity = (size_t)strings->count + 1;
+
+    // 실패해도 예전 데이터의 위치가 남지 않도록 먼저 비움
+    links->election_candidates.group_count = 0;
+    links->candidate_pledges.group_count = 0;
+    for (size_t h = 0; h < links->capacity; h++) {
+        links->election_positions[h] = PLEDGE_LOOKUP_EMPTY;
+        links->candidate_positions[h] = PLEDGE_LOOKUP_EMPTY;
+    }
+
+    if (capacity > links->capacity) {
+        int32_t* election_positions = realloc(links->election_positions, capacity * sizeof(int32_t));
+        if (election_positions) links->election_positions = election_positions;
+        int32_t* candidate_positions = realloc(links->candidate_positions, capacity * sizeof(int32_t));
+        if (candidate_positions) links->candidate_positions = candidate_positions;
+        if (!election_positions || !candidate_positions) return 0;
+        for (size_t h = links->capacity; h < capacity; h++) {
+            links->election_positions[h] = PLEDGE_LOOKUP_EMPTY;
+            links->candidate_positions[h] = PLEDGE_LOOKUP_EMPTY;
+        }
+        links->capacity = capacity;
+    }
+
+    for (int e = 0; e < election_count; e++) {
+        links->election_positions[elections[e].election_id] = e;
+    }
+    for (int c = 0; c < candidate_count; c++) {
+        links->candidate_positions[candidates[c].candidate_id] = c;
+    }
+
+    // 위 -> 아래 방향 연결 (후보자 -> 선거, 공약 -> 후보자)
+    int32_t* election_of = malloc(sizeof(int32_t) * (size_t)(candidate_count > 0 ? candidate_count : 1));
+    if (!election_of) return 0;
+    for (int c = 0; c < candidate_count; c++) {
+        candidates[c].election_index = links->election_positions[candidates[c].election_id];
+        election_of[c] = candidates[c].election_index;
+    }
+    for (int i = 0; i < pledges->count; i++) {
+        pledges->candidate_indices[i] = links->candidate_positions[pledges->candidates[i]];
+    }
+
+    // 아래 -> 위 방향 인접 목록 (선거 -> 후보자, 후보자 -> 공약)
+    int ok = adjacency_index_build(&links->election_candidates, election_of, candidate_count, election_count) &&
+             adjacency_index_build(&links->candidate_pledges, pledges->candidate_indices, pledges->count,
+                                   candidate_count);
+    free(election_of);
+    return ok;
+}
+
+int dataset_links_find_election(const DatasetLinks* links, StringHandle election_id) {
+    if (election_id == STRING_HANDLE_NONE || election_id >= links->capacity) return PLEDGE_LOOKUP_EMPTY;
+    return links->election_positions[election_id];
+}
+
+int dataset_links_find_candidate(const DatasetLinks* links, StringHandle candidate_id) {
+    if (candidate_id == STRING_HANDLE_NONE || candidate_id >= links->capacity) return PLEDGE_LOOKUP_EMPTY;
+    return links->candidate_positions[candidate_id];
+}
+
+int dataset_links_candidates(const DatasetLinks* links, int election, const int32_t** candidates) {
+    return adjacency_index_range(&links->election_candidates, election, candidates);
+}
+
+int dataset_links_pledges(const DatasetLinks* links, int candidate, const int32_t** pledges) {
+    return adjacency_index_range(&links->candidate_pledges, candidate, pledges);
+}
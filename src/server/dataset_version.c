@@ -0,0 +1,98 @@
+#include "dataset_version.h"
+#include "utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+DatasetVersion* dataset_version_create(void) {
+    DatasetVersion* version = calloc(1, sizeof(DatasetVersion));
+    if (!version) return NULL;
+
+    pledge_table_init(&version->pledges);
+    pledge_lookup_init(&version->pledge_index);
+    dataset_links_init(&version->links);
+
+    // 선거/후보자 배열은 dataset_version_reserve 또는 첫 추가 때 할당
+    if (!string_intern_init(&version->strings)) {
+        free(version);
+        return NULL;
+    }
+    if (!leaderboard_init(&version->leaderboard)) {
+        string_intern_free(&version->strings);
+        free(version);
+        return NULL;
+    }
+    return version;
+}
+
+void dataset_version_destroy(DatasetVersion* version) {
+    if (!version) return;
+
+    leaderboard_free(&version->leaderboard);
+    dataset_links_free(&version->links);
+    pledge_lookup_free(&version->pledge_index);
+    pledge_table_free(&version->pledges);
+    string_intern_free(&version->strings);
+    free(version->elections);
+    free(version->candidates);
+    free(version);
+}
+
+int dataset_version_reserve(DatasetVersion* version, int elections, int candidates, int pledges) {
+    ElectionRecord* election_records = grow_array(version->elections, &version->election_capacity,
+                                                  elections, sizeof(ElectionRecord));
+    if (!election_records) return 0;
+    version->elections = election_records;
+
+    CandidateRecord* candidate_records = grow_array(version->candidates, &version->candidate_capacity,
+                                                    candidates, sizeof(CandidateRecord));
+    if (!candidate_records) return 0;
+    version->candidates = candidate_records;
+
+    return pledge_table_reserve(&version->pledges, pledges);
+}
+
+int dataset_version_add_election(DatasetVersion* version, const ElectionInfo* info) {
+    ElectionRecord* records = grow_array(version->elections, &version->election_capacity,
+                                         version->election_count + 1, sizeof(ElectionRecord));
+    if (!records) return 0;
+    version->elections = records;
+
+    if (!election_record_intern(&records[version->election_count], info, &version->strings)) return 0;
+    version->election_count++;
+    return 1;
+}
+
+int dataset_version_add_candidate(DatasetVersion* version, const CandidateInfo* info) {
+    CandidateRecord* records = grow_array(version->candidates, &version->candidate_capacity,
+                                          version->candidate_count + 1, sizeof(CandidateRecord));
+    if (!records) return 0;
+    version->candidates = records;
+
+    if (!candidate_record_intern(&records[version->candidate_count], info, &version->strings)) return 0;
+    version->candidate_count++;
+    return 1;
+}
+
+size_t dataset_version_memory(DatasetVersion* version) {
+    const DatasetLinks* links = &version->links;
+    return sizeof(DatasetVersion) +
+           string_intern_memory(&version->strings) +
+           (size_t)version->election_capacity * sizeof(ElectionRecord) +
+           (size_t)version->candidate_capacity * sizeof(CandidateRecord) +
+           pledge_table_memory(&version->pledges) +
+           version->pledge_index.capacity * sizeof(int32_t) +
+           adjacency_index_memory(&links->election_candidates) +
+           adjacency_index_memory(&links->candidate_pledges) +
+           links->capacity * sizeof(int32_t) * 2 +
+           leaderboard_memory(&version->leaderboard);
+}
+
+// 문자열은 인턴 테이블에서 한 번만 찾고 이후는 핸들로 바로 접근
+int dataset_version_find_pledge(const DatasetVersion* version, const char* pledge_id) {
+    StringHandle handle = string_intern_find(&version->strings, pledge_id);
+    return pledge_lookup_find(&version->pledge_index, handle);
+}
+
+const char* dataset_version_string(const DatasetVersion* version, StringHandle handle) {
+    return string_intern_get(&version->strings, handle);
+}
@@ -0,0 +1,68 @@
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "epoch.h"
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+void epoch_init(EpochDomain* domain) {
+    memset(domain, 0, sizeof(EpochDomain));
+}
+
+// 읽기 수를 올린 뒤 에포크가 그대로인지 다시 확인
+// (확인 전에 에포크가 넘어갔다면 쓰는 쪽이 이 칸을 이미 확인했을 수 있으므로 새 칸으로 다시 들어감)
+int epoch_enter(EpochDomain* domain) {
+    for (;;) {
+        unsigned long epoch = __atomic_load_n(&domain->epoch, __ATOMIC_SEQ_CST);
+        int token = (int)(epoch & 1);
+        __atomic_add_fetch(&domain->readers[token], 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&domain->epoch, __ATOMIC_SEQ_CST) == epoch) return token;
+        __atomic_sub_fetch(&domain->readers[token], 1, __ATOMIC_SEQ_CST);
+    }
+}
+
+void epoch_exit(EpochDomain* domain, int token) {
+    __atomic_sub_fetch(&domain->readers[token], 1, __ATOMIC_RELEASE);
+}
+
+// 경과 시간 측정 (밀리초)
+static double now_ms(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+#endif
+}
+
+static void pause_briefly(void) {
+#ifdef _WIN32
+    Sleep(1);
+#else
+    struct timespec ts = { 0, 200000L };   // 0.2ms
+    nanosleep(&ts, NULL);
+#endif
+}
+
+void epoch_synchronize(EpochDomain* domain) {
+    double start = now_ms();
+    unsigned long epoch = __atomic_fetch_add(&domain->epoch, 1, __ATOMIC_SEQ_CST);
+    int token = (int)(epoch & 1);
+
+    // 넘기기 전 에포크로 들어온 읽기는 요청 하나를 처리하는 동안만 머무르므로 짧게 쉬며 확인
+    while (__atomic_load_n(&domain->readers[token], __ATOMIC_ACQUIRE) != 0) {
+        pause_briefly();
+    }
+
+    domain->synchronizations++;
+    domain->last_wait_ms = now_ms() - start;
+}
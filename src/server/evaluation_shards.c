@@ -0,0 +1,99 @@
+#include "evaluation_shards.h"
+#include "hash_index.h"
+#include <string.h>
+
+int evaluation_shards_init(EvaluationShards* shards) {
+    memset(shards, 0, sizeof(EvaluationShards));
+
+    for (int i = 0; i < EVALUATION_SHARD_COUNT; i++) {
+        EvaluationShard* shard = &shards->shards[i];
+        if (!rw_lock_init(&shard->lock)) {
+            evaluation_shards_free(shards);
+            return 0;
+        }
+        if (!string_intern_init(&shard->strings)) {
+            rw_lock_destroy(&shard->lock);
+            evaluation_shards_free(shards);
+            return 0;
+        }
+        // 저장소 초기화가 실패해도 store.strings는 채워지므로 아래 해제에서 이 샤드까지 정리됨
+        if (!evaluation_store_init(&shard->store, &shard->strings)) {
+            evaluation_shards_free(shards);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void evaluation_shards_free(EvaluationShards* shards) {
+    for (int i = 0; i < EVALUATION_SHARD_COUNT; i++) {
+        EvaluationShard* shard = &shards->shards[i];
+        if (!shard->store.strings) continue;   // 초기화되지 않은 샤드
+        evaluation_store_free(&shard->store);
+        string_intern_free(&shard->strings);
+        rw_lock_destroy(&shard->lock);
+        memset(shard, 0, sizeof(EvaluationShard));
+    }
+}
+
+void evaluation_shards_clear(EvaluationShards* shards) {
+    for (int i = 0; i < EVALUATION_SHARD_COUNT; i++) {
+        evaluation_store_clear(&shards->shards[i].store);
+    }
+}
+
+// 해시의 상위 비트로 샤드를 고름
+// (하위 비트는 샤드 안의 인턴 테이블이 칸을 고르는 데 쓰므로 겹치면 공약 ID가 일부 칸에만 몰림)
+int evaluation_shards_index(const char* pledge_id) {
+    return (int)(hash_index_hash(pledge_id) >> (32 - EVALUATION_SHARD_BITS));
+}
+
+EvaluationShard* evaluation_shards_for(EvaluationShards* shards, const char* pledge_id) {
+    return &shards->shards[evaluation_shards_index(pledge_id)];
+}
+
+void evaluation_shards_lock_all(EvaluationShards* shards) {
+    for (int i = 0; i < EVALUATION_SHARD_COUNT; i++) {
+        rw_lock_read_lock(&shards->shards[i].lock);
+    }
+}
+
+void evaluation_shards_unlock_all(EvaluationShards* shards) {
+    for (int i = EVALUATION_SHARD_COUNT - 1; i >= 0; i--) {
+        rw_lock_read_unlock(&shards->shards[i].lock);
+    }
+}
+
+void evaluation_shards_write_lock_all(EvaluationShards* shards) {
+    for (int i = 0; i < EVALUATION_SHARD_COUNT; i++) {
+        rw_lock_write_lock(&shards->shards[i].lock);
+    }
+}
+
+void evaluation_shards_write_unlock_all(EvaluationShards* shards) {
+    for (int i = EVALUATION_SHARD_COUNT - 1; i >= 0; i--) {
+        rw_lock_write_unlock(&shards->shards[i].lock);
+    }
+}
+
+int evaluation_shards_count(EvaluationShards* shards) {
+    int count = 0;
+    for (int i = 0; i < EVALUATION_SHARD_COUNT; i++) {
+        EvaluationShard* shard = &shards->shards[i];
+        rw_lock_read_lock(&shard->lock);
+        count += shard->store.count;
+        rw_lock_read_unlock(&shard->lock);
+    }
+    return count;
+}
+
+size_t evaluation_shards_memory(EvaluationShards* shards) {
+    size_t bytes = 0;
+    for (int i = 0; i < EVALUATION_SHARD_COUNT; i++) {
+        EvaluationShard* shard = &shards->shards[i];
+        rw_lock_read_lock(&shard->lock);
+        bytes += evaluation_store_memory(&shard->store) + string_intern_memory(&shard->strings);
+        rw_lock_read_unlock(&shard->lock);
+    }
+    return bytes;
+}
@@ -0,0 +1,262 @@
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "evaluation_snapshot.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <io.h>
+#else
+    #include <unistd.h>
+    #include <errno.h>
+#endif
+
+#define SNAPSHOT_RECORD_FIXED_SIZE 11       // 타입 + 시간 + 길이 두 개
+
+// 경과 시간 측정 (밀리초)
+static double now_ms(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+#endif
+}
+
+static void put_u32(unsigned char* p, unsigned long value) {
+    p[0] = (unsigned char)(value >> 24);
+    p[1] = (unsigned char)(value >> 16);
+    p[2] = (unsigned char)(value >> 8);
+    p[3] = (unsigned char)value;
+}
+
+static unsigned long get_u32(const unsigned char* p) {
+    return ((unsigned long)p[0] << 24) | ((unsigned long)p[1] << 16) |
+           ((unsigned long)p[2] << 8) | p[3];
+}
+
+static void put_i64(unsigned char* p, long long value) {
+    unsigned long long v = (unsigned long long)value;
+    for (int i = 7; i >= 0; i--) {
+        p[i] = (unsigned char)v;
+        v >>= 8;
+    }
+}
+
+static long long get_i64(const unsigned char* p) {
+    unsigned long long v = 0;
+    for (int i = 0; i < 8; i++) {
+        v = (v << 8) | p[i];
+    }
+    return (long long)v;
+}
+
+// 버퍼 내용을 디스크까지 기록
+static int sync_file(FILE* file) {
+    if (fflush(file) != 0) return 0;
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    while (fsync(fileno(file)) != 0) {
+        if (errno != EINTR) return 0;
+    }
+    return 1;
+#endif
+}
+
+void evaluation_snapshot_begin(EvaluationSnapshotImage* image) {
+    memset(image, 0, sizeof(EvaluationSnapshotImage));
+    image->created_at = time(NULL);
+}
+
+int evaluation_snapshot_capture(const EvaluationStore* store, EvaluationSnapshotImage* image) {
+    if (image->part_count >= EVALUATION_SNAPSHOT_MAX_PARTS) {
+        write_error_log("evaluation_snapshot_capture", "저장소 사본이 너무 많습니다");
+        return 0;
+    }
+    double start = now_ms();
+
+    // 평가 페이지만 통째로 복사 (인덱스는 로드할 때 다시 만듦)
+    EvaluationSnapshotPart* part = &image->parts[image->part_count];
+    part->items = malloc(sizeof(EvaluationRecord) * (size_t)(store->count > 0 ? store->count : 1));
+    if (!part->items) {
+        write_error_log("evaluation_snapshot_capture", "메모리 할당 실패");
+        return 0;
+    }
+    for (int copied = 0; copied < store->count; copied += EVALUATION_PAGE_SIZE) {
+        int length = store->count - copied < EVALUATION_PAGE_SIZE ? store->count - copied : EVALUATION_PAGE_SIZE;
+        memcpy(part->items + copied, evaluation_store_at(store, copied), sizeof(EvaluationRecord) * (size_t)length);
+    }
+    part->count = store->count;
+    part->strings = store->strings;
+    image->part_count++;
+    image->count += store->count;
+    image->capture_ms += now_ms() - start;
+    return 1;
+}
+
+void evaluation_snapshot_release(EvaluationSnapshotImage* image) {
+    for (int p = 0; p < image->part_count; p++) {
+        free(image->parts[p].items);
+    }
+    memset(image, 0, sizeof(EvaluationSnapshotImage));
+}
+
+int evaluation_snapshot_write(const char* path, const char* temp_path, const EvaluationSnapshotImage* image,
+                              EvaluationSnapshotResult* result) {
+    memset(result, 0, sizeof(EvaluationSnapshotResult));
+    double start = now_ms();
+
+    FILE* file = fopen(temp_path, "wb");
+    if (!file) {
+        write_error_log("evaluation_snapshot_write", "스냅샷 임시 파일 열기 실패");
+        return 0;
+    }
+
+    unsigned char header[EVALUATION_SNAPSHOT_HEADER_SIZE];
+    put_u32(header, EVALUATION_SNAPSHOT_MAGIC);
+    put_u32(header + 4, EVALUATION_SNAPSHOT_VERSION);
+    put_i64(header + 8, (long long)image->created_at);
+    put_u32(header + 16, (unsigned long)image->count);
+
+    int ok = fwrite(header, 1, sizeof(header), file) == sizeof(header);
+    unsigned long crc = crc32_update(0, header, sizeof(header));
+    long bytes = (long)sizeof(header);
+
+    unsigned char record[SNAPSHOT_RECORD_FIXED_SIZE + 2 * MAX_STRING_LEN];
+    for (int p = 0; ok && p < image->part_count; p++) {
+        const EvaluationSnapshotPart* part = &image->parts[p];
+        for (int i = 0; ok && i < part->count; i++) {
+            const EvaluationRecord* eval = &part->items[i];
+            const char* user_id = string_intern_get(part->strings, eval->user);
+            const char* pledge_id = string_intern_get(part->strings, eval->pledge);
+            size_t uid_len = strlen(user_id);
+            size_t pid_len = strlen(pledge_id);
+            if (uid_len >= MAX_STRING_LEN || pid_len >= MAX_STRING_LEN) {
+                ok = 0;
+                break;
+            }
+
+            record[0] = (unsigned char)(signed char)eval->evaluation_type;
+            put_i64(record + 1, (long long)eval->evaluation_time);
+            record[9] = (unsigned char)uid_len;
+            record[10] = (unsigned char)pid_len;
+            memcpy(record + SNAPSHOT_RECORD_FIXED_SIZE, user_id, uid_len);
+            memcpy(record + SNAPSHOT_RECORD_FIXED_SIZE + uid_len, pledge_id, pid_len);
+
+            size_t length = SNAPSHOT_RECORD_FIXED_SIZE + uid_len + pid_len;
+            ok = fwrite(record, 1, length, file) == length;
+            crc = crc32_update(crc, record, length);
+            bytes += (long)length;
+        }
+    }
+
+    unsigned char trailer[4];
+    put_u32(trailer, crc);
+    ok = ok && fwrite(trailer, 1, sizeof(trailer), file) == sizeof(trailer) && sync_file(file);
+    bytes += (long)sizeof(trailer);
+
+    if (fclose(file) != 0 || !ok) {
+        write_error_log("evaluation_snapshot_write", "스냅샷 기록 실패");
+        remove(temp_path);
+        return 0;
+    }
+
+#ifdef _WIN32
+    // Windows의 rename은 대상 파일이 있으면 실패함
+    remove(path);
+#endif
+    if (rename(temp_path, path) != 0) {
+        write_error_log("evaluation_snapshot_write", "스냅샷 파일 교체 실패");
+        remove(temp_path);
+        return 0;
+    }
+
+    result->records = image->count;
+    result->bytes = bytes;
+    result->created_at = image->created_at;
+    result->elapsed_ms = now_ms() - start;
+    return 1;
+}
+
+int evaluation_snapshot_load(const char* path, EvaluationSnapshotApplyFunc apply, void* context,
+                             EvaluationSnapshotResult* result) {
+    memset(result, 0, sizeof(EvaluationSnapshotResult));
+    double start = now_ms();
+
+    FILE* file = fopen(path, "rb");
+    if (!file) return 0;
+
+    // 파일 전체를 한 번에 읽은 뒤 CRC 확인
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size < EVALUATION_SNAPSHOT_HEADER_SIZE + 4) {
+        fclose(file);
+        write_error_log("evaluation_snapshot_load", "스냅샷 파일이 너무 짧습니다");
+        return -1;
+    }
+
+    unsigned char* data = malloc((size_t)size);
+    if (!data) {
+        fclose(file);
+        write_error_log("evaluation_snapshot_load", "메모리 할당 실패");
+        return -1;
+    }
+    size_t got = fread(data, 1, (size_t)size, file);
+    fclose(file);
+
+    size_t body_size = (size_t)size - 4;
+    if (got != (size_t)size ||
+        get_u32(data) != EVALUATION_SNAPSHOT_MAGIC ||
+        get_u32(data + 4) != EVALUATION_SNAPSHOT_VERSION ||
+        crc32_update(0, data, body_size) != get_u32(data + body_size)) {
+        free(data);
+        write_error_log("evaluation_snapshot_load", "스냅샷 파일이 손상되었습니다");
+        return -1;
+    }
+
+    time_t created_at = (time_t)get_i64(data + 8);
+    unsigned long count = get_u32(data + 16);
+
+    int applied = 0;
+    size_t offset = EVALUATION_SNAPSHOT_HEADER_SIZE;
+    char user_id[256];
+    char pledge_id[256];
+
+    for (unsigned long i = 0; i < count; i++) {
+        if (offset + SNAPSHOT_RECORD_FIXED_SIZE > body_size) break;
+        const unsigned char* record = data + offset;
+        size_t uid_len = record[9];
+        size_t pid_len = record[10];
+        if (offset + SNAPSHOT_RECORD_FIXED_SIZE + uid_len + pid_len > body_size) break;
+
+        memcpy(user_id, record + SNAPSHOT_RECORD_FIXED_SIZE, uid_len);
+        user_id[uid_len] = '\0';
+        memcpy(pledge_id, record + SNAPSHOT_RECORD_FIXED_SIZE + uid_len, pid_len);
+        pledge_id[pid_len] = '\0';
+
+        if (!apply(context, user_id, pledge_id, (int)(signed char)record[0], (time_t)get_i64(record + 1))) {
+            write_error_log("evaluation_snapshot_load", "평가 저장 메모리 부족");
+            break;
+        }
+        applied++;
+        offset += SNAPSHOT_RECORD_FIXED_SIZE + uid_len + pid_len;
+    }
+    free(data);
+
+    result->records = applied;
+    result->bytes = size;
+    result->created_at = created_at;
+    result->elapsed_ms = now_ms() - start;
+    return 1;
+}
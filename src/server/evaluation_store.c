@@ -0,0 +1,275 @@
+#include "evaluation_store.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define EVALUATION_SLOTS_MIN_CAPACITY 1024
+#define EVALUATION_EMPTY (-1)
+
+// (user, pledge) 핸들 쌍 해시 (64비트 키를 섞어서 하위 비트도 고르게)
+static size_t pair_hash(StringHandle user, StringHandle pledge) {
+    uint64_t key = ((uint64_t)user << 32) | pledge;
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return (size_t)key;
+}
+
+static void fill_empty(int32_t* array, size_t from, size_t to) {
+    for (size_t i = from; i < to; i++) {
+        array[i] = EVALUATION_EMPTY;
+    }
+}
+
+EvaluationRecord* evaluation_store_at(const EvaluationStore* store, int slot) {
+    return &store->pages[slot >> EVALUATION_PAGE_SHIFT][slot & (EVALUATION_PAGE_SIZE - 1)];
+}
+
+int evaluation_store_init(EvaluationStore* store, StringIntern* strings) {
+    memset(store, 0, sizeof(EvaluationStore));
+    store->strings = strings;
+
+    store->slots = malloc(EVALUATION_SLOTS_MIN_CAPACITY * sizeof(int32_t));
+    if (!store->slots) return 0;
+    store->slot_capacity = EVALUATION_SLOTS_MIN_CAPACITY;
+    fill_empty(store->slots, 0, store->slot_capacity);
+    return 1;
+}
+
+void evaluation_store_free(EvaluationStore* store) {
+    for (int i = 0; i < store->page_count; i++) {
+        free(store->pages[i]);
+    }
+    free(store->pages);
+    free(store->slots);
+    free(store->pledge_heads);
+    memset(store, 0, sizeof(EvaluationStore));
+}
+
+// 할당한 페이지는 다시 쓰기 위해 남겨 둠
+void evaluation_store_clear(EvaluationStore* store) {
+    fill_empty(store->slots, 0, store->slot_capacity);
+    fill_empty(store->pledge_heads, 0, store->pledge_head_capacity);
+    store->count = 0;
+}
+
+// 키가 있는 칸 위치 (없으면 -1)
+static long find_position(const EvaluationStore* store, StringHandle user, StringHandle pledge) {
+    size_t mask = store->slot_capacity - 1;
+    size_t pos = pair_hash(user, pledge) & mask;
+
+    while (store->slots[pos] != EVALUATION_EMPTY) {
+        const EvaluationRecord* record = evaluation_store_at(store, store->slots[pos]);
+        if (record->user == user && record->pledge == pledge) return (long)pos;
+        pos = (pos + 1) & mask;
+    }
+    return -1;
+}
+
+static void place_slot(int32_t* slots, size_t capacity, size_t hash, int slot) {
+    size_t mask = capacity - 1;
+    size_t pos = hash & mask;
+
+    while (slots[pos] != EVALUATION_EMPTY) {
+        pos = (pos + 1) & mask;
+    }
+    slots[pos] = slot;
+}
+
+// 적재율 50% 이하 유지 (확장 시 평가 위치 0..count-1로 다시 채움)
+static int grow_slots_if_needed(EvaluationStore* store, size_t needed) {
+    if (needed * 2 <= store->slot_capacity) return 1;
+
+    size_t capacity = store->slot_capacity;
+    while (needed * 2 > capacity) capacity *= 2;
+
+    int32_t* slots = malloc(capacity * sizeof(int32_t));
+    if (!slots) return 0;
+    fill_empty(slots, 0, capacity);
+
+    for (int i = 0; i < store->count; i++) {
+        const EvaluationRecord* record = evaluation_store_at(store, i);
+        place_slot(slots, capacity, pair_hash(record->user, record->pledge), i);
+    }
+    free(store->slots);
+    store->slots = slots;
+    store->slot_capacity = capacity;
+    return 1;
+}
+
+// 칸 삭제 후 뒤따르는 칸을 당겨서 탐사 경로 유지 (backward shift deletion)
+static void remove_position(EvaluationStore* store, size_t pos) {
+    size_t mask = store->slot_capacity - 1;
+    size_t hole = pos;
+    size_t next = (pos + 1) & mask;
+
+    while (store->slots[next] != EVALUATION_EMPTY) {
+        const EvaluationRecord* record = evaluation_store_at(store, store->slots[next]);
+        size_t home = pair_hash(record->user, record->pledge) & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            store->slots[hole] = store->slots[next];
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+    store->slots[hole] = EVALUATION_EMPTY;
+}
+
+// 새 평가 자리 확보 (마지막 페이지가 차면 페이지 추가)
+static int reserve_slot(EvaluationStore* store) {
+    if (store->count < store->page_count * EVALUATION_PAGE_SIZE) return 1;
+
+    if (store->page_count == store->page_capacity) {
+        int capacity = store->page_capacity ? store->page_capacity * 2 : 16;
+        EvaluationRecord** pages = realloc(store->pages, (size_t)capacity * sizeof(EvaluationRecord*));
+        if (!pages) return 0;
+        store->pages = pages;
+        store->page_capacity = capacity;
+    }
+
+    EvaluationRecord* page = malloc(EVALUATION_PAGE_SIZE * sizeof(EvaluationRecord));
+    if (!page) return 0;
+    store->pages[store->page_count++] = page;
+    return 1;
+}
+
+// 공약 핸들 표가 handle을 담을 수 있게 확장
+static int reserve_pledge_head(EvaluationStore* store, StringHandle pledge) {
+    if (pledge < store->pledge_head_capacity) return 1;
+
+    size_t capacity = store->pledge_head_capacity ? store->pledge_head_capacity : 256;
+    while (pledge >= capacity) capacity *= 2;
+
+    int32_t* heads = realloc(store->pledge_heads, capacity * sizeof(int32_t));
+    if (!heads) return 0;
+    fill_empty(heads, store->pledge_head_capacity, capacity);
+    store->pledge_heads = heads;
+    store->pledge_head_capacity = capacity;
+    return 1;
+}
+
+// 공약 포스팅 리스트 맨 앞에 추가
+static void link_to_pledge(EvaluationStore* store, int slot) {
+    EvaluationRecord* record = evaluation_store_at(store, slot);
+    int head = store->pledge_heads[record->pledge];
+
+    record->prev_in_pledge = EVALUATION_EMPTY;
+    record->next_in_pledge = head;
+    if (head >= 0) {
+        evaluation_store_at(store, head)->prev_in_pledge = slot;
+    }
+    store->pledge_heads[record->pledge] = slot;
+}
+
+static void unlink_from_pledge(EvaluationStore* store, int slot) {
+    EvaluationRecord* record = evaluation_store_at(store, slot);
+    int prev = record->prev_in_pledge;
+    int next = record->next_in_pledge;
+
+    if (prev >= 0) {
+        evaluation_store_at(store, prev)->next_in_pledge = next;
+    } else {
+        store->pledge_heads[record->pledge] = next;
+    }
+    if (next >= 0) {
+        evaluation_store_at(store, next)->prev_in_pledge = prev;
+    }
+}
+
+EvaluationRecord* evaluation_store_get(EvaluationStore* store, const char* user_id, const char* pledge_id) {
+    StringHandle user = string_intern_find(store->strings, user_id);
+    StringHandle pledge = string_intern_find(store->strings, pledge_id);
+    if (user == STRING_HANDLE_NONE || pledge == STRING_HANDLE_NONE) return NULL;
+
+    long pos = find_position(store, user, pledge);
+    return pos >= 0 ? evaluation_store_at(store, store->slots[pos]) : NULL;
+}
+
+int evaluation_store_upsert(EvaluationStore* store, const char* user_id, const char* pledge_id,
+                            int evaluation_type, time_t evaluation_time, int* old_type) {
+    EvaluationRecord* existing = evaluation_store_get(store, user_id, pledge_id);
+    if (existing) {
+        if (old_type) *old_type = existing->evaluation_type;
+        existing->evaluation_type = evaluation_type;
+        existing->evaluation_time = (int64_t)evaluation_time;
+        return 1;
+    }
+
+    if (old_type) *old_type = 0;
+
+    StringHandle user = string_intern_add(store->strings, user_id);
+    StringHandle pledge = string_intern_add(store->strings, pledge_id);
+    if (user == STRING_HANDLE_NONE || pledge == STRING_HANDLE_NONE ||
+        !reserve_slot(store) || !reserve_pledge_head(store, pledge) ||
+        !grow_slots_if_needed(store, (size_t)store->count + 1)) {
+        return 0;
+    }
+
+    int slot = store->count;
+    EvaluationRecord* record = evaluation_store_at(store, slot);
+    memset(record, 0, sizeof(EvaluationRecord));
+    record->user = user;
+    record->pledge = pledge;
+    record->evaluation_type = evaluation_type;
+    record->evaluation_time = (int64_t)evaluation_time;
+
+    place_slot(store->slots, store->slot_capacity, pair_hash(user, pledge), slot);
+    link_to_pledge(store, slot);
+    store->count++;
+    return 1;
+}
+
+int evaluation_store_remove(EvaluationStore* store, const char* user_id, const char* pledge_id, int* old_type) {
+    StringHandle user = string_intern_find(store->strings, user_id);
+    StringHandle pledge = string_intern_find(store->strings, pledge_id);
+    if (user == STRING_HANDLE_NONE || pledge == STRING_HANDLE_NONE) return 0;
+
+    long pos = find_position(store, user, pledge);
+    if (pos < 0) return 0;
+
+    int slot = store->slots[pos];
+    EvaluationRecord* record = evaluation_store_at(store, slot);
+    if (old_type) *old_type = record->evaluation_type;
+
+    unlink_from_pledge(store, slot);
+    remove_position(store, (size_t)pos);
+
+    // 마지막 원소를 빈 자리로 이동 (인덱스와 연결 리스트도 함께 갱신)
+    int last = store->count - 1;
+    if (slot != last) {
+        EvaluationRecord* moved = evaluation_store_at(store, last);
+        store->slots[find_position(store, moved->user, moved->pledge)] = slot;
+
+        if (moved->prev_in_pledge >= 0) {
+            evaluation_store_at(store, moved->prev_in_pledge)->next_in_pledge = slot;
+        } else {
+            store->pledge_heads[moved->pledge] = slot;
+        }
+        if (moved->next_in_pledge >= 0) {
+            evaluation_store_at(store, moved->next_in_pledge)->prev_in_pledge = slot;
+        }
+        *record = *moved;
+    }
+
+    store->count--;
+    return 1;
+}
+
+int evaluation_store_first_for_pledge(const EvaluationStore* store, const char* pledge_id) {
+    return evaluation_store_first_for_handle(store, string_intern_find(store->strings, pledge_id));
+}
+
+int evaluation_store_first_for_handle(const EvaluationStore* store, StringHandle pledge) {
+    if (pledge == STRING_HANDLE_NONE || pledge >= store->pledge_head_capacity) return EVALUATION_EMPTY;
+    return store->pledge_heads[pledge];
+}
+
+int evaluation_store_next_for_pledge(const EvaluationStore* store, int slot) {
+    return evaluation_store_at(store, slot)->next_in_pledge;
+}
+
+size_t evaluation_store_memory(const EvaluationStore* store) {
+    return (size_t)store->page_count * EVALUATION_PAGE_SIZE * sizeof(EvaluationRecord) +
+           (size_t)store->page_capacity * sizeof(EvaluationRecord*) +
+           store->slot_capacity * sizeof(int32_t) +
+           store->pledge_head_capacity * sizeof(int32_t);
+}
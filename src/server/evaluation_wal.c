@@ -0,0 +1,565 @@
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "evaluation_wal.h"
+#include "utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <io.h>
+#else
+    #include <unistd.h>
+    #include <errno.h>
+#endif
+
+#define WAL_MAX_PAYLOAD (1 + 1 + 8 + 1 + 1 + 255 + 255)
+#define WAL_BUFFER_INIT 4096
+
+// 경과 시간 측정 (밀리초)
+static double now_ms(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+#endif
+}
+
+static void put_u32(unsigned char* p, unsigned long value) {
+    p[0] = (unsigned char)(value >> 24);
+    p[1] = (unsigned char)(value >> 16);
+    p[2] = (unsigned char)(value >> 8);
+    p[3] = (unsigned char)value;
+}
+
+static unsigned long get_u32(const unsigned char* p) {
+    return ((unsigned long)p[0] << 24) | ((unsigned long)p[1] << 16) |
+           ((unsigned long)p[2] << 8) | p[3];
+}
+
+static void put_i64(unsigned char* p, long long value) {
+    unsigned long long v = (unsigned long long)value;
+    for (int i = 7; i >= 0; i--) {
+        p[i] = (unsigned char)v;
+        v >>= 8;
+    }
+}
+
+static long long get_i64(const unsigned char* p) {
+    unsigned long long v = 0;
+    for (int i = 0; i < 8; i++) {
+        v = (v << 8) | p[i];
+    }
+    return (long long)v;
+}
+
+// 버퍼 내용을 디스크까지 기록
+static int sync_file(FILE* file) {
+    if (fflush(file) != 0) return 0;
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    while (fsync(fileno(file)) != 0) {
+        if (errno != EINTR) return 0;
+    }
+    return 1;
+#endif
+}
+
+int evaluation_wal_replay(const char* path, EvaluationWalApplyFunc apply, void* context, EvaluationWalReplay* result) {
+    memset(result, 0, sizeof(EvaluationWalReplay));
+
+    FILE* file = fopen(path, "rb");
+    if (!file) return 1;  // 로그 없음
+
+    unsigned char header[EVALUATION_WAL_HEADER_SIZE];
+    if (fread(header, 1, sizeof(header), file) != sizeof(header)) {
+        // 헤더조차 다 쓰지 못한 파일
+        result->torn = 1;
+        fclose(file);
+        return 1;
+    }
+    if (get_u32(header) != EVALUATION_WAL_MAGIC || get_u32(header + 4) != EVALUATION_WAL_VERSION) {
+        write_error_log("evaluation_wal_replay", "WAL 파일 형식이 올바르지 않습니다");
+        fclose(file);
+        return 0;
+    }
+    result->valid_length = EVALUATION_WAL_HEADER_SIZE;
+
+    unsigned char record_header[EVALUATION_WAL_RECORD_HEADER_SIZE];
+    unsigned char payload[WAL_MAX_PAYLOAD];
+    size_t got;
+
+    while ((got = fread(record_header, 1, sizeof(record_header), file)) > 0) {
+        if (got < sizeof(record_header)) {
+            result->torn = 1;
+            break;
+        }
+
+        unsigned long length = get_u32(record_header);
+        unsigned long crc = get_u32(record_header + 4);
+        if (length < 12 || length > WAL_MAX_PAYLOAD ||
+            fread(payload, 1, length, file) != length ||
+            crc32_update(0, payload, length) != crc) {
+            // 기록 도중 종료된 마지막 레코드 (이후 내용은 신뢰할 수 없음)
+            result->torn = 1;
+            break;
+        }
+
+        size_t uid_len = payload[10];
+        size_t pid_len = payload[11];
+        if (12 + uid_len + pid_len != length) {
+            result->torn = 1;
+            break;
+        }
+
+        char user_id[256];
+        char pledge_id[256];
+        memcpy(user_id, payload + 12, uid_len);
+        user_id[uid_len] = '\0';
+        memcpy(pledge_id, payload + 12 + uid_len, pid_len);
+        pledge_id[pid_len] = '\0';
+
+        int op = payload[0];
+        int evaluation_type = (int)(signed char)payload[1];
+        time_t evaluation_time = (time_t)get_i64(payload + 2);
+
+        if (!apply(context, op, user_id, pledge_id, evaluation_type, evaluation_time)) {
+            fclose(file);
+            return 0;
+        }
+
+        result->records++;
+        result->valid_length += (long)(EVALUATION_WAL_RECORD_HEADER_SIZE + length);
+    }
+
+    fclose(file);
+    return 1;
+}
+
+// 로그 파일 열기 (새 파일이면 헤더 기록)
+static FILE* open_log_file(const char* path, int truncate) {
+    FILE* file = fopen(path, truncate ? "wb" : "ab");
+    if (!file) {
+        write_error_log("evaluation_wal", "WAL 파일 열기 실패");
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    if (ftell(file) == 0) {
+        unsigned char header[EVALUATION_WAL_HEADER_SIZE];
+        put_u32(header, EVALUATION_WAL_MAGIC);
+        put_u32(header + 4, EVALUATION_WAL_VERSION);
+        if (fwrite(header, 1, sizeof(header), file) != sizeof(header) || !sync_file(file)) {
+            write_error_log("evaluation_wal", "WAL 헤더 기록 실패");
+            fclose(file);
+            return NULL;
+        }
+    }
+    return file;
+}
+
+// 현재 로그를 archive_path로 옮기고 빈 로그로 다시 시작 (그룹 커밋 스레드에서만 호출)
+static int rotate_log_file(EvaluationWal* wal) {
+    fclose(wal->file);
+
+#ifdef _WIN32
+    remove(wal->archive_path);
+#endif
+    int renamed = rename(wal->path, wal->archive_path) == 0;
+    FILE* file = open_log_file(wal->path, renamed);
+    if (!file && renamed) {
+        // 새 로그를 만들 수 없으면 원래 로그로 되돌림
+        rename(wal->archive_path, wal->path);
+        renamed = 0;
+        file = open_log_file(wal->path, 0);
+    }
+    if (!file) {
+        write_error_log("evaluation_wal", "WAL 교체 후 파일을 다시 열 수 없습니다");
+    }
+    wal->file = file;
+    return renamed && file != NULL;
+}
+
+// 현재 pending 버퍼를 디스크에 기록 (그룹 커밋 스레드 또는 스레드 종료 후에만 호출)
+static void commit_pending(EvaluationWal* wal) {
+#ifdef _WIN32
+    EnterCriticalSection(&wal->mutex);
+#else
+    pthread_mutex_lock(&wal->mutex);
+#endif
+
+    int rotate = wal->rotate_requested;
+    if (wal->pending_records == 0 && !rotate) {
+#ifdef _WIN32
+        LeaveCriticalSection(&wal->mutex);
+#else
+        pthread_mutex_unlock(&wal->mutex);
+#endif
+        return;
+    }
+
+    // 버퍼 교체 후 잠금 밖에서 기록 (그동안 다른 스레드는 계속 추가 가능)
+    char* buffer = wal->pending;
+    size_t length = wal->pending_length;
+    int records = wal->pending_records;
+
+    wal->pending = wal->flushing;
+    wal->flushing = buffer;
+    size_t capacity = wal->pending_capacity;
+    wal->pending_capacity = wal->flushing_capacity;
+    wal->flushing_capacity = capacity;
+    wal->pending_length = 0;
+    wal->pending_records = 0;
+
+#ifdef _WIN32
+    LeaveCriticalSection(&wal->mutex);
+#else
+    pthread_mutex_unlock(&wal->mutex);
+#endif
+
+    // 교체 요청 전에 추가된 레코드까지는 기존 로그에 기록
+    int ok = 1;
+    double elapsed = 0.0;
+    if (records > 0) {
+        double start = now_ms();
+        ok = wal->file && fwrite(buffer, 1, length, wal->file) == length && sync_file(wal->file);
+        elapsed = now_ms() - start;
+
+        if (!ok) {
+            write_error_log("evaluation_wal", "WAL 기록 실패");
+        }
+    }
+    int rotated = rotate && wal->file && rotate_log_file(wal);
+
+#ifdef _WIN32
+    EnterCriticalSection(&wal->mutex);
+#else
+    pthread_mutex_lock(&wal->mutex);
+#endif
+    if (records > 0) {
+        if (ok) {
+            wal->committed += (unsigned long long)records;
+            wal->commits++;
+            wal->bytes += length;
+        } else {
+            wal->errors++;
+        }
+        wal->last_commit_ms = elapsed;
+        if (elapsed > wal->max_commit_ms) wal->max_commit_ms = elapsed;
+    }
+    if (rotate) {
+        if (rotated) wal->rotations++;
+        wal->rotate_result = rotated;
+        wal->rotate_requested = 0;
+#ifdef _WIN32
+        WakeAllConditionVariable(&wal->rotated);
+#else
+        pthread_cond_broadcast(&wal->rotated);
+#endif
+    }
+#ifdef _WIN32
+    LeaveCriticalSection(&wal->mutex);
+#else
+    pthread_mutex_unlock(&wal->mutex);
+#endif
+}
+
+// 그룹 커밋 스레드: 레코드가 들어오면 window_ms 동안 더 모은 뒤 한 번에 fsync
+static void wal_commit_loop(EvaluationWal* wal) {
+    while (1) {
+#ifdef _WIN32
+        EnterCriticalSection(&wal->mutex);
+        while (wal->running && wal->pending_records == 0 && !wal->rotate_requested) {
+            SleepConditionVariableCS(&wal->wake, &wal->mutex, INFINITE);
+        }
+        if (wal->running && !wal->rotate_requested && wal->pending_records < wal->batch_records) {
+            SleepConditionVariableCS(&wal->wake, &wal->mutex, (DWORD)wal->window_ms);
+        }
+        int running = wal->running;
+        LeaveCriticalSection(&wal->mutex);
+#else
+        pthread_mutex_lock(&wal->mutex);
+        while (wal->running && wal->pending_records == 0 && !wal->rotate_requested) {
+            pthread_cond_wait(&wal->wake, &wal->mutex);
+        }
+        if (wal->running && !wal->rotate_requested && wal->pending_records < wal->batch_records) {
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_sec += wal->window_ms / 1000;
+            deadline.tv_nsec += (long)(wal->window_ms % 1000) * 1000000L;
+            if (deadline.tv_nsec >= 1000000000L) {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000L;
+            }
+            while (wal->running && !wal->rotate_requested && wal->pending_records < wal->batch_records &&
+                   pthread_cond_timedwait(&wal->wake, &wal->mutex, &deadline) == 0) {
+                // 배치가 다 차거나 시간이 지날 때까지 대기
+            }
+        }
+        int running = wal->running;
+        pthread_mutex_unlock(&wal->mutex);
+#endif
+
+        if (!running) break;
+        commit_pending(wal);
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI wal_commit_thread(LPVOID param) {
+    wal_commit_loop((EvaluationWal*)param);
+    return 0;
+}
+#else
+static void* wal_commit_thread(void* param) {
+    wal_commit_loop((EvaluationWal*)param);
+    return NULL;
+}
+#endif
+
+int evaluation_wal_open(EvaluationWal* wal, const char* path, int truncate, int window_ms, int batch_records) {
+    memset(wal, 0, sizeof(EvaluationWal));
+    crc32_update(0, NULL, 0);  // 여러 스레드가 추가하기 전에 CRC 테이블 생성
+
+    wal->window_ms = window_ms > 0 ? window_ms : 1;
+    wal->batch_records = batch_records > 0 ? batch_records : 1;
+
+    safe_strcpy(wal->path, path, sizeof(wal->path));
+    wal->file = open_log_file(path, truncate);
+    if (!wal->file) {
+        return 0;
+    }
+
+    wal->pending = malloc(WAL_BUFFER_INIT);
+    wal->flushing = malloc(WAL_BUFFER_INIT);
+    if (!wal->pending || !wal->flushing) {
+        free(wal->pending);
+        free(wal->flushing);
+        fclose(wal->file);
+        wal->file = NULL;
+        return 0;
+    }
+    wal->pending_capacity = WAL_BUFFER_INIT;
+    wal->flushing_capacity = WAL_BUFFER_INIT;
+
+#ifdef _WIN32
+    InitializeCriticalSection(&wal->mutex);
+    InitializeConditionVariable(&wal->wake);
+    InitializeConditionVariable(&wal->rotated);
+#else
+    pthread_mutex_init(&wal->mutex, NULL);
+    pthread_cond_init(&wal->wake, NULL);
+    pthread_cond_init(&wal->rotated, NULL);
+#endif
+
+    wal->running = 1;
+#ifdef _WIN32
+    wal->thread = CreateThread(NULL, 0, wal_commit_thread, wal, 0, NULL);
+    int started = wal->thread != NULL;
+#else
+    int started = pthread_create(&wal->thread, NULL, wal_commit_thread, wal) == 0;
+#endif
+    if (!started) {
+        wal->running = 0;
+        evaluation_wal_close(wal);
+        return 0;
+    }
+    return 1;
+}
+
+void evaluation_wal_close(EvaluationWal* wal) {
+    if (!wal->pending) return;
+
+    if (wal->running) {
+#ifdef _WIN32
+        EnterCriticalSection(&wal->mutex);
+        wal->running = 0;
+        WakeConditionVariable(&wal->wake);
+        LeaveCriticalSection(&wal->mutex);
+        WaitForSingleObject(wal->thread, INFINITE);
+        CloseHandle(wal->thread);
+#else
+        pthread_mutex_lock(&wal->mutex);
+        wal->running = 0;
+        pthread_cond_signal(&wal->wake);
+        pthread_mutex_unlock(&wal->mutex);
+        pthread_join(wal->thread, NULL);
+#endif
+    }
+
+    // 남은 레코드 기록
+    commit_pending(wal);
+
+    if (wal->file) fclose(wal->file);
+    wal->file = NULL;
+    free(wal->pending);
+    free(wal->flushing);
+    wal->pending = NULL;
+    wal->flushing = NULL;
+
+#ifdef _WIN32
+    DeleteCriticalSection(&wal->mutex);
+#else
+    pthread_cond_destroy(&wal->wake);
+    pthread_cond_destroy(&wal->rotated);
+    pthread_mutex_destroy(&wal->mutex);
+#endif
+}
+
+int evaluation_wal_append(EvaluationWal* wal, int op, const char* user_id, const char* pledge_id,
+                          int evaluation_type, time_t evaluation_time) {
+    size_t uid_len = strlen(user_id);
+    size_t pid_len = strlen(pledge_id);
+    if (!wal->file || uid_len > 255 || pid_len > 255) return 0;
+
+    // 레코드 인코딩은 잠금 밖에서
+    unsigned char record[EVALUATION_WAL_RECORD_HEADER_SIZE + WAL_MAX_PAYLOAD];
+    unsigned char* payload = record + EVALUATION_WAL_RECORD_HEADER_SIZE;
+    size_t length = 12 + uid_len + pid_len;
+
+    payload[0] = (unsigned char)op;
+    payload[1] = (unsigned char)(signed char)evaluation_type;
+    put_i64(payload + 2, (long long)evaluation_time);
+    payload[10] = (unsigned char)uid_len;
+    payload[11] = (unsigned char)pid_len;
+    memcpy(payload + 12, user_id, uid_len);
+    memcpy(payload + 12 + uid_len, pledge_id, pid_len);
+
+    put_u32(record, (unsigned long)length);
+    put_u32(record + 4, crc32_update(0, payload, length));
+    size_t total = EVALUATION_WAL_RECORD_HEADER_SIZE + length;
+
+#ifdef _WIN32
+    EnterCriticalSection(&wal->mutex);
+#else
+    pthread_mutex_lock(&wal->mutex);
+#endif
+
+    int ok = 1;
+    if (wal->pending_length + total > wal->pending_capacity) {
+        size_t capacity = wal->pending_capacity * 2;
+        while (wal->pending_length + total > capacity) capacity *= 2;
+        char* grown = realloc(wal->pending, capacity);
+        if (grown) {
+            wal->pending = grown;
+            wal->pending_capacity = capacity;
+        } else {
+            ok = 0;
+        }
+    }
+
+    if (ok) {
+        memcpy(wal->pending + wal->pending_length, record, total);
+        wal->pending_length += total;
+        wal->pending_records++;
+        wal->appended++;
+
+        // 첫 레코드면 커밋 스레드를 깨워 대기 시간을 시작하고, 배치가 차면 바로 커밋
+        if (wal->pending_records == 1 || wal->pending_records >= wal->batch_records) {
+#ifdef _WIN32
+            WakeConditionVariable(&wal->wake);
+#else
+            pthread_cond_signal(&wal->wake);
+#endif
+        }
+    } else {
+        wal->errors++;
+    }
+
+#ifdef _WIN32
+    LeaveCriticalSection(&wal->mutex);
+#else
+    pthread_mutex_unlock(&wal->mutex);
+#endif
+
+    return ok;
+}
+
+int evaluation_wal_rotate(EvaluationWal* wal, const char* archive_path) {
+    if (!wal->running) return 0;
+
+#ifdef _WIN32
+    EnterCriticalSection(&wal->mutex);
+#else
+    pthread_mutex_lock(&wal->mutex);
+#endif
+
+    // 다른 교체가 진행 중이면 끝날 때까지 대기
+    while (wal->rotate_requested) {
+#ifdef _WIN32
+        SleepConditionVariableCS(&wal->rotated, &wal->mutex, INFINITE);
+#else
+        pthread_cond_wait(&wal->rotated, &wal->mutex);
+#endif
+    }
+
+    safe_strcpy(wal->archive_path, archive_path, sizeof(wal->archive_path));
+    wal->rotate_requested = 1;
+#ifdef _WIN32
+    WakeConditionVariable(&wal->wake);
+#else
+    pthread_cond_signal(&wal->wake);
+#endif
+
+    while (wal->rotate_requested) {
+#ifdef _WIN32
+        SleepConditionVariableCS(&wal->rotated, &wal->mutex, INFINITE);
+#else
+        pthread_cond_wait(&wal->rotated, &wal->mutex);
+#endif
+    }
+    int result = wal->rotate_result;
+
+#ifdef _WIN32
+    LeaveCriticalSection(&wal->mutex);
+#else
+    pthread_mutex_unlock(&wal->mutex);
+#endif
+
+    return result;
+}
+
+void evaluation_wal_get_stats(EvaluationWal* wal, EvaluationWalStats* stats) {
+    memset(stats, 0, sizeof(EvaluationWalStats));
+    if (!wal->file) return;
+
+#ifdef _WIN32
+    EnterCriticalSection(&wal->mutex);
+#else
+    pthread_mutex_lock(&wal->mutex);
+#endif
+    stats->window_ms = wal->window_ms;
+    stats->batch_records = wal->batch_records;
+    stats->pending_records = wal->pending_records;
+    stats->appended = wal->appended;
+    stats->committed = wal->committed;
+    stats->commits = wal->commits;
+    stats->bytes = wal->bytes;
+    stats->errors = wal->errors;
+    stats->rotations = wal->rotations;
+    stats->last_commit_ms = wal->last_commit_ms;
+    stats->max_commit_ms = wal->max_commit_ms;
+#ifdef _WIN32
+    LeaveCriticalSection(&wal->mutex);
+#else
+    pthread_mutex_unlock(&wal->mutex);
+#endif
+
+    stats->average_batch = stats->commits > 0 ? (double)stats->committed / (double)stats->commits : 0.0;
+}
+
+int evaluation_wal_format_stats(const EvaluationWalStats* stats, char* buffer, size_t buffer_size) {
+    return snprintf(buffer, buffer_size,
+                    "[WAL] window=%dms batch=%d 대기=%d 추가=%llu 커밋=%llu (%llu회, 평균 %.1f개) "
+                    "바이트=%llu 오류=%llu 교체=%llu fsync=%.2fms (최대 %.2fms)",
+                    stats->window_ms, stats->batch_records, stats->pending_records,
+                    stats->appended, stats->committed, stats->commits, stats->average_batch,
+                    stats->bytes, stats->errors, stats->rotations, stats->last_commit_ms, stats->max_commit_ms);
+}
@@ -0,0 +1,525 @@
+#include "event_loop.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <stdint.h>
+    #include <fcntl.h>
+    #include <errno.h>
+#endif
+
+#ifdef __linux__
+
+struct Reactor;
+
+// 연결별 상태 (하나의 리액터 스레드만 접근하므로 잠금 불필요)
+typedef struct Connection {
+    socket_t socket;
+    int id;
+    struct Reactor* reactor;
+    ClientJob* pending_job;        // 워커에서 처리 중인 요청 (연결당 하나씩 순서대로 처리)
+    int closed;                    // 처리 중에 연결이 끊긴 경우 완료 후 해제
+    int read_closed;               // 상대방이 송신을 끝냄 (남은 요청의 응답을 모두 보낸 뒤 종료)
+    FrameReader reader;            // 수신 버퍼 (프레임 단위로 잘라서 처리)
+    char* write_buf;               // 송신 대기 버퍼
+    size_t write_len;
+    size_t write_off;
+    size_t write_cap;
+    struct Connection* prev;       // 리액터의 연결 목록 (종료 시 정리용)
+    struct Connection* next;
+} Connection;
+
+// 리액터 스레드 정보
+typedef struct Reactor {
+    int index;
+    int epoll_fd;
+    int wake_fd;                   // 워커가 작업 완료를 알리는 eventfd
+    pthread_mutex_t completion_mutex;
+    ClientJob* completed_head;     // 워커가 끝낸 작업 목록
+    ClientJob* completed_tail;
+    long pending_jobs;             // 워커에 넘긴 뒤 아직 돌아오지 않은 작업 수
+    pthread_t thread;
+    int thread_started;
+    long connection_count;
+    Connection* connections;
+    pthread_mutex_t list_mutex;    // 연결 목록 보호 (accept 스레드와 공유)
+    volatile int* running;
+} Reactor;
+
+int event_loop_supported(void) {
+    return 1;
+}
+
+// 소켓을 논블로킹 모드로 설정
+static int set_nonblocking(socket_t sock) {
+    int flags = fcntl(sock, F_GETFL, 0);
+    if (flags < 0) return 0;
+    return fcntl(sock, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+// 버퍼 용량 확보 (부족하면 두 배씩 증가)
+static int ensure_capacity(char** buf, size_t* cap, size_t needed) {
+    if (*cap >= needed) return 1;
+
+    size_t new_cap = *cap ? *cap : CONNECTION_BUFFER_INIT;
+    while (new_cap < needed) new_cap *= 2;
+
+    char* new_buf = realloc(*buf, new_cap);
+    if (!new_buf) return 0;
+
+    *buf = new_buf;
+    *cap = new_cap;
+    return 1;
+}
+
+static void free_connection(Connection* conn) {
+    frame_reader_free(&conn->reader);
+    free(conn->write_buf);
+    free(conn);
+}
+
+// 연결 종료 및 정리
+static void close_connection(Reactor* reactor, Connection* conn) {
+    epoll_ctl(reactor->epoll_fd, EPOLL_CTL_DEL, conn->socket, NULL);
+    close(conn->socket);
+
+    pthread_mutex_lock(&reactor->list_mutex);
+    if (conn->prev) conn->prev->next = conn->next;
+    else reactor->connections = conn->next;
+    if (conn->next) conn->next->prev = conn->prev;
+    reactor->connection_count--;
+    pthread_mutex_unlock(&reactor->list_mutex);
+
+    // 워커가 아직 이 연결의 요청을 처리 중이면 완료 시점에 해제
+    if (conn->pending_job) {
+        conn->closed = 1;
+        return;
+    }
+    free_connection(conn);
+}
+
+// 워커 스레드에서 호출: 완료된 작업을 리액터에 돌려보냄
+static void on_job_complete(ClientJob* job) {
+    Connection* conn = (Connection*)job->context;
+    Reactor* reactor = conn->reactor;
+    uint64_t one = 1;
+
+    job->next = NULL;
+    pthread_mutex_lock(&reactor->completion_mutex);
+    if (reactor->completed_tail) reactor->completed_tail->next = job;
+    else reactor->completed_head = job;
+    reactor->completed_tail = job;
+    pthread_mutex_unlock(&reactor->completion_mutex);
+
+    if (write(reactor->wake_fd, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+        write_error_log("on_job_complete", "리액터 깨우기 실패");
+    }
+}
+
+// 송신 대기 데이터 전송 (EAGAIN이면 다음 EPOLLOUT 이벤트에서 계속)
+// 반환값: 1 = 정상, 0 = 연결 오류
+static int flush_connection(Connection* conn) {
+    while (conn->write_off < conn->write_len) {
+        ssize_t sent = send(conn->socket, conn->write_buf + conn->write_off,
+                            conn->write_len - conn->write_off, MSG_NOSIGNAL);
+        if (sent > 0) {
+            conn->write_off += (size_t)sent;
+        } else if (sent < 0 && errno == EINTR) {
+            continue;
+        } else if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return 1;
+        } else {
+            return 0;
+        }
+    }
+
+    conn->write_len = 0;
+    conn->write_off = 0;
+    return 1;
+}
+
+// 응답을 요청과 같은 인코딩으로 송신 버퍼에 추가
+static int queue_response(Connection* conn, const Frame* response) {
+    // 이미 보낸 앞부분은 버려서 버퍼가 계속 커지지 않게 함
+    if (conn->write_off > 0) {
+        memmove(conn->write_buf, conn->write_buf + conn->write_off, conn->write_len - conn->write_off);
+        conn->write_len -= conn->write_off;
+        conn->write_off = 0;
+    }
+
+    size_t size = frame_encoded_size(response, conn->reader.mode);
+    if (!ensure_capacity(&conn->write_buf, &conn->write_cap, conn->write_len + size)) {
+        return 0;
+    }
+
+    conn->write_len += frame_encode(response, conn->reader.mode, conn->write_buf + conn->write_len);
+    return 1;
+}
+
+// 송신만 닫힌 연결이 더 할 일이 없는지 (처리 중인 요청과 보낼 응답이 모두 끝남)
+// process_buffered_messages 뒤에는 처리 중인 요청이 없으면 완성된 프레임도 남아 있지 않음
+static int connection_finished(const Connection* conn) {
+    return conn->read_closed && !conn->pending_job && conn->write_off >= conn->write_len;
+}
+
+// 수신 버퍼에 모인 메시지를 워커 풀에 넘김
+// 응답 순서를 지키기 위해 연결당 한 번에 하나의 요청만 워커에 넘기고,
+// 나머지는 완료 후 다시 이 함수가 호출될 때 처리
+static int process_buffered_messages(Connection* conn) {
+    while (!conn->pending_job) {
+        Frame request;
+        int result = frame_reader_next(&conn->reader, &request);
+        if (result == 0) break;
+        if (result < 0) {
+            write_error_log("process_buffered_messages", "잘못된 프레임 수신");
+            return 0;
+        }
+
+        ClientJob* job = malloc(sizeof(ClientJob));
+        if (!job) {
+            write_error_log("process_buffered_messages", "작업 메모리 할당 실패");
+            frame_free(&request);
+            return 0;
+        }
+
+        job->request = request;
+        frame_init(&job->response);
+        job->on_complete = on_job_complete;
+        job->context = conn;
+        job->next = NULL;
+
+        conn->pending_job = job;
+        conn->reactor->pending_jobs++;
+
+        if (!submit_client_job(job)) {
+            // 큐가 가득 찬 경우 바로 거절 응답
+            conn->pending_job = NULL;
+            conn->reactor->pending_jobs--;
+
+            fill_server_busy_response(&job->response);
+            int queued = queue_response(conn, &job->response);
+            frame_free(&job->request);
+            frame_free(&job->response);
+            free(job);
+
+            if (!queued) {
+                write_error_log("process_buffered_messages", "송신 버퍼 할당 실패");
+                return 0;
+            }
+        }
+    }
+
+    return flush_connection(conn);
+}
+
+// 읽기 이벤트 처리 (엣지 트리거이므로 EAGAIN까지 모두 읽음)
+// 반환값: 1 = 연결 유지, 0 = 연결 종료
+static int handle_readable(Connection* conn) {
+    while (!conn->read_closed) {
+        if (conn->reader.length - conn->reader.offset >= CONNECTION_BUFFER_MAX) {
+            write_error_log("handle_readable", "수신 버퍼 한도 초과");
+            return 0;
+        }
+
+        size_t available;
+        char* space = frame_reader_reserve(&conn->reader, CONNECTION_BUFFER_INIT, &available);
+        if (!space) {
+            write_error_log("handle_readable", "수신 버퍼 할당 실패");
+            return 0;
+        }
+
+        ssize_t received = recv(conn->socket, space, available, 0);
+        if (received > 0) {
+            frame_reader_commit(&conn->reader, (size_t)received);
+        } else if (received == 0) {
+            // 상대방이 송신을 끝냄 (shutdown(SHUT_WR) 포함): 더 읽지 않고 이미 받은 요청의 응답은 보냄
+            conn->read_closed = 1;
+            break;
+        } else if (errno == EINTR) {
+            continue;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            break;
+        } else {
+            return 0;
+        }
+    }
+
+    return process_buffered_messages(conn);
+}
+
+// 워커가 끝낸 작업의 응답을 송신하고 다음 요청을 이어서 처리
+static void drain_completions(Reactor* reactor) {
+    uint64_t value;
+    while (read(reactor->wake_fd, &value, sizeof(value)) > 0) {
+    }
+
+    pthread_mutex_lock(&reactor->completion_mutex);
+    ClientJob* job = reactor->completed_head;
+    reactor->completed_head = NULL;
+    reactor->completed_tail = NULL;
+    pthread_mutex_unlock(&reactor->completion_mutex);
+
+    while (job) {
+        ClientJob* next = job->next;
+        Connection* conn = (Connection*)job->context;
+
+        conn->pending_job = NULL;
+        reactor->pending_jobs--;
+
+        if (conn->closed) {
+            free_connection(conn);
+        } else if (!queue_response(conn, &job->response) || !process_buffered_messages(conn) ||
+                   connection_finished(conn)) {
+            close_connection(reactor, conn);
+        }
+
+        frame_free(&job->request);
+        frame_free(&job->response);
+        free(job);
+        job = next;
+    }
+}
+
+// 리액터 스레드: 자신에게 배정된 연결들의 이벤트 처리
+static void* reactor_thread(void* arg) {
+    Reactor* reactor = (Reactor*)arg;
+    struct epoll_event events[EVENT_LOOP_MAX_EVENTS];
+
+    while (*reactor->running) {
+        int count = epoll_wait(reactor->epoll_fd, events, EVENT_LOOP_MAX_EVENTS, EVENT_LOOP_TIMEOUT_MS);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            write_error_log("reactor_thread", "epoll_wait 실패");
+            break;
+        }
+
+        int woken = 0;
+        for (int i = 0; i < count; i++) {
+            Connection* conn = (Connection*)events[i].data.ptr;
+            int keep = 1;
+
+            // data.ptr이 NULL이면 워커의 완료 알림
+            // (완료 처리 중 연결이 해제될 수 있으므로 이번 이벤트를 모두 처리한 뒤 수행)
+            if (!conn) {
+                woken = 1;
+                continue;
+            }
+
+            if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+                keep = 0;
+            }
+            if (keep && (events[i].events & (EPOLLIN | EPOLLRDHUP))) {
+                keep = handle_readable(conn);
+            }
+            if (keep && (events[i].events & EPOLLOUT)) {
+                keep = flush_connection(conn);
+            }
+            if (keep && connection_finished(conn)) {
+                keep = 0;
+            }
+
+            if (!keep) {
+                close_connection(reactor, conn);
+            }
+        }
+
+        if (woken) {
+            drain_completions(reactor);
+        }
+    }
+
+    // 종료 시 남은 연결 정리
+    while (reactor->connections) {
+        close_connection(reactor, reactor->connections);
+    }
+
+    // 워커에서 처리 중인 작업이 모두 돌아와야 연결 메모리를 해제할 수 있음
+    while (reactor->pending_jobs > 0) {
+        epoll_wait(reactor->epoll_fd, events, EVENT_LOOP_MAX_EVENTS, EVENT_LOOP_TIMEOUT_MS);
+        drain_completions(reactor);
+    }
+
+    return NULL;
+}
+
+// 새 연결을 리액터에 등록
+static int register_connection(Reactor* reactor, socket_t client_socket, int id) {
+    Connection* conn = calloc(1, sizeof(Connection));
+    if (!conn) return 0;
+
+    conn->socket = client_socket;
+    conn->id = id;
+    conn->reactor = reactor;
+
+    // epoll 등록 전에 목록에 넣어야 리액터가 곧바로 닫아도 목록이 어긋나지 않음
+    pthread_mutex_lock(&reactor->list_mutex);
+    conn->next = reactor->connections;
+    if (reactor->connections) reactor->connections->prev = conn;
+    reactor->connections = conn;
+    reactor->connection_count++;
+    pthread_mutex_unlock(&reactor->list_mutex);
+
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN | EPOLLOUT | EPOLLET | EPOLLRDHUP;
+    ev.data.ptr = conn;
+
+    if (epoll_ctl(reactor->epoll_fd, EPOLL_CTL_ADD, client_socket, &ev) != 0) {
+        pthread_mutex_lock(&reactor->list_mutex);
+        if (conn->next) conn->next->prev = NULL;
+        reactor->connections = conn->next;
+        reactor->connection_count--;
+        pthread_mutex_unlock(&reactor->list_mutex);
+        free(conn);
+        return 0;
+    }
+
+    return 1;
+}
+
+int run_event_loop(socket_t listen_socket, int reactor_count, volatile int* running) {
+    if (reactor_count < 1) reactor_count = 1;
+    if (reactor_count > MAX_REACTOR_COUNT) reactor_count = MAX_REACTOR_COUNT;
+
+    Reactor* reactors = calloc((size_t)reactor_count, sizeof(Reactor));
+    if (!reactors) {
+        write_error_log("run_event_loop", "리액터 메모리 할당 실패");
+        return 0;
+    }
+
+    int accept_epoll = -1;
+    int success = 0;
+
+    for (int i = 0; i < reactor_count; i++) {
+        reactors[i].epoll_fd = -1;
+        reactors[i].wake_fd = -1;
+        pthread_mutex_init(&reactors[i].list_mutex, NULL);
+        pthread_mutex_init(&reactors[i].completion_mutex, NULL);
+    }
+
+    // 리액터 생성
+    for (int i = 0; i < reactor_count; i++) {
+        reactors[i].index = i;
+        reactors[i].running = running;
+        reactors[i].epoll_fd = epoll_create1(0);
+        if (reactors[i].epoll_fd < 0) {
+            write_error_log("run_event_loop", "epoll 생성 실패");
+            goto cleanup;
+        }
+
+        // 워커 완료 알림용 eventfd 등록 (data.ptr = NULL로 구분)
+        reactors[i].wake_fd = eventfd(0, EFD_NONBLOCK);
+        struct epoll_event wake_ev;
+        memset(&wake_ev, 0, sizeof(wake_ev));
+        wake_ev.events = EPOLLIN;
+        wake_ev.data.ptr = NULL;
+        if (reactors[i].wake_fd < 0 ||
+            epoll_ctl(reactors[i].epoll_fd, EPOLL_CTL_ADD, reactors[i].wake_fd, &wake_ev) != 0) {
+            write_error_log("run_event_loop", "eventfd 생성 실패");
+            goto cleanup;
+        }
+        if (pthread_create(&reactors[i].thread, NULL, reactor_thread, &reactors[i]) != 0) {
+            write_error_log("run_event_loop", "리액터 스레드 생성 실패");
+            goto cleanup;
+        }
+        reactors[i].thread_started = 1;
+    }
+
+    // accept 전용 epoll (종료 플래그를 주기적으로 확인하기 위함)
+    accept_epoll = epoll_create1(0);
+    if (accept_epoll < 0 || !set_nonblocking(listen_socket)) {
+        write_error_log("run_event_loop", "accept 소켓 설정 실패");
+        goto cleanup;
+    }
+
+    struct epoll_event listen_ev;
+    memset(&listen_ev, 0, sizeof(listen_ev));
+    listen_ev.events = EPOLLIN;
+    listen_ev.data.fd = listen_socket;
+    if (epoll_ctl(accept_epoll, EPOLL_CTL_ADD, listen_socket, &listen_ev) != 0) {
+        write_error_log("run_event_loop", "서버 소켓 epoll 등록 실패");
+        goto cleanup;
+    }
+
+    printf("⚡ epoll 이벤트 루프 시작 (리액터 스레드 %d개)\n", reactor_count);
+    success = 1;
+
+    int connection_id = 0;
+    int next_reactor = 0;
+
+    while (*running) {
+        struct epoll_event ev;
+        int count = epoll_wait(accept_epoll, &ev, 1, EVENT_LOOP_TIMEOUT_MS);
+        if (count <= 0) continue;
+
+        // 대기 중인 연결을 모두 수락하여 리액터에 순서대로 배정
+        while (1) {
+            struct sockaddr_in client_addr;
+            socklen_t client_addr_len = sizeof(client_addr);
+            socket_t client_socket = accept(listen_socket, (struct sockaddr*)&client_addr, &client_addr_len);
+
+            if (client_socket == INVALID_SOCKET) {
+                if (errno == EINTR) continue;
+                if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                    write_error_log("run_event_loop", "Failed to accept client connection");
+                }
+                break;
+            }
+
+            if (!set_nonblocking(client_socket)) {
+                close(client_socket);
+                continue;
+            }
+
+            Reactor* reactor = &reactors[next_reactor];
+            next_reactor = (next_reactor + 1) % reactor_count;
+
+            if (!register_connection(reactor, client_socket, ++connection_id)) {
+                write_error_log("run_event_loop", "연결 등록 실패");
+                close(client_socket);
+            }
+        }
+    }
+
+cleanup:
+    // running 플래그가 내려가야 리액터가 종료되므로, 오류로 빠져나온 경우 직접 내림
+    *running = 0;
+
+    for (int i = 0; i < reactor_count; i++) {
+        if (reactors[i].thread_started) {
+            pthread_join(reactors[i].thread, NULL);
+        }
+        if (reactors[i].epoll_fd >= 0) {
+            close(reactors[i].epoll_fd);
+        }
+        if (reactors[i].wake_fd >= 0) {
+            close(reactors[i].wake_fd);
+        }
+        pthread_mutex_destroy(&reactors[i].list_mutex);
+        pthread_mutex_destroy(&reactors[i].completion_mutex);
+    }
+    if (accept_epoll >= 0) close(accept_epoll);
+    free(reactors);
+
+    printf("⚡ epoll 이벤트 루프 종료\n");
+    return success;
+}
+
+#else
+
+int event_loop_supported(void) {
+    return 0;
+}
+
+int run_event_loop(socket_t listen_socket, int reactor_count, volatile int* running) {
+    (void)listen_socket;
+    (void)reactor_count;
+    (void)running;
+    write_error_log("run_event_loop", "epoll 이벤트 루프는 Linux에서만 지원됩니다");
+    return 0;
+}
+
+#endif
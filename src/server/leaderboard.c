@@ -0,0 +1,324 @@
+#include "leaderboard.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define LEADERBOARD_NONE (-1)
+
+int leaderboard_init(Leaderboard* board) {
+    memset(board, 0, sizeof(Leaderboard));
+    return 1;
+}
+
+static void free_index(LeaderboardIndex* index) {
+    if (index->locks) {
+        for (int b = 0; b < index->board_count; b++) {
+            rw_lock_destroy(&index->locks[b]);
+        }
+    }
+    free(index->items);
+    free(index->offsets);
+    free(index->board_of);
+    free(index->positions);
+    free(index->likes);
+    free(index->dislikes);
+    free(index->locks);
+    memset(index, 0, sizeof(LeaderboardIndex));
+}
+
+static void clear_board(Leaderboard* board) {
+    for (int k = 0; k < LEADERBOARD_KIND_COUNT; k++) {
+        free_index(&board->kinds[k]);
+    }
+    board->pledge_count = 0;
+}
+
+void leaderboard_free(Leaderboard* board) {
+    clear_board(board);
+}
+
+// a가 b보다 순위가 높은지 (지지율 -> 총 표 수 -> 공약 위치, 표가 없는 공약은 항상 아래)
+static int ranks_higher(const LeaderboardIndex* index, int32_t a, int32_t b) {
+    long long likes_a = index->likes[a];
+    long long likes_b = index->likes[b];
+    long long total_a = likes_a + index->dislikes[a];
+    long long total_b = likes_b + index->dislikes[b];
+
+    if (total_a > 0 && total_b > 0) {
+        // likes_a / total_a와 likes_b / total_b 비교 (나눗셈 없이)
+        long long left = likes_a * total_b;
+        long long right = likes_b * total_a;
+        if (left != right) return left > right;
+    }
+    if (total_a != total_b) return total_a > total_b;
+    return a < b;
+}
+
+static void place(LeaderboardIndex* index, int32_t slot, int32_t pledge) {
+    index->items[slot] = pledge;
+    index->positions[pledge] = slot;
+}
+
+// 보드 안 상대 위치 기준으로 힙 조정 (base: 보드 시작, count: 보드 크기)
+static int sift_up(LeaderboardIndex* index, int32_t base, int32_t relative) {
+    int32_t pledge = index->items[base + relative];
+    int moved = 0;
+
+    while (relative > 0) {
+        int32_t parent = (relative - 1) / 2;
+        int32_t parent_pledge = index->items[base + parent];
+        if (!ranks_higher(index, pledge, parent_pledge)) break;
+        place(index, base + relative, parent_pledge);
+        relative = parent;
+        moved = 1;
+    }
+    place(index, base + relative, pledge);
+    return moved;
+}
+
+static void sift_down(LeaderboardIndex* index, int32_t base, int32_t count, int32_t relative) {
+    int32_t pledge = index->items[base + relative];
+
+    for (;;) {
+        int32_t child = relative * 2 + 1;
+        if (child >= count) break;
+        if (child + 1 < count && ranks_higher(index, index->items[base + child + 1], index->items[base + child])) {
+            child++;
+        }
+        int32_t child_pledge = index->items[base + child];
+        if (!ranks_higher(index, child_pledge, pledge)) break;
+        place(index, base + relative, child_pledge);
+        relative = child;
+    }
+    place(index, base + relative, pledge);
+}
+
+// 보드 하나를 아래에서부터 힙 정리 (O(보드 크기))
+static void heapify_board(LeaderboardIndex* index, int b) {
+    int32_t base = index->offsets[b];
+    int32_t count = index->offsets[b + 1] - base;
+    for (int32_t relative = count / 2 - 1; relative >= 0; relative--) {
+        sift_down(index, base, count, relative);
+    }
+}
+
+// 보드별로 공약을 모아(계수 정렬) 힙을 만듦
+// board_of가 NULL이면 공약 위치 % board_count 보드에 나눠 담음 (전체 순위의 줄)
+static int build_index(LeaderboardIndex* index, const int* likes, const int* dislikes, int pledge_count,
+                       const int32_t* board_of, int board_count) {
+    size_t slots = (size_t)(pledge_count > 0 ? pledge_count : 1);
+
+    index->items = malloc(slots * sizeof(int32_t));
+    index->offsets = calloc((size_t)board_count + 1, sizeof(int32_t));
+    index->board_of = malloc(slots * sizeof(int32_t));
+    index->positions = malloc(slots * sizeof(int32_t));
+    index->likes = malloc(slots * sizeof(int32_t));
+    index->dislikes = malloc(slots * sizeof(int32_t));
+    index->locks = malloc((size_t)(board_count > 0 ? board_count : 1) * sizeof(RwLock));
+    if (!index->items || !index->offsets || !index->board_of || !index->positions ||
+        !index->likes || !index->dislikes || !index->locks) {
+        free(index->locks);
+        index->locks = NULL;
+        return 0;
+    }
+    for (int b = 0; b < board_count; b++) {
+        if (!rw_lock_init(&index->locks[b])) {
+            // 초기화된 잠금까지만 해제되도록 보드 수를 줄여 둠
+            index->board_count = b;
+            return 0;
+        }
+    }
+    index->board_count = board_count;
+
+    // 보드별 공약 수 -> 시작 위치
+    for (int i = 0; i < pledge_count; i++) {
+        int b = board_of ? board_of[i] : i % board_count;
+        if (b < 0 || b >= board_count) b = LEADERBOARD_NONE;
+        index->board_of[i] = b;
+        index->positions[i] = LEADERBOARD_NONE;
+        index->likes[i] = likes[i];
+        index->dislikes[i] = dislikes[i];
+        if (b != LEADERBOARD_NONE) index->offsets[b + 1]++;
+    }
+    for (int b = 0; b < board_count; b++) {
+        index->offsets[b + 1] += index->offsets[b];
+    }
+
+    // 공약 배치 (offsets를 채우는 커서로 잠시 빌려 쓴 뒤 되돌림)
+    for (int i = 0; i < pledge_count; i++) {
+        int b = index->board_of[i];
+        if (b == LEADERBOARD_NONE) continue;
+        place(index, index->offsets[b]++, i);
+    }
+    for (int b = board_count; b > 0; b--) {
+        index->offsets[b] = index->offsets[b - 1];
+    }
+    index->offsets[0] = 0;
+
+    for (int b = 0; b < board_count; b++) {
+        heapify_board(index, b);
+    }
+    return 1;
+}
+
+int leaderboard_rebuild(Leaderboard* board, const int* likes, const int* dislikes, int pledge_count,
+                        const int32_t* election_of, int election_count,
+                        const int32_t* category_of, int category_count) {
+    clear_board(board);
+
+    int ok = build_index(&board->kinds[LEADERBOARD_GLOBAL], likes, dislikes, pledge_count,
+                         NULL, LEADERBOARD_GLOBAL_STRIPES) &&
+             build_index(&board->kinds[LEADERBOARD_ELECTION], likes, dislikes, pledge_count,
+                         election_of, election_count) &&
+             build_index(&board->kinds[LEADERBOARD_CATEGORY], likes, dislikes, pledge_count,
+                         category_of, category_count);
+    if (ok) {
+        board->pledge_count = pledge_count;
+    } else {
+        clear_board(board);
+    }
+    return ok;
+}
+
+void leaderboard_resync(Leaderboard* board, const int* likes, const int* dislikes) {
+    for (int k = 0; k < LEADERBOARD_KIND_COUNT; k++) {
+        LeaderboardIndex* index = &board->kinds[k];
+        for (int b = 0; b < index->board_count; b++) {
+            rw_lock_write_lock(&index->locks[b]);
+
+            for (int32_t slot = index->offsets[b]; slot < index->offsets[b + 1]; slot++) {
+                int32_t pledge = index->items[slot];
+                index->likes[pledge] = likes[pledge];
+                index->dislikes[pledge] = dislikes[pledge];
+            }
+            heapify_board(index, b);
+
+            rw_lock_write_unlock(&index->locks[b]);
+        }
+    }
+}
+
+void leaderboard_update(Leaderboard* board, int pledge, int likes, int dislikes) {
+    if (pledge < 0 || pledge >= board->pledge_count) return;
+
+    // 종류마다 공약이 속한 보드 하나만 잠금 (한 번에 하나씩 잡으므로 잠금 순서 문제 없음)
+    for (int k = 0; k < LEADERBOARD_KIND_COUNT; k++) {
+        LeaderboardIndex* index = &board->kinds[k];
+        int b = index->board_of[pledge];
+        if (b == LEADERBOARD_NONE) continue;
+
+        rw_lock_write_lock(&index->locks[b]);
+
+        index->likes[pledge] = likes;
+        index->dislikes[pledge] = dislikes;
+
+        int32_t base = index->offsets[b];
+        int32_t count = index->offsets[b + 1] - base;
+        int32_t relative = index->positions[pledge] - base;
+        if (!sift_up(index, base, relative)) {
+            sift_down(index, base, count, relative);
+        }
+
+        rw_lock_write_unlock(&index->locks[b]);
+    }
+}
+
+// 후보 힙 (items 안의 위치를 순위 순으로 꺼냄, 크기는 꺼낸 수 + 처음 넣은 보드 수를 넘지 않음)
+typedef struct {
+    int32_t slots[LEADERBOARD_MAX_LIMIT + LEADERBOARD_GLOBAL_STRIPES];
+    int count;
+} Frontier;
+
+static void frontier_push(const LeaderboardIndex* index, Frontier* frontier, int32_t slot) {
+    int i = frontier->count++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!ranks_higher(index, index->items[slot], index->items[frontier->slots[parent]])) break;
+        frontier->slots[i] = frontier->slots[parent];
+        i = parent;
+    }
+    frontier->slots[i] = slot;
+}
+
+static int32_t frontier_pop(const LeaderboardIndex* index, Frontier* frontier) {
+    int32_t top = frontier->slots[0];
+    int32_t last = frontier->slots[--frontier->count];
+    int i = 0;
+
+    for (;;) {
+        int child = i * 2 + 1;
+        if (child >= frontier->count) break;
+        if (child + 1 < frontier->count &&
+            ranks_higher(index, index->items[frontier->slots[child + 1]], index->items[frontier->slots[child]])) {
+            child++;
+        }
+        if (!ranks_higher(index, index->items[frontier->slots[child]], index->items[last])) break;
+        frontier->slots[i] = frontier->slots[child];
+        i = child;
+    }
+    if (frontier->count > 0) frontier->slots[i] = last;
+    return top;
+}
+
+int leaderboard_top(Leaderboard* board, LeaderboardKind kind, int board_index, int limit, LeaderboardEntry* entries) {
+    if (kind < 0 || kind >= LEADERBOARD_KIND_COUNT || limit <= 0) return 0;
+    if (limit > LEADERBOARD_MAX_LIMIT) limit = LEADERBOARD_MAX_LIMIT;
+
+    LeaderboardIndex* index = &board->kinds[kind];
+    int first = board_index;
+    int last = board_index + 1;
+
+    // 전체 순위는 보드 0 하나로 보이고 실제로는 모든 줄을 함께 읽음
+    if (kind == LEADERBOARD_GLOBAL) {
+        if (board_index != 0) return 0;
+        first = 0;
+        last = index->board_count;
+    } else if (board_index < 0 || board_index >= index->board_count) {
+        return 0;
+    }
+
+    for (int b = first; b < last; b++) {
+        rw_lock_read_lock(&index->locks[b]);
+    }
+
+    Frontier frontier;
+    frontier.count = 0;
+    for (int b = first; b < last; b++) {
+        if (index->offsets[b + 1] > index->offsets[b]) frontier_push(index, &frontier, index->offsets[b]);
+    }
+
+    // 힙에서 부모는 항상 자식보다 순위가 높으므로 보드마다의 루트부터 후보를 넓혀 가며 꺼내면 순위 순서가 됨
+    int found = 0;
+    while (found < limit && frontier.count > 0) {
+        int32_t slot = frontier_pop(index, &frontier);
+        int32_t pledge = index->items[slot];
+        if (index->likes[pledge] + index->dislikes[pledge] == 0) break;   // 이후는 모두 표가 없는 공약
+
+        entries[found].pledge = pledge;
+        entries[found].likes = index->likes[pledge];
+        entries[found].dislikes = index->dislikes[pledge];
+        found++;
+
+        int b = index->board_of[pledge];
+        int32_t base = index->offsets[b];
+        int32_t count = index->offsets[b + 1] - base;
+        int32_t child = (slot - base) * 2 + 1;
+        if (child < count) frontier_push(index, &frontier, base + child);
+        if (child + 1 < count) frontier_push(index, &frontier, base + child + 1);
+    }
+
+    for (int b = last - 1; b >= first; b--) {
+        rw_lock_read_unlock(&index->locks[b]);
+    }
+    return found;
+}
+
+size_t leaderboard_memory(Leaderboard* board) {
+    // 배열 크기는 다시 만들 때만 바뀌므로 잠금 없이 계산
+    size_t pledges = (size_t)board->pledge_count;
+    size_t bytes = 0;
+    for (int k = 0; k < LEADERBOARD_KIND_COUNT; k++) {
+        size_t boards = (size_t)board->kinds[k].board_count;
+        bytes += pledges * 5 * sizeof(int32_t) + (boards + 1) * sizeof(int32_t) + boards * sizeof(RwLock);
+    }
+    return bytes;
+}
@@ -1,6 +1,15 @@
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "server.h"
 #include "utils.h"
 #include "api.h"
+#include "api_cache.h"
+#include "event_loop.h"
+#include "worker_pool.h"
+#include "evaluation_wal.h"
+#include "delim_scan.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -16,15 +25,78 @@
 // 전역 서버 데이터
 static ServerData g_server_data;
 static int g_server_running = 0;
+static ServerMode g_server_mode = SERVER_MODE_THREAD;
+static int g_reactor_count = DEFAULT_REACTOR_COUNT;
+
+// 워커 풀 (일반 요청용 / 느린 새로고침 요청용)
+static WorkerPool g_worker_pool;
+static WorkerPool g_refresh_pool;
+static int g_worker_pools_ready = 0;
+
+// 평가 카운터 검증 스레드
+#ifdef _WIN32
+static HANDLE g_counter_checker_thread = NULL;
+#else
+static pthread_t g_counter_checker_thread;
+#endif
+static volatile int g_counter_checker_running = 0;
+static int g_counter_check_interval = DEFAULT_COUNTER_CHECK_INTERVAL;
+static CounterCheckStats g_counter_check_stats;
+
+// 평가 WAL (평가 변경은 WAL에 추가만 하고, 전체 상태는 스냅샷으로 저장)
+static EvaluationWal g_evaluation_wal;
+static int g_wal_window_ms = DEFAULT_WAL_WINDOW_MS;
+static int g_wal_batch_records = DEFAULT_WAL_BATCH_RECORDS;
+
+// 평가 스냅샷 스레드
+#ifdef _WIN32
+static HANDLE g_snapshot_thread = NULL;
+#else
+static pthread_t g_snapshot_thread;
+#endif
+static volatile int g_snapshot_running = 0;
+static int g_snapshot_interval = DEFAULT_SNAPSHOT_INTERVAL;
+static SnapshotStats g_snapshot_stats;
+static unsigned long g_evaluation_version = 0;  // 평가 변경 횟수 (샤드 쓰기 잠금 안에서 원자적으로 증가)
+static unsigned long g_snapshot_version = 0;    // 마지막 스냅샷에 반영된 변경 횟수
+
+// API 동시 수집 설정 (동시에 보내 둘 요청 수, 속도 제한은 api.c의 엔드포인트별 토큰 버킷)
+static APIFetchOptions g_api_fetch_options = { API_FETCH_DEFAULT_IN_FLIGHT };
 
 // 함수 선언
 void handle_client_simple(socket_t client_socket);
 
+// 경과 시간 측정 (밀리초)
+static double now_ms(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+#endif
+}
+
+// 현재 데이터 버전 읽기 시작 (잠금 없음, 돌려받은 버전은 release_dataset 전까지 해제되지 않음)
+// 같은 요청 안에서는 처음 받은 버전만 사용 (문자열 핸들과 배열 위치는 버전마다 다름)
+static DatasetVersion* acquire_dataset(int* token) {
+    *token = epoch_enter(&g_server_data.dataset_epoch);
+    return __atomic_load_n(&g_server_data.dataset, __ATOMIC_ACQUIRE);
+}
+
+static void release_dataset(int token) {
+    epoch_exit(&g_server_data.dataset_epoch, token);
+}
+
 // 데이터 파일 경로
 #define ELECTIONS_FILE "data/elections.txt"
 #define CANDIDATES_FILE "data/candidates.txt"
 #define PLEDGES_FILE "data/pledges.txt"
 #define UPDATE_TIME_FILE "data/last_update.txt"
+#define EVALUATIONS_FILE "data/evaluations.txt"            // 예전 텍스트 형식 (스냅샷이 없을 때만 읽음)
 
 // 신호 처리
 void signal_handler(int signal) {
@@ -43,21 +115,16 @@ int init_server(void) {
     
     // 뮤텍스 초기화
 #ifdef _WIN32
-    InitializeCriticalSection(&g_server_data.data_mutex);
     InitializeCriticalSection(&g_server_data.client_mutex);
 #else
-    if (pthread_mutex_init(&g_server_data.data_mutex, NULL) != 0) {
-        write_error_log("init_server", "Failed to initialize data mutex");
-        return 0;
-    }
-    
     if (pthread_mutex_init(&g_server_data.client_mutex, NULL) != 0) {
         write_error_log("init_server", "Failed to initialize client mutex");
-        pthread_mutex_destroy(&g_server_data.data_mutex);
         return 0;
     }
 #endif
     
+    epoch_init(&g_server_data.dataset_epoch);
+    
     // Windows 소켓 초기화
 #ifdef _WIN32
     WSADATA wsaData;
@@ -101,28 +168,47 @@ int init_server(void) {
         printf("✅ 사용자 데이터 %d개 로드 완료\n", g_server_data.user_count);
     }
     
-    // 기존 데이터 로드
-    printf("📊 기존 데이터 로드 중...\n");
-    g_server_data.election_count = load_elections_from_file(g_server_data.elections, MAX_ELECTIONS);
-    printf("   선거 정보: %d개\n", g_server_data.election_count);
-    
-    g_server_data.candidate_count = load_candidates_from_file(g_server_data.candidates, MAX_CANDIDATES);
-    printf("   후보자 정보: %d개\n", g_server_data.candidate_count);
+    // 평가 저장소 생성 (평가 수 제한 없음, 공약 카운터 계산에 쓰이므로 데이터보다 먼저 준비)
+    if (!evaluation_shards_init(&g_server_data.evaluations)) {
+        write_error_log("init_server", "Failed to allocate evaluation store");
+        return 0;
+    }
     
-    g_server_data.pledge_count = load_pledges_from_file(g_server_data.pledges, MAX_PLEDGES);
-    printf("   공약 정보: %d개\n", g_server_data.pledge_count);
+    // 기존 데이터 로드 (공약 ID 인덱스 포함)
+    printf("📊 기존 데이터 로드 중...\n");
+    g_server_data.dataset = load_dataset_version();
+    if (!g_server_data.dataset) {
+        write_error_log("init_server", "Failed to load dataset");
+        return 0;
+    }
+    g_server_data.dataset->number = 1;
+    printf("   선거 정보: %d개\n", g_server_data.dataset->election_count);
+    printf("   후보자 정보: %d개\n", g_server_data.dataset->candidate_count);
+    printf("   공약 정보: %d개\n", g_server_data.dataset->pledges.count);
     
     // 평가 데이터 로드
     printf("📈 평가 데이터 로드 중...\n");
-    int eval_count = load_evaluations_from_file();
+    int reset_wal = 0;
+    int eval_count = load_evaluations_from_file(&reset_wal);
+    if (eval_count < 0) {
+        write_error_log("init_server", "Failed to load evaluations");
+        return 0;
+    }
     printf("   평가 데이터: %d개\n", eval_count);
     
-    // 모든 공약의 통계 업데이트
-    printf("🔄 공약 통계 초기화 중...\n");
-    for (int i = 0; i < g_server_data.pledge_count; i++) {
-        update_pledge_statistics(g_server_data.pledges[i].pledge_id);
+    // 스냅샷 이후 변경이 있었으면 새 스냅샷을 저장한 뒤 로그를 비움
+    if (reset_wal) {
+        if (!save_evaluations_to_file()) {
+            write_error_log("init_server", "Failed to write evaluation snapshot");
+            return 0;
+        }
+        remove(EVALUATION_WAL_ARCHIVE_FILE);
+    }
+    if (!evaluation_wal_open(&g_evaluation_wal, EVALUATION_WAL_FILE, reset_wal,
+                             g_wal_window_ms, g_wal_batch_records)) {
+        write_error_log("init_server", "Failed to open evaluation WAL");
+        return 0;
     }
-    printf("✅ 공약 통계 초기화 완료\n");
     
     write_log("INFO", "Server initialized successfully");
     return 1;
@@ -141,9 +227,8 @@ DWORD WINAPI handle_client_thread(LPVOID param) {
     
     handle_client_simple(data->client_socket);
     
+    // 클라이언트 소켓은 handle_client_simple()에서 닫음
     printf("🧵 스레드 종료: 클라이언트 %d\n", data->client_id);
-    // 클라이언트 소켓 정리
-    closesocket(data->client_socket);
     free(data);
     return 0;
 }
@@ -154,233 +239,48 @@ void* handle_client_thread(void* param) {
     
     handle_client_simple(data->client_socket);
     
+    // 클라이언트 소켓은 handle_client_simple()에서 닫음
     printf("🧵 스레드 종료: 클라이언트 %d\n", data->client_id);
-    // 클라이언트 소켓 정리
-    close(data->client_socket);
     free(data);
     return NULL;
 }
 #endif
 
-// NetworkMessage 기반 클라이언트 처리
+// 프레임 기반 클라이언트 처리 (구버전 NetworkMessage 구조체도 자동 인식)
 void handle_client_simple(socket_t client_socket) {
-    NetworkMessage request, response;
-    int bytes_received;
+    FrameReader reader;
+    Frame request, response;
     
     write_log("INFO", "Client connected");
     printf("✅ 클라이언트가 연결되었습니다!\n");
     
+    frame_reader_init(&reader);
+    
     while (g_server_running) {
-        // NetworkMessage 구조체로 요청 수신
-        memset(&request, 0, sizeof(NetworkMessage));
-        bytes_received = recv(client_socket, (char*)&request, sizeof(NetworkMessage), 0);
-        
-        if (bytes_received <= 0) {
+        // 프레임 하나가 완성될 때까지 수신 (부분 수신은 reader가 모아 둠)
+        int result = frame_receive(client_socket, &reader, &request);
+        if (result == 0) {
             printf("📤 클라이언트 연결이 종료되었습니다.\n");
             break;
         }
-        
-        if (bytes_received != sizeof(NetworkMessage)) {
-            printf("⚠️  잘못된 메시지 크기: %d bytes (예상: %zu bytes)\n", 
-                   bytes_received, sizeof(NetworkMessage));
-            continue;
+        if (result < 0) {
+            printf("⚠️  잘못된 메시지 형식으로 연결을 종료합니다.\n");
+            break;
         }
         
-        printf("📨 메시지 수신: 타입=%d, 사용자=%s\n", 
-               request.message_type, request.user_id);
+        printf("📨 메시지 수신: 타입=%d, 사용자=%s, 크기=%zu bytes%s\n", 
+               request.message_type, request.user_id, request.payload_length,
+               reader.mode == FRAME_MODE_LEGACY ? " (구버전)" : "");
         
-        // 응답 메시지 초기화
-        memset(&response, 0, sizeof(NetworkMessage));
-        
-        // 메시지 타입에 따른 처리
-        switch (request.message_type) {
-            case MSG_LOGIN_REQUEST:
-                handle_login_request(&request, &response);
-                break;
-                
-            case MSG_LOGOUT_REQUEST:
-                handle_logout_request(&request, &response);
-                break;
-                
-            case MSG_GET_ELECTIONS:
-                handle_get_elections_request(&response);
-                break;
-                
-            case MSG_GET_CANDIDATES:
-                // 새로고침 명령 확인
-                if (strcmp(request.data, "refresh_candidates") == 0) {
-                    printf("🔄 후보자 정보 새로고침 요청 수신\n");
-                    
-                    // API 데이터 수집 실행
-                    response.message_type = MSG_SUCCESS;
-                    printf("🔄 API 데이터 수집을 시작합니다...\n");
-                    
-                    if (collect_api_data()) {
-                        response.status_code = STATUS_SUCCESS;
-                        strcpy(response.data, "후보자 정보 새로고침 완료");
-                        response.data_length = strlen(response.data);
-                        printf("✅ 후보자 정보 새로고침 성공\n");
-                    } else {
-                        response.status_code = STATUS_INTERNAL_ERROR;
-                        strcpy(response.data, "후보자 정보 새로고침 실패");
-                        response.data_length = strlen(response.data);
-                        printf("❌ 후보자 정보 새로고침 실패\n");
-                    }
-                } else {
-                    // 일반적인 후보자 조회 요청
-                    handle_get_candidates_request(request.data, &response);
-                }
-                break;
-                
-            case MSG_GET_PLEDGES:
-                // request.data에서 candidate_id 추출 필요
-                handle_get_pledges_request("", &response);
-                break;
-                
-            case MSG_REFRESH_ELECTIONS:
-                printf("🔄 선거 정보 새로고침 요청 수신\n");
-                response.message_type = MSG_SUCCESS;
-                
-                if (collect_elections_only()) {
-                    response.status_code = STATUS_SUCCESS;
-                    strcpy(response.data, "선거 정보 새로고침 완료");
-                    response.data_length = strlen(response.data);
-                    printf("✅ 선거 정보 새로고침 성공\n");
-                } else {
-                response.status_code = STATUS_INTERNAL_ERROR;
-                    strcpy(response.data, "선거 정보 새로고침 실패");
-                    response.data_length = strlen(response.data);
-                    printf("❌ 선거 정보 새로고침 실패\n");
-                }
-                break;
-                
-            case MSG_REFRESH_CANDIDATES:
-                printf("🔄 후보자 정보 새로고침 요청 수신\n");
-                response.message_type = MSG_SUCCESS;
-                
-                if (collect_candidates_only()) {
-                response.status_code = STATUS_SUCCESS;
-                    strcpy(response.data, "후보자 정보 새로고침 완료");
-                    response.data_length = strlen(response.data);
-                    printf("✅ 후보자 정보 새로고침 성공\n");
-                } else {
-                    response.status_code = STATUS_INTERNAL_ERROR;
-                    strcpy(response.data, "후보자 정보 새로고침 실패");
-                    response.data_length = strlen(response.data);
-                    printf("❌ 후보자 정보 새로고침 실패\n");
-                }
-                break;
-                
-            case MSG_REFRESH_PLEDGES:
-                printf("🔄 공약 정보 새로고침 요청 수신\n");
-                response.message_type = MSG_SUCCESS;
-                
-                if (collect_pledges_only()) {
-                    response.status_code = STATUS_SUCCESS;
-                    strcpy(response.data, "공약 정보 새로고침 완료");
-                    response.data_length = strlen(response.data);
-                    printf("✅ 공약 정보 새로고침 성공\n");
-                } else {
-                    response.status_code = STATUS_INTERNAL_ERROR;
-                    strcpy(response.data, "공약 정보 새로고침 실패");
-                    response.data_length = strlen(response.data);
-                    printf("❌ 공약 정보 새로고침 실패\n");
-                }
-                break;
-                
-            case MSG_REFRESH_ALL:
-                printf("🔄 전체 데이터 새로고침 요청 수신\n");
-                response.message_type = MSG_SUCCESS;
-                
-                if (collect_api_data()) {
-                    response.status_code = STATUS_SUCCESS;
-                    strcpy(response.data, "전체 데이터 새로고침 완료");
-                    response.data_length = strlen(response.data);
-                    printf("✅ 전체 데이터 새로고침 성공\n");
-                } else {
-                    response.status_code = STATUS_INTERNAL_ERROR;
-                    strcpy(response.data, "전체 데이터 새로고침 실패");
-                    response.data_length = strlen(response.data);
-                    printf("❌ 전체 데이터 새로고침 실패\n");
-                }
-                break;
-                
-            case MSG_EVALUATE_PLEDGE:
-                {
-                    // 평가 요청 처리
-                    // data 형식: "pledge_id|evaluation_type" (예: "100120965_1|1")
-                    char pledge_id[MAX_STRING_LEN];
-                    int evaluation_type = 0;
-                    
-                    if (sscanf(request.data, "%255[^|]|%d", pledge_id, &evaluation_type) == 2) {
-                        handle_evaluate_pledge_request(request.user_id, pledge_id, evaluation_type, &response);
-                    } else {
-                        response.message_type = MSG_ERROR;
-                        response.status_code = STATUS_BAD_REQUEST;
-                        strcpy(response.data, "평가 데이터 형식이 올바르지 않습니다 (형식: pledge_id|evaluation_type)");
-                    }
-                }
-                break;
-                
-            case MSG_CANCEL_EVALUATION:
-                {
-                    // 평가 취소 요청 처리
-                    // data 형식: "pledge_id" (예: "100120965_1")
-                    char pledge_id[MAX_STRING_LEN];
-                    
-                    if (sscanf(request.data, "%255s", pledge_id) == 1) {
-                        handle_cancel_evaluation_request(request.user_id, pledge_id, &response);
-                    } else {
-                        response.message_type = MSG_ERROR;
-                        response.status_code = STATUS_BAD_REQUEST;
-                        strcpy(response.data, "공약 ID가 올바르지 않습니다");
-                    }
-                }
-                break;
-                
-            case MSG_GET_USER_EVALUATION:
-                {
-                    // 사용자 평가 조회 요청 처리
-                    // data 형식: "pledge_id" (예: "100120965_1")
-                    char pledge_id[MAX_STRING_LEN];
-                    
-                    if (sscanf(request.data, "%255s", pledge_id) == 1) {
-                        handle_get_user_evaluation_request(request.user_id, pledge_id, &response);
-                    } else {
-                        response.message_type = MSG_ERROR;
-                        response.status_code = STATUS_BAD_REQUEST;
-                        strcpy(response.data, "공약 ID가 올바르지 않습니다");
-                    }
-                }
-                break;
-                
-            case MSG_GET_STATISTICS:
-                {
-                    // 통계 요청 처리
-                    // data 형식: "pledge_id" (예: "100120965_1")
-                    char pledge_id[MAX_STRING_LEN];
-                    
-                    if (sscanf(request.data, "%255s", pledge_id) == 1) {
-                        handle_get_statistics_request(pledge_id, &response);
-                    } else {
-                        response.message_type = MSG_ERROR;
-                        response.status_code = STATUS_BAD_REQUEST;
-                        strcpy(response.data, "공약 ID가 올바르지 않습니다");
-                    }
-                }
-                break;
-                
-            default:
-                printf("❌ 알 수 없는 메시지 타입: %d\n", request.message_type);
-                response.message_type = MSG_ERROR;
-                response.status_code = STATUS_BAD_REQUEST;
-                strcpy(response.data, "지원하지 않는 메시지 타입입니다");
-                break;
-        }
+        // 워커 풀에서 처리하고 완료될 때까지 대기
+        frame_init(&response);
+        execute_client_request(&request, &response);
+        frame_free(&request);
         
-        // 응답 전송
-        int bytes_sent = send(client_socket, (char*)&response, sizeof(NetworkMessage), 0);
-        if (bytes_sent <= 0) {
+        // 요청과 같은 방식으로 응답 전송
+        int sent = frame_send(client_socket, &response, reader.mode);
+        frame_free(&response);
+        if (!sent) {
             printf("❌ 응답 전송 실패\n");
             break;
         }
@@ -389,6 +289,8 @@ void handle_client_simple(socket_t client_socket) {
                response.message_type, response.status_code);
     }
     
+    frame_reader_free(&reader);
+    
 #ifdef _WIN32
     closesocket(client_socket);
 #else
@@ -398,6 +300,528 @@ void handle_client_simple(socket_t client_socket) {
     write_log("INFO", "Client disconnected");
 }
 
+// 워커 풀 생성
+int init_worker_pools(int worker_threads, int refresh_threads) {
+    if (!worker_pool_init(&g_worker_pool, "일반", worker_threads, DEFAULT_WORKER_QUEUE_SIZE)) {
+        return 0;
+    }
+    if (!worker_pool_init(&g_refresh_pool, "새로고침", refresh_threads, DEFAULT_REFRESH_QUEUE_SIZE)) {
+        worker_pool_shutdown(&g_worker_pool);
+        return 0;
+    }
+    
+    g_worker_pools_ready = 1;
+    return 1;
+}
+
+// 워커 풀 종료 (남은 작업 처리 후 종료)
+void shutdown_worker_pools(void) {
+    if (!g_worker_pools_ready) return;
+    
+    print_server_status();
+    worker_pool_shutdown(&g_refresh_pool);
+    worker_pool_shutdown(&g_worker_pool);
+    g_worker_pools_ready = 0;
+}
+
+// API 수집처럼 오래 걸리는 요청인지 확인
+int is_refresh_request(const Frame* request) {
+    switch (request->message_type) {
+        case MSG_REFRESH_ELECTIONS:
+        case MSG_REFRESH_CANDIDATES:
+        case MSG_REFRESH_PLEDGES:
+        case MSG_REFRESH_ALL:
+        case MSG_REFRESH_INCREMENTAL:
+            return 1;
+        case MSG_GET_CANDIDATES:
+            // 구버전 클라이언트의 전체 새로고침 명령
+            return request->payload && strcmp(request->payload, "refresh_candidates") == 0;
+        default:
+            return 0;
+    }
+}
+
+// 워커에서 실행되는 작업 본체
+static void run_client_job(void* arg) {
+    ClientJob* job = (ClientJob*)arg;
+    
+    frame_init(&job->response);
+    process_frame_request(&job->request, &job->response);
+    
+    if (job->on_complete) {
+        job->on_complete(job);
+    }
+}
+
+// 요청 종류에 맞는 풀에 작업 제출 (큐가 가득 차면 0 반환)
+int submit_client_job(ClientJob* job) {
+    if (!g_worker_pools_ready) return 0;
+    
+    WorkerPool* pool = is_refresh_request(&job->request) ? &g_refresh_pool : &g_worker_pool;
+    return worker_pool_submit(pool, run_client_job, job);
+}
+
+// 큐가 가득 찬 경우의 응답
+void fill_server_busy_response(Frame* response) {
+    const char* message = "서버가 혼잡합니다. 잠시 후 다시 시도하세요";
+    
+    frame_free(response);
+    frame_init(response);
+    response->message_type = MSG_ERROR;
+    response->status_code = STATUS_SERVICE_UNAVAILABLE;
+    frame_set_payload(response, message, strlen(message));
+}
+
+// 스레드 모드: 작업 완료 통지
+static void signal_job_complete(ClientJob* job) {
+    worker_semaphore_post((WorkerSemaphore*)job->context);
+}
+
+// 스레드 모드: 워커 풀에 요청을 넘기고 완료될 때까지 대기
+// (응답 payload의 소유권은 response로 넘어감)
+void execute_client_request(Frame* request, Frame* response) {
+    ClientJob job;
+    WorkerSemaphore done;
+    
+    if (!worker_semaphore_init(&done, 0)) {
+        fill_server_busy_response(response);
+        return;
+    }
+    
+    job.request = *request;
+    frame_init(&job.response);
+    job.on_complete = signal_job_complete;
+    job.context = &done;
+    job.next = NULL;
+    
+    if (submit_client_job(&job)) {
+        worker_semaphore_wait(&done);
+        *response = job.response;
+    } else {
+        fill_server_busy_response(response);
+    }
+    
+    worker_semaphore_destroy(&done);
+}
+
+// 평가 카운터 검증 상태 한 줄 요약
+static void format_counter_check_stats(char* buffer, size_t size) {
+    long runs = __atomic_load_n(&g_counter_check_stats.runs, __ATOMIC_RELAXED);
+    long mismatches = __atomic_load_n(&g_counter_check_stats.mismatches, __ATOMIC_RELAXED);
+    int last_checked = __atomic_load_n(&g_counter_check_stats.last_checked, __ATOMIC_RELAXED);
+    int last_mismatches = __atomic_load_n(&g_counter_check_stats.last_mismatches, __ATOMIC_RELAXED);
+    time_t last_run = __atomic_load_n(&g_counter_check_stats.last_run, __ATOMIC_RELAXED);
+    
+    snprintf(buffer, size, "[카운터 검증] interval=%ds runs=%ld mismatches=%ld last_checked=%d last_mismatches=%d last_age=%lds",
+             g_counter_check_interval, runs, mismatches, last_checked, last_mismatches,
+             last_run ? (long)(time(NULL) - last_run) : -1L);
+}
+
+// 평가 스냅샷 상태 한 줄 요약
+static void format_snapshot_stats(char* buffer, size_t size) {
+    long snapshots = __atomic_load_n(&g_snapshot_stats.snapshots, __ATOMIC_RELAXED);
+    long failures = __atomic_load_n(&g_snapshot_stats.failures, __ATOMIC_RELAXED);
+    int last_records = __atomic_load_n(&g_snapshot_stats.last_records, __ATOMIC_RELAXED);
+    long last_bytes = __atomic_load_n(&g_snapshot_stats.last_bytes, __ATOMIC_RELAXED);
+    long capture_us = __atomic_load_n(&g_snapshot_stats.last_capture_us, __ATOMIC_RELAXED);
+    long write_us = __atomic_load_n(&g_snapshot_stats.last_write_us, __ATOMIC_RELAXED);
+    time_t last_time = __atomic_load_n(&g_snapshot_stats.last_time, __ATOMIC_RELAXED);
+    
+    snprintf(buffer, size, "[스냅샷] interval=%ds snapshots=%ld failures=%ld last_records=%d last_bytes=%ld "
+             "capture=%.2fms write=%.2fms last_age=%lds",
+             g_snapshot_interval, snapshots, failures, last_records, last_bytes,
+             capture_us / 1000.0, write_us / 1000.0,
+             last_time ? (long)(time(NULL) - last_time) : -1L);
+}
+
+// API 호출 속도 제한 한 줄 요약 (엔드포인트별 초당 요청 수/버스트, 가져간 토큰 수, 토큰 대기 시간 합계)
+static void format_api_rate_stats(char* buffer, size_t size) {
+    int offset = snprintf(buffer, size, "[API 속도]");
+    for (int i = 0; i < API_ENDPOINT_COUNT && offset < (int)size; i++) {
+        TokenBucket limit;
+        api_get_rate_limit((APIEndpoint)i, &limit);
+        offset += snprintf(buffer + offset, size - offset, " %s=%.1f/s burst=%.0f calls=%lu waited=%.0fms",
+                           api_endpoint_name((APIEndpoint)i), limit.rate, limit.burst,
+                           limit.acquired, limit.waited_ms);
+    }
+}
+
+// API 응답 캐시 한 줄 요약 (엔드포인트별 TTL, 요청 없이 쓴 수/304 수/새로 저장한 수, 다시 받지 않은 바이트)
+static void format_api_cache_stats(char* buffer, size_t size) {
+    if (!api_cache_enabled()) {
+        snprintf(buffer, size, "[API 캐시] off");
+        return;
+    }
+    
+    APICacheStats stats;
+    api_cache_get_stats(&stats);
+    int offset = snprintf(buffer, size, "[API 캐시] ttl");
+    for (int i = 0; i < API_ENDPOINT_COUNT && offset < (int)size; i++) {
+        offset += snprintf(buffer + offset, size - offset, " %s=%lds",
+                           api_endpoint_name((APIEndpoint)i), api_cache_get_ttl((APIEndpoint)i));
+    }
+    if (offset < (int)size) {
+        snprintf(buffer + offset, size - offset, " hits=%lu revalidated=%lu misses=%lu stored=%lu stale=%lu saved=%.1fKB",
+                 stats.hits, stats.revalidated, stats.misses, stats.stored, stats.stale_served,
+                 stats.bytes_saved / 1024.0);
+    }
+}
+
+// 데이터 표 용량 한 줄 요약 (개수/할당 칸 수, 표는 새로고침마다 파일 줄 수에 맞춰 새로 할당)
+static void format_capacity_stats(char* buffer, size_t size) {
+    int token;
+    DatasetVersion* dataset = acquire_dataset(&token);
+    
+    if (dataset) {
+        snprintf(buffer, size, "[용량] version=%lu elections=%d/%d candidates=%d/%d pledges=%d/%d strings=%u "
+                 "dataset=%.1fKB evaluations=%d evaluation_memory=%.1fKB users=%d/%d",
+                 dataset->number, dataset->election_count, dataset->election_capacity,
+                 dataset->candidate_count, dataset->candidate_capacity,
+                 dataset->pledges.count, dataset->pledges.capacity, dataset->strings.count,
+                 dataset_version_memory(dataset) / 1024.0,
+                 evaluation_shards_count(&g_server_data.evaluations),
+                 evaluation_shards_memory(&g_server_data.evaluations) / 1024.0,
+                 g_server_data.user_count, MAX_USERS);
+    } else {
+        snprintf(buffer, size, "[용량] 데이터 없음");
+    }
+    
+    release_dataset(token);
+}
+
+// 서버 상태 출력
+void print_server_status(void) {
+    WorkerPoolStats stats;
+    char line[MAX_CONTENT_LEN];
+    
+    print_separator();
+    printf("📊 서버 상태 (%s 모드)\n", g_server_mode == SERVER_MODE_EPOLL ? "epoll" : "스레드");
+    if (g_worker_pools_ready) {
+        worker_pool_get_stats(&g_worker_pool, &stats);
+        worker_pool_format_stats(&stats, line, sizeof(line));
+        printf("   %s\n", line);
+        
+        worker_pool_get_stats(&g_refresh_pool, &stats);
+        worker_pool_format_stats(&stats, line, sizeof(line));
+        printf("   %s\n", line);
+    }
+    format_counter_check_stats(line, sizeof(line));
+    printf("   %s\n", line);
+    
+    EvaluationWalStats wal_stats;
+    evaluation_wal_get_stats(&g_evaluation_wal, &wal_stats);
+    evaluation_wal_format_stats(&wal_stats, line, sizeof(line));
+    printf("   %s\n", line);
+    
+    format_snapshot_stats(line, sizeof(line));
+    printf("   %s\n", line);
+    
+    format_api_rate_stats(line, sizeof(line));
+    printf("   %s\n", line);
+    
+    format_api_cache_stats(line, sizeof(line));
+    printf("   %s\n", line);
+    
+    format_capacity_stats(line, sizeof(line));
+    printf("   %s\n", line);
+    print_separator();
+}
+
+// 서버 상태 조회 요청 처리
+void handle_get_server_status_request(NetworkMessage* response) {
+    WorkerPoolStats stats;
+    char line[MAX_CONTENT_LEN];
+    int offset;
+    
+    response->message_type = MSG_SUCCESS;
+    response->status_code = STATUS_SUCCESS;
+    
+    offset = snprintf(response->data, MAX_CONTENT_LEN, "mode=%s\n",
+                      g_server_mode == SERVER_MODE_EPOLL ? "epoll" : "thread");
+    
+    WorkerPool* pools[2] = { &g_worker_pool, &g_refresh_pool };
+    for (int i = 0; i < 2 && g_worker_pools_ready; i++) {
+        worker_pool_get_stats(pools[i], &stats);
+        worker_pool_format_stats(&stats, line, sizeof(line));
+        if (offset < MAX_CONTENT_LEN) {
+            offset += snprintf(response->data + offset, MAX_CONTENT_LEN - offset, "%s\n", line);
+        }
+    }
+    
+    format_counter_check_stats(line, sizeof(line));
+    if (offset < MAX_CONTENT_LEN) {
+        offset += snprintf(response->data + offset, MAX_CONTENT_LEN - offset, "%s\n", line);
+    }
+    
+    EvaluationWalStats wal_stats;
+    evaluation_wal_get_stats(&g_evaluation_wal, &wal_stats);
+    evaluation_wal_format_stats(&wal_stats, line, sizeof(line));
+    if (offset < MAX_CONTENT_LEN) {
+        offset += snprintf(response->data + offset, MAX_CONTENT_LEN - offset, "%s\n", line);
+    }
+    
+    format_snapshot_stats(line, sizeof(line));
+    if (offset < MAX_CONTENT_LEN) {
+        offset += snprintf(response->data + offset, MAX_CONTENT_LEN - offset, "%s\n", line);
+    }
+    
+    format_api_rate_stats(line, sizeof(line));
+    if (offset < MAX_CONTENT_LEN) {
+        offset += snprintf(response->data + offset, MAX_CONTENT_LEN - offset, "%s\n", line);
+    }
+    
+    format_api_cache_stats(line, sizeof(line));
+    if (offset < MAX_CONTENT_LEN) {
+        offset += snprintf(response->data + offset, MAX_CONTENT_LEN - offset, "%s\n", line);
+    }
+    
+    format_capacity_stats(line, sizeof(line));
+    if (offset < MAX_CONTENT_LEN) {
+        snprintf(response->data + offset, MAX_CONTENT_LEN - offset, "%s\n", line);
+    }
+    
+    response->data_length = strlen(response->data);
+}
+
+// 프레임 요청 처리
+// 기존 핸들러는 NetworkMessage 기반이므로 변환해서 호출
+void process_frame_request(Frame* request, Frame* response) {
+    NetworkMessage legacy_request, legacy_response;
+    
+    // 응답이 MAX_CONTENT_LEN을 넘을 수 있는 요청은 프레임으로 직접 처리
+    switch (request->message_type) {
+        case MSG_GET_ELECTIONS:
+            handle_get_elections_request(request, response);
+            return;
+        case MSG_GET_CANDIDATES:
+            // 구버전 클라이언트의 전체 새로고침 명령은 아래 기존 경로로 처리
+            if (request->payload && strcmp(request->payload, "refresh_candidates") == 0) break;
+            handle_get_candidates_request(request, response);
+            return;
+        case MSG_GET_PLEDGES:
+            handle_get_pledges_request(request, response);
+            return;
+        case MSG_GET_STATISTICS_BATCH:
+            handle_get_statistics_batch_request(request, response);
+            return;
+        case MSG_GET_LEADERBOARD:
+            handle_get_leaderboard_request(request, response);
+            return;
+        case MSG_GET_STANDINGS:
+            handle_get_standings_request(request, response);
+            return;
+        default:
+            break;
+    }
+    
+    frame_to_message(request, &legacy_request);
+    memset(&legacy_response, 0, sizeof(NetworkMessage));
+    
+    process_client_message(NULL, &legacy_request, &legacy_response);
+    
+    frame_free(response);
+    if (!frame_from_message(&legacy_response, response)) {
+        write_error_log("process_frame_request", "응답 메모리 할당 실패");
+    }
+}
+
+// 메시지 타입별 요청 처리 (스레드 모드와 이벤트 루프 모드가 공유)
+void process_client_message(ClientSession* session, NetworkMessage* request, NetworkMessage* response) {
+    (void)session;  // 세션 정보는 아직 사용하지 않음
+    
+    // 메시지 타입에 따른 처리
+    switch (request->message_type) {
+        case MSG_LOGIN_REQUEST:
+            handle_login_request(request, response);
+            break;
+            
+        case MSG_LOGOUT_REQUEST:
+            handle_logout_request(request, response);
+            break;
+            
+        case MSG_GET_CANDIDATES:
+            // 후보자/선거/공약 목록 조회는 process_frame_request가 프레임으로 직접 처리하고,
+            // 여기로는 구버전 클라이언트의 전체 새로고침 명령("refresh_candidates")만 들어옴
+            printf("🔄 후보자 정보 새로고침 요청 수신\n");
+            
+            // API 데이터 수집 실행
+            response->message_type = MSG_SUCCESS;
+            printf("🔄 API 데이터 수집을 시작합니다...\n");
+            
+            if (collect_api_data()) {
+                response->status_code = STATUS_SUCCESS;
+                strcpy(response->data, "후보자 정보 새로고침 완료");
+                response->data_length = strlen(response->data);
+                printf("✅ 후보자 정보 새로고침 성공\n");
+            } else {
+                response->status_code = STATUS_INTERNAL_ERROR;
+                strcpy(response->data, "후보자 정보 새로고침 실패");
+                response->data_length = strlen(response->data);
+                printf("❌ 후보자 정보 새로고침 실패\n");
+            }
+            break;
+            
+        case MSG_REFRESH_ELECTIONS:
+            printf("🔄 선거 정보 새로고침 요청 수신\n");
+            response->message_type = MSG_SUCCESS;
+            
+            if (collect_elections_only()) {
+                response->status_code = STATUS_SUCCESS;
+                strcpy(response->data, "선거 정보 새로고침 완료");
+                response->data_length = strlen(response->data);
+                printf("✅ 선거 정보 새로고침 성공\n");
+            } else {
+            response->status_code = STATUS_INTERNAL_ERROR;
+                strcpy(response->data, "선거 정보 새로고침 실패");
+                response->data_length = strlen(response->data);
+                printf("❌ 선거 정보 새로고침 실패\n");
+            }
+            break;
+            
+        case MSG_REFRESH_CANDIDATES:
+            printf("🔄 후보자 정보 새로고침 요청 수신\n");
+            response->message_type = MSG_SUCCESS;
+            
+            if (collect_candidates_only()) {
+            response->status_code = STATUS_SUCCESS;
+                strcpy(response->data, "후보자 정보 새로고침 완료");
+                response->data_length = strlen(response->data);
+                printf("✅ 후보자 정보 새로고침 성공\n");
+            } else {
+                response->status_code = STATUS_INTERNAL_ERROR;
+                strcpy(response->data, "후보자 정보 새로고침 실패");
+                response->data_length = strlen(response->data);
+                printf("❌ 후보자 정보 새로고침 실패\n");
+            }
+            break;
+            
+        case MSG_REFRESH_PLEDGES:
+            printf("🔄 공약 정보 새로고침 요청 수신\n");
+            response->message_type = MSG_SUCCESS;
+            
+            if (collect_pledges_only()) {
+                response->status_code = STATUS_SUCCESS;
+                strcpy(response->data, "공약 정보 새로고침 완료");
+                response->data_length = strlen(response->data);
+                printf("✅ 공약 정보 새로고침 성공\n");
+            } else {
+                response->status_code = STATUS_INTERNAL_ERROR;
+                strcpy(response->data, "공약 정보 새로고침 실패");
+                response->data_length = strlen(response->data);
+                printf("❌ 공약 정보 새로고침 실패\n");
+            }
+            break;
+            
+        case MSG_REFRESH_ALL:
+            printf("🔄 전체 데이터 새로고침 요청 수신\n");
+            response->message_type = MSG_SUCCESS;
+            
+            if (collect_api_data()) {
+                response->status_code = STATUS_SUCCESS;
+                strcpy(response->data, "전체 데이터 새로고침 완료");
+                response->data_length = strlen(response->data);
+                printf("✅ 전체 데이터 새로고침 성공\n");
+            } else {
+                response->status_code = STATUS_INTERNAL_ERROR;
+                strcpy(response->data, "전체 데이터 새로고침 실패");
+                response->data_length = strlen(response->data);
+                printf("❌ 전체 데이터 새로고침 실패\n");
+            }
+            break;
+            
+        case MSG_REFRESH_INCREMENTAL:
+            printf("🔄 증분 새로고침 요청 수신\n");
+            response->message_type = MSG_SUCCESS;
+            
+            if (collect_api_data_incremental(response->data, sizeof(response->data))) {
+                response->status_code = STATUS_SUCCESS;
+                printf("✅ 증분 새로고침 성공\n");
+            } else {
+                response->status_code = STATUS_INTERNAL_ERROR;
+                printf("❌ 증분 새로고침 실패\n");
+            }
+            response->data_length = strlen(response->data);
+            break;
+            
+        case MSG_EVALUATE_PLEDGE:
+            {
+                // 평가 요청 처리
+                // data 형식: "pledge_id|evaluation_type" (예: "100120965_1|1")
+                char pledge_id[MAX_STRING_LEN];
+                int evaluation_type = 0;
+                
+                if (sscanf(request->data, "%255[^|]|%d", pledge_id, &evaluation_type) == 2) {
+                    handle_evaluate_pledge_request(request->user_id, pledge_id, evaluation_type, response);
+                } else {
+                    response->message_type = MSG_ERROR;
+                    response->status_code = STATUS_BAD_REQUEST;
+                    strcpy(response->data, "평가 데이터 형식이 올바르지 않습니다 (형식: pledge_id|evaluation_type)");
+                }
+            }
+            break;
+            
+        case MSG_CANCEL_EVALUATION:
+            {
+                // 평가 취소 요청 처리
+                // data 형식: "pledge_id" (예: "100120965_1")
+                char pledge_id[MAX_STRING_LEN];
+                
+                if (sscanf(request->data, "%255s", pledge_id) == 1) {
+                    handle_cancel_evaluation_request(request->user_id, pledge_id, response);
+                } else {
+                    response->message_type = MSG_ERROR;
+                    response->status_code = STATUS_BAD_REQUEST;
+                    strcpy(response->data, "공약 ID가 올바르지 않습니다");
+                }
+            }
+            break;
+            
+        case MSG_GET_USER_EVALUATION:
+            {
+                // 사용자 평가 조회 요청 처리
+                // data 형식: "pledge_id" (예: "100120965_1")
+                char pledge_id[MAX_STRING_LEN];
+                
+                if (sscanf(request->data, "%255s", pledge_id) == 1) {
+                    handle_get_user_evaluation_request(request->user_id, pledge_id, response);
+                } else {
+                    response->message_type = MSG_ERROR;
+                    response->status_code = STATUS_BAD_REQUEST;
+                    strcpy(response->data, "공약 ID가 올바르지 않습니다");
+                }
+            }
+            break;
+            
+        case MSG_GET_STATISTICS:
+            {
+                // 통계 요청 처리
+                // data 형식: "pledge_id" (예: "100120965_1")
+                char pledge_id[MAX_STRING_LEN];
+                
+                if (sscanf(request->data, "%255s", pledge_id) == 1) {
+                    handle_get_statistics_request(pledge_id, response);
+                } else {
+                    response->message_type = MSG_ERROR;
+                    response->status_code = STATUS_BAD_REQUEST;
+                    strcpy(response->data, "공약 ID가 올바르지 않습니다");
+                }
+            }
+            break;
+            
+        case MSG_GET_SERVER_STATUS:
+            handle_get_server_status_request(response);
+            break;
+            
+        default:
+            printf("❌ 알 수 없는 메시지 타입: %d\n", request->message_type);
+            response->message_type = MSG_ERROR;
+            response->status_code = STATUS_BAD_REQUEST;
+            strcpy(response->data, "지원하지 않는 메시지 타입입니다");
+            break;
+    }
+    
+}
+
 // 로그인 요청 처리
 void handle_login_request(NetworkMessage* request, NetworkMessage* response) {
     printf("🔐 로그인 요청 처리 중...\n");
@@ -493,37 +917,113 @@ void handle_logout_request(NetworkMessage* request, NetworkMessage* response) {
     printf("✅ 로그아웃 완료: %s\n", request->user_id);
 }
 
-// 선거 정보 요청 처리  
-void handle_get_elections_request(NetworkMessage* response) {
+// 목록 응답 실패 처리 (응답 메모리 부족)
+static void fill_list_error_response(Frame* response) {
+    const char* message = "응답 메모리 할당 실패";
+    
+    frame_free(response);
+    frame_init(response);
+    response->message_type = MSG_ERROR;
+    response->status_code = STATUS_INTERNAL_ERROR;
+    frame_set_payload(response, message, strlen(message));
+}
+
+// 선거 정보 요청 처리 (프레임으로 직접 응답하므로 목록 크기 제한 없음)
+// 응답 형식: 데이터 파일과 같음 - 첫 줄 "COUNT=N", 이후 "ID|이름|날짜|타입|활성상태"
+void handle_get_elections_request(const Frame* request, Frame* response) {
+    (void)request;
     printf("📊 선거 정보 요청 처리\n");
     
+    int token;
+    DatasetVersion* dataset = acquire_dataset(&token);
     response->message_type = MSG_SUCCESS;
     response->status_code = STATUS_SUCCESS;
-    snprintf(response->data, sizeof(response->data), 
-             "선거 정보 %d개 조회 가능", g_server_data.election_count);
-    response->data_length = strlen(response->data);
+    
+    int ok = frame_appendf(response, "COUNT=%d\n", dataset->election_count);
+    for (int i = 0; ok && i < dataset->election_count; i++) {
+        const ElectionRecord* election = &dataset->elections[i];
+        ok = frame_appendf(response, "%s|%s|%s|%s|%d\n",
+                           dataset_version_string(dataset, election->election_id),
+                           dataset_version_string(dataset, election->election_name),
+                           dataset_version_string(dataset, election->election_date),
+                           dataset_version_string(dataset, election->election_type),
+                           election->is_active);
+    }
+    release_dataset(token);
+    
+    if (!ok) fill_list_error_response(response);
 }
 
-// 후보자 정보 요청 처리
-void handle_get_candidates_request(const char* election_id, NetworkMessage* response) {
+// 후보자 정보 요청 처리 (payload가 선거 ID면 그 선거의 후보자만, 비어 있으면 전체)
+// 응답 형식: 첫 줄 "COUNT=N", 이후 "후보자ID|이름|정당|번호|선거ID|공약수"
+void handle_get_candidates_request(const Frame* request, Frame* response) {
+    const char* election_id = request->payload ? request->payload : "";
     printf("👥 후보자 정보 요청 처리\n");
     
+    int token;
+    DatasetVersion* dataset = acquire_dataset(&token);
     response->message_type = MSG_SUCCESS;
     response->status_code = STATUS_SUCCESS;
-    snprintf(response->data, sizeof(response->data), 
-             "후보자 정보 %d개 조회 가능", g_server_data.candidate_count);
-    response->data_length = strlen(response->data);
+    
+    const int32_t* positions = NULL;
+    int count = dataset->candidate_count;
+    if (election_id[0] != '\0') {
+        int election = dataset_links_find_election(&dataset->links, string_intern_find(&dataset->strings, election_id));
+        count = election >= 0 ? dataset_links_candidates(&dataset->links, election, &positions) : 0;
+    }
+    
+    int ok = frame_appendf(response, "COUNT=%d\n", count);
+    for (int i = 0; ok && i < count; i++) {
+        const CandidateRecord* candidate = &dataset->candidates[positions ? positions[i] : i];
+        ok = frame_appendf(response, "%s|%s|%s|%d|%s|%d\n",
+                           dataset_version_string(dataset, candidate->candidate_id),
+                           dataset_version_string(dataset, candidate->candidate_name),
+                           dataset_version_string(dataset, candidate->party_name),
+                           candidate->candidate_number,
+                           dataset_version_string(dataset, candidate->election_id),
+                           candidate->pledge_count);
+    }
+    release_dataset(token);
+    
+    if (!ok) fill_list_error_response(response);
 }
 
-// 공약 정보 요청 처리
-void handle_get_pledges_request(const char* candidate_id, NetworkMessage* response) {
+// 공약 정보 요청 처리 (payload가 후보자 ID면 그 후보자의 공약만, 비어 있으면 전체)
+// 응답 형식: 첫 줄 "COUNT=N", 이후 "공약ID|후보자ID|제목|내용|카테고리|좋아요|싫어요|생성시간"
+// 좋아요/싫어요는 파일 값이 아니라 지금 카운터 값
+void handle_get_pledges_request(const Frame* request, Frame* response) {
+    const char* candidate_id = request->payload ? request->payload : "";
     printf("📋 공약 정보 요청 처리\n");
     
+    int token;
+    DatasetVersion* dataset = acquire_dataset(&token);
     response->message_type = MSG_SUCCESS;
     response->status_code = STATUS_SUCCESS;
-    snprintf(response->data, sizeof(response->data), 
-             "공약 정보 %d개 조회 가능", g_server_data.pledge_count);
-    response->data_length = strlen(response->data);
+    
+    const PledgeTable* pledges = &dataset->pledges;
+    const int32_t* positions = NULL;
+    int count = pledges->count;
+    if (candidate_id[0] != '\0') {
+        int candidate = dataset_links_find_candidate(&dataset->links, string_intern_find(&dataset->strings, candidate_id));
+        count = candidate >= 0 ? dataset_links_pledges(&dataset->links, candidate, &positions) : 0;
+    }
+    
+    int ok = frame_appendf(response, "COUNT=%d\n", count);
+    for (int i = 0; ok && i < count; i++) {
+        int index = positions ? positions[i] : i;
+        ok = frame_appendf(response, "%s|%s|%s|%s|%s|%d|%d|%lld\n",
+                           dataset_version_string(dataset, pledges->ids[index]),
+                           dataset_version_string(dataset, pledges->candidates[index]),
+                           dataset_version_string(dataset, pledges->cold[index].title),
+                           dataset_version_string(dataset, pledges->cold[index].content),
+                           dataset_version_string(dataset, pledge_table_category(pledges, index)),
+                           __atomic_load_n(&pledges->likes[index], __ATOMIC_RELAXED),
+                           __atomic_load_n(&pledges->dislikes[index], __ATOMIC_RELAXED),
+                           (long long)pledges->cold[index].created_time);
+    }
+    release_dataset(token);
+    
+    if (!ok) fill_list_error_response(response);
 }
 
 // JSON 파싱 함수 (간단한 구현)
@@ -624,6 +1124,14 @@ void generate_session_id_server(char* session_id, const char* user_id) {
              user_id, (long long)now, random_num);
 }
 
+// 서버 동작 모드 설정 (start_server 호출 전에 설정)
+void set_server_mode(ServerMode mode, int reactor_count) {
+    g_server_mode = mode;
+    if (reactor_count > 0) {
+        g_reactor_count = reactor_count;
+    }
+}
+
 // 서버 시작
 int start_server(int port) {
     socket_t server_socket;
@@ -656,8 +1164,9 @@ int start_server(int port) {
         return 0;
     }
     
-    // 연결 대기
-    if (listen(server_socket, MAX_CLIENTS) == SOCKET_ERROR) {
+    // 연결 대기 (이벤트 루프 모드는 동시 연결이 많으므로 대기열을 크게 잡음)
+    int backlog = (g_server_mode == SERVER_MODE_EPOLL) ? SOMAXCONN : MAX_CLIENTS;
+    if (listen(server_socket, backlog) == SOCKET_ERROR) {
         write_error_log("start_server", "Failed to listen on socket");
 #ifdef _WIN32
         closesocket(server_socket);
@@ -672,6 +1181,18 @@ int start_server(int port) {
     write_log("INFO", log_msg);
     
     g_server_running = 1;
+    
+    // 이벤트 루프 모드
+    if (g_server_mode == SERVER_MODE_EPOLL) {
+        int result = run_event_loop(server_socket, g_reactor_count, &g_server_running);
+#ifdef _WIN32
+        closesocket(server_socket);
+#else
+        close(server_socket);
+#endif
+        return result;
+    }
+    
     int client_counter = 0;
     
     // 클라이언트 연결 처리 (다중 클라이언트 지원)
@@ -697,7 +1218,11 @@ int start_server(int port) {
         ClientThreadData* thread_data = malloc(sizeof(ClientThreadData));
         if (!thread_data) {
             printf("❌ 메모리 할당 실패\n");
+#ifdef _WIN32
             closesocket(client_socket);
+#else
+            close(client_socket);
+#endif
             continue;
         }
         
@@ -743,12 +1268,24 @@ int start_server(int port) {
 void cleanup_server(void) {
     write_log("INFO", "Cleaning up server resources...");
     
+    // 남은 WAL 레코드를 기록한 뒤 스냅샷 저장 (성공하면 WAL은 더 필요 없음)
+    if (g_evaluation_wal.running) {
+        evaluation_wal_close(&g_evaluation_wal);
+        if (save_evaluations_to_file()) {
+            remove(EVALUATION_WAL_FILE);
+            remove(EVALUATION_WAL_ARCHIVE_FILE);
+        }
+    }
+    
+    // 워커 스레드가 모두 멈춘 뒤이므로 현재 버전을 바로 해제
+    dataset_version_destroy(g_server_data.dataset);
+    g_server_data.dataset = NULL;
+    evaluation_shards_free(&g_server_data.evaluations);
+    
 #ifdef _WIN32
-    DeleteCriticalSection(&g_server_data.data_mutex);
     DeleteCriticalSection(&g_server_data.client_mutex);
     WSACleanup();
 #else
-    pthread_mutex_destroy(&g_server_data.data_mutex);
     pthread_mutex_destroy(&g_server_data.client_mutex);
 #endif
     
@@ -848,25 +1385,206 @@ void save_update_time(void) {
     fclose(file);
 }
 
+// 새로고침 진행 여부 (API 호출과 파일 저장이 겹치지 않게 하는 표시, 잠금이 아니므로 다른 요청은 기다리지 않음)
+static int g_refresh_running = 0;
+
+static int begin_data_refresh(void) {
+    int expected = 0;
+    return __atomic_compare_exchange_n(&g_refresh_running, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+}
+
+static void end_data_refresh(void) {
+    __atomic_store_n(&g_refresh_running, 0, __ATOMIC_RELEASE);
+}
+
+// 파일 줄 수만큼 배열 할당 (한 줄에 많아야 한 항목이므로 load_*_from_file이 넘치지 않음, 메모리 부족 시 NULL)
+static void* alloc_file_rows(const char* filename, size_t item_size, int* capacity) {
+    *capacity = count_file_lines(filename);
+    if (*capacity < 1) *capacity = 1;
+    return calloc((size_t)*capacity, item_size);
+}
+
+// 후보자 API 응답을 배열 끝에 파싱 (응답 한 페이지 분량만큼 자리를 먼저 늘림, 메모리 부족 시 -1)
+static int append_candidate_response(CandidateInfo** candidates, int* capacity, int* count,
+                                     const char* response, const char* election_id) {
+    CandidateInfo* grown = grow_array(*candidates, capacity, *count + API_PAGE_ROWS, sizeof(CandidateInfo));
+    if (!grown) return -1;
+    *candidates = grown;
+    
+    int parsed = parse_candidate_json(response, election_id, &grown[*count], API_PAGE_ROWS);
+    if (parsed > 0) *count += parsed;
+    return parsed;
+}
+
+// 공약 API 응답을 배열 끝에 파싱 (후보자 한 명의 최대 공약 수만큼 자리를 먼저 늘림, 메모리 부족 시 -1)
+static int append_pledge_response(PledgeInfo** pledges, int* capacity, int* count, const char* response) {
+    PledgeInfo* grown = grow_array(*pledges, capacity, *count + API_MAX_PLEDGES_PER_CANDIDATE, sizeof(PledgeInfo));
+    if (!grown) return -1;
+    *pledges = grown;
+    
+    int parsed = parse_pledge_json(response, &grown[*count], API_MAX_PLEDGES_PER_CANDIDATE);
+    if (parsed > 0) *count += parsed;
+    return parsed;
+}
+
+// 동시 수집 응답을 모으는 곳 (완료 콜백은 한 번에 하나씩 호출되므로 잠금 없이 배열 끝에 추가)
+typedef struct {
+    CandidateInfo** candidates;
+    PledgeInfo** pledges;
+    int* capacity;
+    int* count;
+    int out_of_memory;
+    char* failed;                           // 요청이 실패한 대상 표시 (대상 배열 위치 기준, NULL이면 기록하지 않음)
+    const void* targets;                    // 대상 배열 시작 (선거 또는 후보자 배열)
+} FetchCollector;
+
+static void on_candidate_response(APIFetchRequest* request, void* context) {
+    FetchCollector* collector = (FetchCollector*)context;
+    const ElectionInfo* election = (const ElectionInfo*)request->user_data;
+    
+    if (request->status != 0 || !request->response.data) {
+        printf("   ⚠️ 후보자 API 호출 실패, 건너뛰기 (%s)\n", election->election_name);
+        fflush(stdout);
+        if (collector->failed) collector->failed[election - (const ElectionInfo*)collector->targets] = 1;
+        return;
+    }
+    if (collector->out_of_memory) return;
+    
+    int count = append_candidate_response(collector->candidates, collector->capacity, collector->count,
+                                          request->response.data, election->election_id);
+    if (count < 0) {
+        printf("❌ 메모리 할당 실패\n");
+        collector->out_of_memory = 1;
+    } else if (count > 0) {
+        printf("   ✅ %s: %d명 후보자 파싱 완료 (%.0fms)\n", election->election_name, count, request->elapsed_ms);
+    }
+    fflush(stdout);
+}
+
+static void on_pledge_response(APIFetchRequest* request, void* context) {
+    FetchCollector* collector = (FetchCollector*)context;
+    const CandidateInfo* candidate = (const CandidateInfo*)request->user_data;
+    
+    if (request->status != 0 || !request->response.data) {
+        printf("   ⚠️ 공약 API 호출 실패, 건너뛰기 ('%s', ID: %s)\n", candidate->candidate_name, candidate->candidate_id);
+        fflush(stdout);
+        if (collector->failed) collector->failed[candidate - (const CandidateInfo*)collector->targets] = 1;
+        return;
+    }
+    if (collector->out_of_memory) return;
+    
+    int count = append_pledge_response(collector->pledges, collector->capacity, collector->count, request->response.data);
+    if (count < 0) {
+        printf("❌ 메모리 할당 실패\n");
+        collector->out_of_memory = 1;
+    } else if (count > 0) {
+        printf("   ✅ '%s': %d개 공약 파싱 완료 (%.0fms)\n", candidate->candidate_name, count, request->elapsed_ms);
+    } else {
+        printf("   ⚠️ '%s': 공약 파싱 결과 0개 - API 응답 확인 필요\n", candidate->candidate_name);
+    }
+    fflush(stdout);
+}
+
+static void print_fetch_stats(const char* label, int requested, const APIFetchStats* stats) {
+    printf("⏱️ %s 응답 %d/%d개 수신 (캐시 %d개, 304 %d개, 실패 %d개, 동시 최대 %d개, %.2f초)\n",
+           label, stats->succeeded, requested, stats->cached, stats->revalidated, stats->failed,
+           stats->peak_in_flight, stats->elapsed_ms / 1000.0);
+    fflush(stdout);
+}
+
+// 선거 targets[]의 후보자를 동시에 수집해 candidates 끝에 추가 (응답이 도착한 순서대로, 메모리 부족 시 0)
+// failed가 있으면 요청이 실패한 선거 위치에 1을 기록
+static int fetch_candidates(APIClient* client, ElectionInfo* elections, const int* targets, int target_count,
+                            CandidateInfo** candidates, int* capacity, int* count, char* failed) {
+    if (target_count <= 0) return 1;
+    
+    APIFetchRequest* requests = calloc((size_t)target_count, sizeof(APIFetchRequest));
+    if (!requests) return 0;
+    
+    int request_count = 0;
+    for (int t = 0; t < target_count; t++) {
+        ElectionInfo* election = &elections[targets[t]];
+        APIFetchRequest* request = &requests[request_count];
+        if (!api_build_candidate_url(client, election->election_id, request->url, sizeof(request->url))) {
+            if (failed) failed[targets[t]] = 1;
+            continue;
+        }
+        request->endpoint = API_ENDPOINT_CANDIDATE;
+        request->user_data = election;
+        request_count++;
+    }
+    
+    FetchCollector collector = { candidates, NULL, capacity, count, 0, failed, elections };
+    APIFetchStats stats;
+    api_fetch_all(client, requests, request_count, &g_api_fetch_options, on_candidate_response, &collector, &stats);
+    print_fetch_stats("후보자", request_count, &stats);
+    
+    free(requests);
+    return !collector.out_of_memory;
+}
+
+// 공약 요청 한 건에 드는 시간 (마지막 공약 수집의 전체 시간 / 캐시를 뺀 요청 수, 요청이 겹치므로 실제 벽시계 기준)
+// 증분 새로고침이 건너뛴 요청으로 아낀 시간을 어림할 때 사용 (새로고침 스레드만 읽고 씀)
+static double g_pledge_request_ms = 0.0;
+
+// 후보자 targets[]의 공약을 동시에 수집해 pledges 끝에 추가 (공약 ID는 후보자 ID 기준이라 도착 순서와 무관, 메모리 부족 시 0)
+// failed가 있으면 요청이 실패한 후보자 위치에 1을 기록
+static int fetch_pledges(APIClient* client, CandidateInfo* candidates, const int* targets, int target_count,
+                         PledgeInfo** pledges, int* capacity, int* count, char* failed) {
+    if (target_count <= 0) return 1;
+    
+    APIFetchRequest* requests = calloc((size_t)target_count, sizeof(APIFetchRequest));
+    if (!requests) return 0;
+    
+    int request_count = 0;
+    for (int t = 0; t < target_count; t++) {
+        CandidateInfo* candidate = &candidates[targets[t]];
+        APIFetchRequest* request = &requests[request_count];
+        if (!api_build_pledge_url(client, candidate->election_id, candidate->candidate_id,
+                                  request->url, sizeof(request->url))) {
+            if (failed) failed[targets[t]] = 1;
+            continue;
+        }
+        request->endpoint = API_ENDPOINT_PLEDGE;
+        request->user_data = candidate;
+        request_count++;
+    }
+    
+    TokenBucket limit;
+    api_get_rate_limit(API_ENDPOINT_PLEDGE, &limit);
+    printf("🌐 공약 API %d건 동시 요청 (동시 %d개, 초당 %.1f건, 버스트 %.0f건)\n",
+           request_count, g_api_fetch_options.max_in_flight, limit.rate, limit.burst);
+    fflush(stdout);
+    
+    FetchCollector collector = { NULL, pledges, capacity, count, 0, failed, candidates };
+    APIFetchStats stats;
+    api_fetch_all(client, requests, request_count, &g_api_fetch_options, on_pledge_response, &collector, &stats);
+    print_fetch_stats("공약", request_count, &stats);
+    
+    int network_requests = request_count - stats.cached;
+    if (network_requests > 0) g_pledge_request_ms = stats.elapsed_ms / network_requests;
+    
+    free(requests);
+    return !collector.out_of_memory;
+}
+
 // 서버 시작 시 API 데이터 수집
 // 선거 정보만 수집하는 함수
 int collect_elections_only(void) {
     printf("\n🔄 선거 정보만 수집을 시작합니다...\n");
     fflush(stdout);
     
-    // 뮤텍스 잠금
-#ifdef _WIN32
-    EnterCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_lock(&g_server_data.data_mutex);
-#endif
-    
-    printf("🔒 API 호출 뮤텍스 잠금 획득\n");
-    fflush(stdout);
+    // 한 번에 하나의 새로고침만 허용 (API 호출 중에는 잠금을 잡지 않으므로 조회/평가는 계속 처리됨)
+    if (!begin_data_refresh()) {
+        printf("⚠️ 이미 다른 새로고침이 진행 중입니다\n");
+        fflush(stdout);
+        return 0;
+    }
     
-    // 동적 메모리 할당
+    // 동적 메모리 할당 (선거 배열은 응답 하나에 들어갈 수 있는 만큼만)
     APIClient* api_client = malloc(sizeof(APIClient));
-    ElectionInfo* elections = malloc(sizeof(ElectionInfo) * MAX_ELECTIONS);
+    int election_capacity = 0;
+    ElectionInfo* elections = grow_array(NULL, &election_capacity, API_MAX_ELECTIONS_PER_RESPONSE, sizeof(ElectionInfo));
     char* response_buffer = malloc(65536);
     
     if (!api_client || !elections || !response_buffer) {
@@ -876,7 +1594,6 @@ int collect_elections_only(void) {
     }
     
     memset(api_client, 0, sizeof(APIClient));
-    memset(elections, 0, sizeof(ElectionInfo) * MAX_ELECTIONS);
     
     int election_count = 0;
     int success = 1;
@@ -903,7 +1620,7 @@ int collect_elections_only(void) {
         printf("✅ 선거 정보 API 호출 성공\n");
         fflush(stdout);
         
-        election_count = parse_election_json(response_buffer, elections, MAX_ELECTIONS);
+        election_count = parse_election_json(response_buffer, elections, election_capacity);
         printf("📊 파싱된 선거 정보: %d개\n", election_count);
         fflush(stdout);
         
@@ -932,21 +1649,14 @@ cleanup:
     fflush(stdout);
     
     // 서버 전역 데이터 업데이트
-    g_server_data.election_count = load_elections_from_file(g_server_data.elections, MAX_ELECTIONS);
+    refresh_dataset();
     
 cleanup_memory:
     if (api_client) free(api_client);
     if (elections) free(elections);
     if (response_buffer) free(response_buffer);
     
-    printf("🔓 API 호출 뮤텍스 해제\n");
-    fflush(stdout);
-    
-#ifdef _WIN32
-    LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
+    end_data_refresh();
     
     return success;
 }
@@ -956,31 +1666,28 @@ int collect_candidates_only(void) {
     printf("\n🔄 후보자 정보만 수집을 시작합니다...\n");
     fflush(stdout);
     
-    // 뮤텍스 잠금
-#ifdef _WIN32
-    EnterCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_lock(&g_server_data.data_mutex);
-#endif
-    
-    printf("🔒 API 호출 뮤텍스 잠금 획득\n");
-    fflush(stdout);
+    // 한 번에 하나의 새로고침만 허용 (API 호출 중에는 잠금을 잡지 않으므로 조회/평가는 계속 처리됨)
+    if (!begin_data_refresh()) {
+        printf("⚠️ 이미 다른 새로고침이 진행 중입니다\n");
+        fflush(stdout);
+        return 0;
+    }
     
-    // 동적 메모리 할당
+    // 동적 메모리 할당 (선거 배열은 파일 줄 수만큼, 후보자 배열은 응답마다 늘림)
     APIClient* api_client = malloc(sizeof(APIClient));
-    ElectionInfo* elections = malloc(sizeof(ElectionInfo) * MAX_ELECTIONS);
-    CandidateInfo* candidates = malloc(sizeof(CandidateInfo) * MAX_CANDIDATES);
-    char* response_buffer = malloc(65536);
+    int election_capacity = 0;
+    ElectionInfo* elections = alloc_file_rows(ELECTIONS_FILE, sizeof(ElectionInfo), &election_capacity);
+    int candidate_capacity = 0;
+    CandidateInfo* candidates = NULL;
+    int* target_elections = malloc(sizeof(int) * (size_t)election_capacity);
     
-    if (!api_client || !elections || !candidates || !response_buffer) {
+    if (!api_client || !elections || !target_elections) {
         printf("❌ 메모리 할당 실패\n");
         fflush(stdout);
         goto cleanup_memory;
     }
     
     memset(api_client, 0, sizeof(APIClient));
-    memset(elections, 0, sizeof(ElectionInfo) * MAX_ELECTIONS);
-    memset(candidates, 0, sizeof(CandidateInfo) * MAX_CANDIDATES);
     
     int total_candidates = 0;
     int success = 1;
@@ -1000,7 +1707,7 @@ int collect_candidates_only(void) {
     fflush(stdout);
     
     // 기존 선거 정보 로드
-    int election_count = load_elections_from_file(elections, MAX_ELECTIONS);
+    int election_count = load_elections_from_file(elections, election_capacity);
     printf("📂 기존 선거 정보 %d개 로드\n", election_count);
     
     if (election_count == 0) {
@@ -1019,10 +1726,10 @@ int collect_candidates_only(void) {
     int current_year = tm_now->tm_year + 1900;
     
     // 실제 열린 선거만 처리 (미래 선거 제외)
-    int processed_elections = 0;
+    int target_count = 0;
     int max_elections_to_process = 3; // 최대 3개 선거까지 처리
     
-    for (int i = 0; i < election_count && processed_elections < max_elections_to_process && total_candidates < MAX_CANDIDATES - 100; i++) {
+    for (int i = 0; i < election_count && target_count < max_elections_to_process; i++) {
         // 선거 연도 확인
         int election_year = atoi(elections[i].election_id) / 10000;
         if (election_year > current_year) {
@@ -1030,32 +1737,15 @@ int collect_candidates_only(void) {
             continue;
         }
         
-        printf("   선거 %d/%d: %s 처리 중...\n", 
-               processed_elections, max_elections_to_process, elections[i].election_name);
-        fflush(stdout);
-        
-        if (api_get_candidate_info(api_client, elections[i].election_id, 
-                                  response_buffer, 65536) == 0) {
-            printf("   ✅ 후보자 API 호출 성공\n");
-            fflush(stdout);
-            
-            int count = parse_candidate_json(response_buffer, elections[i].election_id,
-                                           &candidates[total_candidates], 
-                                           MAX_CANDIDATES - total_candidates);
-            if (count > 0) {
-                printf("   ✅ %d명 후보자 파싱 완료\n", count);
-                total_candidates += count;
-            }
-            } else {
-            printf("   ⚠️ 후보자 API 호출 실패, 건너뛰기\n");
-        }
-        fflush(stdout);
-        
-        if (i < max_elections_to_process - 1) {
-            printf("   ⏳ 0.3초 대기 중...\n");
-            fflush(stdout);
-            Sleep(300);
-        }
+        target_elections[target_count++] = i;
+        printf("   선거 %d/%d: %s\n", target_count, max_elections_to_process, elections[i].election_name);
+    }
+    fflush(stdout);
+    
+    // 선거별 후보자 요청을 한꺼번에 보내 두고 도착하는 대로 파싱
+    if (!fetch_candidates(api_client, elections, target_elections, target_count,
+                          &candidates, &candidate_capacity, &total_candidates, NULL)) {
+        success = 0;
     }
     
     if (total_candidates > 0) {
@@ -1078,22 +1768,15 @@ cleanup:
     fflush(stdout);
     
     // 서버 전역 데이터 업데이트
-    g_server_data.candidate_count = load_candidates_from_file(g_server_data.candidates, MAX_CANDIDATES);
+    refresh_dataset();
     
 cleanup_memory:
     if (api_client) free(api_client);
     if (elections) free(elections);
     if (candidates) free(candidates);
-    if (response_buffer) free(response_buffer);
-    
-    printf("🔓 API 호출 뮤텍스 해제\n");
-    fflush(stdout);
+    if (target_elections) free(target_elections);
     
-#ifdef _WIN32
-    LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
+    end_data_refresh();
     
     return success;
 }
@@ -1103,31 +1786,28 @@ int collect_pledges_only(void) {
     printf("\n🔄 공약 정보만 수집을 시작합니다...\n");
     fflush(stdout);
     
-    // 뮤텍스 잠금
-#ifdef _WIN32
-    EnterCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_lock(&g_server_data.data_mutex);
-#endif
-    
-    printf("🔒 API 호출 뮤텍스 잠금 획득\n");
-    fflush(stdout);
+    // 한 번에 하나의 새로고침만 허용 (API 호출 중에는 잠금을 잡지 않으므로 조회/평가는 계속 처리됨)
+    if (!begin_data_refresh()) {
+        printf("⚠️ 이미 다른 새로고침이 진행 중입니다\n");
+        fflush(stdout);
+        return 0;
+    }
     
-    // 동적 메모리 할당
+    // 동적 메모리 할당 (후보자 배열은 파일 줄 수만큼, 공약 배열은 응답마다 늘림)
     APIClient* api_client = malloc(sizeof(APIClient));
-    CandidateInfo* candidates = malloc(sizeof(CandidateInfo) * MAX_CANDIDATES);
-    PledgeInfo* pledges = malloc(sizeof(PledgeInfo) * MAX_PLEDGES);
-    char* response_buffer = malloc(65536);
+    int candidate_capacity = 0;
+    CandidateInfo* candidates = alloc_file_rows(CANDIDATES_FILE, sizeof(CandidateInfo), &candidate_capacity);
+    int pledge_capacity = 0;
+    PledgeInfo* pledges = NULL;
+    int* valid_candidates = NULL;
     
-    if (!api_client || !candidates || !pledges || !response_buffer) {
+    if (!api_client || !candidates) {
         printf("❌ 메모리 할당 실패\n");
         fflush(stdout);
         goto cleanup_memory;
     }
     
     memset(api_client, 0, sizeof(APIClient));
-    memset(candidates, 0, sizeof(CandidateInfo) * MAX_CANDIDATES);
-    memset(pledges, 0, sizeof(PledgeInfo) * MAX_PLEDGES);
     
     int total_pledges = 0;
     int success = 1;
@@ -1147,7 +1827,7 @@ int collect_pledges_only(void) {
     fflush(stdout);
     
     // 기존 후보자 정보 로드
-    int candidate_count = load_candidates_from_file(candidates, MAX_CANDIDATES);
+    int candidate_count = load_candidates_from_file(candidates, candidate_capacity);
     printf("📂 기존 후보자 정보 %d개 로드\n", candidate_count);
     
     if (candidate_count == 0) {
@@ -1161,9 +1841,15 @@ int collect_pledges_only(void) {
     fflush(stdout);
     
     // 2017년 이후 후보자 목록 생성 (공약 데이터가 있는 후보자들)
-    int valid_candidates[MAX_CANDIDATES];
+    valid_candidates = malloc(sizeof(int) * (size_t)candidate_count);
     int valid_count = 0;
     
+    if (!valid_candidates) {
+        printf("❌ 메모리 할당 실패\n");
+        success = 0;
+        goto cleanup;
+    }
+    
     for (int i = 0; i < candidate_count; i++) {
         int election_year = atoi(candidates[i].election_id) / 10000;
         if (election_year >= 2017) {
@@ -1182,50 +1868,16 @@ int collect_pledges_only(void) {
     printf("📊 총 %d명의 후보자에 대해 공약 수집을 시작합니다.\n", valid_count);
     fflush(stdout);
     
-    // 모든 유효한 후보자의 공약 수집
-    for (int idx = 0; idx < valid_count && total_pledges < MAX_PLEDGES - 100; idx++) {
-        int i = valid_candidates[idx];
-        printf("   후보자 %d/%d: '%s' (ID: %s, 선거: %s) 공약 수집 중...\n", 
-               idx+1, valid_count, candidates[i].candidate_name, 
-               candidates[i].candidate_id, candidates[i].election_id);
-        fflush(stdout);
-        
-        if (api_get_pledge_info(api_client, candidates[i].election_id, candidates[i].candidate_id,
-                               response_buffer, 65536) == 0) {
-            printf("   ✅ 공약 API 호출 성공 (응답 길이: %zu bytes)\n", strlen(response_buffer));
-            fflush(stdout);
-            
-            // 응답 데이터 일부 출력 (디버깅용)
-            printf("   📄 API 응답 일부: %.200s...\n", response_buffer);
-            fflush(stdout);
-            
-            int count = parse_pledge_json(response_buffer, 
-                                        &pledges[total_pledges], 
-                                        MAX_PLEDGES - total_pledges);
-            if (count > 0) {
-                printf("   ✅ %d개 공약 파싱 완료\n", count);
-                total_pledges += count;
-            } else {
-                printf("   ⚠️ 공약 파싱 결과 0개 - API 응답 확인 필요\n");
-            }
-        } else {
-            printf("   ⚠️ 공약 API 호출 실패, 건너뛰기\n");
-        }
-        
-        // API 호출 간 대기 (서버 부하 방지)
-        if (idx < valid_count - 1) {
-            Sleep(300); // 0.3초 대기
-        }
-        fflush(stdout);
+    // 모든 유효한 후보자의 공약 요청을 한꺼번에 보내 두고 도착하는 대로 파싱
+    if (!fetch_pledges(api_client, candidates, valid_candidates, valid_count,
+                       &pledges, &pledge_capacity, &total_pledges, NULL)) {
+        printf("⚠️ 메모리 부족으로 일부 공약만 저장합니다\n");
     }
     
     if (total_pledges > 0) {
         if (save_pledges_to_file(pledges, total_pledges)) {
             printf("✅ 공약 정보 저장 완료\n");
             fflush(stdout);
-            
-            // 파일 저장 후 잠시 대기 (버퍼링 문제 해결)
-            Sleep(100);
         } else {
             printf("⚠️ 공약 정보 저장 실패\n");
         }
@@ -1245,24 +1897,15 @@ cleanup:
     // 서버 전역 데이터 업데이트 (파일 저장 후 다시 로드)
     printf("🔄 공약 데이터 다시 로드 중...\n");
     fflush(stdout);
-    g_server_data.pledge_count = load_pledges_from_file(g_server_data.pledges, MAX_PLEDGES);
-    printf("📂 공약 정보 %d개 다시 로드 완료\n", g_server_data.pledge_count);
-    fflush(stdout);
+    refresh_dataset();
     
 cleanup_memory:
     if (api_client) free(api_client);
     if (candidates) free(candidates);
     if (pledges) free(pledges);
-    if (response_buffer) free(response_buffer);
-    
-    printf("🔓 API 호출 뮤텍스 해제\n");
-    fflush(stdout);
+    if (valid_candidates) free(valid_candidates);
     
-#ifdef _WIN32
-    LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
+    end_data_refresh();
     
     return success;
 }
@@ -1271,24 +1914,26 @@ int collect_api_data(void) {
     printf("\n🔄 API 데이터 수집을 시작합니다...\n");
     fflush(stdout);
     
-    // 뮤텍스 잠금 (한 번에 하나의 API 호출만 허용)
-#ifdef _WIN32
-    EnterCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_lock(&g_server_data.data_mutex);
-#endif
-    
-    printf("🔒 API 호출 뮤텍스 잠금 획득\n");
-    fflush(stdout);
+    // 한 번에 하나의 새로고침만 허용 (API 호출 중에는 잠금을 잡지 않으므로 조회/평가는 계속 처리됨)
+    if (!begin_data_refresh()) {
+        printf("⚠️ 이미 다른 새로고침이 진행 중입니다\n");
+        fflush(stdout);
+        return 0;
+    }
     
-    // 동적 메모리 할당 (스택 오버플로우 방지)
+    // 동적 메모리 할당 (스택 오버플로우 방지, 후보자/공약 배열은 응답마다 필요한 만큼 늘림)
     APIClient* api_client = malloc(sizeof(APIClient));
-    ElectionInfo* elections = malloc(sizeof(ElectionInfo) * MAX_ELECTIONS);
-    CandidateInfo* candidates = malloc(sizeof(CandidateInfo) * MAX_CANDIDATES);
-    PledgeInfo* pledges = malloc(sizeof(PledgeInfo) * MAX_PLEDGES);
+    int election_capacity = 0;
+    ElectionInfo* elections = grow_array(NULL, &election_capacity, API_MAX_ELECTIONS_PER_RESPONSE, sizeof(ElectionInfo));
+    int candidate_capacity = 0;
+    CandidateInfo* candidates = NULL;
+    int pledge_capacity = 0;
+    PledgeInfo* pledges = NULL;
+    int* target_elections = NULL;
+    int* valid_candidates = NULL;
     char* response_buffer = malloc(65536);
     
-    if (!api_client || !elections || !candidates || !pledges || !response_buffer) {
+    if (!api_client || !elections || !response_buffer) {
         printf("❌ 메모리 할당 실패\n");
         fflush(stdout);
         goto cleanup_memory;
@@ -1296,9 +1941,6 @@ int collect_api_data(void) {
     
     // 변수 초기화
     memset(api_client, 0, sizeof(APIClient));
-    memset(elections, 0, sizeof(ElectionInfo) * MAX_ELECTIONS);
-    memset(candidates, 0, sizeof(CandidateInfo) * MAX_CANDIDATES);
-    memset(pledges, 0, sizeof(PledgeInfo) * MAX_PLEDGES);
     
     int election_count = 0;
     int total_candidates = 0;
@@ -1327,7 +1969,7 @@ int collect_api_data(void) {
         printf("✅ 선거 정보 API 호출 성공\n");
         fflush(stdout);
         
-        election_count = parse_election_json(response_buffer, elections, MAX_ELECTIONS);
+        election_count = parse_election_json(response_buffer, elections, election_capacity);
         printf("📊 파싱된 선거 정보: %d개\n", election_count);
         fflush(stdout);
         
@@ -1349,36 +1991,21 @@ int collect_api_data(void) {
     
     // 최대 2개 선거만 처리 (더 안전하게)
     int max_elections_to_process = (election_count > 2) ? 2 : election_count;
+    target_elections = malloc(sizeof(int) * (size_t)(max_elections_to_process > 0 ? max_elections_to_process : 1));
     
-    for (int i = 0; i < max_elections_to_process && total_candidates < MAX_CANDIDATES - 100; i++) {
-        printf("   선거 %d/%d: %s 처리 중...\n", 
-               i+1, max_elections_to_process, elections[i].election_name);
-        fflush(stdout);
-        
-        if (api_get_candidate_info(api_client, elections[i].election_id, 
-                                  response_buffer, 65536) == 0) {
-            printf("   ✅ 후보자 API 호출 성공\n");
-            fflush(stdout);
-            
-            int count = parse_candidate_json(response_buffer, elections[i].election_id,
-                                           &candidates[total_candidates], 
-                                           MAX_CANDIDATES - total_candidates);
-            if (count > 0) {
-                printf("   ✅ %d명 후보자 파싱 완료\n", count);
-                total_candidates += count;
-            }
-        } else {
-            printf("   ⚠️ 후보자 API 호출 실패, 건너뛰기\n");
-        }
-        fflush(stdout);
-        
-        // API 호출 간격
-        if (i < max_elections_to_process - 1) {
-            printf("   ⏳ 0.3초 대기 중...\n");
-            fflush(stdout);
-            Sleep(300);
-        }
+    if (!target_elections) {
+        printf("❌ 메모리 할당 실패\n");
+        goto cleanup;
+    }
+    
+    for (int i = 0; i < max_elections_to_process; i++) {
+        target_elections[i] = i;
+        printf("   선거 %d/%d: %s\n", i+1, max_elections_to_process, elections[i].election_name);
     }
+    fflush(stdout);
+    
+    fetch_candidates(api_client, elections, target_elections, max_elections_to_process,
+                     &candidates, &candidate_capacity, &total_candidates, NULL);
     
     if (total_candidates > 0) {
         if (save_candidates_to_file(candidates, total_candidates)) {
@@ -1393,9 +2020,14 @@ int collect_api_data(void) {
     fflush(stdout);
     
     // 2017년 이후 후보자 목록 생성 (공약 데이터가 있는 후보자들)
-    int valid_candidates[MAX_CANDIDATES];
+    valid_candidates = malloc(sizeof(int) * (size_t)(total_candidates > 0 ? total_candidates : 1));
     int valid_count = 0;
     
+    if (!valid_candidates) {
+        printf("❌ 메모리 할당 실패\n");
+        goto cleanup;
+    }
+    
     for (int i = 0; i < total_candidates; i++) {
         int election_year = atoi(candidates[i].election_id) / 10000;
         if (election_year >= 2017) {
@@ -1414,50 +2046,16 @@ int collect_api_data(void) {
     printf("📊 총 %d명의 후보자에 대해 공약 수집을 시작합니다.\n", valid_count);
     fflush(stdout);
     
-    // 모든 유효한 후보자의 공약 수집
-    for (int idx = 0; idx < valid_count && total_pledges < MAX_PLEDGES - 100; idx++) {
-        int i = valid_candidates[idx];
-        printf("   후보자 %d/%d: '%s' (ID: %s, 선거: %s) 공약 수집 중...\n", 
-               idx+1, valid_count, candidates[i].candidate_name, 
-               candidates[i].candidate_id, candidates[i].election_id);
-        fflush(stdout);
-        
-        if (api_get_pledge_info(api_client, candidates[i].election_id, candidates[i].candidate_id,
-                               response_buffer, 65536) == 0) {
-            printf("   ✅ 공약 API 호출 성공 (응답 길이: %zu bytes)\n", strlen(response_buffer));
-            fflush(stdout);
-            
-            // 응답 데이터 일부 출력 (디버깅용)  
-            printf("   📄 API 응답 일부: %.200s...\n", response_buffer);
-            fflush(stdout);
-            
-            int count = parse_pledge_json(response_buffer, 
-                                        &pledges[total_pledges], 
-                                        MAX_PLEDGES - total_pledges);
-            if (count > 0) {
-                printf("   ✅ %d개 공약 파싱 완료\n", count);
-                total_pledges += count;
-            } else {
-                printf("   ⚠️ 공약 파싱 결과 0개 - API 응답 확인 필요\n");
-            }
-        } else {
-            printf("   ⚠️ 공약 API 호출 실패, 건너뛰기\n");
-        }
-        
-        // API 호출 간 대기 (서버 부하 방지)
-        if (idx < valid_count - 1) {
-            Sleep(300); // 0.3초 대기
-        }
-        fflush(stdout);
+    // 모든 유효한 후보자의 공약 요청을 한꺼번에 보내 두고 도착하는 대로 파싱
+    if (!fetch_pledges(api_client, candidates, valid_candidates, valid_count,
+                       &pledges, &pledge_capacity, &total_pledges, NULL)) {
+        printf("⚠️ 메모리 부족으로 일부 공약만 저장합니다\n");
     }
     
     if (total_pledges > 0) {
         if (save_pledges_to_file(pledges, total_pledges)) {
             printf("✅ 공약 정보 저장 완료\n");
             fflush(stdout);
-            
-            // 파일 저장 후 잠시 대기 (버퍼링 문제 해결)
-            Sleep(100);
         } else {
             printf("⚠️ 공약 정보 저장 실패\n");
         }
@@ -1481,12 +2079,7 @@ cleanup:
     // 서버 전역 데이터 업데이트 (파일 저장 후 다시 로드)
     printf("🔄 전체 데이터 다시 로드 중...\n");
     fflush(stdout);
-    g_server_data.election_count = load_elections_from_file(g_server_data.elections, MAX_ELECTIONS);
-    g_server_data.candidate_count = load_candidates_from_file(g_server_data.candidates, MAX_CANDIDATES);
-    g_server_data.pledge_count = load_pledges_from_file(g_server_data.pledges, MAX_PLEDGES);
-    printf("📂 전체 데이터 로드 완료: 선거 %d개, 후보자 %d개, 공약 %d개\n", 
-           g_server_data.election_count, g_server_data.candidate_count, g_server_data.pledge_count);
-    fflush(stdout);
+    refresh_dataset();
     
 cleanup_memory:
     // 메모리 해제
@@ -1494,66 +2087,548 @@ cleanup_memory:
     if (elections) free(elections);
     if (candidates) free(candidates);
     if (pledges) free(pledges);
+    if (target_elections) free(target_elections);
+    if (valid_candidates) free(valid_candidates);
     if (response_buffer) free(response_buffer);
     
-    // 뮤텍스 해제
-    printf("🔓 API 호출 뮤텍스 해제\n");
-    fflush(stdout);
-    
-#ifdef _WIN32
-    LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
+    end_data_refresh();
     
     return 1; // 항상 성공으로 반환하여 서버 크래시 방지
 }
 
-// 파일에서 선거 데이터 읽기
-int load_elections_from_file(ElectionInfo elections[], int max_count) {
-    FILE* file = fopen(ELECTIONS_FILE, "r");
-    if (!file) {
-        write_error_log("load_elections_from_file", "파일 열기 실패");
-        return 0;
-    }
-    
-    char line[1024];
-    int count = 0;
-    int data_count = 0;
-    
-    while (fgets(line, sizeof(line), file) && count < max_count) {
-        // 주석과 빈 줄 건너뛰기
-        if (line[0] == '#' || line[0] == '\n') continue;
-        
-        // COUNT 라인 처리
-        if (strncmp(line, "COUNT=", 6) == 0) {
-            data_count = atoi(line + 6);
-            continue;
-        }
-        
-        // 데이터 파싱: ID|이름|날짜|타입|활성상태
-        char* token = strtok(line, "|");
-        if (!token) continue;
+// =====================================================
+// 증분 새로고침 (바뀐 후보자만 공약을 다시 받음)
+// =====================================================
+
+// 증분 새로고침 결과 (선거/후보자는 현재 데이터 버전과 비교한 수)
+typedef struct {
+    int elections_new;
+    int elections_changed;
+    int elections_removed;
+    int candidates_new;
+    int candidates_changed;
+    int candidates_unchanged;
+    int candidates_removed;
+    int elections_failed;                   // 후보자 요청이 실패해 현재 버전의 후보자를 그대로 쓴 선거 수
+    int candidates_kept;                    // 그 선거에서 그대로 쓴 후보자 수
+    int pledge_requests;                    // 공약을 다시 받은 후보자 수
+    int pledge_skipped;                     // 현재 버전의 공약을 그대로 쓴 후보자 수
+    int pledge_failed;                      // 공약 요청이 실패해 현재 버전의 공약을 그대로 쓴 후보자 수
+    int pledges_fetched;
+    int pledges_reused;
+    int pledges_kept;                       // 요청이 실패한 후보자에게서 그대로 쓴 공약 수
+    double elapsed_ms;
+    double saved_ms;                        // 건너뛴 공약 요청에 들었을 시간 (어림값)
+} DeltaRefreshStats;
+
+// 선거를 현재 버전과 비교 (-1: 새 선거, 0: 바뀜, 1: 같음, index에 현재 버전 위치)
+static int diff_election(const DatasetVersion* dataset, const ElectionInfo* election, int* index) {
+    *index = dataset_links_find_election(&dataset->links, string_intern_find(&dataset->strings, election->election_id));
+    if (*index < 0) return -1;
+    
+    const ElectionRecord* record = &dataset->elections[*index];
+    return strcmp(dataset_version_string(dataset, record->election_name), election->election_name) == 0 &&
+           strcmp(dataset_version_string(dataset, record->election_date), election->election_date) == 0 &&
+           strcmp(dataset_version_string(dataset, record->election_type), election->election_type) == 0 &&
+           record->is_active == election->is_active;
+}
+
+// 후보자를 현재 버전과 비교 (-1: 새 후보자, 0: 바뀜, 1: 같음, index에 현재 버전 위치)
+static int diff_candidate(const DatasetVersion* dataset, const CandidateInfo* candidate, int* index) {
+    *index = dataset_links_find_candidate(&dataset->links, string_intern_find(&dataset->strings, candidate->candidate_id));
+    if (*index < 0) return -1;
+    
+    const CandidateRecord* record = &dataset->candidates[*index];
+    return strcmp(dataset_version_string(dataset, record->candidate_name), candidate->candidate_name) == 0 &&
+           strcmp(dataset_version_string(dataset, record->party_name), candidate->party_name) == 0 &&
+           strcmp(dataset_version_string(dataset, record->election_id), candidate->election_id) == 0 &&
+           record->candidate_number == candidate->candidate_number &&
+           record->pledge_count == candidate->pledge_count;
+}
+
+// 현재 버전에 있는 후보자의 공약을 배열 끝에 복사 (좋아요/싫어요는 지금 카운터 값, 메모리 부족 시 -1)
+static int append_dataset_pledges(const DatasetVersion* dataset, int candidate,
+                                  PledgeInfo** pledges, int* capacity, int* count) {
+    const int32_t* rows;
+    int row_count = dataset_links_pledges(&dataset->links, candidate, &rows);
+    if (row_count <= 0) return 0;
+    
+    PledgeInfo* grown = grow_array(*pledges, capacity, *count + row_count, sizeof(PledgeInfo));
+    if (!grown) return -1;
+    *pledges = grown;
+    
+    const PledgeTable* table = &dataset->pledges;
+    for (int i = 0; i < row_count; i++) {
+        int row = rows[i];
+        PledgeInfo* pledge = &grown[(*count)++];
         
-        strncpy(elections[count].election_id, token, sizeof(elections[count].election_id) - 1);
+        memset(pledge, 0, sizeof(PledgeInfo));
+        safe_strcpy(pledge->pledge_id, dataset_version_string(dataset, table->ids[row]), sizeof(pledge->pledge_id));
+        safe_strcpy(pledge->candidate_id, dataset_version_string(dataset, table->candidates[row]), sizeof(pledge->candidate_id));
+        safe_strcpy(pledge->title, dataset_version_string(dataset, table->cold[row].title), sizeof(pledge->title));
+        safe_strcpy(pledge->content, dataset_version_string(dataset, table->cold[row].content), sizeof(pledge->content));
+        safe_strcpy(pledge->category, dataset_version_string(dataset, pledge_table_category(table, row)),
+                    sizeof(pledge->category));
+        pledge->like_count = __atomic_load_n(&table->likes[row], __ATOMIC_RELAXED);
+        pledge->dislike_count = __atomic_load_n(&table->dislikes[row], __ATOMIC_RELAXED);
+        pledge->created_time = (time_t)table->cold[row].created_time;
+    }
+    return row_count;
+}
+
+// 후보자 요청이 실패한 선거 targets[] 중 현재 버전에 있는 선거의 후보자를 candidates 끝에 복사 (메모리 부족 시 0)
+// 복사한 후보자는 비교에서 그대로인 후보자가 되어 공약도 현재 버전에서 옮겨 오므로 사라진 것으로 세지 않음
+static int keep_failed_candidates(const ElectionInfo* elections, const int* targets, int target_count, const char* failed,
+                                  CandidateInfo** candidates, int* candidate_capacity, int* candidate_count,
+                                  DeltaRefreshStats* stats) {
+    int token;
+    DatasetVersion* dataset = acquire_dataset(&token);
+    int ok = 1;
+    
+    for (int t = 0; t < target_count && ok; t++) {
+        const ElectionInfo* election = &elections[targets[t]];
+        if (!failed[targets[t]]) continue;
         
-        token = strtok(NULL, "|");
-        if (!token) continue;
-        strncpy(elections[count].election_name, token, sizeof(elections[count].election_name) - 1);
+        int index = dataset_links_find_election(&dataset->links,
+                                                string_intern_find(&dataset->strings, election->election_id));
+        if (index < 0) continue;   // 새 선거는 남길 후보자가 없음
         
-        token = strtok(NULL, "|");
-        if (!token) continue;
-        strncpy(elections[count].election_date, token, sizeof(elections[count].election_date) - 1);
+        const int32_t* rows;
+        int row_count = dataset_links_candidates(&dataset->links, index, &rows);
+        CandidateInfo* grown = grow_array(*candidates, candidate_capacity, *candidate_count + row_count,
+                                          sizeof(CandidateInfo));
+        if (!grown) {
+            ok = 0;
+            break;
+        }
+        *candidates = grown;
         
-        token = strtok(NULL, "|");
-        if (!token) continue;
-        strncpy(elections[count].election_type, token, sizeof(elections[count].election_type) - 1);
+        int kept = 0;
+        for (int i = 0; i < row_count; i++) {
+            const CandidateRecord* record = &dataset->candidates[rows[i]];
+            // 같은 ID가 여러 줄이면 인덱스가 가리키는 (마지막) 줄만 옮김
+            if (dataset_links_find_candidate(&dataset->links, record->candidate_id) != rows[i]) continue;
+            
+            CandidateInfo* candidate = &grown[(*candidate_count)++];
+            memset(candidate, 0, sizeof(CandidateInfo));
+            safe_strcpy(candidate->candidate_id, dataset_version_string(dataset, record->candidate_id),
+                        sizeof(candidate->candidate_id));
+            safe_strcpy(candidate->candidate_name, dataset_version_string(dataset, record->candidate_name),
+                        sizeof(candidate->candidate_name));
+            safe_strcpy(candidate->party_name, dataset_version_string(dataset, record->party_name),
+                        sizeof(candidate->party_name));
+            safe_strcpy(candidate->election_id, dataset_version_string(dataset, record->election_id),
+                        sizeof(candidate->election_id));
+            candidate->candidate_number = record->candidate_number;
+            candidate->pledge_count = record->pledge_count;
+            kept++;
+        }
         
-        token = strtok(NULL, "|\n");
-        if (!token) continue;
-        elections[count].is_active = atoi(token);
+        stats->elections_failed++;
+        stats->candidates_kept += kept;
+        printf("   ↩️ %s: 후보자 요청 실패, 현재 후보자 %d명 유지\n", election->election_name, kept);
+    }
+    fflush(stdout);
+    
+    release_dataset(token);
+    return ok;
+}
+
+// 받은 선거/후보자 목록을 현재 버전과 비교해 통계를 채우고, 공약을 다시 받을 2017년 이후 후보자를 targets에 모음
+// 그대로인 후보자의 공약은 현재 버전에서 pledges로 복사 (버전은 이 함수 안에서만 잡고 있음, 메모리 부족 시 0)
+static int diff_with_dataset(const ElectionInfo* elections, int election_count,
+                             const CandidateInfo* candidates, int candidate_count,
+                             int* targets, int* target_count,
+                             PledgeInfo** pledges, int* pledge_capacity, int* pledge_count,
+                             DeltaRefreshStats* stats) {
+    int token;
+    DatasetVersion* dataset = acquire_dataset(&token);
+    
+    // 현재 버전에서 받은 목록에 다시 나온 선거/후보자 표시 (나오지 않은 수가 사라진 수)
+    char* seen = calloc((size_t)(dataset->election_count + dataset->candidate_count + 1), 1);
+    if (!seen) {
+        release_dataset(token);
+        return 0;
+    }
+    char* seen_elections = seen;
+    char* seen_candidates = seen + dataset->election_count;
+    
+    for (int i = 0; i < election_count; i++) {
+        int index;
+        int result = diff_election(dataset, &elections[i], &index);
+        if (result < 0) {
+            stats->elections_new++;
+        } else {
+            seen_elections[index] = 1;
+            if (result == 0) stats->elections_changed++;
+        }
+    }
+    
+    int ok = 1;
+    *target_count = 0;
+    for (int i = 0; i < candidate_count; i++) {
+        int index;
+        int result = diff_candidate(dataset, &candidates[i], &index);
+        if (result < 0) {
+            stats->candidates_new++;
+        } else {
+            seen_candidates[index] = 1;
+            if (result == 0) stats->candidates_changed++;
+            else stats->candidates_unchanged++;
+        }
         
-        count++;
+        if (atoi(candidates[i].election_id) / 10000 < 2017) continue;
+        
+        // 그대로이고 공약도 로드돼 있으면 다시 받지 않음 (지난번에 공약 요청이 실패한 후보자는 다시 받음)
+        int reused = 0;
+        if (result == 1 && ok) {
+            reused = append_dataset_pledges(dataset, index, pledges, pledge_capacity, pledge_count);
+            if (reused < 0) {
+                ok = 0;
+                reused = 0;
+            }
+        }
+        
+        if (reused > 0) {
+            stats->pledge_skipped++;
+            stats->pledges_reused += reused;
+        } else {
+            targets[(*target_count)++] = i;
+            printf("🔍 공약 수집 대상 후보자 %d: %s (%s년, %s)\n", *target_count, candidates[i].candidate_name,
+                   candidates[i].election_id, result < 0 ? "새 후보자" : (result == 0 ? "정보 변경" : "공약 없음"));
+        }
+    }
+    
+    // 같은 ID가 여러 줄이면 인덱스가 가리키는 (마지막) 위치에만 표시되므로 ID 기준으로 확인
+    for (int e = 0; e < dataset->election_count; e++) {
+        int index = dataset_links_find_election(&dataset->links, dataset->elections[e].election_id);
+        if (index >= 0 && index == e && !seen_elections[e]) stats->elections_removed++;
+    }
+    for (int c = 0; c < dataset->candidate_count; c++) {
+        int index = dataset_links_find_candidate(&dataset->links, dataset->candidates[c].candidate_id);
+        if (index >= 0 && index == c && !seen_candidates[c]) stats->candidates_removed++;
+    }
+    
+    free(seen);
+    release_dataset(token);
+    return ok;
+}
+
+// 공약 요청이 실패한 targets[] 후보자 중 현재 버전에 있는 후보자의 공약을 pledges로 복사 (메모리 부족 시 0)
+// (빠뜨린 채로 게시하면 요청 한 번 실패로 그 후보자의 공약이 새 버전과 pledges.txt에서 사라짐)
+static int keep_failed_pledges(const CandidateInfo* candidates, const int* targets, int target_count, const char* failed,
+                               PledgeInfo** pledges, int* pledge_capacity, int* pledge_count,
+                               DeltaRefreshStats* stats) {
+    int token;
+    DatasetVersion* dataset = acquire_dataset(&token);
+    int ok = 1;
+    
+    for (int t = 0; t < target_count && ok; t++) {
+        const CandidateInfo* candidate = &candidates[targets[t]];
+        if (!failed[targets[t]]) continue;
+        
+        int index = dataset_links_find_candidate(&dataset->links,
+                                                 string_intern_find(&dataset->strings, candidate->candidate_id));
+        if (index < 0) continue;   // 새 후보자는 남길 공약이 없음
+        
+        int kept = append_dataset_pledges(dataset, index, pledges, pledge_capacity, pledge_count);
+        if (kept < 0) {
+            ok = 0;
+        } else if (kept > 0) {
+            stats->pledge_failed++;
+            stats->pledges_kept += kept;
+            printf("   ↩️ '%s': 공약 요청 실패, 현재 공약 %d개 유지\n", candidate->candidate_name, kept);
+        }
+    }
+    fflush(stdout);
+    
+    release_dataset(token);
+    return ok;
+}
+
+// 건너뛴 공약 요청으로 아낀 시간 (지난 공약 수집의 요청당 시간, 아직 잰 적이 없으면 공약 API 속도 제한 간격)
+static double estimate_saved_ms(int skipped) {
+    double per_request = g_pledge_request_ms;
+    if (per_request <= 0.0) {
+        TokenBucket limit;
+        api_get_rate_limit(API_ENDPOINT_PLEDGE, &limit);
+        per_request = limit.rate > 0.0 ? 1000.0 / limit.rate : 0.0;
+    }
+    return per_request * skipped;
+}
+
+// 증분 새로고침: 선거/후보자 목록은 매번 받아 현재 데이터 버전과 비교하고,
+// 공약은 새로 나왔거나 정보가 바뀐 후보자만 다시 받음 (그대로인 후보자는 현재 버전의 공약을 그대로 사용)
+// - 후보자 요청이 실패한 선거는 현재 버전의 후보자를, 공약 요청이 실패한 후보자는 현재 버전의 공약을 그대로 사용
+//   (요청 한 번 실패로 지금 있는 후보자/공약을 지우지 않음)
+// - 바뀐 것이 하나도 없으면 파일과 현재 버전을 건드리지 않음
+// - 바뀐 것이 있으면 합친 목록을 저장하고 refresh_dataset으로 새 버전을 게시
+//   (평가 카운터는 공약 ID로 현재 버전에서 옮겨 오므로 평가 수가 초기화되지 않음)
+// summary에는 클라이언트에 돌려줄 한 줄 요약을 기록 (NULL이면 생략)
+int collect_api_data_incremental(char* summary, size_t summary_size) {
+    printf("\n🔄 증분 새로고침을 시작합니다...\n");
+    fflush(stdout);
+    
+    if (!begin_data_refresh()) {
+        printf("⚠️ 이미 다른 새로고침이 진행 중입니다\n");
+        fflush(stdout);
+        if (summary) snprintf(summary, summary_size, "이미 다른 새로고침이 진행 중입니다");
+        return 0;
+    }
+    
+    double start = now_ms();
+    DeltaRefreshStats stats;
+    memset(&stats, 0, sizeof(stats));
+    
+    APIClient* api_client = malloc(sizeof(APIClient));
+    int election_capacity = 0;
+    ElectionInfo* elections = grow_array(NULL, &election_capacity, API_MAX_ELECTIONS_PER_RESPONSE, sizeof(ElectionInfo));
+    int candidate_capacity = 0;
+    CandidateInfo* candidates = NULL;
+    int pledge_capacity = 0;
+    PledgeInfo* pledges = NULL;
+    int* target_elections = NULL;
+    int* pledge_targets = NULL;
+    char* failed_elections = NULL;
+    char* failed_candidates = NULL;
+    char* response_buffer = malloc(65536);
+    
+    int election_count = 0;
+    int total_candidates = 0;
+    int total_pledges = 0;
+    int target_count = 0;
+    int success = 0;
+    
+    if (!api_client || !elections || !response_buffer) {
+        printf("❌ 메모리 할당 실패\n");
+        goto cleanup;
+    }
+    
+    memset(api_client, 0, sizeof(APIClient));
+    if (!init_api_client(api_client)) {
+        printf("❌ API 클라이언트 초기화 실패\n");
+        goto cleanup;
+    }
+    
+    // 1. 선거 목록 (목록이 없으면 비교할 수 없으므로 현재 데이터 유지)
+    if (api_get_election_info(api_client, response_buffer, 65536) != 0) {
+        printf("⚠️ 선거 정보 API 호출 실패, 현재 데이터를 유지합니다\n");
+        goto cleanup;
+    }
+    election_count = parse_election_json(response_buffer, elections, election_capacity);
+    if (election_count == 0) {
+        printf("⚠️ 파싱된 선거 정보가 없어 현재 데이터를 유지합니다\n");
+        goto cleanup;
+    }
+    
+    // 2. 후보자 목록 (전체 새로고침과 같은 선거 범위, 요청이 실패한 선거는 현재 후보자 유지)
+    int max_elections_to_process = (election_count > 2) ? 2 : election_count;
+    target_elections = malloc(sizeof(int) * (size_t)max_elections_to_process);
+    failed_elections = calloc((size_t)election_count, 1);
+    if (!target_elections || !failed_elections) {
+        printf("❌ 메모리 할당 실패\n");
+        goto cleanup;
+    }
+    for (int i = 0; i < max_elections_to_process; i++) target_elections[i] = i;
+    
+    if (!fetch_candidates(api_client, elections, target_elections, max_elections_to_process,
+                          &candidates, &candidate_capacity, &total_candidates, failed_elections) ||
+        !keep_failed_candidates(elections, target_elections, max_elections_to_process, failed_elections,
+                                &candidates, &candidate_capacity, &total_candidates, &stats)) {
+        printf("❌ 메모리 할당 실패, 현재 데이터를 유지합니다\n");
+        goto cleanup;
+    }
+    if (total_candidates == 0) {
+        printf("⚠️ 받은 후보자 정보가 없어 현재 데이터를 유지합니다\n");
+        goto cleanup;
+    }
+    
+    // 3. 현재 버전과 비교 (그대로인 후보자의 공약은 여기서 복사)
+    pledge_targets = malloc(sizeof(int) * (size_t)total_candidates);
+    failed_candidates = calloc((size_t)total_candidates, 1);
+    if (!pledge_targets || !failed_candidates ||
+        !diff_with_dataset(elections, election_count, candidates, total_candidates, pledge_targets, &target_count,
+                           &pledges, &pledge_capacity, &total_pledges, &stats)) {
+        printf("❌ 메모리 할당 실패\n");
+        goto cleanup;
+    }
+    
+    printf("📊 비교 결과: 선거 새로 %d, 변경 %d, 사라짐 %d / 후보자 새로 %d, 변경 %d, 그대로 %d, 사라짐 %d "
+           "(후보자 요청 실패로 유지한 선거 %d, 후보자 %d)\n",
+           stats.elections_new, stats.elections_changed, stats.elections_removed,
+           stats.candidates_new, stats.candidates_changed, stats.candidates_unchanged, stats.candidates_removed,
+           stats.elections_failed, stats.candidates_kept);
+    fflush(stdout);
+    
+    // 4. 새로 나왔거나 바뀐 후보자의 공약만 수집 (요청이 실패한 후보자는 현재 공약 유지)
+    int reused_pledges = total_pledges;
+    stats.pledge_requests = target_count;
+    if (!fetch_pledges(api_client, candidates, pledge_targets, target_count,
+                       &pledges, &pledge_capacity, &total_pledges, failed_candidates)) {
+        printf("⚠️ 메모리 부족으로 일부 공약만 저장합니다\n");
+    }
+    stats.pledges_fetched = total_pledges - reused_pledges;
+    if (!keep_failed_pledges(candidates, pledge_targets, target_count, failed_candidates,
+                             &pledges, &pledge_capacity, &total_pledges, &stats)) {
+        printf("❌ 메모리 할당 실패, 현재 데이터를 유지합니다\n");
+        goto cleanup;
+    }
+    stats.saved_ms = estimate_saved_ms(stats.pledge_skipped);
+    
+    // 5. 바뀐 것이 있을 때만 저장하고 새 버전 게시
+    int changed = stats.elections_new + stats.elections_changed + stats.elections_removed +
+                  stats.candidates_new + stats.candidates_changed + stats.candidates_removed +
+                  stats.pledges_fetched;
+    if (changed == 0) {
+        printf("✅ 바뀐 선거/후보자가 없어 현재 데이터 버전을 그대로 유지합니다\n");
+    } else {
+        save_elections_to_file(elections, election_count);
+        save_candidates_to_file(candidates, total_candidates);
+        save_pledges_to_file(pledges, total_pledges);
+        printf("🔄 변경분을 반영한 데이터 버전 게시 중...\n");
+        fflush(stdout);
+        refresh_dataset();
+    }
+    save_update_time();
+    success = 1;
+    
+cleanup:
+    if (api_client && api_client->is_initialized) {
+        cleanup_api_client(api_client);
+    }
+    
+    stats.elapsed_ms = now_ms() - start;
+    if (success) {
+        printf("\n🎉 증분 새로고침 완료! (%.2f초)\n", stats.elapsed_ms / 1000.0);
+        printf("   - 공약 요청: %d명 (새로 받은 공약 %d개)\n", stats.pledge_requests, stats.pledges_fetched);
+        printf("   - 건너뛴 후보자: %d명 (그대로 쓴 공약 %d개)\n", stats.pledge_skipped, stats.pledges_reused);
+        printf("   - 요청 실패로 유지한 후보자: %d명 (공약 %d개)\n", stats.pledge_failed, stats.pledges_kept);
+        printf("   - 아낀 시간: 약 %.2f초\n", stats.saved_ms / 1000.0);
+        if (summary) {
+            snprintf(summary, summary_size,
+                     "증분 새로고침 완료: 공약 요청 %d명 (공약 %d개), 건너뜀 %d명 (공약 %d개), 약 %.1f초 절약 (%.1f초 소요)",
+                     stats.pledge_requests, stats.pledges_fetched, stats.pledge_skipped, stats.pledges_reused,
+                     stats.saved_ms / 1000.0, stats.elapsed_ms / 1000.0);
+        }
+    } else if (summary) {
+        snprintf(summary, summary_size, "증분 새로고침 실패 (현재 데이터 유지)");
+    }
+    fflush(stdout);
+    
+    if (api_client) free(api_client);
+    if (elections) free(elections);
+    if (candidates) free(candidates);
+    if (pledges) free(pledges);
+    if (target_elections) free(target_elections);
+    if (pledge_targets) free(pledge_targets);
+    if (failed_elections) free(failed_elections);
+    if (failed_candidates) free(failed_candidates);
+    if (response_buffer) free(response_buffer);
+    
+    end_data_refresh();
+    return success;
+}
+
+// 데이터 파일 한 줄 길이 (끝의 개행 제거)
+static size_t trim_line(char* line) {
+    size_t length = strlen(line);
+    if (length > 0 && line[length - 1] == '\n') line[--length] = '\0';
+    return length;
+}
+
+// 선거 데이터 한 줄 파싱: ID|이름|날짜|타입|활성상태 (주석/빈 줄/형식 오류면 0)
+static int parse_election_line(char* line, ElectionInfo* election) {
+    // 주석과 빈 줄, COUNT 라인 건너뛰기
+    if (line[0] == '#' || line[0] == '\n') return 0;
+    if (strncmp(line, "COUNT=", 6) == 0) return 0;
+    
+    char* fields[5];
+    if (delim_split(line, trim_line(line), '|', fields, 5) < 5) return 0;
+    
+    memset(election, 0, sizeof(ElectionInfo));
+    safe_strcpy(election->election_id, fields[0], sizeof(election->election_id));
+    safe_strcpy(election->election_name, fields[1], sizeof(election->election_name));
+    safe_strcpy(election->election_date, fields[2], sizeof(election->election_date));
+    safe_strcpy(election->election_type, fields[3], sizeof(election->election_type));
+    election->is_active = atoi(fields[4]);
+    
+    return 1;
+}
+
+// 후보자 데이터 한 줄 파싱: 후보자ID|이름|정당|번호|선거ID|공약수
+static int parse_candidate_line(char* line, CandidateInfo* candidate) {
+    // 주석과 빈 줄 건너뛰기
+    if (line[0] == '#' || line[0] == '\n') return 0;
+    if (strncmp(line, "COUNT=", 6) == 0) return 0;
+    
+    char* fields[6];
+    if (delim_split(line, trim_line(line), '|', fields, 6) < 6) return 0;
+    
+    memset(candidate, 0, sizeof(CandidateInfo));
+    safe_strcpy(candidate->candidate_id, fields[0], sizeof(candidate->candidate_id));
+    safe_strcpy(candidate->candidate_name, fields[1], sizeof(candidate->candidate_name));
+    safe_strcpy(candidate->party_name, fields[2], sizeof(candidate->party_name));
+    candidate->candidate_number = atoi(fields[3]);
+    safe_strcpy(candidate->election_id, fields[4], sizeof(candidate->election_id));
+    candidate->pledge_count = atoi(fields[5]);
+    
+    return 1;
+}
+
+// 공약 데이터 한 줄 파싱: 공약ID|후보자ID|제목|내용|카테고리|좋아요|싫어요|생성시간
+// verbose가 1이면 형식이 맞지 않는 줄을 출력
+static int parse_pledge_line(char* line, PledgeInfo* pledge, int line_num, int verbose) {
+    // 주석과 빈 줄 건너뛰기
+    if (line[0] == '#' || line[0] == '\n') {
+        return 0;
+    }
+    if (strncmp(line, "COUNT=", 6) == 0) {
+        return 0;
+    }
+    
+    // 파이프(|) 위치를 한 번에 찾아 8개 필드로 나눔 - 정확히 7개여야 함 (빈 필드도 유지)
+    char* tokens[8];
+    int field_count = delim_split(line, trim_line(line), '|', tokens, 8);
+    
+    if (field_count != 8) {
+        if (verbose) {
+            // 나눈 자리를 되돌려 원래 줄을 출력
+            for (int i = 1; i < field_count && i < 8; i++) tokens[i][-1] = '|';
+            printf("DEBUG: 라인 %d 건너뛰기 (파이프 개수: %d개): %.50s...\n", 
+                   line_num, field_count - 1, line);
+        }
+        return 0;
+    }
+    
+    // 필드 할당
+    safe_strcpy(pledge->pledge_id, tokens[0], sizeof(pledge->pledge_id));
+    safe_strcpy(pledge->candidate_id, tokens[1], sizeof(pledge->candidate_id));
+    safe_strcpy(pledge->title, tokens[2], sizeof(pledge->title));
+    safe_strcpy(pledge->content, tokens[3], sizeof(pledge->content));
+    safe_strcpy(pledge->category, tokens[4], sizeof(pledge->category));
+    
+    pledge->like_count = atoi(tokens[5]);
+    pledge->dislike_count = atoi(tokens[6]);
+    pledge->created_time = (time_t)atoll(tokens[7]);
+    
+    return 1;
+}
+
+// 파일에서 선거 데이터 읽기
+int load_elections_from_file(ElectionInfo elections[], int max_count) {
+    FILE* file = fopen(ELECTIONS_FILE, "r");
+    if (!file) {
+        write_error_log("load_elections_from_file", "파일 열기 실패");
+        return 0;
+    }
+    
+    char line[1024];
+    int count = 0;
+    
+    while (fgets(line, sizeof(line), file) && count < max_count) {
+        if (parse_election_line(line, &elections[count])) {
+            count++;
+        }
     }
     
     fclose(file);
@@ -1573,37 +2648,9 @@ int load_candidates_from_file(CandidateInfo candidates[], int max_count) {
     int count = 0;
     
     while (fgets(line, sizeof(line), file) && count < max_count) {
-        // 주석과 빈 줄 건너뛰기
-        if (line[0] == '#' || line[0] == '\n') continue;
-        if (strncmp(line, "COUNT=", 6) == 0) continue;
-        
-        // 데이터 파싱: 후보자ID|이름|정당|번호|선거ID|공약수
-        char* token = strtok(line, "|");
-        if (!token) continue;
-        
-        strncpy(candidates[count].candidate_id, token, sizeof(candidates[count].candidate_id) - 1);
-        
-        token = strtok(NULL, "|");
-        if (!token) continue;
-        strncpy(candidates[count].candidate_name, token, sizeof(candidates[count].candidate_name) - 1);
-        
-        token = strtok(NULL, "|");
-        if (!token) continue;
-        strncpy(candidates[count].party_name, token, sizeof(candidates[count].party_name) - 1);
-        
-        token = strtok(NULL, "|");
-        if (!token) continue;
-        candidates[count].candidate_number = atoi(token);
-        
-        token = strtok(NULL, "|");
-        if (!token) continue;
-        strncpy(candidates[count].election_id, token, sizeof(candidates[count].election_id) - 1);
-        
-        token = strtok(NULL, "|\n");
-        if (!token) continue;
-        candidates[count].pledge_count = atoi(token);
-        
-        count++;
+        if (parse_candidate_line(line, &candidates[count])) {
+            count++;
+        }
     }
     
     fclose(file);
@@ -1611,96 +2658,78 @@ int load_candidates_from_file(CandidateInfo candidates[], int max_count) {
     return count;
 }
 
-// 파일에서 공약 데이터 읽기
-int load_pledges_from_file(PledgeInfo pledges[], int max_count) {
+// 파일에서 선거 데이터를 읽어 새 버전에 등록 (메모리가 부족하면 그때까지 읽은 수 반환)
+int load_election_records(DatasetVersion* version) {
+    FILE* file = fopen(ELECTIONS_FILE, "r");
+    if (!file) {
+        write_error_log("load_election_records", "파일 열기 실패");
+        return 0;
+    }
+    
+    char line[1024];
+    ElectionInfo election;
+    
+    while (fgets(line, sizeof(line), file)) {
+        if (!parse_election_line(line, &election)) continue;
+        if (!dataset_version_add_election(version, &election)) {
+            write_error_log("load_election_records", "선거 레코드 메모리 부족");
+            break;
+        }
+    }
+    
+    fclose(file);
+    printf("📂 선거 정보 %d개를 파일에서 로드했습니다.\n", version->election_count);
+    return version->election_count;
+}
+
+// 파일에서 후보자 데이터를 읽어 새 버전에 등록
+int load_candidate_records(DatasetVersion* version) {
+    FILE* file = fopen(CANDIDATES_FILE, "r");
+    if (!file) {
+        write_error_log("load_candidate_records", "파일 열기 실패");
+        return 0;
+    }
+    
+    char line[1024];
+    CandidateInfo candidate;
+    
+    while (fgets(line, sizeof(line), file)) {
+        if (!parse_candidate_line(line, &candidate)) continue;
+        if (!dataset_version_add_candidate(version, &candidate)) {
+            write_error_log("load_candidate_records", "후보자 레코드 메모리 부족");
+            break;
+        }
+    }
+    
+    fclose(file);
+    printf("📂 후보자 정보 %d개를 파일에서 로드했습니다.\n", version->candidate_count);
+    return version->candidate_count;
+}
+
+// 파일에서 공약 데이터를 읽어 공약 표에 추가 (한 줄씩 파싱하므로 PledgeInfo 배열을 잡지 않음)
+int load_pledge_table(PledgeTable* pledges, StringIntern* strings) {
+    pledge_table_clear(pledges);
+    
     FILE* file = fopen(PLEDGES_FILE, "r");
     if (!file) {
-        write_error_log("load_pledges_from_file", "파일 열기 실패");
+        write_error_log("load_pledge_table", "파일 열기 실패");
         return 0;
     }
     
     char line[2048];
+    PledgeInfo pledge;
     int count = 0;
     int line_num = 0;
     
-    while (fgets(line, sizeof(line), file) && count < max_count) {
+    while (fgets(line, sizeof(line), file)) {
         line_num++;
         
-        // 주석과 빈 줄 건너뛰기
-        if (line[0] == '#' || line[0] == '\n') {
-            continue;
-        }
-        if (strncmp(line, "COUNT=", 6) == 0) {
-            continue;
-        }
-        
-        // 개행 문자 제거
-        line[strcspn(line, "\n")] = 0;
-        
-        // 파이프(|) 개수 확인 - 정확히 7개여야 함 (8개 필드)
-        int pipe_count = 0;
-        for (int i = 0; line[i]; i++) {
-            if (line[i] == '|') pipe_count++;
-        }
-        
-        if (pipe_count != 7) {
-            if (count <= 5) {  // 처음 5개만 로그 출력
-                printf("DEBUG: 라인 %d 건너뛰기 (파이프 개수: %d개): %.50s...\n", 
-                       line_num, pipe_count, line);
-            }
-            continue;
-        }
-        
-        // 데이터 파싱: 공약ID|후보자ID|제목|내용|카테고리|좋아요|싫어요|생성시간
-        // 빈 필드를 고려한 수동 파싱
-        char* tokens[8];
-        char line_copy[2048];
-        strcpy(line_copy, line);
-        
-        int token_count = 0;
-        char* start = line_copy;
-        char* end;
-        
-        // 8개 필드를 순차적으로 파싱
-        for (int i = 0; i < 8 && token_count < 8; i++) {
-            end = strchr(start, '|');
-            if (end) {
-                *end = '\0';  // 구분자를 NULL로 변경
-                tokens[token_count++] = start;
-                start = end + 1;
-            } else if (i == 7) {
-                // 마지막 필드 (생성시간)
-                tokens[token_count++] = start;
-            } else {
-                // 예상치 못한 상황
-                break;
-            }
-        }
-        
-        if (token_count < 8) {
-            continue;
+        // 처음 5개 공약을 읽는 동안만 형식 오류 줄 출력
+        if (!parse_pledge_line(line, &pledge, line_num, count <= 5)) continue;
+        if (!pledge_table_append(pledges, &pledge, strings)) {
+            write_error_log("load_pledge_table", "공약 표 메모리 부족");
+            break;
         }
-        
-        // 필드 할당
-        strncpy(pledges[count].pledge_id, tokens[0], sizeof(pledges[count].pledge_id) - 1);
-        pledges[count].pledge_id[sizeof(pledges[count].pledge_id) - 1] = '\0';
-        
-        strncpy(pledges[count].candidate_id, tokens[1], sizeof(pledges[count].candidate_id) - 1);
-        pledges[count].candidate_id[sizeof(pledges[count].candidate_id) - 1] = '\0';
-        
-        strncpy(pledges[count].title, tokens[2], sizeof(pledges[count].title) - 1);
-        pledges[count].title[sizeof(pledges[count].title) - 1] = '\0';
-        
-        strncpy(pledges[count].content, tokens[3], sizeof(pledges[count].content) - 1);
-        pledges[count].content[sizeof(pledges[count].content) - 1] = '\0';
-        
-        strncpy(pledges[count].category, tokens[4], sizeof(pledges[count].category) - 1);
-        pledges[count].category[sizeof(pledges[count].category) - 1] = '\0';
-        
-        pledges[count].like_count = atoi(tokens[5]);
-        pledges[count].dislike_count = atoi(tokens[6]);
-        pledges[count].created_time = (time_t)atoll(tokens[7]);
-        
         count++;
     }
     
@@ -1709,6 +2738,40 @@ int load_pledges_from_file(PledgeInfo pledges[], int max_count) {
     return count;
 }
 
+// 선거/후보자/공약 파일로 새 데이터 버전을 만듦 (공약 인덱스와 선거 -> 후보자 -> 공약 연결까지, 카운터는 0)
+// 서버 데이터는 건드리지 않으므로 잠금 없이 호출 (메모리 부족 시 NULL)
+DatasetVersion* load_dataset_version(void) {
+    DatasetVersion* version = dataset_version_create();
+    if (!version) {
+        write_error_log("load_dataset_version", "데이터 버전 메모리 할당 실패");
+        return NULL;
+    }
+    
+    // 한 줄에 많아야 한 항목이므로 파일 줄 수만큼 미리 잡아 두면 읽는 동안 다시 할당하지 않음
+    if (!dataset_version_reserve(version, count_file_lines(ELECTIONS_FILE), count_file_lines(CANDIDATES_FILE),
+                                 count_file_lines(PLEDGES_FILE))) {
+        write_error_log("load_dataset_version", "데이터 표 메모리 할당 실패");
+        dataset_version_destroy(version);
+        return NULL;
+    }
+    
+    load_election_records(version);
+    load_candidate_records(version);
+    load_pledge_table(&version->pledges, &version->strings);
+    
+    printf("📂 데이터 문자열 %u개 (%.1f KB), 공약 분야 %d개\n", version->strings.count,
+           string_intern_memory(&version->strings) / 1024.0, version->pledges.category_count);
+    
+    if (!pledge_lookup_rebuild(&version->pledge_index, &version->pledges, &version->strings) ||
+        !dataset_links_rebuild(&version->links, version->elections, version->election_count,
+                               version->candidates, version->candidate_count, &version->pledges, &version->strings)) {
+        write_error_log("load_dataset_version", "공약 인덱스 메모리 할당 실패");
+        dataset_version_destroy(version);
+        return NULL;
+    }
+    return version;
+}
+
 // 업데이트 시간 확인
 time_t get_last_update_time(void) {
     FILE* file = fopen(UPDATE_TIME_FILE, "r");
@@ -1725,6 +2788,156 @@ time_t get_last_update_time(void) {
 // 공약 평가 시스템 구현
 // =====================================================
 
+// 공약 평가 카운터 원자적 접근
+// 쓰기는 공약이 속한 샤드 쓰기 잠금 안에서 평가 변경분만 반영하고, 읽기는 샤드 잠금 없이 수행
+static void add_pledge_counter(int* counter, int delta) {
+    __atomic_add_fetch(counter, delta, __ATOMIC_RELAXED);
+}
+
+static void store_pledge_counter(int* counter, int value) {
+    __atomic_store_n(counter, value, __ATOMIC_RELAXED);
+}
+
+static int load_pledge_counter(const int* counter) {
+    return __atomic_load_n(counter, __ATOMIC_RELAXED);
+}
+
+// 후보자/선거 합계를 공약 카운터로부터 다시 계산 (모든 평가 샤드 잠금을 잡은 상태 또는 게시 전 버전에 호출)
+// 읽는 쪽은 샤드 잠금 없이 읽으므로 새 값을 따로 모은 뒤 원자적으로 기록
+void recount_rollups_locked(DatasetVersion* dataset) {
+    const PledgeTable* pledges = &dataset->pledges;
+    int candidate_count = dataset->candidate_count;
+    int election_count = dataset->election_count;
+    VoteRollup* totals = calloc((size_t)(candidate_count + election_count + 1), sizeof(VoteRollup));
+    if (!totals) {
+        write_error_log("recount_rollups_locked", "메모리 할당 실패");
+        return;
+    }
+    VoteRollup* election_totals = totals + candidate_count;
+    
+    for (int i = 0; i < pledges->count; i++) {
+        int candidate = pledges->candidate_indices[i];
+        if (candidate < 0) continue;
+        
+        int likes = load_pledge_counter(&pledges->likes[i]);
+        int dislikes = load_pledge_counter(&pledges->dislikes[i]);
+        totals[candidate].likes += likes;
+        totals[candidate].dislikes += dislikes;
+        totals[candidate].pledges++;
+        
+        int election = dataset->candidates[candidate].election_index;
+        if (election >= 0) {
+            election_totals[election].likes += likes;
+            election_totals[election].dislikes += dislikes;
+            election_totals[election].pledges++;
+        }
+    }
+    
+    for (int c = 0; c < candidate_count; c++) {
+        VoteRollup* votes = &dataset->candidates[c].votes;
+        store_pledge_counter(&votes->likes, totals[c].likes);
+        store_pledge_counter(&votes->dislikes, totals[c].dislikes);
+        store_pledge_counter(&votes->pledges, totals[c].pledges);
+    }
+    for (int e = 0; e < election_count; e++) {
+        VoteRollup* votes = &dataset->elections[e].votes;
+        store_pledge_counter(&votes->likes, election_totals[e].likes);
+        store_pledge_counter(&votes->dislikes, election_totals[e].dislikes);
+        store_pledge_counter(&votes->pledges, election_totals[e].pledges);
+    }
+    
+    free(totals);
+}
+
+// 공약 카운터로 순위표 다시 만들기 (게시 전 버전 또는 시작 시에만 호출, O(공약 수))
+// 게시된 버전의 순위표는 보드 잠금을 하나씩 잡는 leaderboard_resync로 바로잡음
+// 선거 보드는 dataset_links_rebuild가 채운 공약 -> 후보자 -> 선거 위치를, 분야 보드는 분야 번호를 그대로 사용
+int rebuild_leaderboard_locked(DatasetVersion* dataset) {
+    const PledgeTable* pledges = &dataset->pledges;
+    size_t pledge_slots = (size_t)(pledges->count > 0 ? pledges->count : 1);
+    int32_t* board_of = malloc(pledge_slots * 2 * sizeof(int32_t));
+    int ok = 0;
+    
+    if (board_of) {
+        int32_t* election_of = board_of;
+        int32_t* category_of = board_of + pledge_slots;
+        
+        for (int i = 0; i < pledges->count; i++) {
+            int candidate = pledges->candidate_indices[i];
+            election_of[i] = candidate >= 0 ? dataset->candidates[candidate].election_index : -1;
+            category_of[i] = pledges->category_ids[i];
+        }
+        
+        ok = leaderboard_rebuild(&dataset->leaderboard, pledges->likes, pledges->dislikes, pledges->count,
+                                 election_of, dataset->election_count, category_of, pledges->category_count);
+    }
+    
+    free(board_of);
+    if (!ok) {
+        write_error_log("rebuild_leaderboard_locked", "순위표 메모리 할당 실패");
+    }
+    return ok;
+}
+
+// 후보자/선거 합계에 변경분 반영 (후보자의 공약이 여러 샤드에 흩어져 있으므로 원자적으로 더함)
+static void add_rollup_delta(VoteRollup* votes, int like_delta, int dislike_delta) {
+    if (like_delta) add_pledge_counter(&votes->likes, like_delta);
+    if (dislike_delta) add_pledge_counter(&votes->dislikes, dislike_delta);
+}
+
+// 평가 변경(old_type -> new_type, 0은 평가 없음)을 공약 카운터와 후보자/선거 합계, 순위표에 반영
+// (공약이 속한 샤드의 쓰기 잠금을 잡은 상태에서 호출, 같은 공약의 카운터는 항상 같은 샤드 잠금 아래에서 바뀜)
+// 새 버전은 모든 샤드 잠금 안에서 게시되므로 샤드 잠금을 잡은 동안 읽은 버전이 곧 현재 버전
+static void apply_evaluation_delta_locked(const char* pledge_id, int old_type, int new_type) {
+    if (old_type == new_type) return;
+    
+    int like_delta = (new_type == 1) - (old_type == 1);
+    int dislike_delta = (new_type == -1) - (old_type == -1);
+    
+    int token;
+    DatasetVersion* dataset = acquire_dataset(&token);
+    
+    int index = dataset_version_find_pledge(dataset, pledge_id);
+    if (index >= 0) {
+        PledgeTable* pledges = &dataset->pledges;
+        
+        if (like_delta) add_pledge_counter(&pledges->likes[index], like_delta);
+        if (dislike_delta) add_pledge_counter(&pledges->dislikes[index], dislike_delta);
+        
+        int candidate = pledges->candidate_indices[index];
+        if (candidate >= 0) {
+            CandidateRecord* record = &dataset->candidates[candidate];
+            add_rollup_delta(&record->votes, like_delta, dislike_delta);
+            if (record->election_index >= 0) {
+                add_rollup_delta(&dataset->elections[record->election_index].votes, like_delta, dislike_delta);
+            }
+        }
+        
+        leaderboard_update(&dataset->leaderboard, index, load_pledge_counter(&pledges->likes[index]),
+                           load_pledge_counter(&pledges->dislikes[index]));
+    }
+    
+    release_dataset(token);
+}
+
+// 평가 변경을 WAL에 추가 (샤드 쓰기 잠금을 잡은 상태에서 호출해 같은 평가의 메모리 반영 순서와 로그 순서를 일치시킴)
+static void log_evaluation_change_locked(EvaluationShard* shard, int op, const char* user_id, const char* pledge_id) {
+    int evaluation_type = 0;
+    time_t evaluation_time = time(NULL);
+    
+    if (op == WAL_OP_UPSERT) {
+        const EvaluationRecord* eval = evaluation_store_get(&shard->store, user_id, pledge_id);
+        if (!eval) return;
+        evaluation_type = eval->evaluation_type;
+        evaluation_time = (time_t)eval->evaluation_time;
+    }
+    
+    __atomic_add_fetch(&g_evaluation_version, 1, __ATOMIC_RELAXED);
+    if (!evaluation_wal_append(&g_evaluation_wal, op, user_id, pledge_id, evaluation_type, evaluation_time)) {
+        write_error_log("log_evaluation_change_locked", "WAL 추가 실패 (재시작 시 이 평가는 복구되지 않음)");
+    }
+}
+
 // 공약 평가 요청 처리 (새로운 평가 또는 기존 평가 변경)
 void handle_evaluate_pledge_request(const char* user_id, const char* pledge_id, int evaluation_type, NetworkMessage* response) {
     if (!user_id || !pledge_id || !response) {
@@ -1757,9 +2970,7 @@ void handle_evaluate_pledge_request(const char* user_id, const char* pledge_id,
     
     // 평가 추가/변경
     if (update_evaluation(user_id, pledge_id, evaluation_type)) {
-        // 통계 업데이트
-        update_pledge_statistics(pledge_id);
-        
+        // 통계는 update_evaluation()에서 변경분만큼 바로 반영됨
         response->status_code = STATUS_SUCCESS;
         if (existing_evaluation == 0) {
             // 새로운 평가
@@ -1786,46 +2997,24 @@ void handle_evaluate_pledge_request(const char* user_id, const char* pledge_id,
 int add_evaluation(const char* user_id, const char* pledge_id, int evaluation_type) {
     if (!user_id || !pledge_id) return 0;
     
-#ifdef _WIN32
-    EnterCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_lock(&g_server_data.data_mutex);
-#endif
+    EvaluationShard* shard = evaluation_shards_for(&g_server_data.evaluations, pledge_id);
+    rw_lock_write_lock(&shard->lock);
     
-    // 평가 배열이 가득 찬 경우 확인
-    if (g_server_data.evaluation_count >= 10000) {
-        write_error_log("add_evaluation", "평가 저장 공간 부족");
-#ifdef _WIN32
-        LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-        pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
+    // 새 평가 정보 추가 (저장 공간이 가득 차면 실패)
+    int old_type = 0;
+    if (!evaluation_store_upsert(&shard->store, user_id, pledge_id,
+                                 evaluation_type, time(NULL), &old_type)) {
+        write_error_log("add_evaluation", "평가 저장 메모리 부족");
+        rw_lock_write_unlock(&shard->lock);
         return 0;
     }
     
-    // 새 평가 정보 추가
-    EvaluationInfo* eval = &g_server_data.evaluations[g_server_data.evaluation_count];
-    strcpy(eval->user_id, user_id);
-    strcpy(eval->pledge_id, pledge_id);
-    eval->evaluation_type = evaluation_type;
-    eval->evaluation_time = time(NULL);
+    apply_evaluation_delta_locked(pledge_id, old_type, evaluation_type);
     
-    g_server_data.evaluation_count++;
-    
-    // 평가 데이터를 파일에 저장
-    FILE* file = fopen("data/evaluations.txt", "a");
-    if (file) {
-        fprintf(file, "%s|%s|%d|%lld\n", 
-                eval->user_id, eval->pledge_id, eval->evaluation_type, 
-                (long long)eval->evaluation_time);
-        fclose(file);
-    }
+    // WAL에 기록 (디스크 반영은 그룹 커밋 스레드가 담당)
+    log_evaluation_change_locked(shard, WAL_OP_UPSERT, user_id, pledge_id);
     
-#ifdef _WIN32
-    LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
+    rw_lock_write_unlock(&shard->lock);
     
     write_log("INFO", "새 평가 추가 완료");
     return 1;
@@ -1835,94 +3024,41 @@ int add_evaluation(const char* user_id, const char* pledge_id, int evaluation_ty
 int get_user_evaluation(const char* user_id, const char* pledge_id) {
     if (!user_id || !pledge_id) return 0;
     
-#ifdef _WIN32
-    EnterCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_lock(&g_server_data.data_mutex);
-#endif
+    EvaluationShard* shard = evaluation_shards_for(&g_server_data.evaluations, pledge_id);
+    rw_lock_read_lock(&shard->lock);
     
-    for (int i = 0; i < g_server_data.evaluation_count; i++) {
-        if (strcmp(g_server_data.evaluations[i].user_id, user_id) == 0 &&
-            strcmp(g_server_data.evaluations[i].pledge_id, pledge_id) == 0) {
-            int evaluation_type = g_server_data.evaluations[i].evaluation_type;
-#ifdef _WIN32
-            LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-            pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
-            return evaluation_type; // 1: 좋아요, -1: 싫어요, 0: 취소됨
-        }
-    }
+    EvaluationRecord* eval = evaluation_store_get(&shard->store, user_id, pledge_id);
+    int evaluation_type = eval ? eval->evaluation_type : 0; // 1: 좋아요, -1: 싫어요, 0: 평가 없음
     
-#ifdef _WIN32
-    LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
+    rw_lock_read_unlock(&shard->lock);
     
-    return 0; // 평가 없음
+    return evaluation_type;
 }
 
 // 평가 추가/변경 (기존 평가가 있으면 변경, 없으면 추가)
 int update_evaluation(const char* user_id, const char* pledge_id, int evaluation_type) {
     if (!user_id || !pledge_id) return 0;
     
-#ifdef _WIN32
-    EnterCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_lock(&g_server_data.data_mutex);
-#endif
-    
-    // 기존 평가 찾기
-    for (int i = 0; i < g_server_data.evaluation_count; i++) {
-        if (strcmp(g_server_data.evaluations[i].user_id, user_id) == 0 &&
-            strcmp(g_server_data.evaluations[i].pledge_id, pledge_id) == 0) {
-            // 기존 평가 변경
-            g_server_data.evaluations[i].evaluation_type = evaluation_type;
-            g_server_data.evaluations[i].evaluation_time = time(NULL);
-            
-            // 파일에 전체 평가 데이터 다시 저장
-            save_evaluations_to_file();
-            
-#ifdef _WIN32
-            LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-            pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
-            write_log("INFO", "기존 평가 변경 완료");
-            return 1;
-        }
-    }
+    EvaluationShard* shard = evaluation_shards_for(&g_server_data.evaluations, pledge_id);
+    rw_lock_write_lock(&shard->lock);
     
-    // 새 평가 추가
-    if (g_server_data.evaluation_count >= 10000) {
-        write_error_log("update_evaluation", "평가 저장 공간 부족");
-#ifdef _WIN32
-        LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-        pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
+    // 기존 평가가 있으면 변경, 없으면 추가
+    int old_type = 0;
+    if (!evaluation_store_upsert(&shard->store, user_id, pledge_id,
+                                 evaluation_type, time(NULL), &old_type)) {
+        write_error_log("update_evaluation", "평가 저장 메모리 부족");
+        rw_lock_write_unlock(&shard->lock);
         return 0;
     }
     
-    EvaluationInfo* eval = &g_server_data.evaluations[g_server_data.evaluation_count];
-    strcpy(eval->user_id, user_id);
-    strcpy(eval->pledge_id, pledge_id);
-    eval->evaluation_type = evaluation_type;
-    eval->evaluation_time = time(NULL);
-    
-    g_server_data.evaluation_count++;
+    apply_evaluation_delta_locked(pledge_id, old_type, evaluation_type);
     
-    // 파일에 전체 평가 데이터 저장
-    save_evaluations_to_file();
+    // WAL에 기록 (디스크 반영은 그룹 커밋 스레드가 담당)
+    log_evaluation_change_locked(shard, WAL_OP_UPSERT, user_id, pledge_id);
     
-#ifdef _WIN32
-    LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
+    rw_lock_write_unlock(&shard->lock);
     
-    write_log("INFO", "새 평가 추가 완료");
+    write_log("INFO", old_type != 0 ? "기존 평가 변경 완료" : "새 평가 추가 완료");
     return 1;
 }
 
@@ -1930,41 +3066,23 @@ int update_evaluation(const char* user_id, const char* pledge_id, int evaluation
 int cancel_evaluation(const char* user_id, const char* pledge_id) {
     if (!user_id || !pledge_id) return 0;
     
-#ifdef _WIN32
-    EnterCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_lock(&g_server_data.data_mutex);
-#endif
+    EvaluationShard* shard = evaluation_shards_for(&g_server_data.evaluations, pledge_id);
+    rw_lock_write_lock(&shard->lock);
     
     // 기존 평가 찾아서 제거
-    for (int i = 0; i < g_server_data.evaluation_count; i++) {
-        if (strcmp(g_server_data.evaluations[i].user_id, user_id) == 0 &&
-            strcmp(g_server_data.evaluations[i].pledge_id, pledge_id) == 0) {
-            
-            // 배열에서 해당 평가 제거 (뒤의 요소들을 앞으로 이동)
-            for (int j = i; j < g_server_data.evaluation_count - 1; j++) {
-                g_server_data.evaluations[j] = g_server_data.evaluations[j + 1];
-            }
-            g_server_data.evaluation_count--;
-            
-            // 파일에 전체 평가 데이터 다시 저장
-            save_evaluations_to_file();
-            
-#ifdef _WIN32
-            LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-            pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
-            write_log("INFO", "평가 취소 완료");
-            return 1;
-        }
+    int old_type = 0;
+    if (evaluation_store_remove(&shard->store, user_id, pledge_id, &old_type)) {
+        apply_evaluation_delta_locked(pledge_id, old_type, 0);
+        
+        // WAL에 기록 (디스크 반영은 그룹 커밋 스레드가 담당)
+        log_evaluation_change_locked(shard, WAL_OP_REMOVE, user_id, pledge_id);
+        
+        rw_lock_write_unlock(&shard->lock);
+        write_log("INFO", "평가 취소 완료");
+        return 1;
     }
     
-#ifdef _WIN32
-    LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
+    rw_lock_write_unlock(&shard->lock);
     
     return 0; // 취소할 평가가 없음
 }
@@ -1989,144 +3107,453 @@ void handle_cancel_evaluation_request(const char* user_id, const char* pledge_id
     
     // 평가 취소
     if (cancel_evaluation(user_id, pledge_id)) {
-        // 통계 업데이트
-        update_pledge_statistics(pledge_id);
+        // 통계는 cancel_evaluation()에서 변경분만큼 바로 반영됨
+        response->status_code = STATUS_SUCCESS;
+        snprintf(response->data, sizeof(response->data), 
+                "%s 평가가 취소되었습니다.", 
+                existing_evaluation == 1 ? "좋아요" : "싫어요");
+        
+        write_access_log(user_id, "평가 취소 완료");
+    } else {
+        response->status_code = STATUS_INTERNAL_ERROR;
+        strcpy(response->data, "평가 취소 중 오류가 발생했습니다.");
+        write_error_log("handle_cancel_evaluation_request", "평가 취소 실패");
+    }
+}
+
+// 사용자 평가 조회 요청 처리
+void handle_get_user_evaluation_request(const char* user_id, const char* pledge_id, NetworkMessage* response) {
+    if (!user_id || !pledge_id || !response) {
+        response->status_code = STATUS_BAD_REQUEST;
+        strcpy(response->data, "잘못된 매개변수입니다.");
+        return;
+    }
+    
+    int evaluation = get_user_evaluation(user_id, pledge_id);
+    
+    // 단순히 평가 타입만 반환
+    snprintf(response->data, sizeof(response->data), "%d", evaluation);
+    
+    response->status_code = STATUS_SUCCESS;
+    write_log("INFO", "사용자 평가 조회 완료");
+}
+
+// 스냅샷 저장 결과를 통계에 반영
+static void record_snapshot_result(int ok, const EvaluationSnapshotImage* image, const EvaluationSnapshotResult* result) {
+    if (!ok) {
+        __atomic_add_fetch(&g_snapshot_stats.failures, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    __atomic_store_n(&g_snapshot_stats.last_records, result->records, __ATOMIC_RELAXED);
+    __atomic_store_n(&g_snapshot_stats.last_bytes, result->bytes, __ATOMIC_RELAXED);
+    __atomic_store_n(&g_snapshot_stats.last_capture_us, (long)(image->capture_ms * 1000.0), __ATOMIC_RELAXED);
+    __atomic_store_n(&g_snapshot_stats.last_write_us, (long)(result->elapsed_ms * 1000.0), __ATOMIC_RELAXED);
+    __atomic_store_n(&g_snapshot_stats.last_time, result->created_at, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&g_snapshot_stats.snapshots, 1, __ATOMIC_RELAXED);
+}
+
+// 평가 데이터를 스냅샷으로 저장 (잠금 없이 저장소를 직접 읽으므로 다른 스레드가 없을 때만 호출)
+// 임시 파일에 쓴 뒤 교체하므로 저장 중 종료되어도 기존 스냅샷은 남음
+int save_evaluations_to_file(void) {
+    EvaluationSnapshotImage image;
+    EvaluationSnapshotResult result;
+    
+    evaluation_snapshot_begin(&image);
+    for (int i = 0; i < EVALUATION_SHARD_COUNT; i++) {
+        if (!evaluation_snapshot_capture(&g_server_data.evaluations.shards[i].store, &image)) {
+            evaluation_snapshot_release(&image);
+            record_snapshot_result(0, NULL, NULL);
+            return 0;
+        }
+    }
+    int ok = evaluation_snapshot_write(EVALUATION_SNAPSHOT_FILE, EVALUATION_SNAPSHOT_TEMP_FILE, &image, &result);
+    record_snapshot_result(ok, &image, &result);
+    evaluation_snapshot_release(&image);
+    
+    if (!ok) {
+        printf("❌ 평가 스냅샷 저장 실패: %s\n", EVALUATION_SNAPSHOT_FILE);
+        return 0;
+    }
+    g_snapshot_version = __atomic_load_n(&g_evaluation_version, __ATOMIC_RELAXED);
+    printf("✅ 평가 스냅샷 저장 완료: %d개 평가, %ld바이트 (%.1fms)\n",
+           result.records, result.bytes, result.elapsed_ms);
+    write_log("INFO", "평가 스냅샷 저장 완료");
+    return 1;
+}
+
+// 실행 중 평가 스냅샷 저장
+// 1. WAL을 evaluations.wal.old로 교체 (이후 변경은 새 WAL에만 기록)
+// 2. 샤드마다 읽기 잠금 안에서 평가 배열만 복사 (그 샤드의 평가 변경만 복사 동안 대기)
+//    샤드 사이의 복사 시점은 다르지만, 그 사이 변경은 모두 새 WAL에 남고 재생은 평가마다 멱등이므로 복구 결과는 같음
+// 3. 잠금 없이 스냅샷 기록 후 교체, 성공하면 이전 WAL 삭제 (스냅샷이 이전 WAL 내용을 모두 포함)
+int take_evaluation_snapshot(void) {
+    // 직전 스냅샷이 실패해 이전 WAL이 남아 있으면 교체하지 않음 (재시작 시 두 로그를 모두 재생)
+    FILE* archive = fopen(EVALUATION_WAL_ARCHIVE_FILE, "rb");
+    if (archive) {
+        fclose(archive);
+    } else if (!evaluation_wal_rotate(&g_evaluation_wal, EVALUATION_WAL_ARCHIVE_FILE)) {
+        write_error_log("take_evaluation_snapshot", "WAL 교체 실패 (스냅샷은 저장하지만 WAL은 유지)");
+    }
+    
+    EvaluationSnapshotImage image;
+    EvaluationSnapshotResult result;
+    
+    // 복사 전에 읽은 버전이므로 복사 중 변경이 있으면 다음 주기에 다시 저장됨
+    unsigned long version = __atomic_load_n(&g_evaluation_version, __ATOMIC_RELAXED);
+    int ok = 1;
+    evaluation_snapshot_begin(&image);
+    for (int i = 0; i < EVALUATION_SHARD_COUNT && ok; i++) {
+        EvaluationShard* shard = &g_server_data.evaluations.shards[i];
+        rw_lock_read_lock(&shard->lock);
+        ok = evaluation_snapshot_capture(&shard->store, &image);
+        rw_lock_read_unlock(&shard->lock);
+    }
+    
+    if (!ok) {
+        evaluation_snapshot_release(&image);
+        record_snapshot_result(0, NULL, NULL);
+        return 0;
+    }
+    
+    ok = evaluation_snapshot_write(EVALUATION_SNAPSHOT_FILE, EVALUATION_SNAPSHOT_TEMP_FILE, &image, &result);
+    record_snapshot_result(ok, &image, &result);
+    if (ok) {
+        g_snapshot_version = version;
+        remove(EVALUATION_WAL_ARCHIVE_FILE);
+        printf("📸 평가 스냅샷 저장: %d개 평가, %ld바이트 (복사 %.2fms, 기록 %.1fms)\n",
+               result.records, result.bytes, image.capture_ms, result.elapsed_ms);
+    }
+    evaluation_snapshot_release(&image);
+    return ok;
+}
+
+// 스냅샷 스레드 본체 (1초 단위로 종료 요청 확인, 변경이 있을 때만 저장)
+static void run_snapshotter(void) {
+    int elapsed = 0;
+    
+    while (g_snapshot_running) {
+#ifdef _WIN32
+        Sleep(1000);
+#else
+        sleep(1);
+#endif
+        if (++elapsed < g_snapshot_interval) continue;
+        elapsed = 0;
+        
+        if (g_snapshot_running &&
+            __atomic_load_n(&g_evaluation_version, __ATOMIC_RELAXED) != g_snapshot_version) {
+            take_evaluation_snapshot();
+        }
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI snapshot_thread(LPVOID param) {
+    (void)param;
+    run_snapshotter();
+    return 0;
+}
+#else
+static void* snapshot_thread(void* param) {
+    (void)param;
+    run_snapshotter();
+    return NULL;
+}
+#endif
+
+// 스냅샷 스레드 시작 (interval_seconds가 0이면 종료 시에만 저장)
+int start_snapshotter(int interval_seconds) {
+    g_snapshot_interval = interval_seconds;
+    if (interval_seconds <= 0) return 1;
+    
+    g_snapshot_running = 1;
+#ifdef _WIN32
+    g_snapshot_thread = CreateThread(NULL, 0, snapshot_thread, NULL, 0, NULL);
+    if (!g_snapshot_thread) {
+        g_snapshot_running = 0;
+        return 0;
+    }
+#else
+    if (pthread_create(&g_snapshot_thread, NULL, snapshot_thread, NULL) != 0) {
+        g_snapshot_running = 0;
+        return 0;
+    }
+#endif
+    return 1;
+}
+
+void stop_snapshotter(void) {
+    if (!g_snapshot_running) return;
+    
+    g_snapshot_running = 0;
+#ifdef _WIN32
+    WaitForSingleObject(g_snapshot_thread, INFINITE);
+    CloseHandle(g_snapshot_thread);
+    g_snapshot_thread = NULL;
+#else
+    pthread_join(g_snapshot_thread, NULL);
+#endif
+}
+
+// 중복 평가 확인
+int check_duplicate_evaluation(const char* user_id, const char* pledge_id) {
+    if (!user_id || !pledge_id) return 0;
+    
+    EvaluationShard* shard = evaluation_shards_for(&g_server_data.evaluations, pledge_id);
+    rw_lock_read_lock(&shard->lock);
+    
+    int duplicate = evaluation_store_get(&shard->store, user_id, pledge_id) != NULL;
+    
+    rw_lock_read_unlock(&shard->lock);
+    
+    return duplicate; // 1: 중복 발견, 0: 중복 없음
+}
+
+// 공약 하나의 포스팅 리스트를 따라가며 좋아요/싫어요 수 집계 (공약이 속한 평가 샤드 잠금을 잡은 상태에서 호출)
+// 데이터와 평가는 인턴 테이블이 달라 핸들 대신 문자열로 평가 쪽 샤드와 핸들을 찾음
+static void count_pledge_evaluations(const char* pledge_id, int* likes, int* dislikes) {
+    const EvaluationStore* store = &evaluation_shards_for(&g_server_data.evaluations, pledge_id)->store;
+    int slot = evaluation_store_first_for_pledge(store, pledge_id);
+    for (; slot >= 0; slot = evaluation_store_next_for_pledge(store, slot)) {
+        int evaluation_type = evaluation_store_at(store, slot)->evaluation_type;
+        if (evaluation_type == 1) {
+            (*likes)++;
+        } else if (evaluation_type == -1) {
+            (*dislikes)++;
+        }
+        // evaluation_type == 0인 경우는 취소된 평가이므로 집계하지 않음
+    }
+}
+
+// 공약마다 좋아요/싫어요 수 집계 (likes/dislikes는 공약 수 크기, 0으로 초기화)
+// 평가마다 pledge_id 문자열을 찾지 않고 공약당 한 번만 핸들을 찾음
+static void count_evaluations_by_pledge(const DatasetVersion* dataset, int* likes, int* dislikes) {
+    for (int index = 0; index < dataset->pledges.count; index++) {
+        StringHandle pledge_id = dataset->pledges.ids[index];
         
-        response->status_code = STATUS_SUCCESS;
-        snprintf(response->data, sizeof(response->data), 
-                "%s 평가가 취소되었습니다.", 
-                existing_evaluation == 1 ? "좋아요" : "싫어요");
+        // 같은 ID의 공약이 여러 개면 인덱스가 가리키는 공약에만 집계 (증분 갱신과 같은 기준)
+        if (pledge_lookup_find(&dataset->pledge_index, pledge_id) != index) continue;
         
-        write_access_log(user_id, "평가 취소 완료");
-    } else {
-        response->status_code = STATUS_INTERNAL_ERROR;
-        strcpy(response->data, "평가 취소 중 오류가 발생했습니다.");
-        write_error_log("handle_cancel_evaluation_request", "평가 취소 실패");
+        count_pledge_evaluations(dataset_version_string(dataset, pledge_id), &likes[index], &dislikes[index]);
     }
 }
 
-// 사용자 평가 조회 요청 처리
-void handle_get_user_evaluation_request(const char* user_id, const char* pledge_id, NetworkMessage* response) {
-    if (!user_id || !pledge_id || !response) {
-        response->status_code = STATUS_BAD_REQUEST;
-        strcpy(response->data, "잘못된 매개변수입니다.");
+// 모든 공약 카운터를 평가 데이터로부터 다시 계산 (O(공약 수 + 평가 수))
+// 시작 시 평가를 로드한 뒤에만 사용
+void recount_pledge_statistics_locked(DatasetVersion* dataset) {
+    int pledge_count = dataset->pledges.count;
+    if (pledge_count <= 0) return;
+    
+    int* likes = calloc((size_t)pledge_count * 2, sizeof(int));
+    if (!likes) {
+        write_error_log("recount_pledge_statistics_locked", "메모리 할당 실패");
         return;
     }
+    int* dislikes = likes + pledge_count;
     
-    int evaluation = get_user_evaluation(user_id, pledge_id);
-    
-    // 단순히 평가 타입만 반환
-    snprintf(response->data, sizeof(response->data), "%d", evaluation);
+    count_evaluations_by_pledge(dataset, likes, dislikes);
+    for (int i = 0; i < pledge_count; i++) {
+        store_pledge_counter(&dataset->pledges.likes[i], likes[i]);
+        store_pledge_counter(&dataset->pledges.dislikes[i], dislikes[i]);
+    }
     
-    response->status_code = STATUS_SUCCESS;
-    write_log("INFO", "사용자 평가 조회 완료");
+    free(likes);
+    write_log("INFO", "공약 통계 재계산 완료");
 }
 
-// 평가 데이터를 파일에 저장 (전체 덮어쓰기)
-int save_evaluations_to_file(void) {
-    printf("💾 평가 데이터 파일 저장 시작 (총 %d개 평가)\n", g_server_data.evaluation_count);
-    
-    FILE* file = fopen("data/evaluations.txt", "w");
-    if (!file) {
-        printf("❌ 평가 파일 열기 실패: data/evaluations.txt\n");
-        write_error_log("save_evaluations_to_file", "파일 열기 실패");
+// 게시 전 새 버전의 공약 카운터를 현재 버전에서 옮겨 옴 (모든 평가 샤드 잠금을 잡은 상태에서 호출)
+// 현재 버전의 카운터는 평가 원본과 같으므로 같은 ID의 공약은 그대로 복사하고 (O(공약 수)),
+// 새로 생긴 공약만 평가 저장소에서 집계
+static void carry_over_pledge_counters_locked(DatasetVersion* next, const DatasetVersion* current) {
+    PledgeTable* pledges = &next->pledges;
+    
+    for (int index = 0; index < pledges->count; index++) {
+        int likes = 0;
+        int dislikes = 0;
+        
+        if (pledge_lookup_find(&next->pledge_index, pledges->ids[index]) == index) {
+            const char* pledge_id = dataset_version_string(next, pledges->ids[index]);
+            int previous = current ? dataset_version_find_pledge(current, pledge_id) : -1;
+            if (previous >= 0) {
+                likes = load_pledge_counter(&current->pledges.likes[previous]);
+                dislikes = load_pledge_counter(&current->pledges.dislikes[previous]);
+            } else {
+                count_pledge_evaluations(pledge_id, &likes, &dislikes);
+            }
+        }
+        
+        store_pledge_counter(&pledges->likes[index], likes);
+        store_pledge_counter(&pledges->dislikes[index], dislikes);
+    }
+}
+
+// 새로고침으로 저장한 파일을 새 데이터 버전으로 만들어 게시 (RCU, 새로고침 스레드 하나만 호출)
+// 1. 잠금 없이 파일에서 새 버전을 끝까지 만듦 (문자열, 공약 표, 인덱스, 인접 목록)
+// 2. 모든 평가 샤드 읽기 잠금 안에서 카운터를 옮기고 합계/순위표를 만든 뒤 포인터를 한 번에 교체
+//    (이 짧은 구간에는 평가 추가/변경만 대기하고, 조회는 옛 버전이나 새 버전 중 하나를 통째로 읽음)
+// 3. 옛 버전을 읽던 요청이 모두 끝나면 해제
+int refresh_dataset(void) {
+    double start = now_ms();
+    DatasetVersion* next = load_dataset_version();
+    if (!next) {
+        printf("❌ 새 데이터 버전을 만들지 못해 기존 데이터를 유지합니다\n");
         return 0;
     }
+    double built = now_ms();
+    
+    evaluation_shards_lock_all(&g_server_data.evaluations);
+    DatasetVersion* current = __atomic_load_n(&g_server_data.dataset, __ATOMIC_ACQUIRE);
+    carry_over_pledge_counters_locked(next, current);
+    recount_rollups_locked(next);
+    rebuild_leaderboard_locked(next);
+    next->number = current ? current->number + 1 : 1;
+    __atomic_store_n(&g_server_data.dataset, next, __ATOMIC_SEQ_CST);
+    evaluation_shards_unlock_all(&g_server_data.evaluations);
+    double published = now_ms();
+    
+    epoch_synchronize(&g_server_data.dataset_epoch);
+    dataset_version_destroy(current);
+    
+    printf("📂 데이터 버전 #%lu 게시: 선거 %d개, 후보자 %d개, 공약 %d개 (생성 %.1fms, 평가 대기 %.2fms, 옛 버전 회수 대기 %.2fms)\n",
+           next->number, next->election_count, next->candidate_count, next->pledges.count,
+           built - start, published - built, now_ms() - published);
+    fflush(stdout);
+    return 1;
+}
+
+// 공약 카운터를 평가 원본과 비교 (repair가 1이면 불일치 공약을 바로잡음)
+// 평가 처리는 샤드 쓰기 잠금 안에서만 카운터를 쓰므로 모든 샤드를 읽기 잠금으로 잡으면 정확히 비교 가능
+// 바로잡을 때는 게시된 버전의 카운터/합계를 직접 쓰므로 모든 샤드를 쓰기 잠금으로 잡음
+// (모든 샤드를 읽기 잠금으로 잡고 카운터를 옮기는 refresh_dataset과 겹치면 고친 값이 새 버전으로 넘어가지 않음)
+int verify_pledge_counters(int repair) {
+    if (repair) {
+        evaluation_shards_write_lock_all(&g_server_data.evaluations);
+    } else {
+        evaluation_shards_lock_all(&g_server_data.evaluations);
+    }
+    int token;
+    DatasetVersion* dataset = acquire_dataset(&token);
+    
+    int pledge_count = dataset->pledges.count;
+    int mismatches = 0;
+    int* likes = calloc((size_t)(pledge_count > 0 ? pledge_count : 1) * 2, sizeof(int));
+    
+    if (likes) {
+        int* dislikes = likes + pledge_count;
+        count_evaluations_by_pledge(dataset, likes, dislikes);
+        
+        for (int i = 0; i < pledge_count; i++) {
+            PledgeTable* pledges = &dataset->pledges;
+            int like_count = load_pledge_counter(&pledges->likes[i]);
+            int dislike_count = load_pledge_counter(&pledges->dislikes[i]);
+            
+            if (like_count != likes[i] || dislike_count != dislikes[i]) {
+                mismatches++;
+                printf("⚠️  카운터 불일치: %s 좋아요 %d (실제 %d), 싫어요 %d (실제 %d)\n",
+                       dataset_version_string(dataset, pledges->ids[i]), like_count, likes[i], dislike_count, dislikes[i]);
+                if (repair) {
+                    store_pledge_counter(&pledges->likes[i], likes[i]);
+                    store_pledge_counter(&pledges->dislikes[i], dislikes[i]);
+                }
+            }
+        }
+        
+        if (repair && mismatches > 0) {
+            recount_rollups_locked(dataset);
+            leaderboard_resync(&dataset->leaderboard, likes, dislikes);
+        }
+        
+        __atomic_add_fetch(&g_counter_check_stats.runs, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&g_counter_check_stats.mismatches, mismatches, __ATOMIC_RELAXED);
+        __atomic_store_n(&g_counter_check_stats.last_checked, pledge_count, __ATOMIC_RELAXED);
+        __atomic_store_n(&g_counter_check_stats.last_mismatches, mismatches, __ATOMIC_RELAXED);
+        __atomic_store_n(&g_counter_check_stats.last_run, time(NULL), __ATOMIC_RELAXED);
+    }
     
-    fprintf(file, "# 평가 정보 데이터\n");
-    fprintf(file, "# 형식: 사용자ID|공약ID|평가타입|평가시간\n");
-    fprintf(file, "# 평가타입: 1=좋아요, -1=싫어요\n");
+    release_dataset(token);
+    if (repair) {
+        evaluation_shards_write_unlock_all(&g_server_data.evaluations);
+    } else {
+        evaluation_shards_unlock_all(&g_server_data.evaluations);
+    }
     
-    for (int i = 0; i < g_server_data.evaluation_count; i++) {
-        fprintf(file, "%s|%s|%d|%lld\n",
-                g_server_data.evaluations[i].user_id,
-                g_server_data.evaluations[i].pledge_id,
-                g_server_data.evaluations[i].evaluation_type,
-                (long long)g_server_data.evaluations[i].evaluation_time);
-        printf("   📝 저장: %s|%s|%d\n", 
-               g_server_data.evaluations[i].user_id,
-               g_server_data.evaluations[i].pledge_id,
-               g_server_data.evaluations[i].evaluation_type);
+    if (!likes) {
+        write_error_log("verify_pledge_counters", "메모리 할당 실패");
+        return -1;
     }
+    free(likes);
     
-    fclose(file);
-    printf("✅ 평가 데이터 파일 저장 완료: %d개 평가\n", g_server_data.evaluation_count);
-    write_log("INFO", "평가 데이터 파일 저장 완료");
-    return 1;
+    if (mismatches > 0) {
+        write_error_log("verify_pledge_counters", repair ? "평가 카운터 불일치 발견 (복구함)" : "평가 카운터 불일치 발견");
+    }
+    return mismatches;
 }
 
-// 중복 평가 확인
-int check_duplicate_evaluation(const char* user_id, const char* pledge_id) {
-    if (!user_id || !pledge_id) return 0;
-    
-#ifdef _WIN32
-    EnterCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_lock(&g_server_data.data_mutex);
-#endif
+// 카운터 검증 스레드 본체 (1초 단위로 종료 요청 확인)
+static void run_counter_checker(void) {
+    int elapsed = 0;
     
-    for (int i = 0; i < g_server_data.evaluation_count; i++) {
-        if (strcmp(g_server_data.evaluations[i].user_id, user_id) == 0 &&
-            strcmp(g_server_data.evaluations[i].pledge_id, pledge_id) == 0) {
+    while (g_counter_checker_running) {
 #ifdef _WIN32
-            LeaveCriticalSection(&g_server_data.data_mutex);
+        Sleep(1000);
 #else
-            pthread_mutex_unlock(&g_server_data.data_mutex);
+        sleep(1);
 #endif
-            return 1; // 중복 발견
+        if (++elapsed < g_counter_check_interval) continue;
+        elapsed = 0;
+        
+        if (g_counter_checker_running) {
+            verify_pledge_counters(1);
         }
     }
-    
-#ifdef _WIN32
-    LeaveCriticalSection(&g_server_data.data_mutex);
-#else
-    pthread_mutex_unlock(&g_server_data.data_mutex);
-#endif
-    
-    return 0; // 중복 없음
 }
 
-// 공약 통계 업데이트
-void update_pledge_statistics(const char* pledge_id) {
-    if (!pledge_id) return;
-    
-    int like_count = 0;
-    int dislike_count = 0;
-    
 #ifdef _WIN32
-    EnterCriticalSection(&g_server_data.data_mutex);
+static DWORD WINAPI counter_checker_thread(LPVOID param) {
+    (void)param;
+    run_counter_checker();
+    return 0;
+}
 #else
-    pthread_mutex_lock(&g_server_data.data_mutex);
+static void* counter_checker_thread(void* param) {
+    (void)param;
+    run_counter_checker();
+    return NULL;
+}
 #endif
+
+// 평가 카운터 검증 스레드 시작 (interval_seconds가 0이면 실행하지 않음)
+int start_counter_checker(int interval_seconds) {
+    g_counter_check_interval = interval_seconds;
+    if (interval_seconds <= 0) return 1;
     
-    // 해당 공약의 모든 평가 집계
-    for (int i = 0; i < g_server_data.evaluation_count; i++) {
-        if (strcmp(g_server_data.evaluations[i].pledge_id, pledge_id) == 0) {
-            if (g_server_data.evaluations[i].evaluation_type == 1) {
-                like_count++;
-            } else if (g_server_data.evaluations[i].evaluation_type == -1) {
-                dislike_count++;
-            }
-            // evaluation_type == 0인 경우는 취소된 평가이므로 집계하지 않음
-        }
+    g_counter_checker_running = 1;
+#ifdef _WIN32
+    g_counter_checker_thread = CreateThread(NULL, 0, counter_checker_thread, NULL, 0, NULL);
+    if (!g_counter_checker_thread) {
+        g_counter_checker_running = 0;
+        return 0;
     }
-    
-    // 공약 정보에서 해당 공약 찾아서 통계 업데이트
-    for (int i = 0; i < g_server_data.pledge_count; i++) {
-        if (strcmp(g_server_data.pledges[i].pledge_id, pledge_id) == 0) {
-            g_server_data.pledges[i].like_count = like_count;
-            g_server_data.pledges[i].dislike_count = dislike_count;
-            break;
-        }
+#else
+    if (pthread_create(&g_counter_checker_thread, NULL, counter_checker_thread, NULL) != 0) {
+        g_counter_checker_running = 0;
+        return 0;
     }
+#endif
+    return 1;
+}
+
+void stop_counter_checker(void) {
+    if (!g_counter_checker_running) return;
     
+    g_counter_checker_running = 0;
 #ifdef _WIN32
-    LeaveCriticalSection(&g_server_data.data_mutex);
+    WaitForSingleObject(g_counter_checker_thread, INFINITE);
+    CloseHandle(g_counter_checker_thread);
+    g_counter_checker_thread = NULL;
 #else
-    pthread_mutex_unlock(&g_server_data.data_mutex);
+    pthread_join(g_counter_checker_thread, NULL);
 #endif
-    
-    write_log("INFO", "공약 통계 업데이트 완료");
 }
 
 // 공약 통계 요청 처리
@@ -2137,15 +3564,25 @@ void handle_get_statistics_request(const char* pledge_id, NetworkMessage* respon
         return;
     }
     
-    // 해당 공약 찾기
+    // 해당 공약 찾기 (현재 데이터 버전에서 복사, 잠금은 사용하지 않음)
+    PledgeInfo pledge_copy;
     PledgeInfo* pledge = NULL;
-    for (int i = 0; i < g_server_data.pledge_count; i++) {
-        if (strcmp(g_server_data.pledges[i].pledge_id, pledge_id) == 0) {
-            pledge = &g_server_data.pledges[i];
-            break;
-        }
+    
+    int token;
+    DatasetVersion* dataset = acquire_dataset(&token);
+    
+    int index = dataset_version_find_pledge(dataset, pledge_id);
+    if (index >= 0) {
+        const PledgeTable* pledges = &dataset->pledges;
+        safe_strcpy(pledge_copy.pledge_id, dataset_version_string(dataset, pledges->ids[index]), sizeof(pledge_copy.pledge_id));
+        safe_strcpy(pledge_copy.title, dataset_version_string(dataset, pledges->cold[index].title), sizeof(pledge_copy.title));
+        pledge_copy.like_count = load_pledge_counter(&pledges->likes[index]);
+        pledge_copy.dislike_count = load_pledge_counter(&pledges->dislikes[index]);
+        pledge = &pledge_copy;
     }
     
+    release_dataset(token);
+    
     if (!pledge) {
         response->status_code = STATUS_NOT_FOUND;
         strcpy(response->data, "해당 공약을 찾을 수 없습니다.");
@@ -2180,63 +3617,481 @@ void handle_get_statistics_request(const char* pledge_id, NetworkMessage* respon
     write_log("INFO", "공약 통계 정보 제공 완료");
 }
 
-// 평가 데이터 파일 로드
-int load_evaluations_from_file(void) {
-    FILE* file = fopen("data/evaluations.txt", "r");
+// 일괄 통계 응답에 공약 한 줄 추가 (acquire_dataset으로 받은 버전 사용)
+static int append_pledge_statistics_line(Frame* response, const DatasetVersion* dataset, int index) {
+    const PledgeTable* pledges = &dataset->pledges;
+    int like_count = load_pledge_counter(&pledges->likes[index]);
+    int dislike_count = load_pledge_counter(&pledges->dislikes[index]);
+    int total_votes = like_count + dislike_count;
+    double approval_rate = 0.0;
+    if (total_votes > 0) {
+        approval_rate = ((double)like_count / total_votes) * 100.0;
+    }
+    
+    return frame_appendf(response, "%s|%s|%d|%d|%d|%.1f\n",
+                         dataset_version_string(dataset, pledges->ids[index]), dataset_version_string(dataset, pledges->candidates[index]),
+                         like_count, dislike_count,
+                         total_votes, approval_rate);
+}
+
+// 공약 통계 일괄 조회
+// 요청 형식: "pledges:ID1,ID2,..." | "candidate:후보자ID" | "election:선거ID"
+// 응답 형식: 첫 줄 "COUNT=N", 이후 줄마다 "공약ID|후보자ID|좋아요|싫어요|총투표|지지율"
+void handle_get_statistics_batch_request(const Frame* request, Frame* response) {
+    const char* query = request->payload ? request->payload : "";
+    const char* scope_value = strchr(query, ':');
+    
+    response->message_type = MSG_GET_STATISTICS_BATCH;
+    
+    if (!scope_value || scope_value[1] == '\0') {
+        const char* message = "요청 형식이 올바르지 않습니다 (pledges:/candidate:/election:)";
+        response->message_type = MSG_ERROR;
+        response->status_code = STATUS_BAD_REQUEST;
+        frame_set_payload(response, message, strlen(message));
+        return;
+    }
+    
+    size_t scope_len = (size_t)(scope_value - query);
+    scope_value++;
+    
+    int is_pledges = (scope_len == 7 && strncmp(query, "pledges", 7) == 0);
+    int is_candidate = (scope_len == 9 && strncmp(query, "candidate", 9) == 0);
+    int is_election = (scope_len == 8 && strncmp(query, "election", 8) == 0);
+    
+    if (!is_pledges && !is_candidate && !is_election) {
+        const char* message = "지원하지 않는 조회 범위입니다";
+        response->message_type = MSG_ERROR;
+        response->status_code = STATUS_BAD_REQUEST;
+        frame_set_payload(response, message, strlen(message));
+        return;
+    }
+    
+    // 결과 줄을 먼저 만들고 마지막에 COUNT 줄을 앞에 붙임
+    Frame body;
+    frame_init(&body);
+    int count = 0;
+    int ok = 1;
+    
+    // 카운터는 원자적으로 읽으므로 잠금 없이 현재 데이터 버전만 붙잡고 읽음
+    int token;
+    DatasetVersion* dataset = acquire_dataset(&token);
+    
+    if (is_pledges) {
+        // 쉼표로 구분된 공약 ID를 하나씩 조회
+        const char* cursor = scope_value;
+        while (*cursor && ok) {
+            const char* comma = strchr(cursor, ',');
+            size_t len = comma ? (size_t)(comma - cursor) : strlen(cursor);
+            
+            if (len > 0 && len < MAX_STRING_LEN) {
+                char pledge_id[MAX_STRING_LEN];
+                memcpy(pledge_id, cursor, len);
+                pledge_id[len] = '\0';
+                
+                int index = dataset_version_find_pledge(dataset, pledge_id);
+                if (index >= 0) {
+                    ok = append_pledge_statistics_line(&body, dataset, index);
+                    count++;
+                }
+            }
+            
+            if (!comma) break;
+            cursor = comma + 1;
+        }
+    } else {
+        // 조회 ID 핸들 -> 선거/후보자 위치 -> 인접 목록 (공약 표를 훑지 않고 결과 수만큼만 방문)
+        StringHandle scope_handle = string_intern_find(&dataset->strings, scope_value);
+        const DatasetLinks* links = &dataset->links;
+        const int32_t* candidates = NULL;
+        int candidate_count = 0;
+        int32_t single_candidate;
+        
+        if (is_candidate) {
+            single_candidate = dataset_links_find_candidate(links, scope_handle);
+            if (single_candidate >= 0) {
+                candidates = &single_candidate;
+                candidate_count = 1;
+            }
+        } else {
+            int election = dataset_links_find_election(links, scope_handle);
+            candidate_count = dataset_links_candidates(links, election, &candidates);
+        }
+        
+        for (int c = 0; c < candidate_count && ok; c++) {
+            const int32_t* pledges = NULL;
+            int pledge_count = dataset_links_pledges(links, candidates[c], &pledges);
+            for (int p = 0; p < pledge_count && ok; p++) {
+                ok = append_pledge_statistics_line(&body, dataset, pledges[p]);
+                count++;
+            }
+        }
+    }
+    
+    release_dataset(token);
+    
+    if (!ok || !frame_appendf(response, "COUNT=%d\n", count) ||
+        !frame_append_payload(response, body.payload ? body.payload : "", body.payload_length)) {
+        const char* message = "통계 응답 생성 실패";
+        response->message_type = MSG_ERROR;
+        response->status_code = STATUS_INTERNAL_ERROR;
+        frame_set_payload(response, message, strlen(message));
+    } else {
+        response->status_code = STATUS_SUCCESS;
+    }
+    
+    frame_free(&body);
+}
+
+// 순위표 보드 찾기 (없으면 -1)
+static int find_leaderboard_board(const DatasetVersion* dataset, LeaderboardKind kind, const char* value) {
+    if (kind == LEADERBOARD_GLOBAL) return 0;
+    
+    StringHandle handle = string_intern_find(&dataset->strings, value);
+    if (handle == STRING_HANDLE_NONE) return -1;
+    
+    if (kind == LEADERBOARD_ELECTION) {
+        return dataset_links_find_election(&dataset->links, handle);
+    } else {
+        for (int i = 0; i < dataset->pledges.category_count; i++) {
+            if (dataset->pledges.categories[i] == handle) return i;
+        }
+    }
+    return -1;
+}
+
+// 공약 지지율 순위 조회 (서버가 평가마다 갱신하는 힙에서 상위 K개를 바로 꺼냄)
+// 요청 형식: "K|global" | "K|election:선거ID" | "K|category:분야" (K는 1~LEADERBOARD_MAX_LIMIT)
+// 응답 형식: 첫 줄 "COUNT=N", 이후 순위 순서로 "공약ID|후보자ID|분야|좋아요|싫어요|총투표|지지율|제목"
+void handle_get_leaderboard_request(const Frame* request, Frame* response) {
+    const char* query = request->payload ? request->payload : "";
+    const char* scope = strchr(query, '|');
+    int limit = atoi(query);
+    
+    response->message_type = MSG_GET_LEADERBOARD;
+    
+    LeaderboardKind kind = LEADERBOARD_KIND_COUNT;
+    const char* value = "";
+    if (scope) {
+        scope++;
+        if (strcmp(scope, "global") == 0) {
+            kind = LEADERBOARD_GLOBAL;
+        } else if (strncmp(scope, "election:", 9) == 0 && scope[9] != '\0') {
+            kind = LEADERBOARD_ELECTION;
+            value = scope + 9;
+        } else if (strncmp(scope, "category:", 9) == 0 && scope[9] != '\0') {
+            kind = LEADERBOARD_CATEGORY;
+            value = scope + 9;
+        }
+    }
+    
+    if (kind == LEADERBOARD_KIND_COUNT || limit <= 0 || limit > LEADERBOARD_MAX_LIMIT) {
+        const char* message = "요청 형식이 올바르지 않습니다 (K|global, K|election:ID, K|category:분야)";
+        response->message_type = MSG_ERROR;
+        response->status_code = STATUS_BAD_REQUEST;
+        frame_set_payload(response, message, strlen(message));
+        return;
+    }
+    
+    LeaderboardEntry entries[LEADERBOARD_MAX_LIMIT];
+    int count = 0;
+    int ok = 1;
+    
+    // 순위표는 자체 잠금으로 보호되고, 공약 위치 -> 문자열 변환은 같은 데이터 버전에서 처리
+    int token;
+    DatasetVersion* dataset = acquire_dataset(&token);
+    
+    int board_index = find_leaderboard_board(dataset, kind, value);
+    if (board_index >= 0) {
+        count = leaderboard_top(&dataset->leaderboard, kind, board_index, limit, entries);
+    }
+    
+    ok = frame_appendf(response, "COUNT=%d\n", count);
+    const PledgeTable* pledges = &dataset->pledges;
+    for (int i = 0; i < count && ok; i++) {
+        int index = entries[i].pledge;
+        int total_votes = entries[i].likes + entries[i].dislikes;
+        double approval_rate = ((double)entries[i].likes / total_votes) * 100.0;
+        
+        ok = frame_appendf(response, "%s|%s|%s|%d|%d|%d|%.1f|%s\n",
+                           dataset_version_string(dataset, pledges->ids[index]), dataset_version_string(dataset, pledges->candidates[index]),
+                           dataset_version_string(dataset, pledge_table_category(pledges, index)),
+                           entries[i].likes, entries[i].dislikes, total_votes, approval_rate,
+                           dataset_version_string(dataset, pledges->cold[index].title));
+    }
+    
+    release_dataset(token);
+    
+    if (!ok) {
+        const char* message = "순위 응답 생성 실패";
+        response->message_type = MSG_ERROR;
+        response->status_code = STATUS_INTERNAL_ERROR;
+        frame_set_payload(response, message, strlen(message));
+    } else {
+        response->status_code = STATUS_SUCCESS;
+    }
+}
+
+// 순위 정렬용 합계 사본
+typedef struct {
+    int index;                              // candidates 또는 elections 배열 위치
+    int likes;
+    int dislikes;
+    int pledges;
+} StandingRow;
+
+// 지지율 높은 순 (같으면 총 표 수, 표가 없으면 맨 뒤)
+static int compare_standing_rows(const void* a, const void* b) {
+    const StandingRow* left = (const StandingRow*)a;
+    const StandingRow* right = (const StandingRow*)b;
+    long long left_total = (long long)left->likes + left->dislikes;
+    long long right_total = (long long)right->likes + right->dislikes;
+    
+    if (left_total > 0 && right_total > 0) {
+        long long lhs = (long long)left->likes * right_total;
+        long long rhs = (long long)right->likes * left_total;
+        if (lhs != rhs) return lhs > rhs ? -1 : 1;
+    }
+    if (left_total != right_total) return left_total > right_total ? -1 : 1;
+    return left->index - right->index;
+}
+
+static void read_standing_row(StandingRow* row, int index, const VoteRollup* votes) {
+    row->index = index;
+    row->likes = load_pledge_counter(&votes->likes);
+    row->dislikes = load_pledge_counter(&votes->dislikes);
+    row->pledges = load_pledge_counter(&votes->pledges);
+}
+
+// 후보자/선거 순위 조회 (평가마다 갱신되는 합계를 바로 읽으므로 공약을 훑지 않음)
+// 요청 형식: "election:선거ID" (해당 선거의 후보자별) | "elections" (선거별)
+// 응답 형식: 첫 줄 "COUNT=N", 이후 지지율 순서로 "ID|좋아요|싫어요|총투표|지지율|공약수"
+void handle_get_standings_request(const Frame* request, Frame* response) {
+    const char* query = request->payload ? request->payload : "";
+    int is_elections = strcmp(query, "elections") == 0;
+    int is_election = strncmp(query, "election:", 9) == 0 && query[9] != '\0';
+    
+    response->message_type = MSG_GET_STANDINGS;
+    
+    if (!is_elections && !is_election) {
+        const char* message = "요청 형식이 올바르지 않습니다 (election:선거ID, elections)";
+        response->message_type = MSG_ERROR;
+        response->status_code = STATUS_BAD_REQUEST;
+        frame_set_payload(response, message, strlen(message));
+        return;
+    }
+    
+    int token;
+    DatasetVersion* dataset = acquire_dataset(&token);
+    
+    int capacity = is_elections ? dataset->election_count : dataset->candidate_count;
+    StandingRow* rows = malloc(sizeof(StandingRow) * (size_t)(capacity > 0 ? capacity : 1));
+    int count = 0;
+    int ok = rows != NULL;
+    
+    if (ok && is_elections) {
+        for (int e = 0; e < dataset->election_count; e++) {
+            read_standing_row(&rows[count++], e, &dataset->elections[e].votes);
+        }
+    } else if (ok) {
+        StringHandle election_id = string_intern_find(&dataset->strings, query + 9);
+        int election = dataset_links_find_election(&dataset->links, election_id);
+        const int32_t* candidates = NULL;
+        int candidate_count = dataset_links_candidates(&dataset->links, election, &candidates);
+        for (int c = 0; c < candidate_count; c++) {
+            read_standing_row(&rows[count++], candidates[c], &dataset->candidates[candidates[c]].votes);
+        }
+    }
+    
+    if (ok) {
+        qsort(rows, (size_t)count, sizeof(StandingRow), compare_standing_rows);
+        ok = frame_appendf(response, "COUNT=%d\n", count);
+    }
+    for (int i = 0; i < count && ok; i++) {
+        StringHandle id = is_elections ? dataset->elections[rows[i].index].election_id
+                                       : dataset->candidates[rows[i].index].candidate_id;
+        int total_votes = rows[i].likes + rows[i].dislikes;
+        double approval_rate = total_votes > 0 ? ((double)rows[i].likes / total_votes) * 100.0 : 0.0;
+        
+        ok = frame_appendf(response, "%s|%d|%d|%d|%.1f|%d\n", dataset_version_string(dataset, id),
+                           rows[i].likes, rows[i].dislikes, total_votes, approval_rate, rows[i].pledges);
+    }
+    
+    release_dataset(token);
+    free(rows);
+    
+    if (!ok) {
+        const char* message = "순위 응답 생성 실패";
+        response->message_type = MSG_ERROR;
+        response->status_code = STATUS_INTERNAL_ERROR;
+        frame_set_payload(response, message, strlen(message));
+    } else {
+        response->status_code = STATUS_SUCCESS;
+    }
+}
+
+// 평가 하나를 공약이 속한 샤드에 넣음 (스냅샷/텍스트 파일 로드, 초기화 중이므로 잠금 불필요)
+static int load_evaluation_record(void* context, const char* user_id, const char* pledge_id,
+                                  int evaluation_type, time_t evaluation_time) {
+    EvaluationStore* store = &evaluation_shards_for((EvaluationShards*)context, pledge_id)->store;
+    return evaluation_store_upsert(store, user_id, pledge_id, evaluation_type, evaluation_time, NULL);
+}
+
+// WAL 재생 시 레코드 적용
+static int apply_wal_record(void* context, int op, const char* user_id, const char* pledge_id,
+                            int evaluation_type, time_t evaluation_time) {
+    EvaluationStore* store = &evaluation_shards_for((EvaluationShards*)context, pledge_id)->store;
+    
+    if (op == WAL_OP_UPSERT) {
+        if (!evaluation_store_upsert(store, user_id, pledge_id, evaluation_type, evaluation_time, NULL)) {
+            write_error_log("apply_wal_record", "평가 저장 메모리 부족");
+        }
+    } else if (op == WAL_OP_REMOVE) {
+        evaluation_store_remove(store, user_id, pledge_id, NULL);
+    }
+    return 1;
+}
+
+// 예전 텍스트 평가 파일 로드 (스냅샷이 아직 없을 때 한 번만 사용)
+static int load_legacy_evaluations(EvaluationShards* shards) {
+    FILE* file = fopen(EVALUATIONS_FILE, "r");
     if (!file) {
         write_log("WARNING", "평가 데이터 파일이 없습니다. 새로 생성됩니다.");
         return 0;
     }
     
     char line[512];
-    g_server_data.evaluation_count = 0;
-    
-    while (fgets(line, sizeof(line), file) && 
-           g_server_data.evaluation_count < 10000) {
+    while (fgets(line, sizeof(line), file)) {
         // 주석과 빈 줄 건너뛰기
         if (line[0] == '#' || line[0] == '\n') continue;
         
         // 데이터 파싱: 사용자ID|공약ID|평가타입|평가시간
+        EvaluationInfo eval;
         char* token = strtok(line, "|");
         if (!token) continue;
-        
-        EvaluationInfo* eval = &g_server_data.evaluations[g_server_data.evaluation_count];
-        strcpy(eval->user_id, token);
+        safe_strcpy(eval.user_id, token, sizeof(eval.user_id));
         
         token = strtok(NULL, "|");
         if (!token) continue;
-        strcpy(eval->pledge_id, token);
+        safe_strcpy(eval.pledge_id, token, sizeof(eval.pledge_id));
         
         token = strtok(NULL, "|");
         if (!token) continue;
-        eval->evaluation_type = atoi(token);
+        eval.evaluation_type = atoi(token);
         
         token = strtok(NULL, "|\n");
         if (!token) continue;
-        eval->evaluation_time = (time_t)atoll(token);
+        eval.evaluation_time = (time_t)atoll(token);
         
-        g_server_data.evaluation_count++;
+        // 같은 (사용자, 공약) 평가가 여러 줄이면 마지막 줄이 우선
+        load_evaluation_record(shards, eval.user_id, eval.pledge_id, eval.evaluation_type, eval.evaluation_time);
     }
     
     fclose(file);
-    printf("📊 평가 데이터 %d개를 파일에서 로드했습니다.\n", g_server_data.evaluation_count);
+    printf("📊 텍스트 평가 파일에서 %d개를 로드했습니다 (스냅샷으로 변환 예정).\n", evaluation_shards_count(shards));
+    return 1;
+}
+
+// 평가 데이터 로드: 최신 스냅샷 위에 이전 WAL(스냅샷 저장 중 종료된 경우)과 현재 WAL을 차례로 재생
+// 로그 재생은 멱등이므로 스냅샷에 이미 반영된 레코드를 다시 적용해도 결과는 같음
+int load_evaluations_from_file(int* needs_snapshot) {
+    EvaluationShards* shards = &g_server_data.evaluations;
+    evaluation_shards_clear(shards);
+    *needs_snapshot = 0;
+    
+    EvaluationSnapshotResult snapshot;
+    int loaded = evaluation_snapshot_load(EVALUATION_SNAPSHOT_FILE, load_evaluation_record, shards, &snapshot);
+    if (loaded < 0) {
+        printf("❌ 평가 스냅샷이 손상되었습니다: %s\n", EVALUATION_SNAPSHOT_FILE);
+        return -1;
+    }
+    if (loaded) {
+        __atomic_store_n(&g_snapshot_stats.last_records, snapshot.records, __ATOMIC_RELAXED);
+        __atomic_store_n(&g_snapshot_stats.last_bytes, snapshot.bytes, __ATOMIC_RELAXED);
+        __atomic_store_n(&g_snapshot_stats.last_time, snapshot.created_at, __ATOMIC_RELAXED);
+        printf("📦 평가 스냅샷 로드: %d개, %ld바이트 (%.1fms, %ld초 전 저장)\n",
+               snapshot.records, snapshot.bytes, snapshot.elapsed_ms, (long)(time(NULL) - snapshot.created_at));
+    } else if (load_legacy_evaluations(shards)) {
+        *needs_snapshot = 1;
+    }
     
-    // 로드된 평가 데이터를 기반으로 모든 공약의 통계 업데이트
-    printf("🔄 공약 통계 업데이트 중...\n");
-    for (int i = 0; i < g_server_data.pledge_count; i++) {
-        update_pledge_statistics(g_server_data.pledges[i].pledge_id);
+    // 마지막 스냅샷 이후의 변경 사항 재생
+    const char* logs[2] = { EVALUATION_WAL_ARCHIVE_FILE, EVALUATION_WAL_FILE };
+    for (int i = 0; i < 2; i++) {
+        EvaluationWalReplay wal_replay;
+        if (!evaluation_wal_replay(logs[i], apply_wal_record, shards, &wal_replay)) {
+            return -1;
+        }
+        if (wal_replay.records > 0 || wal_replay.torn) {
+            printf("📜 WAL 재생 (%s): 레코드 %d개%s\n", logs[i], wal_replay.records,
+                   wal_replay.torn ? " (잘린 마지막 레코드는 무시)" : "");
+            *needs_snapshot = 1;
+        }
     }
-    printf("✅ 공약 통계 업데이트 완료!\n");
     
-    // 업데이트된 통계를 파일에 저장
-    printf("💾 업데이트된 공약 통계를 파일에 저장 중...\n");
-    if (save_pledges_to_file(g_server_data.pledges, g_server_data.pledge_count)) {
-        printf("✅ 공약 통계 파일 저장 완료!\n");
-    } else {
-        printf("❌ 공약 통계 파일 저장 실패!\n");
+    // 로드된 평가 데이터를 기반으로 모든 공약의 통계를 한 번에 계산 (초기화 중이므로 잠금 불필요)
+    // 통계는 평가 데이터에서 항상 다시 계산하므로 pledges.txt는 다시 쓰지 않음
+    recount_pledge_statistics_locked(g_server_data.dataset);
+    recount_rollups_locked(g_server_data.dataset);
+    rebuild_leaderboard_locked(g_server_data.dataset);
+    
+    return evaluation_shards_count(shards);
+}
+
+// 엔드포인트별 옵션 값의 대상: "N"은 모든 엔드포인트, "pledge:N"처럼 앞에 이름을 붙이면 그 엔드포인트만
+// (*value를 숫자 부분으로 옮김, 이름이 잘못되면 0)
+static int parse_endpoint_option(const char** value, int* first, int* last) {
+    *first = 0;
+    *last = API_ENDPOINT_COUNT - 1;
+    
+    const char* colon = strchr(*value, ':');
+    if (colon) {
+        char name[32];
+        size_t length = (size_t)(colon - *value);
+        if (length >= sizeof(name)) return 0;
+        memcpy(name, *value, length);
+        name[length] = '\0';
+        
+        int endpoint = api_find_endpoint(name);
+        if (endpoint < 0) return 0;
+        *first = *last = endpoint;
+        *value = colon + 1;
+    }
+    return 1;
+}
+
+// --api-rate / --api-burst 값 적용
+static int apply_api_rate_option(const char* value, int is_burst) {
+    int first, last;
+    if (!parse_endpoint_option(&value, &first, &last)) return 0;
+    
+    double number = atof(value);
+    if (number < 0.0 || (is_burst && number < 1.0)) return 0;
+    
+    for (int i = first; i <= last; i++) {
+        TokenBucket limit;
+        api_get_rate_limit((APIEndpoint)i, &limit);
+        if (is_burst) {
+            api_set_rate_limit((APIEndpoint)i, limit.rate, number);
+        } else {
+            api_set_rate_limit((APIEndpoint)i, number, limit.burst);
+        }
     }
+    return 1;
+}
+
+// --api-cache-ttl 값 적용 (초, 0이면 매번 조건부 요청으로 확인)
+static int apply_api_cache_ttl_option(const char* value) {
+    int first, last;
+    if (!parse_endpoint_option(&value, &first, &last)) return 0;
     
-    return g_server_data.evaluation_count;
+    char* end;
+    long seconds = strtol(value, &end, 10);
+    if (end == value || *end != '\0' || seconds < 0) return 0;
+    
+    for (int i = first; i <= last; i++) {
+        api_cache_set_ttl((APIEndpoint)i, seconds);
+    }
+    return 1;
 }
 
 // 메인 함수
@@ -2249,16 +4104,109 @@ int main(int argc, char* argv[]) {
     
     int port = SERVER_PORT;
     
-    // 명령행 인수 처리
-    if (argc > 1) {
-        port = atoi(argv[1]);
-        if (port <= 0 || port > 65535) {
-            printf("잘못된 포트 번호: %s\n", argv[1]);
-            printf("사용법: %s [포트번호]\n", argv[0]);
-            return 1;
+    ServerMode mode = SERVER_MODE_THREAD;
+    int reactor_count = DEFAULT_REACTOR_COUNT;
+    int worker_threads = DEFAULT_WORKER_THREADS;
+    int refresh_threads = DEFAULT_REFRESH_WORKER_THREADS;
+    int verify_interval = DEFAULT_COUNTER_CHECK_INTERVAL;
+    int snapshot_interval = DEFAULT_SNAPSHOT_INTERVAL;
+    
+    // 명령행 인수 처리: [포트번호] [--mode=thread|epoll] [--reactors=N] [--workers=N] [--refresh-workers=N] [--verify-interval=초] [--wal-window-ms=N] [--wal-batch=N] [--snapshot-interval=초] [--api-concurrency=N] [--api-rate=[엔드포인트:]N] [--api-burst=[엔드포인트:]N] [--api-cache-ttl=[엔드포인트:]초] [--no-api-cache] [--api-base-url=URL]
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--mode=", 7) == 0) {
+            const char* value = argv[i] + 7;
+            if (strcmp(value, "thread") == 0) {
+                mode = SERVER_MODE_THREAD;
+            } else if (strcmp(value, "epoll") == 0) {
+                mode = SERVER_MODE_EPOLL;
+            } else {
+                printf("잘못된 서버 모드: %s\n", value);
+                printf("사용법: %s [포트번호] [--mode=thread|epoll] [--reactors=N] [--workers=N] [--refresh-workers=N] [--verify-interval=초] [--wal-window-ms=N] [--wal-batch=N] [--snapshot-interval=초] [--api-concurrency=N] [--api-rate=[엔드포인트:]N] [--api-burst=[엔드포인트:]N] [--api-cache-ttl=[엔드포인트:]초] [--no-api-cache] [--api-base-url=URL]\n", argv[0]);
+                return 1;
+            }
+        } else if (strncmp(argv[i], "--workers=", 10) == 0) {
+            worker_threads = atoi(argv[i] + 10);
+            if (worker_threads <= 0 || worker_threads > MAX_WORKER_THREADS) {
+                printf("잘못된 워커 수: %s (1~%d)\n", argv[i] + 10, MAX_WORKER_THREADS);
+                return 1;
+            }
+        } else if (strncmp(argv[i], "--refresh-workers=", 18) == 0) {
+            refresh_threads = atoi(argv[i] + 18);
+            if (refresh_threads <= 0 || refresh_threads > MAX_WORKER_THREADS) {
+                printf("잘못된 새로고침 워커 수: %s (1~%d)\n", argv[i] + 18, MAX_WORKER_THREADS);
+                return 1;
+            }
+        } else if (strncmp(argv[i], "--verify-interval=", 18) == 0) {
+            verify_interval = atoi(argv[i] + 18);
+            if (verify_interval < 0) {
+                printf("잘못된 카운터 검증 주기: %s (0이면 끔)\n", argv[i] + 18);
+                return 1;
+            }
+        } else if (strncmp(argv[i], "--wal-window-ms=", 16) == 0) {
+            g_wal_window_ms = atoi(argv[i] + 16);
+            if (g_wal_window_ms <= 0) {
+                printf("잘못된 WAL 커밋 대기 시간: %s (1 이상, ms)\n", argv[i] + 16);
+                return 1;
+            }
+        } else if (strncmp(argv[i], "--wal-batch=", 12) == 0) {
+            g_wal_batch_records = atoi(argv[i] + 12);
+            if (g_wal_batch_records <= 0) {
+                printf("잘못된 WAL 배치 크기: %s (1 이상)\n", argv[i] + 12);
+                return 1;
+            }
+        } else if (strncmp(argv[i], "--snapshot-interval=", 20) == 0) {
+            snapshot_interval = atoi(argv[i] + 20);
+            if (snapshot_interval < 0) {
+                printf("잘못된 스냅샷 주기: %s (0이면 종료 시에만 저장)\n", argv[i] + 20);
+                return 1;
+            }
+        } else if (strncmp(argv[i], "--api-concurrency=", 18) == 0) {
+            g_api_fetch_options.max_in_flight = atoi(argv[i] + 18);
+            if (g_api_fetch_options.max_in_flight <= 0 || g_api_fetch_options.max_in_flight > API_FETCH_MAX_IN_FLIGHT) {
+                printf("잘못된 API 동시 요청 수: %s (1~%d)\n", argv[i] + 18, API_FETCH_MAX_IN_FLIGHT);
+                return 1;
+            }
+        } else if (strncmp(argv[i], "--api-rate=", 11) == 0) {
+            if (!apply_api_rate_option(argv[i] + 11, 0)) {
+                printf("잘못된 API 초당 요청 수: %s ([election|candidate|pledge:]N, 0이면 제한 없음)\n", argv[i] + 11);
+                return 1;
+            }
+        } else if (strncmp(argv[i], "--api-burst=", 12) == 0) {
+            if (!apply_api_rate_option(argv[i] + 12, 1)) {
+                printf("잘못된 API 버스트: %s ([election|candidate|pledge:]N, 1 이상)\n", argv[i] + 12);
+                return 1;
+            }
+        } else if (strncmp(argv[i], "--api-cache-ttl=", 16) == 0) {
+            if (!apply_api_cache_ttl_option(argv[i] + 16)) {
+                printf("잘못된 API 캐시 TTL: %s ([election|candidate|pledge:]초, 0이면 매번 재검증)\n", argv[i] + 16);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--no-api-cache") == 0) {
+            api_cache_set_enabled(0);
+        } else if (strncmp(argv[i], "--api-base-url=", 15) == 0) {
+            api_set_base_url(argv[i] + 15);
+        } else if (strncmp(argv[i], "--reactors=", 11) == 0) {
+            reactor_count = atoi(argv[i] + 11);
+            if (reactor_count <= 0 || reactor_count > MAX_REACTOR_COUNT) {
+                printf("잘못된 리액터 수: %s (1~%d)\n", argv[i] + 11, MAX_REACTOR_COUNT);
+                return 1;
+            }
+        } else {
+            port = atoi(argv[i]);
+            if (port <= 0 || port > 65535) {
+                printf("잘못된 포트 번호: %s\n", argv[i]);
+                printf("사용법: %s [포트번호] [--mode=thread|epoll] [--reactors=N] [--workers=N] [--refresh-workers=N] [--verify-interval=초] [--wal-window-ms=N] [--wal-batch=N] [--snapshot-interval=초] [--api-concurrency=N] [--api-rate=[엔드포인트:]N] [--api-burst=[엔드포인트:]N] [--api-cache-ttl=[엔드포인트:]초] [--no-api-cache] [--api-base-url=URL]\n", argv[0]);
+                return 1;
+            }
         }
     }
     
+    if (mode == SERVER_MODE_EPOLL && !event_loop_supported()) {
+        printf("⚠️  이 플랫폼은 epoll을 지원하지 않아 스레드 모드로 실행합니다.\n");
+        mode = SERVER_MODE_THREAD;
+    }
+    set_server_mode(mode, reactor_count);
+    
     // 신호 처리 설정
     signal(SIGINT, signal_handler);
 #ifndef _WIN32
@@ -2267,6 +4215,11 @@ int main(int argc, char* argv[]) {
     
     print_header("대선 후보 공약 열람 및 평가 시스템 서버");
     printf("포트: %d\n", port);
+    if (mode == SERVER_MODE_EPOLL) {
+        printf("모드: epoll 이벤트 루프 (리액터 %d개)\n", reactor_count);
+    } else {
+        printf("모드: 연결당 스레드\n");
+    }
     printf("종료하려면 Ctrl+C를 누르세요.\n");
     print_separator();
     
@@ -2289,13 +4242,38 @@ int main(int argc, char* argv[]) {
     printf("💡 데이터 수집은 클라이언트에서 '데이터 새로고침'을 선택하세요.\n");
     print_separator();
     
+    // 워커 풀 시작
+    if (!init_worker_pools(worker_threads, refresh_threads)) {
+        printf("워커 풀 생성 실패\n");
+        cleanup_server();
+        return 1;
+    }
+    
+    // 평가 카운터 검증 스레드 시작
+    if (!start_counter_checker(verify_interval)) {
+        printf("⚠️  카운터 검증 스레드 생성 실패 (검증 없이 계속 실행합니다)\n");
+    }
+    
+    // 평가 스냅샷 스레드 시작
+    if (!start_snapshotter(snapshot_interval)) {
+        printf("⚠️  스냅샷 스레드 생성 실패 (종료 시에만 저장합니다)\n");
+    }
+    
     // 서버 시작
     if (!start_server(port)) {
         printf("서버 시작 실패\n");
+        stop_snapshotter();
+        stop_counter_checker();
+        shutdown_worker_pools();
         cleanup_server();
         return 1;
     }
     
+    // 남은 작업 처리 후 워커 풀 종료
+    stop_snapshotter();
+    stop_counter_checker();
+    shutdown_worker_pools();
+    
     // 서버 정리
     cleanup_server();
     
@@ -0,0 +1,92 @@
+#include "rw_lock.h"
+#include <string.h>
+
+#ifdef _WIN32
+
+int rw_lock_init(RwLock* lock) {
+    InitializeSRWLock(&lock->lock);
+    return 1;
+}
+
+void rw_lock_destroy(RwLock* lock) {
+    (void)lock;
+}
+
+void rw_lock_read_lock(RwLock* lock) {
+    AcquireSRWLockShared(&lock->lock);
+}
+
+void rw_lock_read_unlock(RwLock* lock) {
+    ReleaseSRWLockShared(&lock->lock);
+}
+
+void rw_lock_write_lock(RwLock* lock) {
+    AcquireSRWLockExclusive(&lock->lock);
+}
+
+void rw_lock_write_unlock(RwLock* lock) {
+    ReleaseSRWLockExclusive(&lock->lock);
+}
+
+#else
+
+int rw_lock_init(RwLock* lock) {
+    memset(lock, 0, sizeof(RwLock));
+    if (pthread_mutex_init(&lock->mutex, NULL) != 0) return 0;
+    if (pthread_cond_init(&lock->readers_done, NULL) != 0) {
+        pthread_mutex_destroy(&lock->mutex);
+        return 0;
+    }
+    if (pthread_cond_init(&lock->writer_done, NULL) != 0) {
+        pthread_cond_destroy(&lock->readers_done);
+        pthread_mutex_destroy(&lock->mutex);
+        return 0;
+    }
+    return 1;
+}
+
+void rw_lock_destroy(RwLock* lock) {
+    pthread_cond_destroy(&lock->writer_done);
+    pthread_cond_destroy(&lock->readers_done);
+    pthread_mutex_destroy(&lock->mutex);
+}
+
+void rw_lock_read_lock(RwLock* lock) {
+    pthread_mutex_lock(&lock->mutex);
+    while (lock->writer || lock->writers_waiting > 0) {
+        pthread_cond_wait(&lock->writer_done, &lock->mutex);
+    }
+    lock->readers++;
+    pthread_mutex_unlock(&lock->mutex);
+}
+
+void rw_lock_read_unlock(RwLock* lock) {
+    pthread_mutex_lock(&lock->mutex);
+    lock->readers--;
+    if (lock->readers == 0 && lock->writers_waiting > 0) {
+        pthread_cond_signal(&lock->readers_done);
+    }
+    pthread_mutex_unlock(&lock->mutex);
+}
+
+void rw_lock_write_lock(RwLock* lock) {
+    pthread_mutex_lock(&lock->mutex);
+    lock->writers_waiting++;
+    while (lock->writer || lock->readers > 0) {
+        pthread_cond_wait(&lock->readers_done, &lock->mutex);
+    }
+    lock->writers_waiting--;
+    lock->writer = 1;
+    pthread_mutex_unlock(&lock->mutex);
+}
+
+void rw_lock_write_unlock(RwLock* lock) {
+    pthread_mutex_lock(&lock->mutex);
+    lock->writer = 0;
+    // 다음 쓰기 대기자와 막혀 있던 읽기 스레드를 모두 깨움
+    pthread_cond_signal(&lock->readers_done);
+    pthread_cond_broadcast(&lock->writer_done);
+    pthread_mutex_unlock(&lock->mutex);
+}
+
+#endif
@@ -0,0 +1,146 @@
+#include "string_intern.h"
+#include "hash_index.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define STRING_INTERN_MIN_CAPACITY 256
+
+int string_intern_init(StringIntern* table) {
+    memset(table, 0, sizeof(StringIntern));
+
+    table->pages = calloc(STRING_INTERN_MAX_PAGES, sizeof(const char**));
+    table->entries = calloc(STRING_INTERN_MIN_CAPACITY, sizeof(StringInternEntry));
+    if (!table->pages || !table->entries) {
+        string_intern_free(table);
+        return 0;
+    }
+    table->capacity = STRING_INTERN_MIN_CAPACITY;
+    return 1;
+}
+
+void string_intern_free(StringIntern* table) {
+    for (size_t i = 0; i < table->chunk_count; i++) {
+        free(table->chunks[i]);
+    }
+    free(table->chunks);
+
+    if (table->pages) {
+        for (size_t i = 0; i < STRING_INTERN_MAX_PAGES && table->pages[i]; i++) {
+            free((void*)table->pages[i]);
+        }
+        free((void*)table->pages);
+    }
+    free(table->entries);
+    memset(table, 0, sizeof(StringIntern));
+}
+
+// 아레나에 문자열 복사 (청크가 모자라면 새 청크, 청크보다 긴 문자열은 전용 청크)
+static const char* arena_copy(StringIntern* table, const char* str, size_t length) {
+    size_t needed = length + 1;
+    int need_chunk = table->chunk_count == 0 || table->chunk_used + needed > STRING_INTERN_CHUNK_SIZE;
+
+    if (need_chunk) {
+        if (table->chunk_count == table->chunk_capacity) {
+            size_t capacity = table->chunk_capacity ? table->chunk_capacity * 2 : 16;
+            char** chunks = realloc(table->chunks, capacity * sizeof(char*));
+            if (!chunks) return NULL;
+            table->chunks = chunks;
+            table->chunk_capacity = capacity;
+        }
+        size_t size = needed > STRING_INTERN_CHUNK_SIZE ? needed : STRING_INTERN_CHUNK_SIZE;
+        char* chunk = malloc(size);
+        if (!chunk) return NULL;
+        table->chunks[table->chunk_count++] = chunk;
+        table->chunk_used = 0;
+    }
+
+    char* copy = table->chunks[table->chunk_count - 1] + table->chunk_used;
+    memcpy(copy, str, needed);
+    table->chunk_used += needed;
+    table->bytes += needed;
+    return copy;
+}
+
+static void place_entry(StringInternEntry* entries, size_t capacity, uint32_t hash, StringHandle handle) {
+    size_t mask = capacity - 1;
+    size_t pos = hash & mask;
+
+    while (entries[pos].handle != STRING_HANDLE_NONE) {
+        pos = (pos + 1) & mask;
+    }
+    entries[pos].hash = hash;
+    entries[pos].handle = handle;
+}
+
+// 적재율 50% 이하 유지
+static int grow_if_needed(StringIntern* table) {
+    if (((size_t)table->count + 1) * 2 <= table->capacity) return 1;
+
+    size_t capacity = table->capacity * 2;
+    StringInternEntry* entries = calloc(capacity, sizeof(StringInternEntry));
+    if (!entries) return 0;
+
+    for (size_t i = 0; i < table->capacity; i++) {
+        if (table->entries[i].handle != STRING_HANDLE_NONE) {
+            place_entry(entries, capacity, table->entries[i].hash, table->entries[i].handle);
+        }
+    }
+    free(table->entries);
+    table->entries = entries;
+    table->capacity = capacity;
+    return 1;
+}
+
+static StringHandle find_with_hash(const StringIntern* table, const char* str, uint32_t hash) {
+    size_t mask = table->capacity - 1;
+    size_t pos = hash & mask;
+
+    while (table->entries[pos].handle != STRING_HANDLE_NONE) {
+        if (table->entries[pos].hash == hash &&
+            strcmp(string_intern_get(table, table->entries[pos].handle), str) == 0) {
+            return table->entries[pos].handle;
+        }
+        pos = (pos + 1) & mask;
+    }
+    return STRING_HANDLE_NONE;
+}
+
+StringHandle string_intern_add(StringIntern* table, const char* str) {
+    uint32_t hash = hash_index_hash(str);
+    StringHandle handle = find_with_hash(table, str, hash);
+    if (handle != STRING_HANDLE_NONE) return handle;
+
+    handle = table->count + 1;
+    size_t page = handle >> STRING_INTERN_PAGE_SHIFT;
+    if (page >= STRING_INTERN_MAX_PAGES || !grow_if_needed(table)) return STRING_HANDLE_NONE;
+
+    if (!table->pages[page]) {
+        table->pages[page] = calloc(STRING_INTERN_PAGE_SIZE, sizeof(const char*));
+        if (!table->pages[page]) return STRING_HANDLE_NONE;
+    }
+
+    const char* copy = arena_copy(table, str, strlen(str));
+    if (!copy) return STRING_HANDLE_NONE;
+
+    table->pages[page][handle & (STRING_INTERN_PAGE_SIZE - 1)] = copy;
+    place_entry(table->entries, table->capacity, hash, handle);
+    table->count = handle;
+    return handle;
+}
+
+StringHandle string_intern_find(const StringIntern* table, const char* str) {
+    return find_with_hash(table, str, hash_index_hash(str));
+}
+
+const char* string_intern_get(const StringIntern* table, StringHandle handle) {
+    if (handle == STRING_HANDLE_NONE) return "";
+    return table->pages[handle >> STRING_INTERN_PAGE_SHIFT][handle & (STRING_INTERN_PAGE_SIZE - 1)];
+}
+
+size_t string_intern_memory(const StringIntern* table) {
+    size_t pages = ((size_t)table->count >> STRING_INTERN_PAGE_SHIFT) + 1;
+    return table->chunk_count * STRING_INTERN_CHUNK_SIZE +
+           STRING_INTERN_MAX_PAGES * sizeof(const char**) +
+           pages * STRING_INTERN_PAGE_SIZE * sizeof(const char*) +
+           table->capacity * sizeof(StringInternEntry);
+}
@@ -0,0 +1,317 @@
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "worker_pool.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef _WIN32
+    #include <sched.h>
+#endif
+
+// 단조 증가 시간 (밀리초)
+static unsigned long long monotonic_ms(void) {
+#ifdef _WIN32
+    return (unsigned long long)GetTickCount();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000ULL + (unsigned long long)(ts.tv_nsec / 1000000);
+#endif
+}
+
+// 다른 스레드에 실행 양보
+static void worker_yield(void) {
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+// 세마포어 초기화
+int worker_semaphore_init(WorkerSemaphore* sem, unsigned int initial) {
+#ifdef _WIN32
+    sem->handle = CreateSemaphore(NULL, (LONG)initial, 0x7fffffff, NULL);
+    return sem->handle != NULL;
+#else
+    return sem_init(&sem->sem, 0, initial) == 0;
+#endif
+}
+
+void worker_semaphore_post(WorkerSemaphore* sem) {
+#ifdef _WIN32
+    ReleaseSemaphore(sem->handle, 1, NULL);
+#else
+    sem_post(&sem->sem);
+#endif
+}
+
+void worker_semaphore_wait(WorkerSemaphore* sem) {
+#ifdef _WIN32
+    WaitForSingleObject(sem->handle, INFINITE);
+#else
+    // 시그널에 의해 깨어난 경우 다시 대기
+    while (sem_wait(&sem->sem) != 0) {
+    }
+#endif
+}
+
+void worker_semaphore_destroy(WorkerSemaphore* sem) {
+#ifdef _WIN32
+    CloseHandle(sem->handle);
+#else
+    sem_destroy(&sem->sem);
+#endif
+}
+
+// 큐 초기화 (capacity는 2의 거듭제곱으로 올림)
+static int queue_init(WorkerQueue* queue, size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) size <<= 1;
+
+    queue->cells = malloc(size * sizeof(WorkerQueueCell));
+    if (!queue->cells) return 0;
+
+    for (size_t i = 0; i < size; i++) {
+        queue->cells[i].sequence = i;
+        queue->cells[i].func = NULL;
+        queue->cells[i].arg = NULL;
+    }
+    queue->mask = size - 1;
+    queue->enqueue_pos = 0;
+    queue->dequeue_pos = 0;
+    return 1;
+}
+
+// 작업 추가 (가득 차면 0 반환)
+static int queue_push(WorkerQueue* queue, WorkerJobFunc func, void* arg) {
+    size_t pos = __atomic_load_n(&queue->enqueue_pos, __ATOMIC_RELAXED);
+
+    while (1) {
+        WorkerQueueCell* cell = &queue->cells[pos & queue->mask];
+        size_t seq = __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE);
+        long diff = (long)seq - (long)pos;
+
+        if (diff == 0) {
+            // 이 슬롯을 차지하기 위해 경쟁
+            if (__atomic_compare_exchange_n(&queue->enqueue_pos, &pos, pos + 1, 1,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                cell->func = func;
+                cell->arg = arg;
+                __atomic_store_n(&cell->sequence, pos + 1, __ATOMIC_RELEASE);
+                return 1;
+            }
+        } else if (diff < 0) {
+            return 0;  // 큐가 가득 참
+        } else {
+            pos = __atomic_load_n(&queue->enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+// 작업 꺼내기 (비어 있으면 0 반환)
+static int queue_pop(WorkerQueue* queue, WorkerJobFunc* func, void** arg) {
+    size_t pos = __atomic_load_n(&queue->dequeue_pos, __ATOMIC_RELAXED);
+
+    while (1) {
+        WorkerQueueCell* cell = &queue->cells[pos & queue->mask];
+        size_t seq = __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE);
+        long diff = (long)seq - (long)(pos + 1);
+
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&queue->dequeue_pos, &pos, pos + 1, 1,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                *func = cell->func;
+                *arg = cell->arg;
+                __atomic_store_n(&cell->sequence, pos + queue->mask + 1, __ATOMIC_RELEASE);
+                return 1;
+            }
+        } else if (diff < 0) {
+            return 0;  // 큐가 비어 있음
+        } else {
+            pos = __atomic_load_n(&queue->dequeue_pos, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+// 워커 스레드 본체
+static void worker_loop(WorkerPool* pool) {
+    while (1) {
+        worker_semaphore_wait(&pool->available);
+
+        // 토큰 하나는 작업 하나 (또는 종료 신호)
+        // 앞 슬롯을 차지한 생산자가 아직 작업을 기록하지 않았으면 뒤 슬롯의 토큰으로 깨어나도 꺼낼 수 없으므로,
+        // 토큰을 버리지 않고 그 작업이 보일 때까지 다시 시도 (버리면 뒤 작업이 다음 제출 전까지 멈춤)
+        // 종료 중이어도 queue_depth는 슬롯을 차지하기 전에 오르므로, 0일 때만 꺼낼 작업이 없는 종료 신호로 봄
+        WorkerJobFunc func;
+        void* arg;
+        int popped;
+        while (!(popped = queue_pop(&pool->queue, &func, &arg))) {
+            if (!pool->running && __atomic_load_n(&pool->queue_depth, __ATOMIC_ACQUIRE) == 0) break;
+            worker_yield();
+        }
+        if (!popped) break;
+
+        __atomic_sub_fetch(&pool->queue_depth, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&pool->busy_workers, 1, __ATOMIC_RELAXED);
+        unsigned long long start = monotonic_ms();
+
+        func(arg);
+
+        __atomic_add_fetch(&pool->busy_time_ms, monotonic_ms() - start, __ATOMIC_RELAXED);
+        __atomic_sub_fetch(&pool->busy_workers, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&pool->completed, 1, __ATOMIC_RELAXED);
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI worker_thread(LPVOID param) {
+    worker_loop((WorkerPool*)param);
+    return 0;
+}
+#else
+static void* worker_thread(void* param) {
+    worker_loop((WorkerPool*)param);
+    return NULL;
+}
+#endif
+
+// 워커 풀 생성
+int worker_pool_init(WorkerPool* pool, const char* name, int thread_count, size_t queue_capacity) {
+    if (!pool || thread_count <= 0) return 0;
+    if (thread_count > MAX_WORKER_THREADS) thread_count = MAX_WORKER_THREADS;
+
+    memset(pool, 0, sizeof(WorkerPool));
+    safe_strcpy(pool->name, name ? name : "worker", sizeof(pool->name));
+
+    if (!queue_init(&pool->queue, queue_capacity)) {
+        write_error_log("worker_pool_init", "작업 큐 할당 실패");
+        return 0;
+    }
+    if (!worker_semaphore_init(&pool->available, 0)) {
+        write_error_log("worker_pool_init", "세마포어 생성 실패");
+        free(pool->queue.cells);
+        return 0;
+    }
+
+#ifdef _WIN32
+    pool->threads = calloc((size_t)thread_count, sizeof(HANDLE));
+#else
+    pool->threads = calloc((size_t)thread_count, sizeof(pthread_t));
+#endif
+    if (!pool->threads) {
+        worker_semaphore_destroy(&pool->available);
+        free(pool->queue.cells);
+        return 0;
+    }
+
+    pool->running = 1;
+    pool->started_at_ms = monotonic_ms();
+
+    for (int i = 0; i < thread_count; i++) {
+#ifdef _WIN32
+        pool->threads[i] = CreateThread(NULL, 0, worker_thread, pool, 0, NULL);
+        if (pool->threads[i] == NULL) break;
+#else
+        if (pthread_create(&pool->threads[i], NULL, worker_thread, pool) != 0) break;
+#endif
+        pool->thread_count++;
+    }
+
+    if (pool->thread_count == 0) {
+        write_error_log("worker_pool_init", "워커 스레드 생성 실패");
+        worker_pool_shutdown(pool);
+        return 0;
+    }
+
+    printf("🧵 워커 풀 '%s' 시작 (스레드 %d개, 큐 %zu칸)\n",
+           pool->name, pool->thread_count, pool->queue.mask + 1);
+    return 1;
+}
+
+// 작업 제출 (큐가 가득 차면 0 반환 - 호출자가 거절 응답 처리)
+int worker_pool_submit(WorkerPool* pool, WorkerJobFunc func, void* arg) {
+    if (!pool || !pool->running || !func) return 0;
+
+    // 워커가 꺼내기 전에 깊이를 먼저 올려서 음수가 되지 않게 함
+    long depth = __atomic_add_fetch(&pool->queue_depth, 1, __ATOMIC_RELAXED);
+    if (!queue_push(&pool->queue, func, arg)) {
+        __atomic_sub_fetch(&pool->queue_depth, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&pool->rejected, 1, __ATOMIC_RELAXED);
+        return 0;
+    }
+
+    long max_depth = __atomic_load_n(&pool->max_queue_depth, __ATOMIC_RELAXED);
+    while (depth > max_depth &&
+           !__atomic_compare_exchange_n(&pool->max_queue_depth, &max_depth, depth, 1,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+
+    __atomic_add_fetch(&pool->submitted, 1, __ATOMIC_RELAXED);
+    worker_semaphore_post(&pool->available);
+    return 1;
+}
+
+// 워커 풀 종료 (큐에 남은 작업을 모두 처리한 뒤 종료)
+void worker_pool_shutdown(WorkerPool* pool) {
+    if (!pool || !pool->threads) return;
+
+    pool->running = 0;
+    for (int i = 0; i < pool->thread_count; i++) {
+        worker_semaphore_post(&pool->available);
+    }
+
+    for (int i = 0; i < pool->thread_count; i++) {
+#ifdef _WIN32
+        WaitForSingleObject(pool->threads[i], INFINITE);
+        CloseHandle(pool->threads[i]);
+#else
+        pthread_join(pool->threads[i], NULL);
+#endif
+    }
+
+    worker_semaphore_destroy(&pool->available);
+    free(pool->threads);
+    free(pool->queue.cells);
+    pool->threads = NULL;
+    pool->queue.cells = NULL;
+    pool->thread_count = 0;
+}
+
+// 워커 풀 상태 조회
+void worker_pool_get_stats(WorkerPool* pool, WorkerPoolStats* stats) {
+    memset(stats, 0, sizeof(WorkerPoolStats));
+    if (!pool) return;
+
+    safe_strcpy(stats->name, pool->name, sizeof(stats->name));
+    stats->thread_count = pool->thread_count;
+    stats->queue_capacity = pool->queue.mask + 1;
+    stats->queue_depth = __atomic_load_n(&pool->queue_depth, __ATOMIC_RELAXED);
+    stats->max_queue_depth = __atomic_load_n(&pool->max_queue_depth, __ATOMIC_RELAXED);
+    stats->busy_workers = __atomic_load_n(&pool->busy_workers, __ATOMIC_RELAXED);
+    stats->submitted = __atomic_load_n(&pool->submitted, __ATOMIC_RELAXED);
+    stats->completed = __atomic_load_n(&pool->completed, __ATOMIC_RELAXED);
+    stats->rejected = __atomic_load_n(&pool->rejected, __ATOMIC_RELAXED);
+
+    unsigned long long elapsed = monotonic_ms() - pool->started_at_ms;
+    unsigned long long busy = __atomic_load_n(&pool->busy_time_ms, __ATOMIC_RELAXED);
+    if (elapsed > 0 && pool->thread_count > 0) {
+        stats->utilization = (double)busy / ((double)elapsed * pool->thread_count);
+        if (stats->utilization > 1.0) stats->utilization = 1.0;
+    }
+}
+
+// 상태를 한 줄 문자열로 변환
+int worker_pool_format_stats(const WorkerPoolStats* stats, char* buffer, size_t buffer_size) {
+    return snprintf(buffer, buffer_size,
+        "%s: 스레드=%d 작업중=%ld 큐=%ld/%zu (최대 %ld) 처리=%llu/%llu 거절=%llu 가동률=%.1f%%",
+        stats->name, stats->thread_count, stats->busy_workers,
+        stats->queue_depth, stats->queue_capacity, stats->max_queue_depth,
+        stats->completed, stats->submitted, stats->rejected,
+        stats->utilization * 100.0);
+}